@@ -29,6 +29,7 @@ class SEElectroCardioGram;
 class SECompartmentManager;
 
 class SEEngineTracker;
+class SEEngineProfiler;
 class SEEngineConfiguration;
 
 #include <google/protobuf/message.h>
@@ -54,6 +55,7 @@ public:
   //--------------------------------------------------------------------------------------------------
   /// \brief
   /// Reset engine and set it to the state in the provided file.
+  /// The file may be in the ASCII or the binary format, the format is detected from the file header.
   /// You may provided a Simulation Time to be used if desired.
   /// It will be reflected in the GetSimulationTime method.
   /// Return value indicates engine was able to load provided state file.
@@ -77,11 +79,24 @@ public:
   /// \brief
   /// Save the current state of the engine.
   /// State will be written to a file if provided.
-  /// State object will be returned.
+  /// Files ending in .pbb are written in the binary format, all others in the ASCII format.
+  /// State object will be returned, or nullptr if the file could not be written.
   /// Engine will be in a cleared state if this method fails.
   //--------------------------------------------------------------------------------------------------
   virtual std::unique_ptr<google::protobuf::Message> SaveState(const std::string& filename = "") = 0;
 
+  //--------------------------------------------------------------------------------------------------
+  /// \brief
+  /// Set the provided engine to the current state of this engine.
+  /// If the provided engine already holds the same circuits, compartments and substances
+  /// (ex. it was loaded from the same state file), their values are copied straight into it,
+  /// otherwise this is the same as loading the result of SaveState into the provided engine.
+  /// Data requests of the provided engine are kept as is.
+  /// Return value indicates the provided engine was set to the state of this engine.
+  /// The provided engine will be in a cleared state if this method fails.
+  //--------------------------------------------------------------------------------------------------
+  virtual bool ForkInto(PhysiologyEngine& engine) = 0;
+
   //--------------------------------------------------------------------------------------------------
   /// \brief
   /// locates the pba patient file and reads in the values. 
@@ -117,6 +132,14 @@ public:
   /// and provide access to the data easily (ex. to easily write data to csv files)
   //--------------------------------------------------------------------------------------------------
   virtual SEEngineTracker* GetEngineTracker() = 0;
+
+  //--------------------------------------------------------------------------------------------------
+  /// \brief
+  /// Retrieve the SEEngineProfiler timing each part of the engine time step
+  /// Profiling is disabled by default, enable it to start recording wall time per system phase,
+  /// circuit solve, transport and tracker output
+  //--------------------------------------------------------------------------------------------------
+  virtual SEEngineProfiler* GetProfiler() = 0;
   
   //--------------------------------------------------------------------------------------------------
   /// \brief
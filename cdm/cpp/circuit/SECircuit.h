@@ -8,12 +8,42 @@
 #define CIRCUIT_TEMPLATE typename CircuitBindType, typename NodeType, typename CircuitNodeBindType, typename PathType, typename CircuitPathBindType
 #define CIRCUIT_TYPES CircuitBindType,NodeType,CircuitNodeBindType,PathType,CircuitPathBindType
 
+// Flat, index based view of a circuit's topology, built in SECircuit::StateChange
+// Node and path indices are positions in the circuit's GetNodes() and GetPaths() vectors
+// The circuit calculator walks these arrays instead of doing map lookups for every node and path
+struct CDM_DECL SECompiledCircuit
+{
+  // The (at most one) element on a path, as determined by the Next values when the state changed
+  enum class Element : unsigned char { None = 0, Switch, Resistance, Capacitance, Inductance, Valve, FluxSource, PotentialSource };
+
+  void Clear()
+  {
+    NumCalculatorNodes = 0;
+    NodeCalculatorIndex.clear();
+    PathSource.clear();
+    PathTarget.clear();
+    PathElement.clear();
+    PathPolarized.clear();
+    ConnectedPathOffset.clear();
+    ConnectedPaths.clear();
+  }
+
+  size_t                     NumCalculatorNodes = 0;// Number of nodes that are not reference nodes
+  std::vector<int>           NodeCalculatorIndex;// Row/Column of the node in the calculator matrix, -1 for reference nodes
+  std::vector<size_t>        PathSource;         // Node index of each path's source node
+  std::vector<size_t>        PathTarget;         // Node index of each path's target node
+  std::vector<Element>       PathElement;
+  std::vector<unsigned char> PathPolarized;      // 1 if the path has a polarized state
+  std::vector<size_t>        ConnectedPathOffset;// Paths connected to node n are ConnectedPaths[ConnectedPathOffset[n]] up to ConnectedPaths[ConnectedPathOffset[n+1]]
+  std::vector<size_t>        ConnectedPaths;
+};
+
 template<CIRCUIT_TEMPLATE>
 class SECircuit : public Loggable
 {
 public:
 
-  SECircuit(const std::string& name, Logger* logger);
+  SECircuit(const std::string& name, SECircuitEpoch& epoch, Logger* logger);
   virtual ~SECircuit();
 
   virtual void Clear(); //clear memory
@@ -61,10 +91,19 @@ public:
 
   virtual void StateChange();
   virtual void SetNextAndCurrentFromBaselines();
+
+  virtual const SECompiledCircuit& GetCompiledCircuit() const { return m_Compiled; }
+  // False if paths were added or removed, or a path now has a different element, since the last StateChange
+  virtual bool IsCompiledCircuitCurrent() const;
+  // Shared by all circuits of the same manager, incremented when this circuit's values change in bulk
+  virtual SECircuitEpoch& GetCircuitEpoch() const { return m_Epoch; }
   
 protected:
+  static SECompiledCircuit::Element GetNextElement(const PathType& path);
+
   std::string  m_Name;
   std::stringstream m_ss;
+  SECircuitEpoch& m_Epoch;
 
   std::vector<NodeType*>               m_ReferenceNodes;
   std::vector<NodeType*>               m_Nodes;
@@ -77,5 +116,6 @@ protected:
   std::vector<PathType*>            m_ValvePaths;
   std::vector<PathType*>            m_PolarizedElementPaths; 
   std::map<const NodeType*, size_t> m_CalculatorIndex;// A unique id (starting at 0) for all nodes except the reference node
+  SECompiledCircuit                 m_Compiled;
 };
 #include "circuit/SECircuit.inl"
\ No newline at end of file
@@ -7,7 +7,7 @@
 #define OPEN_RESISTANCE 1e100
 
 template<CIRCUIT_TEMPLATE>
-SECircuit<CIRCUIT_TYPES>::SECircuit(const std::string& name, Logger* logger) : Loggable(logger), m_Name(name)
+SECircuit<CIRCUIT_TYPES>::SECircuit(const std::string& name, SECircuitEpoch& epoch, Logger* logger) : Loggable(logger), m_Name(name), m_Epoch(epoch)
 {
 }
 
@@ -35,6 +35,7 @@ void SECircuit<CIRCUIT_TYPES>::Clear()
   m_CalculatorIndex.clear();
   m_ValvePaths.clear();
   m_PolarizedElementPaths.clear();
+  m_Compiled.Clear();
 }
 
 template<CIRCUIT_TEMPLATE>
@@ -120,6 +121,7 @@ void SECircuit<CIRCUIT_TYPES>::StateChange()
   m_ConnectedPathMap.clear();
   m_ValvePaths.clear();
   m_PolarizedElementPaths.clear();
+  m_Epoch.Increment();
 
   for (PathType* p : m_Paths)
   {
@@ -207,6 +209,82 @@ void SECircuit<CIRCUIT_TYPES>::StateChange()
     ///\error Fatal: There are too many assumed state options.  The Circuit solver can only handle up to 64 Diodes and Polar Elements in a single circuit (i.e. ~1.8e19 possible combinations).
     Fatal("There are too many assumed state options.  The Circuit solver can only handle up to 64 Diodes and Polar Elements in a single circuit (i.e. ~1.8e19 possible combinations).");
   }
+
+  // Compile an index based view of all this for the calculator
+  m_Compiled.Clear();
+  std::map<const NodeType*, size_t> nodeIndex;
+  m_Compiled.NodeCalculatorIndex.reserve(m_Nodes.size());
+  for (NodeType* n : m_Nodes)
+  {
+    nodeIndex[n] = m_Compiled.NodeCalculatorIndex.size();
+    auto itr = m_CalculatorIndex.find(n);
+    m_Compiled.NodeCalculatorIndex.push_back(itr == m_CalculatorIndex.end() ? -1 : (int)itr->second);
+  }
+  m_Compiled.NumCalculatorNodes = m_CalculatorIndex.size();
+  std::map<const PathType*, size_t> pathIndex;
+  for (PathType* p : m_Paths)
+  {
+    auto src = nodeIndex.find(&p->GetSourceNode());
+    auto tgt = nodeIndex.find(&p->GetTargetNode());
+    if (src == nodeIndex.end() || tgt == nodeIndex.end())
+    {
+      ///\error Fatal: Path is connected to a node that is not in the circuit.
+      m_ss << p->GetName() << " is connected to a node that is not in the circuit.";
+      Fatal(m_ss);
+    }
+    pathIndex[p] = m_Compiled.PathSource.size();
+    m_Compiled.PathSource.push_back(src == nodeIndex.end() ? 0 : src->second);
+    m_Compiled.PathTarget.push_back(tgt == nodeIndex.end() ? 0 : tgt->second);
+    m_Compiled.PathPolarized.push_back(p->HasNextPolarizedState() ? 1 : 0);
+    m_Compiled.PathElement.push_back(GetNextElement(*p));
+  }
+  m_Compiled.ConnectedPathOffset.push_back(0);
+  for (NodeType* n : m_Nodes)
+  {
+    auto itr = m_ConnectedPathMap.find(n);
+    if (itr != m_ConnectedPathMap.end())
+    {
+      for (PathType* p : *itr->second)
+        m_Compiled.ConnectedPaths.push_back(pathIndex[p]);
+    }
+    m_Compiled.ConnectedPathOffset.push_back(m_Compiled.ConnectedPaths.size());
+  }
+}
+
+template<CIRCUIT_TEMPLATE>
+SECompiledCircuit::Element SECircuit<CIRCUIT_TYPES>::GetNextElement(const PathType& p)
+{
+  // Same precedence the calculator has always used when looking at Next elements
+  if (p.NumberOfNextElements() < 1)
+    return SECompiledCircuit::Element::None;
+  if (p.HasNextSwitch())
+    return SECompiledCircuit::Element::Switch;
+  if (p.HasNextResistance())
+    return SECompiledCircuit::Element::Resistance;
+  if (p.HasNextCapacitance())
+    return SECompiledCircuit::Element::Capacitance;
+  if (p.HasNextInductance())
+    return SECompiledCircuit::Element::Inductance;
+  if (p.HasNextValve())
+    return SECompiledCircuit::Element::Valve;
+  if (p.HasNextFluxSource())
+    return SECompiledCircuit::Element::FluxSource;
+  if (p.HasNextPotentialSource())
+    return SECompiledCircuit::Element::PotentialSource;
+  return SECompiledCircuit::Element::None;
+}
+
+template<CIRCUIT_TEMPLATE>
+bool SECircuit<CIRCUIT_TYPES>::IsCompiledCircuitCurrent() const
+{
+  if (m_Compiled.PathElement.size() != m_Paths.size())
+    return false;
+  for (size_t pIdx = 0; pIdx < m_Paths.size(); pIdx++)
+  {
+    if (m_Compiled.PathElement[pIdx] != GetNextElement(*m_Paths[pIdx]))
+      return false;
+  }
+  return true;
 }
 
 template<CIRCUIT_TEMPLATE>
@@ -538,4 +616,5 @@ void SECircuit<CIRCUIT_TYPES>::SetNextAndCurrentFromBaselines()
       n->GetNextQuantity().Copy(n->GetQuantityBaseline());
     }
   }
+  m_Epoch.Increment();
 }
@@ -3,9 +3,13 @@
 
 #pragma once
 #include "Eigen/Core"
+#include "Eigen/SparseCore"
+#include "Eigen/SparseLU"
 #include "utils/TimingProfile.h"
 #include "circuit/SECircuit.h"
 #include "utils/SmartEnum.h"
+#include <list>
+#include <memory>
 
 #define CIRCUIT_CALCULATOR_TEMPLATE typename CircuitType, typename NodeType, typename PathType, typename CapacitanceUnit, typename FluxUnit, typename InductanceUnit, typename PotentialUnit, typename QuantityUnit, typename ResistanceUnit
 #define CIRCUIT_CALCULATOR_TYPES CircuitType,NodeType,PathType,CapacitanceUnit,FluxUnit,InductanceUnit,PotentialUnit,QuantityUnit,ResistanceUnit
@@ -16,6 +20,7 @@ struct CDM_DECL EigenCircuitSolver
   enum Type { Direct, PartialPivLu, FullPivLu, JacobiSvd, HouseholderQr, Ldlt, Llt, SparseLU, SparseQR, BiCGSTAB, ConjugateGradient };
   SMART_ENUM(EigenCircuitSolver, Type, 11);
   static char const* Value(size_t idx);
+  bool IsSparse() const { return value() >= SparseLU; }
 };
 
 template<CIRCUIT_CALCULATOR_TEMPLATE>
@@ -32,6 +37,12 @@ public:
   virtual void Process(CircuitType& circuit, double timeStep_s);
   virtual void PostProcess(CircuitType& circuit);
 
+  // Number of times the circuit was solved during the last Process call, 1 if no valves had to change
+  virtual size_t GetNumberOfValveIterations() const { return m_valveIterations; }
+  // Number of valve configurations (per circuit) the sparse solver keeps the matrix structure and analysis of
+  virtual void SetMaxCachedValveConfigurations(size_t n) { m_maxSparseConfigurations = n < 1 ? 1 : n; }
+  virtual size_t GetNumberOfCachedValveConfigurations() const { return m_sparseConfigurations.size(); }
+
 protected:
   /**/virtual void ParseIn();
   /**/virtual void Solve();
@@ -42,14 +53,18 @@ protected:
   // Valve Support
   virtual bool CheckAndModifyValves();
   virtual bool IsCurrentValveStateUnique();
+  virtual uint64_t GetCurrentValveState() const;
   // Eigen Support
-  virtual void PopulateAMatrix(NodeType& nKCL, PathType& p, double dMultiplier, bool hasPotentialSource = false);
+  virtual void PopulateAMatrix(size_t nodeIdx, size_t pathIdx, double dMultiplier, bool hasPotentialSource = false);
+  void AddToAMatrix(size_t row, size_t col, double value);
+  void BuildSparseAMatrix(size_t numVars);
 
   // These are all transient and cleared/set at the start of the process call
 
   std::stringstream    m_ss;
   //Ax=b
-  Eigen::MatrixXd m_AMatrix; //A
+  Eigen::MatrixXd m_AMatrix; //A, only assembled for the dense solvers
+  std::vector<Eigen::Triplet<double>> m_AMatrixTriplets; //A, as assembled for the sparse solvers
   Eigen::VectorXd m_xVector; //x
   Eigen::VectorXd m_bVector; //b
   
@@ -57,7 +72,28 @@ protected:
   CircuitType*                   m_circuit;
   EigenCircuitSolver             m_solver;
   std::set<uint64_t>             m_valveStates;
-  std::map<PathType*, size_t>    m_potentialSources;
+  size_t                         m_valveIterations;
+  std::vector<size_t>            m_potentialSources;    // Index of each path whose flux is solved for directly
+  std::vector<int>               m_potentialSourceIndex;// Row/Column of each path's flux in the matrix, -1 if not solved for directly
+
+  // These persist between process calls
+  // The non-zero pattern of A, and therefore the symbolic analysis (ordering) of the SparseLU solver,
+  // only changes when the circuit topology or a valve/switch state changes.
+  // Valves flip back and forth between a handful of configurations (i.e. heart valves over a cardiac cycle),
+  // so the structure and analysis of the most recently used configurations are kept around.
+  struct SparseConfiguration
+  {
+    const CircuitType*                           Circuit;
+    uint64_t                                     ValveState;
+    std::vector<Eigen::Triplet<double>>          PatternTriplets;// Triplets AMatrix was structured from
+    std::vector<size_t>                          Slots;          // Position of each of those triplets in AMatrix values
+    Eigen::SparseMatrix<double>                  AMatrix;
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> LU;
+    bool                                         Analyzed;
+  };
+  std::list<std::unique_ptr<SparseConfiguration>> m_sparseConfigurations;// Most recently used first
+  SparseConfiguration*                            m_sparseConfiguration; // Configuration of the current solve
+  size_t                                          m_maxSparseConfigurations;
 
   const CapacitanceUnit &m_CapacitanceUnit;
   const FluxUnit        &m_FluxUnit;
@@ -27,6 +27,9 @@ SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::SECircuitCalculator(const Capacit
 m_CapacitanceUnit(c), m_FluxUnit(f), m_InductanceUnit(i), m_PotentialUnit(p), m_QuantityUnit(q), m_ResistanceUnit(r)
 {
   m_solver.set(EigenCircuitSolver::SparseLU);
+  m_valveIterations = 0;
+  m_sparseConfiguration = nullptr;
+  m_maxSparseConfigurations = 8;
 
   //Make sure the base units are compatible
   if (GeneralMath::PercentTolerance(m_ResistanceUnit.GetBigness(), (m_PotentialUnit.GetBigness() / m_FluxUnit.GetBigness())) > 0.001 ||
@@ -58,6 +61,18 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Process(CircuitType& circuit
   m_circuit = &circuit;
   m_dT_s = timeStep_s;
   m_valveStates.clear();
+  m_valveIterations = 0;
+  // The element on a path may change between steps (ex. a resistance replaced with a switch),
+  // the compiled circuit has to follow or the path would be solved as the element it used to have
+  if (!circuit.IsCompiledCircuitCurrent())
+  {
+    if (circuit.GetCompiledCircuit().PathElement.size() != circuit.GetPaths().size())
+    {
+      ///\error Warning: Circuit was modified without a state change, it will be recompiled.
+      Warning("Circuit " + circuit.GetName() + " was modified without calling StateChange, calling it now.");
+    }
+    circuit.StateChange();
+  }
 
   //Reset all Polarized Elements to be shorted.
   for (PathType* p : circuit.GetPolarizedElementPaths())
@@ -72,14 +87,11 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Process(CircuitType& circuit
   //We'll solve circuits with switches using Assumed Valve (i.e. Diode) States model by thinking of them as switches
   //and checking the resulting Flow and Pressure difference.
   //We'll keep looping until we've either found a solution or determined that it cannot be solved in the current configuration.
-#ifdef VERBOSE  
-  int i = 0;
-#endif
+  //Valves keep their state from the last time-step, so we start from the last converged configuration,
+  //and the sparse structure/analysis of recently used configurations are cached, see BuildSparseAMatrix.
   do
   {
-#ifdef VERBOSE
-    i++;
-#endif
+    m_valveIterations++;
     //We solve for the unknown circuit values this time-step by using Modified Nodal Analysis and linear algebra.
     //All of the source (i.e. Pressure and Flow) values are known, as well as all element (i.e. Resistance, Compliance, Inertance, Switch on/off, Valve direction) values.
     //We'll solve for all of the circuit's node pressures and Pressure Source Flows simultaneously using an error minimization numerical solver.
@@ -90,9 +102,11 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Process(CircuitType& circuit
     CalculateFluxes();
   } while (!CheckAndModifyValves());
 #ifdef VERBOSE
-  std::cout << "Number of Valve Loops = " << i << std::endl;
+  std::cout << "Number of Valve Loops = " << m_valveIterations << std::endl;
 #endif
   CalculateQuantities();
+  //Let anything caching values based on this circuit know they changed
+  circuit.GetCircuitEpoch().Increment();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -143,19 +157,25 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
     }
   }
 
-  size_t idx = 0;
-  size_t numNodes = m_circuit->GetNodes().size() - m_circuit->GetReferenceNodes().size();
+  const SECompiledCircuit& cc = m_circuit->GetCompiledCircuit();
+  const std::vector<NodeType*>& nodes = m_circuit->GetNodes();
+  const std::vector<PathType*>& paths = m_circuit->GetPaths();
+
+  size_t numNodes = cc.NumCalculatorNodes;
   m_potentialSources.clear();
-  for (PathType* p : m_circuit->GetPaths())
+  m_potentialSourceIndex.assign(paths.size(), -1);
+  for (size_t pIdx = 0; pIdx < paths.size(); pIdx++)
   {
     //Set aside the pressure sources, since the Flow through them will be directly solved by adding them to the bottom of the matrix.
     //We have to do this outside of the KCL loop below because we only want to account for each one once.
-    if (p->HasNextPotentialSource() ||
-      (p->NumberOfNextElements() < 1) ||
-      (p->HasNextValve() && p->GetNextValve() == cdm::eGate::Closed) ||
-      (p->HasNextSwitch() && p->GetNextSwitch() == cdm::eGate::Closed))
+    SECompiledCircuit::Element e = cc.PathElement[pIdx];
+    if (e == SECompiledCircuit::Element::PotentialSource ||
+      e == SECompiledCircuit::Element::None ||
+      (e == SECompiledCircuit::Element::Valve && paths[pIdx]->GetNextValve() == cdm::eGate::Closed) ||
+      (e == SECompiledCircuit::Element::Switch && paths[pIdx]->GetNextSwitch() == cdm::eGate::Closed))
     {
-      m_potentialSources[p] = numNodes + idx++;
+      m_potentialSourceIndex[pIdx] = int(numNodes + m_potentialSources.size());
+      m_potentialSources.push_back(pIdx);
     }
   }
 
@@ -164,7 +184,11 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
   //Set the size of the matrix and initialize all elements to zero - we'll populate it later.
   //subtract the known reference - we don't need to solve for that pressure
   //(and it has to be known or we'll have too many unknowns).  
-  m_AMatrix = Eigen::MatrixXd::Zero(numVars, numVars);
+  //The sparse solvers never need the dense matrix, so just collect the non-zero entries for them.
+  if (m_solver.IsSparse())
+    m_AMatrixTriplets.clear();
+  else
+    m_AMatrix = Eigen::MatrixXd::Zero(numVars, numVars);
   //Set the right side b vector
   //All zeros - we'll modify the values later
   m_bVector = Eigen::VectorXd::Zero(numVars);
@@ -176,45 +200,52 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
   //Variables used in the loop
   double dStartingCompliance = 0.0;
   double dStartingInertance = 0.0;
-  for (NodeType* n : m_circuit->GetNodes())
+  for (size_t nIdx = 0; nIdx < nodes.size(); nIdx++)
   {
     //Sum of the flows at each node is 0
     //Skip known reference node (see comment above)
-    if (m_circuit->IsReferenceNode(*n))
+    int row = cc.NodeCalculatorIndex[nIdx];
+    if (row < 0)
       continue;
+    NodeType* n = nodes[nIdx];
 
-    for (PathType* p : *m_circuit->GetConnectedPaths(*n))
+    for (size_t c = cc.ConnectedPathOffset[nIdx]; c < cc.ConnectedPathOffset[nIdx + 1]; c++)
     {
-      NodeType* nSrc = &p->GetSourceNode();
-      NodeType* nTgt = &p->GetTargetNode();
+      size_t pIdx = cc.ConnectedPaths[c];
+      PathType* p = paths[pIdx];
+      NodeType* nSrc = nodes[cc.PathSource[pIdx]];
+      NodeType* nTgt = nodes[cc.PathTarget[pIdx]];
 
-      if (p->HasNextPolarizedState() && p->GetNextPolarizedState() == cdm::eGate::Open)
+      if (cc.PathPolarized[pIdx] && p->GetNextPolarizedState() == cdm::eGate::Open)
       { //Polarized elements that are open are done exactly the same as a open switch.
         //We'll check to see if the resulting pressure difference is valid later.
         //Model as an open switch
         double dMultiplier = 1.0 / OPEN_RESISTANCE;
-        PopulateAMatrix(*n, *p, dMultiplier);
+        PopulateAMatrix(nIdx, pIdx, dMultiplier);
         //Don't allow to function normally - i.e. continue to the next path
         continue;
       }
 
       //Each Path has only one Element (or none at all) and each type is handled differently.
       //The variables in the x vector are the unknown Node Pressures and Flows for Pressure Sources. 
-      if (p->HasNextSwitch())
+      switch (cc.PathElement[pIdx])
+      {
+      case SECompiledCircuit::Element::Switch:
       {
         if (p->GetNextSwitch() == cdm::eGate::Open)
         {
           //Model as a resistor with a ridiculously high resistance (basically an open circuit)
           double dMultiplier = 1.0 / OPEN_RESISTANCE;
-          PopulateAMatrix(*n, *p, dMultiplier);
+          PopulateAMatrix(nIdx, pIdx, dMultiplier);
         }
         else
         {
           //Model as a zero pressure source
-          PopulateAMatrix(*n, *p, 1, true);
+          PopulateAMatrix(nIdx, pIdx, 1, true);
         }
+        break;
       }
-      else if (p->HasNextResistance())
+      case SECompiledCircuit::Element::Resistance:
       {
         double r = p->GetNextResistance().GetValue(m_ResistanceUnit);
         if (r < 0.0)
@@ -223,9 +254,10 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
           Fatal("Resistance cannot be negative.", p->GetName());
         }
         double dMultiplier = 1.0 / r;
-        PopulateAMatrix(*n, *p, dMultiplier);
+        PopulateAMatrix(nIdx, pIdx, dMultiplier);
+        break;
       }
-      else if (p->HasNextCapacitance())
+      case SECompiledCircuit::Element::Capacitance:
       {
         //Capacitors use initial voltage
         if (!nSrc->HasPotential())
@@ -261,7 +293,7 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
 
         //Add left side of the equation
         double dMultiplier = p->GetNextCapacitance().GetValue(m_CapacitanceUnit) / m_dT_s;
-        PopulateAMatrix(*n, *p, dMultiplier);
+        PopulateAMatrix(nIdx, pIdx, dMultiplier);
 
         //Add the known initial time values to the right side of the equation
         //C(0)/dt*(dV(0))
@@ -273,9 +305,10 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
         else if (n == nTgt)
           dLastPressureDiff = nTgt->GetPotential().GetValue(m_PotentialUnit) - nSrc->GetPotential().GetValue(m_PotentialUnit);
 
-        m_bVector(m_circuit->GetCalculatorIndex(*n)) += (dMultiplier*dLastPressureDiff);
+        m_bVector(row) += (dMultiplier*dLastPressureDiff);
+        break;
       }
-      else if (p->HasNextInductance())
+      case SECompiledCircuit::Element::Inductance:
       {
         //Inductors use initial current
         if (!p->HasFlux())
@@ -309,7 +342,7 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
         }
 
         double dMultiplier = m_dT_s / (2 * pInductance);
-        PopulateAMatrix(*n, *p, dMultiplier);
+        PopulateAMatrix(nIdx, pIdx, dMultiplier);
 
         double dLastFlow = 0.0;
         double dLastPressureDiff = 0.0;
@@ -323,9 +356,10 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
           dLastFlow = p->GetFlux().GetValue(m_FluxUnit);
           dLastPressureDiff = n->GetPotential().GetValue(m_PotentialUnit) - nSrc->GetPotential().GetValue(m_PotentialUnit);
         }
-        m_bVector(m_circuit->GetCalculatorIndex(*n)) += dLastFlow - (dMultiplier * dLastPressureDiff);
+        m_bVector(row) += dLastFlow - (dMultiplier * dLastPressureDiff);
+        break;
       }
-      else if (p->HasNextValve())
+      case SECompiledCircuit::Element::Valve:
       {
         //Valves are done exactly the same as switches.
         //We'll check to see if the resulting flow and pressure difference is valid later.
@@ -333,31 +367,35 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
         {
           //Model as a resistor with a ridiculously high resistance (basically an open circuit)
           double dMultiplier = 1.0 / OPEN_RESISTANCE;
-          PopulateAMatrix(*n, *p, dMultiplier);
+          PopulateAMatrix(nIdx, pIdx, dMultiplier);
         }
         else
         {
           //Model as a zero pressure source
-          PopulateAMatrix(*n, *p, 1, true);
+          PopulateAMatrix(nIdx, pIdx, 1, true);
         }
+        break;
       }
-      else if (p->HasNextFluxSource())
+      case SECompiledCircuit::Element::FluxSource:
       {
         //Currents out of the node are assumed positive and the sign is switched when moving from the left side of the equation to the right.
         //Therefore, out of the Node we're current analyzing (i.e. Source) reverses the sign when it goes into the right side vector.
         double sign = (n == nSrc) ? -1 : 1;
         double dFlow = p->GetNextFluxSource().GetValue(m_FluxUnit);
-        m_bVector(m_circuit->GetCalculatorIndex(*n)) += (sign*dFlow);
+        m_bVector(row) += (sign*dFlow);
+        break;
       }
-      else if (p->HasNextPotentialSource())
+      case SECompiledCircuit::Element::PotentialSource:
       {
-        PopulateAMatrix(*n, *p, 1, true);
+        PopulateAMatrix(nIdx, pIdx, 1, true);
+        break;
       }
-      else
+      default:
       {
         //No element
         //Model as a 0v voltage source
-        PopulateAMatrix(*n, *p, 1, true);
+        PopulateAMatrix(nIdx, pIdx, 1, true);
+      }
       }
     }
   }
@@ -366,7 +404,8 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
   //std::cout << "#iterations:     " << Solver.iterations() << std::endl;
   //std::cout << "estimated error: " << Solver.error()      << std::endl;
   std::cout << "PrePotential" << std::endl;
-  std::cout << "A = " << std::endl << m_AMatrix << std::endl;
+  if (!m_solver.IsSparse())
+    std::cout << "A = " << std::endl << m_AMatrix << std::endl;
   std::cout << "b = " << std::endl << m_bVector << std::endl;
   std::cout << "x = " << std::endl << m_xVector << std::endl;
 #endif
@@ -375,30 +414,33 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseIn()
   //We also model closed Switches, "closed" Valves (those allowing flow), and shorts (paths without an element) as 0Pa Pressure Sources.
   //All pressure sources will have their Flow directly solved by adding equations for known Node pressure differences caused by them.
   //We add rows for these equations after the KCL equations (hence the iNodeSize+i).
-  for (auto itr : m_potentialSources)
+  for (size_t pIdx : m_potentialSources)
   {
-    PathType* p = itr.first;
-    NodeType& nSrc = p->GetSourceNode();
-    NodeType& nTgt = p->GetTargetNode();
+    int row = m_potentialSourceIndex[pIdx];
+    int srcIdx = cc.NodeCalculatorIndex[cc.PathSource[pIdx]];
+    int tgtIdx = cc.NodeCalculatorIndex[cc.PathTarget[pIdx]];
 
-    if (!m_circuit->IsReferenceNode(nSrc))
+    if (srcIdx >= 0)
     {
-      m_AMatrix(itr.second, m_circuit->GetCalculatorIndex(nSrc)) = -1;
+      AddToAMatrix(row, srcIdx, -1);
     }
-    if (!m_circuit->IsReferenceNode(nTgt))
+    if (tgtIdx >= 0)
     {
-      m_AMatrix(itr.second, m_circuit->GetCalculatorIndex(nTgt)) = 1;
+      AddToAMatrix(row, tgtIdx, 1);
     }
 
-    if (p->HasNextSwitch() || p->HasNextValve() || p->NumberOfNextElements() < 1)
+    if (cc.PathElement[pIdx] == SECompiledCircuit::Element::PotentialSource)
     {
-      m_bVector(itr.second) = 0.0;
+      m_bVector(row) += paths[pIdx]->GetNextPotentialSource().GetValue(m_PotentialUnit);
     }
     else
     {
-      m_bVector(itr.second) += p->GetNextPotentialSource().GetValue(m_PotentialUnit);
+      m_bVector(row) = 0.0;
     }
   }
+
+  if (m_solver.IsSparse())
+    BuildSparseAMatrix(numVars);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -416,7 +458,10 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
   //std::cout << "#iterations:     " << Solver.iterations() << std::endl;
   //std::cout << "estimated error: " << Solver.error()      << std::endl;
   std::cout << "PreSolve" << std::endl;
-  std::cout << "A = " << std::endl << m_AMatrix << std::endl;
+  if (m_solver.IsSparse())
+    std::cout << "A = " << std::endl << Eigen::MatrixXd(m_sparseConfiguration->AMatrix) << std::endl;
+  else
+    std::cout << "A = " << std::endl << m_AMatrix << std::endl;
   std::cout << "b = " << std::endl << m_bVector << std::endl;
   std::cout << "x = " << std::endl << m_xVector << std::endl;
 #endif
@@ -450,22 +495,30 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
     //Sparse methods
   case EigenCircuitSolver::SparseLU:
   {
-    Eigen::SparseMatrix<double> sparse = m_AMatrix.sparseView();
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.compute(sparse);
+    //Only redo the symbolic analysis (column ordering) when the non-zero pattern of this configuration changes,
+    //otherwise we can just redo the numeric factorization with the new values
+    SparseConfiguration& config = *m_sparseConfiguration;
+    if (!config.Analyzed)
+    {
+      config.LU.analyzePattern(config.AMatrix);
+      config.Analyzed = true;
+    }
+    config.LU.factorize(config.AMatrix);
     //Check to see if we have a good solution.
-    if (solver.info() == Eigen::Success)
-      m_xVector = solver.solve(m_bVector);
+    if (config.LU.info() == Eigen::Success)
+      m_xVector = config.LU.solve(m_bVector);
     else
+    {
+      //Force a new analysis next time, we don't know what state the solver is in
+      config.Analyzed = false;
       sparseFailed = true;
+    }
     break;
   }
   case EigenCircuitSolver::SparseQR:
   {
-    Eigen::SparseMatrix<double> sparse = m_AMatrix.sparseView();
-    //sparse.makeCompressed();
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(sparse);
+    solver.compute(m_sparseConfiguration->AMatrix);
     //Check to see if we have a good solution.
     if (solver.info() == Eigen::Success)
       m_xVector = solver.solve(m_bVector);
@@ -475,9 +528,8 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
   }
   case EigenCircuitSolver::BiCGSTAB:
   {
-    Eigen::SparseMatrix<double> sparse = m_AMatrix.sparseView();
     Eigen::BiCGSTAB<Eigen::SparseMatrix<double>> solver;
-    solver.compute(sparse);
+    solver.compute(m_sparseConfiguration->AMatrix);
     //Check to see if we have a good solution.
     if (solver.info() == Eigen::Success)
       m_xVector = solver.solve(m_bVector);
@@ -487,9 +539,8 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
   }
   case EigenCircuitSolver::ConjugateGradient:
   {
-    Eigen::SparseMatrix<double> sparse = m_AMatrix.sparseView();
     Eigen::ConjugateGradient<Eigen::SparseMatrix<double>> solver;
-    solver.compute(sparse);
+    solver.compute(m_sparseConfiguration->AMatrix);
     //Check to see if we have a good solution.
     if (solver.info() == Eigen::Success)
       m_xVector = solver.solve(m_bVector);
@@ -508,6 +559,8 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
   {
     //The faster sparse solver should almost always work
     //If it didn't, do it dense and make sure we get an answer (if possible)
+    if (m_solver.IsSparse())
+      m_AMatrix = Eigen::MatrixXd(m_sparseConfiguration->AMatrix);
     m_xVector = m_AMatrix.fullPivLu().solve(m_bVector);
 
     if (!(m_AMatrix*m_xVector).isApprox(m_bVector, 1.0e-11))
@@ -536,6 +589,8 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
   //std::cout << "#iterations:     " << Solver.iterations() << std::endl;
   //std::cout << "estimated error: " << Solver.error()      << std::endl;
   std::cout << "PostSolve" << std::endl;
+  if (m_solver.IsSparse() && !sparseFailed)
+    m_AMatrix = Eigen::MatrixXd(m_sparseConfiguration->AMatrix);
   std::cout << "A = " << std::endl << m_AMatrix << std::endl;
   std::cout << "b = " << std::endl << m_bVector << std::endl;
   std::cout << "x = " << std::endl << m_xVector << std::endl;
@@ -556,27 +611,32 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::Solve()
 template<CIRCUIT_CALCULATOR_TEMPLATE>
 void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseOut()
 {
+  const SECompiledCircuit& cc = m_circuit->GetCompiledCircuit();
+  const std::vector<NodeType*>& nodes = m_circuit->GetNodes();
+  const std::vector<PathType*>& paths = m_circuit->GetPaths();
+
   double refPotential = m_circuit->GetReferenceNodes()[0]->GetPotential().GetValue(m_PotentialUnit);
-  for (NodeType* n : m_circuit->GetNodes())
+  for (size_t nIdx = 0; nIdx < nodes.size(); nIdx++)
   {
-    if (!m_circuit->IsReferenceNode(*n))
+    int idx = cc.NodeCalculatorIndex[nIdx];
+    if (idx >= 0)
     {
       //Add the reference potential
       //For the calculations, we assume the reference potential is zero
       //When it's not zero, all potentials are just offset by that amount
-      double potential = m_xVector(m_circuit->GetCalculatorIndex(*n)) + refPotential;
-      ValueOverride<PotentialUnit>(n->GetNextPotential(), potential, m_PotentialUnit);
+      double potential = m_xVector(idx) + refPotential;
+      ValueOverride<PotentialUnit>(nodes[nIdx]->GetNextPotential(), potential, m_PotentialUnit);
     }
   }
-  for (auto itr : m_potentialSources)
+  for (size_t pIdx : m_potentialSources)
   {
     //The Pressure Source Flows are all in order after the Node Pressures.
     //The total number of unknown node pressures are one less than the total number of nodes because the reference node pressure is known.
-    double dFlow = m_xVector(itr.second);
+    double dFlow = m_xVector(m_potentialSourceIndex[pIdx]);
     //We define pressure sources as the difference in pressure from source to target.
     //Therefore, a positive value means the target pressure is greater than the source (and reverse for negative values).
     //This means flow would go Target to Source (high to low pressure), and we need to reverse the sign.
-    ValueOverride<FluxUnit>(itr.first->GetNextFlux(), -dFlow, m_FluxUnit);
+    ValueOverride<FluxUnit>(paths[pIdx]->GetNextFlux(), -dFlow, m_FluxUnit);
   }
 }
 
@@ -592,30 +652,39 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::ParseOut()
 template<CIRCUIT_CALCULATOR_TEMPLATE>
 void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CalculateFluxes()
 {
+  const SECompiledCircuit& cc = m_circuit->GetCompiledCircuit();
+  const std::vector<NodeType*>& nodes = m_circuit->GetNodes();
+  const std::vector<PathType*>& paths = m_circuit->GetPaths();
+
   //Calculate flows (currents)
   //Note: flows use source->target convention for positive flow, so the source pressure needs to be larger than the target pressure for positive flow
-  for (PathType* p : m_circuit->GetPaths())
+  for (size_t pIdx = 0; pIdx < paths.size(); pIdx++)
   {
-    if (p->HasNextFluxSource())
+    PathType* p = paths[pIdx];
+    NodeType* nSrc = nodes[cc.PathSource[pIdx]];
+    NodeType* nTgt = nodes[cc.PathTarget[pIdx]];
+    SECompiledCircuit::Element e = cc.PathElement[pIdx];
+
+    if (e == SECompiledCircuit::Element::FluxSource)
     {
       Override<FluxUnit>(p->GetNextFluxSource(), p->GetNextFlux());
     }
-    else if ((p->HasNextSwitch() && p->GetNextSwitch() == cdm::eGate::Open) ||
-      (p->HasNextValve() && p->GetNextValve() == cdm::eGate::Open) ||
-      (p->HasNextPolarizedState() && p->GetNextPolarizedState() == cdm::eGate::Open))
+    else if ((e == SECompiledCircuit::Element::Switch && p->GetNextSwitch() == cdm::eGate::Open) ||
+      (e == SECompiledCircuit::Element::Valve && p->GetNextValve() == cdm::eGate::Open) ||
+      (cc.PathPolarized[pIdx] && p->GetNextPolarizedState() == cdm::eGate::Open))
     {
       ValueOverride<FluxUnit>(p->GetNextFlux(), 0, m_FluxUnit);
     }
-    else if (p->HasNextResistance())
+    else if (e == SECompiledCircuit::Element::Resistance)
     {
       //I = V/R
       double dResistance;
       dResistance = p->GetNextResistance().GetValue(m_ResistanceUnit);
-      double dPressDiff = p->GetTargetNode().GetNextPotential().GetValue(m_PotentialUnit) - p->GetSourceNode().GetNextPotential().GetValue(m_PotentialUnit);
+      double dPressDiff = nTgt->GetNextPotential().GetValue(m_PotentialUnit) - nSrc->GetNextPotential().GetValue(m_PotentialUnit);
       double dFlow = dPressDiff / dResistance;
       ValueOverride<FluxUnit>(p->GetNextFlux(), -dFlow, m_FluxUnit);
     }
-    else if (p->HasNextCapacitance())
+    else if (e == SECompiledCircuit::Element::Capacitance)
     {
       //Positive flow is from source to target (i.e. SourcePressure > TargetPressure = Positive Flow)      
       //dStartingCompliance is at time = T
@@ -627,18 +696,18 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CalculateFluxes()
       //dEndingCompliance is at time = T + deltaT  
       double dEndingCompliance = p->GetNextCapacitance().GetValue(m_CapacitanceUnit);
       //dStartingPressDiff is at time = T
-      double dStartingPressDiff = p->GetSourceNode().GetPotential().GetValue(m_PotentialUnit) - p->GetTargetNode().GetPotential().GetValue(m_PotentialUnit);
+      double dStartingPressDiff = nSrc->GetPotential().GetValue(m_PotentialUnit) - nTgt->GetPotential().GetValue(m_PotentialUnit);
       //dStartingPressDiff is at time = T + deltaT  
-      double dEndingPressDiff = p->GetSourceNode().GetNextPotential().GetValue(m_PotentialUnit) - p->GetTargetNode().GetNextPotential().GetValue(m_PotentialUnit);
+      double dEndingPressDiff = nSrc->GetNextPotential().GetValue(m_PotentialUnit) - nTgt->GetNextPotential().GetValue(m_PotentialUnit);
       double dFlow = (dEndingCompliance*dEndingPressDiff - dStartingCompliance*dStartingPressDiff) / m_dT_s;
       ValueOverride<FluxUnit>(p->GetNextFlux(), dFlow, m_FluxUnit);
     }
-    else if (p->HasNextInductance())
+    else if (e == SECompiledCircuit::Element::Inductance)
     {
       //V = L*dI/dt
       //I = dt/L*V+I(0)
-      double dPressDiff = p->GetTargetNode().GetNextPotential().GetValue(m_PotentialUnit) - p->GetSourceNode().GetNextPotential().GetValue(m_PotentialUnit);
-      double dInitialPressDiff = p->GetTargetNode().GetPotential().GetValue(m_PotentialUnit) - p->GetSourceNode().GetPotential().GetValue(m_PotentialUnit);
+      double dPressDiff = nTgt->GetNextPotential().GetValue(m_PotentialUnit) - nSrc->GetNextPotential().GetValue(m_PotentialUnit);
+      double dInitialPressDiff = nTgt->GetPotential().GetValue(m_PotentialUnit) - nSrc->GetPotential().GetValue(m_PotentialUnit);
       double dInitialFlow = -1.0 * p->GetFlux().GetValue(m_FluxUnit);
       double dFlow = m_dT_s / (2 * p->GetNextInductance().GetValue(m_InductanceUnit)) * (dPressDiff + dInitialPressDiff) + dInitialFlow;
       ValueOverride<FluxUnit>(p->GetNextFlux(), -dFlow, m_FluxUnit);
@@ -657,21 +726,29 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CalculateFluxes()
 template<CIRCUIT_CALCULATOR_TEMPLATE>
 void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CalculateQuantities()
 {
+  const SECompiledCircuit& cc = m_circuit->GetCompiledCircuit();
+  const std::vector<NodeType*>& nodes = m_circuit->GetNodes();
+  const std::vector<PathType*>& paths = m_circuit->GetPaths();
+
   //Calculate volume changes due to compliance.
   //You need a compliance because volume can't change in a rigid pipe.
 
   //Volumes are only calculated for paths with a compliance, and each model is responsible for populating node volumes based on those values.
-  for (PathType* p : m_circuit->GetPaths())
+  for (size_t pIdx = 0; pIdx < paths.size(); pIdx++)
   {
     // Calculate Quantities
-    if (p->HasNextCapacitance())
+    if (cc.PathElement[pIdx] == SECompiledCircuit::Element::Capacitance)
     {
+      PathType* p = paths[pIdx];
+      NodeType* nSrc = nodes[cc.PathSource[pIdx]];
+      NodeType* nTgt = nodes[cc.PathTarget[pIdx]];
+
       //Charge is analogues to volume
       double flux = p->GetNextFlux().GetValue(m_FluxUnit);
       double dVolumeIncrement = flux * m_dT_s;
 
       //Handle polarized elements special-like
-      if (p->HasNextPolarizedState())
+      if (cc.PathPolarized[pIdx])
       {
         double dStartingCompliance = 0.0;
         if (p->HasCapacitance())
@@ -681,9 +758,9 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CalculateQuantities()
         //dEndingCompliance is at time = T + deltaT  
         double dEndingCompliance = p->GetNextCapacitance().GetValue(m_CapacitanceUnit);
         //dStartingPressDiff is at time = T
-        double dStartingPressDiff = std::abs(p->GetSourceNode().GetPotential().GetValue(m_PotentialUnit) - p->GetTargetNode().GetPotential().GetValue(m_PotentialUnit));
+        double dStartingPressDiff = std::abs(nSrc->GetPotential().GetValue(m_PotentialUnit) - nTgt->GetPotential().GetValue(m_PotentialUnit));
         //dStartingPressDiff is at time = T + deltaT  
-        double dEndingPressDiff = std::abs(p->GetSourceNode().GetNextPotential().GetValue(m_PotentialUnit) - p->GetTargetNode().GetNextPotential().GetValue(m_PotentialUnit));
+        double dEndingPressDiff = std::abs(nSrc->GetNextPotential().GetValue(m_PotentialUnit) - nTgt->GetNextPotential().GetValue(m_PotentialUnit));
 
         if (p->GetPolarizedState() == cdm::eGate::Open)
         {
@@ -701,14 +778,14 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CalculateQuantities()
         dVolumeIncrement = dEndingCompliance*dEndingPressDiff - dStartingCompliance*dStartingPressDiff;
       }
 
-      if (p->GetSourceNode().HasNextQuantity() && !p->GetSourceNode().GetNextQuantity().IsInfinity())
+      if (nSrc->HasNextQuantity() && !nSrc->GetNextQuantity().IsInfinity())
       {
-        IncrementOverride<QuantityUnit>(p->GetSourceNode().GetNextQuantity(), dVolumeIncrement, m_QuantityUnit);
+        IncrementOverride<QuantityUnit>(nSrc->GetNextQuantity(), dVolumeIncrement, m_QuantityUnit);
       }
 
-      if (p->GetTargetNode().HasNextQuantity() && !p->GetTargetNode().GetNextQuantity().IsInfinity())
+      if (nTgt->HasNextQuantity() && !nTgt->GetNextQuantity().IsInfinity())
       {
-        IncrementOverride<QuantityUnit>(p->GetTargetNode().GetNextQuantity(), -dVolumeIncrement, m_QuantityUnit);
+        IncrementOverride<QuantityUnit>(nTgt->GetNextQuantity(), -dVolumeIncrement, m_QuantityUnit);
       }
     }
   }
@@ -791,6 +868,22 @@ bool SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::CheckAndModifyValves()
 //--------------------------------------------------------------------------------------------------
 template<CIRCUIT_CALCULATOR_TEMPLATE>
 bool SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::IsCurrentValveStateUnique()
+{
+  uint64_t currentState = GetCurrentValveState();
+  if (m_valveStates.find(currentState) != end(m_valveStates))
+    return false;
+  m_valveStates.insert(currentState);
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Encode the current Valve and Polarized Element states.
+///
+/// \return Bit mask with a bit set for every closed Valve/Polarized Element.
+//--------------------------------------------------------------------------------------------------
+template<CIRCUIT_CALCULATOR_TEMPLATE>
+uint64_t SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::GetCurrentValveState() const
 {
   uint64_t index = 1;
   uint64_t currentState = 0;
@@ -810,18 +903,15 @@ bool SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::IsCurrentValveStateUnique()
       currentState |= index;
     index = index << static_cast<uint64_t>(1);
   }
-  if (m_valveStates.find(currentState) != end(m_valveStates))
-    return false;
-  m_valveStates.insert(currentState);
-  return true;
+  return currentState;
 }
 
 //--------------------------------------------------------------------------------------------------
 /// \brief
 /// Add a value to the appropriate location in the Jacobian matrix.
 ///
-/// \param  nKCL              The Node that is currently being analyzed.
-/// \param  p                 The Path that is currently being analyzed.
+/// \param  nodeIdx           Index of the Node that is currently being analyzed.
+/// \param  pathIdx           Index of the Path that is currently being analyzed.
 /// \param  dMultiplier       The value to insert in the Jacobian matrix.
 /// \param  hasPressureSource True if the path has a Pressure Source.
 ///
@@ -831,16 +921,18 @@ bool SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::IsCurrentValveStateUnique()
 /// These should include all of the multipliers on the left side of the KCL equations.
 //--------------------------------------------------------------------------------------------------
 template<CIRCUIT_CALCULATOR_TEMPLATE>
-void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::PopulateAMatrix(NodeType& n, PathType& p, double dMultiplier, bool hasPotentialSource)
+void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::PopulateAMatrix(size_t nodeIdx, size_t pathIdx, double dMultiplier, bool hasPotentialSource)
 {
-  NodeType& nSrc = p.GetSourceNode();
-  NodeType& nTgt = p.GetTargetNode();
+  const SECompiledCircuit& cc = m_circuit->GetCompiledCircuit();
+  size_t nSrc = cc.PathSource[pathIdx];
+  size_t nTgt = cc.PathTarget[pathIdx];
+  int row = cc.NodeCalculatorIndex[nodeIdx];
 
   if (std::isinf(dMultiplier))
   {
     //Someone screwed up
     //Probably a divide by zero and most likely from a Resistance
-    m_ss << "Attempting to populate a matrix with an infinite value.  Check " << p.GetName() << " path circuit element.";
+    m_ss << "Attempting to populate a matrix with an infinite value.  Check " << m_circuit->GetPaths()[pathIdx]->GetName() << " path circuit element.";
     Fatal(m_ss);
   }
 
@@ -849,50 +941,127 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::PopulateAMatrix(NodeType& n,
     //Handle Pressure Sources here.
     //The Jacobian Matrix uses their Flow as a variable.
     double sign = 0;
-    if (&nSrc == &n)
+    if (nSrc == nodeIdx)
       sign = -1;
-    else if (&nTgt == &n)
+    else if (nTgt == nodeIdx)
       sign = 1;
-    m_AMatrix(m_circuit->GetCalculatorIndex(n), m_potentialSources[&p]) += sign;
+    AddToAMatrix(row, m_potentialSourceIndex[pathIdx], sign);
   }
   else
   {
     //We use the convention that the Node we're sitting on is always the positive multiplier in the current equation.
     //Therefore, it's positive as either the Source or the Target.
     //Nodes on the other end of the path have a negative multiplier.
+    //Reference nodes are known (zero) potentials, so they do not show up in the matrix.
 
-    if (m_circuit->IsReferenceNode(nSrc))
-    {
-      m_bVector(m_circuit->GetCalculatorIndex(n)) += 0;
-    }
-    else if (&nSrc == &n)
+    int srcIdx = cc.NodeCalculatorIndex[nSrc];
+    if (srcIdx >= 0)
     {
       //If the Source Node is the Node we're sitting on, our convention is positive.
-      m_AMatrix(m_circuit->GetCalculatorIndex(n), m_circuit->GetCalculatorIndex(nSrc)) += dMultiplier;
-    }
-    else
-    {
-      //The Source Node is not the Node we're sitting on for KCL analysis.
-      m_AMatrix(m_circuit->GetCalculatorIndex(n), m_circuit->GetCalculatorIndex(nSrc)) -= dMultiplier;
+      //Otherwise, the Source Node is not the Node we're sitting on for KCL analysis.
+      AddToAMatrix(row, srcIdx, nSrc == nodeIdx ? dMultiplier : -dMultiplier);
     }
 
-    if (m_circuit->IsReferenceNode(nTgt))
-    {
-      m_bVector(m_circuit->GetCalculatorIndex(n)) += 0;
-    }
-    else if (&nTgt == &n)
+    int tgtIdx = cc.NodeCalculatorIndex[nTgt];
+    if (tgtIdx >= 0)
     {
       //If the Target Node is the Node we're sitting on, our convention is positive.
-      m_AMatrix(m_circuit->GetCalculatorIndex(n), m_circuit->GetCalculatorIndex(nTgt)) += dMultiplier;
-    }
-    else
-    {
-      //The Target Node is not the Node we're sitting on for KCL analysis.
-      m_AMatrix(m_circuit->GetCalculatorIndex(n), m_circuit->GetCalculatorIndex(nTgt)) -= dMultiplier;
+      //Otherwise, the Target Node is not the Node we're sitting on for KCL analysis.
+      AddToAMatrix(row, tgtIdx, nTgt == nodeIdx ? dMultiplier : -dMultiplier);
     }
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Accumulate a value into the A matrix.
+///
+/// \param  row   Row of the A matrix.
+/// \param  col   Column of the A matrix.
+/// \param  value Value to add to the current entry.
+///
+/// \details
+/// Sparse solvers get a triplet (duplicates are summed when the sparse matrix is built),
+/// dense solvers get the value added directly into the dense matrix.
+//--------------------------------------------------------------------------------------------------
+template<CIRCUIT_CALCULATOR_TEMPLATE>
+void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::AddToAMatrix(size_t row, size_t col, double value)
+{
+  if (m_solver.IsSparse())
+    m_AMatrixTriplets.emplace_back(int(row), int(col), value);
+  else
+    m_AMatrix(row, col) += value;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Build the compressed sparse A matrix from the triplets collected during ParseIn.
+///
+/// \param  numVars Number of unknowns (rows and columns) in the system.
+///
+/// \details
+/// The sparse matrix and solver analysis are cached per valve configuration (see GetCurrentValveState),
+/// least recently used configurations are dropped once there are more than m_maxSparseConfigurations.
+/// The triplets are emitted in the same order every time the circuit topology and valve/switch states are the same.
+/// When they are, each triplet's position (slot) in the compressed value array is already known from the last build,
+/// and the values are just scattered into place without rebuilding the matrix structure.
+//--------------------------------------------------------------------------------------------------
+template<CIRCUIT_CALCULATOR_TEMPLATE>
+void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::BuildSparseAMatrix(size_t numVars)
+{
+  uint64_t valveState = GetCurrentValveState();
+  auto itr = m_sparseConfigurations.begin();
+  for (; itr != m_sparseConfigurations.end(); ++itr)
+  {
+    if ((*itr)->Circuit == m_circuit && (*itr)->ValveState == valveState)
+      break;
+  }
+  if (itr != m_sparseConfigurations.end())
+    m_sparseConfigurations.splice(m_sparseConfigurations.begin(), m_sparseConfigurations, itr);
+  else
+  {
+    if (m_sparseConfigurations.size() >= m_maxSparseConfigurations)
+      m_sparseConfigurations.pop_back();
+    SparseConfiguration* config = new SparseConfiguration();
+    config->Circuit = m_circuit;
+    config->ValveState = valveState;
+    config->Analyzed = false;
+    m_sparseConfigurations.emplace_front(config);
+  }
+  m_sparseConfiguration = m_sparseConfigurations.front().get();
+  SparseConfiguration& config = *m_sparseConfiguration;
+
+  //Switches are not part of the valve state, so still make sure the structure is the same
+  auto samePosition = [](const Eigen::Triplet<double>& a, const Eigen::Triplet<double>& b) { return a.row() == b.row() && a.col() == b.col(); };
+  if (size_t(config.AMatrix.rows()) == numVars &&
+      config.PatternTriplets.size() == m_AMatrixTriplets.size() &&
+      std::equal(m_AMatrixTriplets.begin(), m_AMatrixTriplets.end(), config.PatternTriplets.begin(), samePosition))
+  {
+    double* values = config.AMatrix.valuePtr();
+    std::fill(values, values + config.AMatrix.nonZeros(), 0.0);
+    for (size_t i = 0; i < m_AMatrixTriplets.size(); i++)
+      values[config.Slots[i]] += m_AMatrixTriplets[i].value();
+    return;
+  }
+
+  //Duplicate entries are summed, just like the += in the dense matrix
+  config.AMatrix.resize(numVars, numVars);
+  config.AMatrix.setFromTriplets(m_AMatrixTriplets.begin(), m_AMatrixTriplets.end());
+  config.AMatrix.makeCompressed();
+  config.Analyzed = false;
+
+  //Remember where each triplet landed for next time
+  const int* outer = config.AMatrix.outerIndexPtr();
+  const int* inner = config.AMatrix.innerIndexPtr();
+  config.Slots.resize(m_AMatrixTriplets.size());
+  for (size_t i = 0; i < m_AMatrixTriplets.size(); i++)
+  {
+    const Eigen::Triplet<double>& t = m_AMatrixTriplets[i];
+    config.Slots[i] = size_t(std::lower_bound(inner + outer[t.col()], inner + outer[t.col() + 1], t.row()) - inner);
+  }
+  config.PatternTriplets = m_AMatrixTriplets;
+}
+
 //--------------------------------------------------------------------------------------------------
 /// \brief
 /// Advances time
@@ -907,6 +1076,9 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::PopulateAMatrix(NodeType& n,
 template<CIRCUIT_CALCULATOR_TEMPLATE>
 void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::PostProcess(CircuitType& circuit)
 {
+  if (!circuit.IsCompiledCircuitCurrent())
+    circuit.StateChange();
+  circuit.GetCircuitEpoch().Increment();
   // 1) Push Next pressures, flows, and modified path elements (the only elements that will have a value in Next are those that are modified since the last time step) to Current
   for (NodeType* n : circuit.GetNodes())
   {
@@ -916,34 +1088,57 @@ void SECircuitCalculator<CIRCUIT_CALCULATOR_TYPES>::PostProcess(CircuitType& cir
   }
   //The current values stay the same, unless there's a next value to modify it
   //This goes along with the circuit "alter" methodology
-  for (PathType* p : circuit.GetPaths())
+  //Only the element the path actually has needs to be looked at
+  const SECompiledCircuit& cc = circuit.GetCompiledCircuit();
+  const std::vector<PathType*>& paths = circuit.GetPaths();
+  for (size_t pIdx = 0; pIdx < paths.size(); pIdx++)
   {
-    if (p->HasNextValve())
-      p->SetValve(p->GetNextValve());
-    if (p->HasNextSwitch())
-      p->SetSwitch(p->GetNextSwitch());
-    if (p->HasNextPolarizedState())
+    PathType* p = paths[pIdx];
+    if (cc.PathPolarized[pIdx] && p->HasNextPolarizedState())
       p->SetPolarizedState(p->GetNextPolarizedState());
 
     if (p->HasNextFlux())
       Override<FluxUnit>(p->GetNextFlux(), p->GetFlux());
-    if (p->HasNextFluxSource())
-      Override<FluxUnit>(p->GetNextFluxSource(), p->GetFluxSource());
-    if (p->HasNextResistance())
-      Override<ResistanceUnit>(p->GetNextResistance(),p->GetResistance());
-    if (p->HasNextCapacitance())
-      Override<CapacitanceUnit>(p->GetNextCapacitance(),p->GetCapacitance());
-    if (p->HasNextInductance())
-      Override<InductanceUnit>(p->GetNextInductance(),p->GetInductance());   
-    if (p->HasNextPotentialSource())
-      Override<PotentialUnit>(p->GetNextPotentialSource(),p->GetPotentialSource());
 
     // 2) Set Next Path elements to the Baseline values
     //    We won't touch Valves or Switches.  Valves should keep their state to efficiently solve based on assumed states
-    p->GetNextFluxSource().Set(p->GetFluxSourceBaseline());
-    p->GetNextResistance().Set(p->GetResistanceBaseline());
-    p->GetNextCapacitance().Set(p->GetCapacitanceBaseline());
-    p->GetNextInductance().Set(p->GetInductanceBaseline());
-    p->GetNextPotentialSource().Set(p->GetPotentialSourceBaseline());
+    switch (cc.PathElement[pIdx])
+    {
+    case SECompiledCircuit::Element::Valve:
+      if (p->HasNextValve())
+        p->SetValve(p->GetNextValve());
+      break;
+    case SECompiledCircuit::Element::Switch:
+      if (p->HasNextSwitch())
+        p->SetSwitch(p->GetNextSwitch());
+      break;
+    case SECompiledCircuit::Element::FluxSource:
+      if (p->HasNextFluxSource())
+        Override<FluxUnit>(p->GetNextFluxSource(), p->GetFluxSource());
+      p->GetNextFluxSource().Set(p->GetFluxSourceBaseline());
+      break;
+    case SECompiledCircuit::Element::Resistance:
+      if (p->HasNextResistance())
+        Override<ResistanceUnit>(p->GetNextResistance(), p->GetResistance());
+      p->GetNextResistance().Set(p->GetResistanceBaseline());
+      break;
+    case SECompiledCircuit::Element::Capacitance:
+      if (p->HasNextCapacitance())
+        Override<CapacitanceUnit>(p->GetNextCapacitance(), p->GetCapacitance());
+      p->GetNextCapacitance().Set(p->GetCapacitanceBaseline());
+      break;
+    case SECompiledCircuit::Element::Inductance:
+      if (p->HasNextInductance())
+        Override<InductanceUnit>(p->GetNextInductance(), p->GetInductance());
+      p->GetNextInductance().Set(p->GetInductanceBaseline());
+      break;
+    case SECompiledCircuit::Element::PotentialSource:
+      if (p->HasNextPotentialSource())
+        Override<PotentialUnit>(p->GetNextPotentialSource(), p->GetPotentialSource());
+      p->GetNextPotentialSource().Set(p->GetPotentialSourceBaseline());
+      break;
+    default:
+      break;
+    }
   }
 }
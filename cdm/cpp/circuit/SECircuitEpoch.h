@@ -0,0 +1,21 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+#include <atomic>
+
+// Incremented whenever circuit values (node potentials/quantities, path fluxes) are changed in bulk,
+// i.e. when a circuit is calculated or advanced in time.
+// Each circuit manager owns one, so engines do not invalidate each others caches.
+// Anything aggregating circuit values (i.e. compartments) can cache its results until this changes.
+// If you modify a node or path value directly, call Increment so those caches are recomputed.
+class CDM_DECL SECircuitEpoch
+{
+public:
+  SECircuitEpoch() : m_Epoch(0) {}
+
+  uint64_t Get() const { return m_Epoch.load(std::memory_order_acquire); }
+  void Increment() { m_Epoch.fetch_add(1, std::memory_order_acq_rel); }
+protected:
+  std::atomic<uint64_t> m_Epoch;
+};
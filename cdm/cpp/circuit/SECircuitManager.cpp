@@ -153,6 +153,7 @@ void SECircuitManager::Serialize(const cdm::CircuitManagerData& src, SECircuitMa
     const cdm::ThermalCircuitData& c = src.thermalcircuit(i);
     SEThermalCircuit::Load(c, dst.CreateCircuit<THERMAL_LEDGER_TYPES>(c.circuit().name(), dst.m_ThermalLedger), dst.m_ThermalLedger.nodes, dst.m_ThermalLedger.paths);
   }
+  dst.m_Epoch.Increment();
 }
 
 cdm::CircuitManagerData* SECircuitManager::Unload(const SECircuitManager& src)
@@ -185,6 +186,82 @@ void SECircuitManager::Serialize(const SECircuitManager& src, cdm::CircuitManage
     dst.mutable_thermalcircuit()->AddAllocated(SEThermalCircuit::Unload(*itr.second));
 }
 
+namespace
+{
+  // The Next elements SECircuit::StateChange compiles a path with
+  template<typename PathType>
+  unsigned short NextElements(const PathType& p)
+  {
+    return (p.HasNextSwitch() ? 1 : 0) | (p.HasNextValve() ? 2 : 0) | (p.HasNextPolarizedState() ? 4 : 0) |
+           (p.HasNextResistance() ? 8 : 0) | (p.HasNextCapacitance() ? 16 : 0) | (p.HasNextInductance() ? 32 : 0) |
+           (p.HasNextFluxSource() ? 64 : 0) | (p.HasNextPotentialSource() ? 128 : 0);
+  }
+
+  template<CIRCUIT_LEDGER_TEMPLATE>
+  bool SameTopology(const SECircuitLedger<CIRCUIT_LEDGER_TYPES>& a, const SECircuitLedger<CIRCUIT_LEDGER_TYPES>& b)
+  {
+    if (a.nodes.size() != b.nodes.size() || a.paths.size() != b.paths.size() || a.circuits.size() != b.circuits.size())
+      return false;
+    // The ledgers are sorted by name, so identical topologies line up entry for entry
+    for (auto aItr = a.nodes.begin(), bItr = b.nodes.begin(); aItr != a.nodes.end(); ++aItr, ++bItr)
+    {
+      if (aItr->first != bItr->first)
+        return false;
+    }
+    for (auto aItr = a.paths.begin(), bItr = b.paths.begin(); aItr != a.paths.end(); ++aItr, ++bItr)
+    {
+      if (aItr->first != bItr->first ||
+          aItr->second->GetSourceNode().GetName() != bItr->second->GetSourceNode().GetName() ||
+          aItr->second->GetTargetNode().GetName() != bItr->second->GetTargetNode().GetName())
+        return false;
+    }
+    for (auto aItr = a.circuits.begin(), bItr = b.circuits.begin(); aItr != a.circuits.end(); ++aItr, ++bItr)
+    {
+      if (aItr->first != bItr->first ||
+          aItr->second->GetNodes().size() != bItr->second->GetNodes().size() ||
+          aItr->second->GetPaths().size() != bItr->second->GetPaths().size())
+        return false;
+    }
+    return true;
+  }
+
+  template<CIRCUIT_LEDGER_TEMPLATE>
+  void CopyLedgerState(const SECircuitLedger<CIRCUIT_LEDGER_TYPES>& src, SECircuitLedger<CIRCUIT_LEDGER_TYPES>& dst)
+  {
+    auto sNode = src.nodes.begin();
+    for (auto& dNode : dst.nodes)
+      NodeType::CopyState(*(sNode++)->second, *dNode.second);
+    bool elementsChanged = false;
+    auto sPath = src.paths.begin();
+    for (auto& dPath : dst.paths)
+    {
+      const PathType& s = *(sPath++)->second;
+      if (NextElements(s) != NextElements(*dPath.second))
+        elementsChanged = true;
+      PathType::CopyState(s, *dPath.second);
+    }
+    // Only recompile the circuits if a path now has a different element
+    if (elementsChanged)
+    {
+      for (auto& dCircuit : dst.circuits)
+        dCircuit.second->StateChange();
+    }
+  }
+}
+
+bool SECircuitManager::CopyState(const SECircuitManager& src, SECircuitManager& dst)
+{
+  if (!SameTopology(src.m_ElectricalLedger, dst.m_ElectricalLedger) ||
+      !SameTopology(src.m_FluidLedger, dst.m_FluidLedger) ||
+      !SameTopology(src.m_ThermalLedger, dst.m_ThermalLedger))
+    return false;
+  CopyLedgerState(src.m_ElectricalLedger, dst.m_ElectricalLedger);
+  CopyLedgerState(src.m_FluidLedger, dst.m_FluidLedger);
+  CopyLedgerState(src.m_ThermalLedger, dst.m_ThermalLedger);
+  dst.m_Epoch.Increment();
+  return true;
+}
+
 void SECircuitManager::SetReadOnly(bool b)
 {
   SetReadOnlyElectrical(b);
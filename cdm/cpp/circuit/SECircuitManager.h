@@ -2,6 +2,7 @@
    See accompanying NOTICE file for details.*/
 
 #pragma once
+#include "circuit/SECircuitEpoch.h"
 class SEFluidCircuit;
 class SEFluidCircuitNode;
 class SEFluidCircuitPath;
@@ -49,13 +50,20 @@ public:
 
   static void Load(const cdm::CircuitManagerData& src, SECircuitManager& dst);
   static cdm::CircuitManagerData* Unload(const SECircuitManager& src);
+  // Copies all node and path values from a manager with identical circuits, nodes and paths
+  // Nothing is copied, and false returned, if the topologies differ
+  static bool CopyState(const SECircuitManager& src, SECircuitManager& dst);
 protected:
   static void Serialize(const cdm::CircuitManagerData& src, SECircuitManager& dst);
   static void Serialize(const SECircuitManager& src, cdm::CircuitManagerData& dst);
 
 public:
   void SetReadOnly(bool b);  
+
+  // Incremented by every circuit of this manager when its values change in bulk
+  SECircuitEpoch& GetCircuitEpoch() { return m_Epoch; }
 protected:
+  SECircuitEpoch m_Epoch;
   
 
 public:
@@ -5,6 +5,7 @@
 PROTO_PUSH
 #include "bind/cdm/Circuit.pb.h"
 PROTO_POP
+#include "circuit/SECircuitEpoch.h"
 
 #define CIRCUIT_NODE_TEMPLATE typename PotentialScalar, typename QuantityScalar
 #define CIRCUIT_NODE_TYPES PotentialScalar,QuantityScalar
@@ -28,6 +29,9 @@ protected:
   static void Serialize(const SECircuitNode& src, cdm::CircuitNodeData& dst);
 
 public:
+  // Copies all values from the same node of a circuit with identical topology
+  static void CopyState(const SECircuitNode& src, SECircuitNode& dst);
+
   virtual std::string GetName() const;
 
   virtual bool HasPotential() const;
@@ -42,6 +42,16 @@ void SECircuitNode<CIRCUIT_NODE_TYPES>::Serialize(const SECircuitNode<CIRCUIT_NO
   dst.set_name(src.m_Name);
 }
 
+template<CIRCUIT_NODE_TEMPLATE>
+void SECircuitNode<CIRCUIT_NODE_TYPES>::CopyState(const SECircuitNode<CIRCUIT_NODE_TYPES>& src, SECircuitNode<CIRCUIT_NODE_TYPES>& dst)
+{
+  CopyScalar(src.m_Potential, dst.m_Potential);
+  CopyScalar(src.m_NextPotential, dst.m_NextPotential);
+  CopyScalar(src.m_Quantity, dst.m_Quantity);
+  CopyScalar(src.m_NextQuantity, dst.m_NextQuantity);
+  CopyScalar(src.m_QuantityBaseline, dst.m_QuantityBaseline);
+}
+
 template<CIRCUIT_NODE_TEMPLATE>
 std::string SECircuitNode<CIRCUIT_NODE_TYPES>::GetName() const
 {
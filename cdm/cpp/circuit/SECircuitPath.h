@@ -26,6 +26,9 @@ protected:
   static void Serialize(const SECircuitPath& src, cdm::CircuitPathData& dst);
 
 public:
+  // Copies all values from the same path of a circuit with identical topology
+  static void CopyState(const SECircuitPath& src, SECircuitPath& dst);
+
   virtual std::string GetName() const;
 
   virtual SECircuitNode<CIRCUIT_NODE_TYPES>& GetSourceNode() const;
@@ -113,6 +113,38 @@ void SECircuitPath<CIRCUIT_PATH_TYPES>::Serialize(const SECircuitPath<CIRCUIT_PA
     dst.set_nextpolarizedstate(src.m_NextPolarizedState);
 }
 
+template<CIRCUIT_PATH_TEMPLATE>
+void SECircuitPath<CIRCUIT_PATH_TYPES>::CopyState(const SECircuitPath<CIRCUIT_PATH_TYPES>& src, SECircuitPath<CIRCUIT_PATH_TYPES>& dst)
+{
+  dst.m_Switch = src.m_Switch;
+  dst.m_NextSwitch = src.m_NextSwitch;
+  dst.m_Valve = src.m_Valve;
+  dst.m_NextValve = src.m_NextValve;
+  dst.m_PolarizedState = src.m_PolarizedState;
+  dst.m_NextPolarizedState = src.m_NextPolarizedState;
+  dst.m_NumElements = src.m_NumElements;
+  dst.m_NumNextElements = src.m_NumNextElements;
+
+  CopyScalar(src.m_Resistance, dst.m_Resistance);
+  CopyScalar(src.m_NextResistance, dst.m_NextResistance);
+  CopyScalar(src.m_ResistanceBaseline, dst.m_ResistanceBaseline);
+  CopyScalar(src.m_Capacitance, dst.m_Capacitance);
+  CopyScalar(src.m_NextCapacitance, dst.m_NextCapacitance);
+  CopyScalar(src.m_CapacitanceBaseline, dst.m_CapacitanceBaseline);
+  CopyScalar(src.m_Inductance, dst.m_Inductance);
+  CopyScalar(src.m_NextInductance, dst.m_NextInductance);
+  CopyScalar(src.m_InductanceBaseline, dst.m_InductanceBaseline);
+  CopyScalar(src.m_Flux, dst.m_Flux);
+  CopyScalar(src.m_NextFlux, dst.m_NextFlux);
+  CopyScalar(src.m_FluxSource, dst.m_FluxSource);
+  CopyScalar(src.m_NextFluxSource, dst.m_NextFluxSource);
+  CopyScalar(src.m_FluxSourceBaseline, dst.m_FluxSourceBaseline);
+  CopyScalar(src.m_PotentialSource, dst.m_PotentialSource);
+  CopyScalar(src.m_NextPotentialSource, dst.m_NextPotentialSource);
+  CopyScalar(src.m_PotentialSourceBaseline, dst.m_PotentialSourceBaseline);
+  CopyScalar(src.m_ValveBreakdownPotential, dst.m_ValveBreakdownPotential);
+}
+
 template<CIRCUIT_PATH_TEMPLATE>
 std::string SECircuitPath<CIRCUIT_PATH_TYPES>::GetName() const
 {
@@ -5,7 +5,7 @@
 #include "circuit/fluid/SEFluidCircuit.h"
 #include "circuit/SECircuitManager.h"
 
-SEFluidCircuit::SEFluidCircuit(const std::string& name, SECircuitManager& mgr) : SECircuit<cdm::FluidCircuitData, SEFluidCircuitNode, cdm::FluidCircuitNodeData, SEFluidCircuitPath, cdm::FluidCircuitPathData>(name, mgr.GetLogger()), m_Mgr(mgr)
+SEFluidCircuit::SEFluidCircuit(const std::string& name, SECircuitManager& mgr) : SECircuit<cdm::FluidCircuitData, SEFluidCircuitNode, cdm::FluidCircuitNodeData, SEFluidCircuitPath, cdm::FluidCircuitPathData>(name, mgr.GetCircuitEpoch(), mgr.GetLogger()), m_Mgr(mgr)
 {
 
 }
@@ -20,6 +20,7 @@ PROTO_POP
 
 SECompartmentManager::SECompartmentManager(SESubstanceManager& subMgr) : Loggable(subMgr.GetLogger()), m_subMgr(subMgr)
 {
+  m_CircuitEpoch = nullptr;
   m_O2      = subMgr.GetSubstance("Oxygen");
   m_CO2     = subMgr.GetSubstance("CarbonDioxide");
   m_CO      = subMgr.GetSubstance("CarbonMonoxide");
@@ -102,6 +103,8 @@ void SECompartmentManager::Load(const cdm::CompartmentManagerData& src, SECompar
 void SECompartmentManager::Serialize(const cdm::CompartmentManagerData& src, SECompartmentManager& dst, SECircuitManager* circuits)
 {
   dst.Clear();
+  if (circuits != nullptr)
+    dst.m_CircuitEpoch = &circuits->GetCircuitEpoch();
 
   for (int i = 0; i<src.gascompartment_size(); i++) 
   { 
@@ -295,6 +298,61 @@ void SECompartmentManager::Serialize(const SECompartmentManager& src, cdm::Compa
  
 }
 
+namespace
+{
+  template<typename Type>
+  bool SameNames(const std::vector<Type*>& a, const std::vector<Type*>& b)
+  {
+    if (a.size() != b.size())
+      return false;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+      if (a[i]->GetName() != b[i]->GetName())
+        return false;
+    }
+    return true;
+  }
+  template<typename CompartmentType>
+  bool SameSubstanceQuantities(const std::vector<CompartmentType*>& a, const std::vector<CompartmentType*>& b)
+  {
+    for (size_t i = 0; i < a.size(); i++)
+    {
+      if (a[i]->GetSubstanceQuantities().size() != b[i]->GetSubstanceQuantities().size())
+        return false;
+    }
+    return true;
+  }
+}
+
+bool SECompartmentManager::CopyState(const SECompartmentManager& src, SECompartmentManager& dst)
+{
+  if (!SameNames(src.m_GasCompartments, dst.m_GasCompartments) || !SameNames(src.m_GasLinks, dst.m_GasLinks) ||
+      !SameNames(src.m_GasSubstances, dst.m_GasSubstances) || !SameSubstanceQuantities(src.m_GasCompartments, dst.m_GasCompartments) ||
+      !SameNames(src.m_LiquidCompartments, dst.m_LiquidCompartments) || !SameNames(src.m_LiquidLinks, dst.m_LiquidLinks) ||
+      !SameNames(src.m_LiquidSubstances, dst.m_LiquidSubstances) || !SameSubstanceQuantities(src.m_LiquidCompartments, dst.m_LiquidCompartments) ||
+      !SameNames(src.m_ThermalCompartments, dst.m_ThermalCompartments) || !SameNames(src.m_ThermalLinks, dst.m_ThermalLinks) ||
+      !SameNames(src.m_TissueCompartments, dst.m_TissueCompartments))
+    return false;
+
+  for (size_t i = 0; i < dst.m_GasCompartments.size(); i++)
+    SEGasCompartment::CopyState(*src.m_GasCompartments[i], *dst.m_GasCompartments[i]);
+  for (size_t i = 0; i < dst.m_GasLinks.size(); i++)
+    SEGasCompartmentLink::CopyState(*src.m_GasLinks[i], *dst.m_GasLinks[i]);
+  for (size_t i = 0; i < dst.m_LiquidCompartments.size(); i++)
+    SELiquidCompartment::CopyState(*src.m_LiquidCompartments[i], *dst.m_LiquidCompartments[i]);
+  for (size_t i = 0; i < dst.m_LiquidLinks.size(); i++)
+    SELiquidCompartmentLink::CopyState(*src.m_LiquidLinks[i], *dst.m_LiquidLinks[i]);
+  for (size_t i = 0; i < dst.m_ThermalCompartments.size(); i++)
+    SEThermalCompartment::CopyState(*src.m_ThermalCompartments[i], *dst.m_ThermalCompartments[i]);
+  for (size_t i = 0; i < dst.m_ThermalLinks.size(); i++)
+    SEThermalCompartmentLink::CopyState(*src.m_ThermalLinks[i], *dst.m_ThermalLinks[i]);
+  for (size_t i = 0; i < dst.m_TissueCompartments.size(); i++)
+    SETissueCompartment::CopyState(*src.m_TissueCompartments[i], *dst.m_TissueCompartments[i]);
+  if (dst.m_CircuitEpoch != nullptr)
+    dst.m_CircuitEpoch->Increment();// Compartment aggregates need to be recomputed from the new values
+  return true;
+}
+
 
 bool SECompartmentManager::HasCompartment(cdm::eCompartmentType type, const std::string& name) const
 {
@@ -348,7 +406,9 @@ const SECompartment* SECompartmentManager::GetCompartment(cdm::eCompartmentType
 
 SEGasCompartment& SECompartmentManager::CreateGasCompartment(const std::string& name)
 {
-  return CreateCompartment<SEGasCompartment>(name, m_GasName2Compartments, &m_GasSubstances);
+  SEGasCompartment& cmpt = CreateCompartment<SEGasCompartment>(name, m_GasName2Compartments, &m_GasSubstances);
+  cmpt.SetCircuitEpoch(m_CircuitEpoch);
+  return cmpt;
 }
 void SECompartmentManager::DeleteGasCompartment(const std::string& name)
 {
@@ -489,7 +549,9 @@ const std::vector<SESubstance*>& SECompartmentManager::GetGasCompartmentSubstanc
 
 SELiquidCompartment& SECompartmentManager::CreateLiquidCompartment(const std::string& name)
 {
-  return CreateCompartment<SELiquidCompartment>(name, m_LiquidName2Compartments, &m_LiquidSubstances);
+  SELiquidCompartment& cmpt = CreateCompartment<SELiquidCompartment>(name, m_LiquidName2Compartments, &m_LiquidSubstances);
+  cmpt.SetCircuitEpoch(m_CircuitEpoch);
+  return cmpt;
 }
 void SECompartmentManager::DeleteLiquidCompartment(const std::string& name)
 {
@@ -745,6 +807,15 @@ const std::vector<SETissueCompartment*>& SECompartmentManager::GetTissueLeafComp
 // General Utilities //
 ///////////////////////
 
+void SECompartmentManager::SetCircuitEpoch(SECircuitEpoch* epoch)
+{
+  m_CircuitEpoch = epoch;
+  for (auto itr : m_GasName2Compartments)
+    itr.second->SetCircuitEpoch(epoch);
+  for (auto itr : m_LiquidName2Compartments)
+    itr.second->SetCircuitEpoch(epoch);
+}
+
 void SECompartmentManager::StateChange()
 {
   // All of our Name 2 Compartment Maps are up to date
@@ -6,6 +6,7 @@
 class SESubstance;
 class SESubstanceManager;
 class SECircuitManager;
+class SECircuitEpoch;
 class SECompartment;
 class SEGasCompartment;
 class SEGasCompartmentLink;
@@ -33,11 +34,17 @@ public:
 
   static void Load(const cdm::CompartmentManagerData& src, SECompartmentManager& dst, SECircuitManager* circuits = nullptr);
   static cdm::CompartmentManagerData* Unload(const SECompartmentManager& src);
+  // Copies all compartment, link and substance quantity values from a manager with identical compartments
+  // Nothing is copied, and false returned, if the compartments, links or substances differ
+  static bool CopyState(const SECompartmentManager& src, SECompartmentManager& dst);
 protected:
   static void Serialize(const cdm::CompartmentManagerData& src, SECompartmentManager& dst, SECircuitManager* circuits = nullptr);
   static void Serialize(const SECompartmentManager& src, cdm::CompartmentManagerData& dst);
 
 public:
+  // The epoch of the circuit manager our compartments are mapped to, fluid compartments cache their aggregates against it
+  // Loading with a circuit manager sets it to that manager's epoch
+  virtual void                                                SetCircuitEpoch(SECircuitEpoch* epoch);
   virtual void                                                StateChange();// Identify leaves and other bookkeeping
   virtual void                                                UpdateLinks();
   virtual void                                                UpdateLinks(SEGasCompartmentGraph& graph);
@@ -195,4 +202,5 @@ protected:
   SESubstance* m_HbO2CO2;
   SESubstance* m_HbCO;
   SESubstanceManager& m_subMgr;
+  SECircuitEpoch*     m_CircuitEpoch;
 };
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "compartment/SECompartment.h"
 #include "circuit/fluid/SEFluidCircuitNode.h"
 #include "compartment/SECompartmentNodes.h"
+#include "circuit/SECircuitEpoch.h"
 #include "substance/SESubstanceTransport.h"
 PROTO_PUSH
 #include "bind/cdm/Compartment.pb.h"
@@ -30,6 +31,8 @@ public:
 protected:
   static void Serialize(const cdm::FluidCompartmentData& src, SEFluidCompartment& dst, SECircuitManager* circuits=nullptr);
   static void Serialize(const SEFluidCompartment& src, cdm::FluidCompartmentData& dst);
+  // Copies the values this compartment holds itself, from the same compartment of an identical manager
+  static void CopyState(const SEFluidCompartment& src, SEFluidCompartment& dst);
 
 public:
   virtual std::string GetName() const { return m_Name; }
@@ -42,6 +45,10 @@ public:
   virtual  SECompartmentNodes<FLUID_COMPARTMENT_NODE>& GetNodeMapping() { return m_Nodes; }
   virtual void MapNode(SEFluidCircuitNode& node);
 
+  // Aggregated values (parent volume/pressure, in/out flow) are cached until this epoch changes
+  // Without an epoch, nothing is cached
+  virtual void SetCircuitEpoch(SECircuitEpoch* epoch);
+
   virtual bool HasInFlow() const;
   virtual const SEScalarVolumePerTime& GetInFlow() const;
   virtual double GetInFlow(const VolumePerTimeUnit& unit) const;
@@ -79,6 +86,23 @@ protected:
 
   virtual double CalculateInFlow_mL_Per_s() const;
   virtual double CalculateOutFlow_mL_Per_s() const;
+  virtual double SumInFlow_mL_Per_s(bool& fromCircuit) const;
+  virtual double SumOutFlow_mL_Per_s(bool& fromCircuit) const;
+  virtual double CalculateChildrenPressure(const PressureUnit& unit) const;
+
+  struct AggregateCache
+  {
+    bool        valid = false;
+    uint64_t    epoch = 0;
+    const void* unit = nullptr;
+    double      value = 0;
+  };
+  // Returns the cached value if it was calculated in the current epoch, for the same unit
+  // Otherwise calls calculate, which sets its argument to true if the result only depends on circuit values
+  template<typename Calculate>
+  double GetCached(AggregateCache& cache, const void* unit, Calculate calculate) const;
+  virtual void ClearCaches();
+  virtual void InvalidateCaches();// Clears our caches and increments the epoch
 
   virtual std::vector<TransportSubstanceType*>& GetTransportSubstances() { return m_TransportSubstances; }
 
@@ -95,5 +119,19 @@ protected:
   std::vector<LinkType*> m_OutgoingLinks;
   std::vector<SEFluidCompartment*> m_FluidChildren;
   SECompartmentNodes<FLUID_COMPARTMENT_NODE>  m_Nodes;
+
+  // Values aggregated from children/links are cached until the circuit epoch changes
+  // Only the circuit calculator (and anything directly modifying node/path values) increments the epoch,
+  // so values are only cached when they come from mapped nodes and paths.
+  // Caches are written from const methods that run concurrently on scheduler threads, hence the mutex
+  SECircuitEpoch*        m_CircuitEpoch;
+  bool                   m_CacheAggregates;// All our leaves are mapped to nodes, set in StateChange
+  mutable std::mutex     m_CacheMutex;
+  mutable AggregateCache m_HasPressureCache;
+  mutable AggregateCache m_PressureCache;
+  mutable AggregateCache m_HasVolumeCache;
+  mutable AggregateCache m_VolumeCache;
+  mutable AggregateCache m_InFlowCache;
+  mutable AggregateCache m_OutFlowCache;
 };
 #include "compartment/fluid/SEFluidCompartment.inl"
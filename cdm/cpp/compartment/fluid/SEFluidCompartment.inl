@@ -16,6 +16,9 @@ SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::SEFluidCompartment(const std::strin
   m_OutFlow = nullptr;
   m_Pressure = nullptr;
   m_Volume = nullptr;
+
+  m_CircuitEpoch = nullptr;
+  m_CacheAggregates = false;
 }
 template<FLUID_COMPARTMENT_TEMPLATE>
 SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::~SEFluidCompartment()
@@ -35,12 +38,15 @@ void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::Clear()
   m_FluidChildren.clear();
   DELETE_VECTOR(m_SubstanceQuantities);
   m_Nodes.Clear();
+  m_CacheAggregates = false;
+  ClearCaches();// Our epoch may already be gone when clearing on destruction, so just forget what we have
 }
 
 template<FLUID_COMPARTMENT_TEMPLATE>
 void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::Serialize(const cdm::FluidCompartmentData& src, SEFluidCompartment& dst, SECircuitManager* circuits)
 {
   SECompartment::Serialize(src.compartment(), dst);
+  dst.InvalidateCaches();
   // This compartment has children
   // We will not load any data as those are calculated on demand based on children
   if (src.compartment().child_size()>0)
@@ -96,6 +102,16 @@ void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::Serialize(const SEFluidCompart
   }
 
 
+template<FLUID_COMPARTMENT_TEMPLATE>
+void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::CopyState(const SEFluidCompartment& src, SEFluidCompartment& dst)
+{
+  // Just like Serialize, children and nodes hold the data of compartments that have them
+  if (dst.HasChildren() || dst.m_Nodes.HasMapping())
+    return;
+  CopyScalar(src.m_Pressure, dst.m_Pressure);
+  CopyScalar(src.m_Volume, dst.m_Volume);
+}
+
 template<FLUID_COMPARTMENT_TEMPLATE>
 const SEScalar* SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetScalar(const std::string& name)
 {
@@ -116,7 +132,63 @@ void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::MapNode(SEFluidCircuitNode& no
   if (HasChildren())
     Fatal("You cannot map nodes to compartments with children.");
   else
+  {
     m_Nodes.MapNode(node);
+    InvalidateCaches();
+  }
+}
+
+template<FLUID_COMPARTMENT_TEMPLATE>
+void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::SetCircuitEpoch(SECircuitEpoch* epoch)
+{
+  m_CircuitEpoch = epoch;
+  InvalidateCaches();
+}
+
+template<FLUID_COMPARTMENT_TEMPLATE>
+void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::ClearCaches()
+{
+  std::lock_guard<std::mutex> lock(m_CacheMutex);
+  m_HasPressureCache = AggregateCache();
+  m_PressureCache = AggregateCache();
+  m_HasVolumeCache = AggregateCache();
+  m_VolumeCache = AggregateCache();
+  m_InFlowCache = AggregateCache();
+  m_OutFlowCache = AggregateCache();
+}
+template<FLUID_COMPARTMENT_TEMPLATE>
+void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::InvalidateCaches()
+{
+  ClearCaches();
+  // Our parents aggregate us, so they need to recompute too
+  if (m_CircuitEpoch != nullptr)
+    m_CircuitEpoch->Increment();
+}
+
+template<FLUID_COMPARTMENT_TEMPLATE>
+template<typename Calculate>
+double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetCached(AggregateCache& cache, const void* unit, Calculate calculate) const
+{
+  bool cacheable = false;
+  if (m_CircuitEpoch == nullptr)
+    return calculate(cacheable);
+  uint64_t epoch = m_CircuitEpoch->Get();
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    if (cache.valid && cache.epoch == epoch && cache.unit == unit)
+      return cache.value;
+  }
+  // Calculate without holding the lock, the calculation can read our other cached values
+  double value = calculate(cacheable);
+  if (cacheable)
+  {
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+    cache.valid = true;
+    cache.epoch = epoch;
+    cache.unit = unit;
+    cache.value = value;
+  }
+  return value;
 }
 
 template<FLUID_COMPARTMENT_TEMPLATE>
@@ -183,22 +255,34 @@ double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetOutFlow(const VolumePerTi
 
 template<FLUID_COMPARTMENT_TEMPLATE>
 double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::CalculateInFlow_mL_Per_s() const
+{
+  return GetCached(m_InFlowCache, nullptr, [this](bool& cacheable) { return SumInFlow_mL_Per_s(cacheable); });
+}
+template<FLUID_COMPARTMENT_TEMPLATE>
+double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::SumInFlow_mL_Per_s(bool& fromCircuit) const
 {
   double flow_mL_Per_s = 0;
+  fromCircuit = true;
 
-  SEScalarVolumePerTime* f;
+  double f;
   for (auto* link : m_IncomingLinks)
   {
     // Positive flow on an incoming path, is flow into the compartment
-    f = &link->GetFlow();
-    if (f->IsPositive() || f->IsZero())
-      flow_mL_Per_s += f->GetValue(VolumePerTimeUnit::mL_Per_s);
+    fromCircuit &= link->HasPath();
+    if (!link->HasFlow())
+      continue;
+    f = link->GetFlow(VolumePerTimeUnit::mL_Per_s);
+    if (f > 0 || SEScalar::IsZero(f, ZERO_APPROX))
+      flow_mL_Per_s += f;
   }
   for (auto* link : m_OutgoingLinks)
   {// Negative flow on an outgoing path, is flow into the compartment
-    f = &link->GetFlow();
-    if (f->IsNegative() || f->IsZero())
-      flow_mL_Per_s += -f->GetValue(VolumePerTimeUnit::mL_Per_s);
+    fromCircuit &= link->HasPath();
+    if (!link->HasFlow())
+      continue;
+    f = link->GetFlow(VolumePerTimeUnit::mL_Per_s);
+    if (f < 0 || SEScalar::IsZero(f, ZERO_APPROX))
+      flow_mL_Per_s += -f;
 
   }
   if (flow_mL_Per_s < 0)
@@ -208,22 +292,34 @@ double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::CalculateInFlow_mL_Per_s() c
 
 template<FLUID_COMPARTMENT_TEMPLATE>
 double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::CalculateOutFlow_mL_Per_s() const
+{
+  return GetCached(m_OutFlowCache, nullptr, [this](bool& cacheable) { return SumOutFlow_mL_Per_s(cacheable); });
+}
+template<FLUID_COMPARTMENT_TEMPLATE>
+double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::SumOutFlow_mL_Per_s(bool& fromCircuit) const
 {
   double flow_mL_Per_s = 0;
+  fromCircuit = true;
 
-  SEScalarVolumePerTime* f;
+  double f;
   for (auto* link : m_IncomingLinks)
   {
     // Negative flow on an incoming path, is flow out of the compartment
-    f = &link->GetFlow();
-    if (f->IsNegative() || f->IsZero())
-      flow_mL_Per_s += -f->GetValue(VolumePerTimeUnit::mL_Per_s);
+    fromCircuit &= link->HasPath();
+    if (!link->HasFlow())
+      continue;
+    f = link->GetFlow(VolumePerTimeUnit::mL_Per_s);
+    if (f < 0 || SEScalar::IsZero(f, ZERO_APPROX))
+      flow_mL_Per_s += -f;
   }
   for (auto* link : m_OutgoingLinks)
   {// Positive flow on an outgoing path, is flow out of the compartment
-    f = &link->GetFlow();
-    if (f->IsPositive() || f->IsZero())
-      flow_mL_Per_s += f->GetValue(VolumePerTimeUnit::mL_Per_s);
+    fromCircuit &= link->HasPath();
+    if (!link->HasFlow())
+      continue;
+    f = link->GetFlow(VolumePerTimeUnit::mL_Per_s);
+    if (f > 0 || SEScalar::IsZero(f, ZERO_APPROX))
+      flow_mL_Per_s += f;
   }
   if (flow_mL_Per_s < 0)
     flow_mL_Per_s = 0;// This number is something like x.e-12, which we treat as 0
@@ -237,10 +333,14 @@ bool SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::HasPressure() const
     return m_Nodes.HasPotential();
   if (!m_FluidChildren.empty())
   {
-    for (auto* child : m_FluidChildren)
-      if (child->HasPressure())
-        return true;
-    return false;
+    return GetCached(m_HasPressureCache, nullptr, [this](bool& cacheable)
+    {
+      cacheable = m_CacheAggregates;
+      for (auto* child : m_FluidChildren)
+        if (child->HasPressure())
+          return 1.0;
+      return 0.0;
+    }) != 0;
   }
   return m_Pressure == nullptr ? false : m_Pressure->IsValid();
 }
@@ -279,37 +379,46 @@ double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetPressure(const PressureUn
     return m_Nodes.GetPotential(unit);
   if (!m_FluidChildren.empty())
   {
-    double Pressure = 0;
-    if (HasVolume())
+    return GetCached(m_PressureCache, &unit, [this, &unit](bool& cacheable)
     {
-      double totalVolume_mL = GetVolume(VolumeUnit::mL);
-      for (SEFluidCompartment* child : m_FluidChildren)
+      cacheable = m_CacheAggregates;
+      return CalculateChildrenPressure(unit);
+    });
+  }
+  if (m_Pressure == nullptr)
+    return SEScalar::dNaN();
+  return m_Pressure->GetValue(unit);
+}
+template<FLUID_COMPARTMENT_TEMPLATE>
+double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::CalculateChildrenPressure(const PressureUnit& unit) const
+{
+  double Pressure = 0;
+  if (HasVolume())
+  {
+    double totalVolume_mL = GetVolume(VolumeUnit::mL);
+    for (SEFluidCompartment* child : m_FluidChildren)
+    {
+      if (child->HasPressure() && child->HasVolume())
       {
-        if (child->HasPressure() && child->HasVolume())
-        {
-          Pressure += child->GetPressure(unit) * (child->GetVolume(VolumeUnit::mL) / totalVolume_mL);
-        }
+        Pressure += child->GetPressure(unit) * (child->GetVolume(VolumeUnit::mL) / totalVolume_mL);
       }
-      return Pressure;
     }
-    else
+    return Pressure;
+  }
+  else
+  {
+    int numHas = 0;
+    for (SEFluidCompartment* child : m_FluidChildren)
     {
-      int numHas = 0;
-      for (SEFluidCompartment* child : m_FluidChildren)
+      if (child->HasPressure())
       {
-        if (child->HasPressure())
-        {
-          numHas++;
-          Pressure += child->GetPressure(unit);
-        }
-        Pressure /= numHas;
+        numHas++;
+        Pressure += child->GetPressure(unit);
       }
-      return Pressure;
+      Pressure /= numHas;
     }
+    return Pressure;
   }
-  if (m_Pressure == nullptr)
-    return SEScalar::dNaN();
-  return m_Pressure->GetValue(unit);
 }
 
 template<FLUID_COMPARTMENT_TEMPLATE>
@@ -319,10 +428,14 @@ bool SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::HasVolume() const
     return m_Nodes.HasQuantity();
   if (!m_FluidChildren.empty())
   {
-    for (auto* child : m_FluidChildren)
-      if (child->HasVolume())
-        return true;
-    return false;
+    return GetCached(m_HasVolumeCache, nullptr, [this](bool& cacheable)
+    {
+      cacheable = m_CacheAggregates;
+      for (auto* child : m_FluidChildren)
+        if (child->HasVolume())
+          return 1.0;
+      return 0.0;
+    }) != 0;
   }
   return m_Volume == nullptr ? false : m_Volume->IsValid();
 }
@@ -337,9 +450,8 @@ SEScalarVolume& SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetVolume()
   {
     m_Volume->SetReadOnly(false);
     m_Volume->Invalidate();
-    for (SEFluidCompartment* child : m_FluidChildren)
-      if (child->HasVolume())
-        m_Volume->Increment(child->GetVolume());
+    if (HasVolume())
+      m_Volume->SetValue(GetVolume(VolumeUnit::mL), VolumeUnit::mL);
     m_Volume->SetReadOnly(true);
   }
   return *m_Volume;
@@ -351,11 +463,15 @@ double SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetVolume(const VolumeUnit&
     return m_Nodes.GetQuantity(unit);
   if (!m_FluidChildren.empty())
   {
-    double volume = 0;
-    for (SEFluidCompartment* child : m_FluidChildren)
-      if (child->HasVolume())
-        volume += child->GetVolume(unit);
-    return volume;
+    return GetCached(m_VolumeCache, &unit, [this, &unit](bool& cacheable)
+    {
+      cacheable = m_CacheAggregates;
+      double volume = 0;
+      for (SEFluidCompartment* child : m_FluidChildren)
+        if (child->HasVolume())
+          volume += child->GetVolume(unit);
+      return volume;
+    });
   }
   if (m_Volume == nullptr)
     return SEScalar::dNaN();
@@ -428,17 +544,20 @@ void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::AddLink(LinkType& link)
       m_OutgoingLinks.push_back(&link);
     else if (this == &link.GetTargetCompartment())
       m_IncomingLinks.push_back(&link);
+    InvalidateCaches();
   }
 }
 template<FLUID_COMPARTMENT_TEMPLATE>
 void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::RemoveLink(LinkType& link)
 {
   Remove(m_Links, &link);
+  InvalidateCaches();
 }
 template<FLUID_COMPARTMENT_TEMPLATE>
 void SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::RemoveLinks()
 {
   m_Links.clear();
+  InvalidateCaches();
 }
 template<FLUID_COMPARTMENT_TEMPLATE>
 const std::vector<LinkType*>& SEFluidCompartment<FLUID_COMPARTMENT_TYPES>::GetLinks()
@@ -25,6 +25,9 @@ protected:
   static void Serialize(const SEFluidCompartmentLink& src, cdm::FluidCompartmentLinkData& dst);
   
 public:
+  // Copies the flow of an unmapped link from the same link of an identical manager
+  static void CopyState(const SEFluidCompartmentLink& src, SEFluidCompartmentLink& dst);
+
   virtual const SEScalar* GetScalar(const std::string& name);
 
   virtual std::string GetName() const { return m_Name; }
@@ -62,6 +62,13 @@ void SEFluidCompartmentLink<FLUID_COMPARTMENT_LINK_TYPES>::Serialize(const SEFlu
     dst.set_allocated_flow(SEScalarVolumePerTime::Unload(mutable_src.GetFlow()));
 }
 
+template<FLUID_COMPARTMENT_LINK_TEMPLATE>
+void SEFluidCompartmentLink<FLUID_COMPARTMENT_LINK_TYPES>::CopyState(const SEFluidCompartmentLink& src, SEFluidCompartmentLink& dst)
+{
+  if (dst.m_Path == nullptr)
+    CopyScalar(src.m_Flow, dst.m_Flow);
+}
+
 template<FLUID_COMPARTMENT_LINK_TEMPLATE>
 void SEFluidCompartmentLink<FLUID_COMPARTMENT_LINK_TYPES>::Clear()
 {
@@ -56,11 +56,22 @@ void SEGasCompartment::Serialize(const SEGasCompartment& src, cdm::GasCompartmen
     dst.mutable_substancequantity()->AddAllocated(SEGasSubstanceQuantity::Unload(*subQ));
 }
 
+void SEGasCompartment::CopyState(const SEGasCompartment& src, SEGasCompartment& dst)
+{
+  SEFluidCompartment::CopyState(src, dst);
+  for (size_t i = 0; i < dst.m_SubstanceQuantities.size(); i++)
+    SEGasSubstanceQuantity::CopyState(*src.m_SubstanceQuantities[i], *dst.m_SubstanceQuantities[i]);
+}
+
 void SEGasCompartment::StateChange()
 {
   m_Leaves.clear();
   FindLeaves<SEGasCompartment>(*this, m_Leaves);
   m_Nodes.StateChange();
+  // Our aggregates can only be cached if all of their values come from circuit nodes
+  m_CacheAggregates = HasChildren();
+  for (SEGasCompartment* leaf : m_Leaves)
+    m_CacheAggregates &= leaf->HasNodeMapping();
 }
 
 void SEGasCompartment::Balance(BalanceGasBy by)
@@ -151,6 +162,8 @@ void SEGasCompartment::AddChild(SEGasCompartment& child)
     return;
   m_FluidChildren.push_back(&child);
   m_Children.push_back(&child);
+  m_CacheAggregates = false;// Until StateChange finds our new leaves
+  InvalidateCaches();
   for (SEGasSubstanceQuantity* subQ : m_SubstanceQuantities)
     subQ->AddChild(child.CreateSubstanceQuantity(subQ->GetSubstance()));
 }
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::GasCompartmentData& src, SEGasCompartment& dst, SESubstanceManager& subMgr, SECircuitManager* circuits = nullptr);
   static cdm::GasCompartmentData* Unload(const SEGasCompartment& src);
+  static void CopyState(const SEGasCompartment& src, SEGasCompartment& dst);
 protected:
   static void Serialize(const cdm::GasCompartmentData& src, SEGasCompartment& dst, SESubstanceManager& subMgr, SECircuitManager* circuits = nullptr);
   static void Serialize(const SEGasCompartment& src, cdm::GasCompartmentData& dst);
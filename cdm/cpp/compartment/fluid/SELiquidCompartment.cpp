@@ -77,6 +77,15 @@ void SELiquidCompartment::Serialize(const SELiquidCompartment& src, cdm::LiquidC
     dst.set_allocated_watervolumefraction(SEScalar0To1::Unload(*src.m_WaterVolumeFraction));
 }
 
+void SELiquidCompartment::CopyState(const SELiquidCompartment& src, SELiquidCompartment& dst)
+{
+  SEFluidCompartment::CopyState(src, dst);
+  for (size_t i = 0; i < dst.m_SubstanceQuantities.size(); i++)
+    SELiquidSubstanceQuantity::CopyState(*src.m_SubstanceQuantities[i], *dst.m_SubstanceQuantities[i]);
+  CopyScalar(src.m_pH, dst.m_pH);
+  CopyScalar(src.m_WaterVolumeFraction, dst.m_WaterVolumeFraction);
+}
+
 const SEScalar* SELiquidCompartment::GetScalar(const std::string& name)
 {
   const SEScalar* s = SEFluidCompartment::GetScalar(name);
@@ -94,6 +103,10 @@ void SELiquidCompartment::StateChange()
   m_Leaves.clear();
   FindLeaves<SELiquidCompartment>(*this, m_Leaves);
   m_Nodes.StateChange();
+  // Our aggregates can only be cached if all of their values come from circuit nodes
+  m_CacheAggregates = HasChildren();
+  for (SELiquidCompartment* leaf : m_Leaves)
+    m_CacheAggregates &= leaf->HasNodeMapping();
 }
 
 void SELiquidCompartment::Balance(BalanceLiquidBy by)
@@ -181,6 +194,8 @@ void SELiquidCompartment::AddChild(SELiquidCompartment& child)
     return;
   m_FluidChildren.push_back(&child);
   m_Children.push_back(&child);
+  m_CacheAggregates = false;// Until StateChange finds our new leaves
+  InvalidateCaches();
   for (SELiquidSubstanceQuantity* subQ : m_SubstanceQuantities)
     subQ->AddChild(child.CreateSubstanceQuantity(subQ->GetSubstance()));
 }
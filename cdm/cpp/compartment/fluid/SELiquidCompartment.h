@@ -22,6 +22,7 @@ public:
 
   static void Load(const cdm::LiquidCompartmentData& src, SELiquidCompartment& dst, SESubstanceManager& subMgr, SECircuitManager* circuits = nullptr);
   static cdm::LiquidCompartmentData* Unload(const SELiquidCompartment& src);
+  static void CopyState(const SELiquidCompartment& src, SELiquidCompartment& dst);
 protected:
   static void Serialize(const cdm::LiquidCompartmentData& src, SELiquidCompartment& dst, SESubstanceManager& subMgr, SECircuitManager* circuits = nullptr);
   static void Serialize(const SELiquidCompartment& src, cdm::LiquidCompartmentData& dst);
@@ -66,6 +66,15 @@ void SEGasSubstanceQuantity::Serialize(const cdm::GasSubstanceQuantityData& src,
   }
 }
 
+void SEGasSubstanceQuantity::CopyState(const SEGasSubstanceQuantity& src, SEGasSubstanceQuantity& dst)
+{
+  if (dst.m_Compartment.HasChildren())
+    return;
+  CopyScalar(src.m_PartialPressure, dst.m_PartialPressure);
+  CopyScalar(src.m_Volume, dst.m_Volume);
+  CopyScalar(src.m_VolumeFraction, dst.m_VolumeFraction);
+}
+
 cdm::GasSubstanceQuantityData* SEGasSubstanceQuantity::Unload(const SEGasSubstanceQuantity& src)
 {
   cdm::GasSubstanceQuantityData* dst = new cdm::GasSubstanceQuantityData();
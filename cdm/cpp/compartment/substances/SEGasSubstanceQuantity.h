@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::GasSubstanceQuantityData& src, SEGasSubstanceQuantity& dst);
   static cdm::GasSubstanceQuantityData* Unload(const SEGasSubstanceQuantity& src);
+  static void CopyState(const SEGasSubstanceQuantity& src, SEGasSubstanceQuantity& dst);
 protected:
   static void Serialize(const cdm::GasSubstanceQuantityData& src, SEGasSubstanceQuantity& dst);
   static void Serialize(const SEGasSubstanceQuantity& src, cdm::GasSubstanceQuantityData& dst);
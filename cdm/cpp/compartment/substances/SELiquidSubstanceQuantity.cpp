@@ -114,6 +114,20 @@ void SELiquidSubstanceQuantity::Serialize(const cdm::LiquidSubstanceQuantityData
   }
 }
 
+void SELiquidSubstanceQuantity::CopyState(const SELiquidSubstanceQuantity& src, SELiquidSubstanceQuantity& dst)
+{
+  if (dst.m_Compartment.HasChildren())
+    return;
+  CopyScalar(src.m_Concentration, dst.m_Concentration);
+  CopyScalar(src.m_Mass, dst.m_Mass);
+  CopyScalar(src.m_MassCleared, dst.m_MassCleared);
+  CopyScalar(src.m_MassDeposited, dst.m_MassDeposited);
+  CopyScalar(src.m_MassExcreted, dst.m_MassExcreted);
+  CopyScalar(src.m_Molarity, dst.m_Molarity);
+  CopyScalar(src.m_PartialPressure, dst.m_PartialPressure);
+  CopyScalar(src.m_Saturation, dst.m_Saturation);
+}
+
 cdm::LiquidSubstanceQuantityData* SELiquidSubstanceQuantity::Unload(const SELiquidSubstanceQuantity& src)
 {
   cdm::LiquidSubstanceQuantityData* dst = new cdm::LiquidSubstanceQuantityData();
@@ -22,6 +22,7 @@ public:
 
   static void Load(const cdm::LiquidSubstanceQuantityData& src, SELiquidSubstanceQuantity& dst);
   static cdm::LiquidSubstanceQuantityData* Unload(const SELiquidSubstanceQuantity& src);
+  static void CopyState(const SELiquidSubstanceQuantity& src, SELiquidSubstanceQuantity& dst);
 protected:
   static void Serialize(const cdm::LiquidSubstanceQuantityData& src, SELiquidSubstanceQuantity& dst);
   static void Serialize(const SELiquidSubstanceQuantity& src, cdm::LiquidSubstanceQuantityData& dst);
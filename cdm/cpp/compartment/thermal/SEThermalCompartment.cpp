@@ -76,6 +76,14 @@ void SEThermalCompartment::Serialize(const cdm::ThermalCompartmentData& src, SET
   }
 }
 
+void SEThermalCompartment::CopyState(const SEThermalCompartment& src, SEThermalCompartment& dst)
+{
+  if (dst.HasChildren() || dst.m_Nodes.HasMapping())
+    return;
+  CopyScalar(src.m_Heat, dst.m_Heat);
+  CopyScalar(src.m_Temperature, dst.m_Temperature);
+}
+
 cdm::ThermalCompartmentData* SEThermalCompartment::Unload(const SEThermalCompartment& src)
 {
   cdm::ThermalCompartmentData* dst = new cdm::ThermalCompartmentData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::ThermalCompartmentData& src, SEThermalCompartment& dst, SECircuitManager* circuits=nullptr);
   static cdm::ThermalCompartmentData* Unload(const SEThermalCompartment& src);
+  static void CopyState(const SEThermalCompartment& src, SEThermalCompartment& dst);
 protected:
   static void Serialize(const cdm::ThermalCompartmentData& src, SEThermalCompartment& dst, SECircuitManager* circuits = nullptr);
   static void Serialize(const SEThermalCompartment& src, cdm::ThermalCompartmentData& dst);
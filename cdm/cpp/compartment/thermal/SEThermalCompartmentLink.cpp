@@ -49,6 +49,12 @@ void SEThermalCompartmentLink::Serialize(const cdm::ThermalCompartmentLinkData&
   }  
 }
 
+void SEThermalCompartmentLink::CopyState(const SEThermalCompartmentLink& src, SEThermalCompartmentLink& dst)
+{
+  if (dst.m_Path == nullptr)
+    CopyScalar(src.m_HeatTransferRate, dst.m_HeatTransferRate);
+}
+
 cdm::ThermalCompartmentLinkData* SEThermalCompartmentLink::Unload(const SEThermalCompartmentLink& src)
 {
   cdm::ThermalCompartmentLinkData* dst = new cdm::ThermalCompartmentLinkData();
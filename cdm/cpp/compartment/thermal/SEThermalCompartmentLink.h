@@ -20,6 +20,7 @@ public:
   
   static void Load(const cdm::ThermalCompartmentLinkData& src, SEThermalCompartmentLink& dst, SECircuitManager* circuits=nullptr);
   static cdm::ThermalCompartmentLinkData* Unload(const SEThermalCompartmentLink& src);
+  static void CopyState(const SEThermalCompartmentLink& src, SEThermalCompartmentLink& dst);
 protected:
   static void Serialize(const cdm::ThermalCompartmentLinkData& src, SEThermalCompartmentLink& dst, SECircuitManager* circuits = nullptr);
   static void Serialize(const SEThermalCompartmentLink& src, cdm::ThermalCompartmentLinkData& dst);
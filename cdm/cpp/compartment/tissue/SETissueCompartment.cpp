@@ -71,6 +71,18 @@ void SETissueCompartment::Serialize(const cdm::TissueCompartmentData& src, SETis
     SEScalarMass::Load(src.totalmass(), dst.GetTotalMass());
 }
 
+void SETissueCompartment::CopyState(const SETissueCompartment& src, SETissueCompartment& dst)
+{
+  CopyScalar(src.m_AcidicPhospohlipidConcentration, dst.m_AcidicPhospohlipidConcentration);
+  CopyScalar(src.m_MatrixVolume, dst.m_MatrixVolume);
+  CopyScalar(src.m_NeutralLipidsVolumeFraction, dst.m_NeutralLipidsVolumeFraction);
+  CopyScalar(src.m_NeutralPhospholipidsVolumeFraction, dst.m_NeutralPhospholipidsVolumeFraction);
+  CopyScalar(src.m_TissueToPlasmaAlbuminRatio, dst.m_TissueToPlasmaAlbuminRatio);
+  CopyScalar(src.m_TissueToPlasmaAlphaAcidGlycoproteinRatio, dst.m_TissueToPlasmaAlphaAcidGlycoproteinRatio);
+  CopyScalar(src.m_TissueToPlasmaLipoproteinRatio, dst.m_TissueToPlasmaLipoproteinRatio);
+  CopyScalar(src.m_TotalMass, dst.m_TotalMass);
+}
+
 cdm::TissueCompartmentData* SETissueCompartment::Unload(const SETissueCompartment& src)
 {
   cdm::TissueCompartmentData* dst = new cdm::TissueCompartmentData();
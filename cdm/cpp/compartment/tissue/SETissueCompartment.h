@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::TissueCompartmentData& src, SETissueCompartment& dst);
   static cdm::TissueCompartmentData* Unload(const SETissueCompartment& src);
+  static void CopyState(const SETissueCompartment& src, SETissueCompartment& dst);
 protected:
   static void Serialize(const cdm::TissueCompartmentData& src, SETissueCompartment& dst);
   static void Serialize(const SETissueCompartment& src, cdm::TissueCompartmentData& dst);
@@ -65,6 +65,16 @@ void SEAutoSerialization::Serialize(const cdm::AutoSerializationData& src, SEAut
   dst.SetFileName(src.filename());
 }
 
+void SEAutoSerialization::Copy(const SEAutoSerialization& src, SEAutoSerialization& dst)
+{
+  CopyScalar(src.m_Period, dst.m_Period);
+  dst.m_PeriodTimeStamps = src.m_PeriodTimeStamps;
+  dst.m_AfterActions = src.m_AfterActions;
+  dst.m_ReloadState = src.m_ReloadState;
+  dst.m_Directory = src.m_Directory;
+  dst.m_FileName = src.m_FileName;
+}
+
 cdm::AutoSerializationData* SEAutoSerialization::Unload(const SEAutoSerialization& src)
 {
   cdm::AutoSerializationData *dst = new cdm::AutoSerializationData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::AutoSerializationData& src, SEAutoSerialization& dst);
   static cdm::AutoSerializationData* Unload(const SEAutoSerialization& src);
+  static void Copy(const SEAutoSerialization& src, SEAutoSerialization& dst);
 protected:
   static void Serialize(const cdm::AutoSerializationData& src, SEAutoSerialization& dst);
   static void Serialize(const SEAutoSerialization& src, cdm::AutoSerializationData& dst);
@@ -0,0 +1,190 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "engine/SEEngineProfiler.h"
+#include "utils/FileUtils.h"
+#include <fstream>
+#include <iomanip>
+
+namespace
+{
+  std::string EscapeJSON(const std::string& s)
+  {
+    std::string escaped;
+    for (char c : s)
+    {
+      if (c == '"' || c == '\\')
+        escaped += '\\';
+      escaped += c;
+    }
+    return escaped;
+  }
+
+  bool WriteText(const std::string& filename, const std::string& text)
+  {
+    CreateFilePath(filename);
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
+    if (!file.is_open())
+      return false;
+    file << text;
+    return file.good();
+  }
+}
+
+SEEngineProfiler::SEEngineProfiler(Logger* logger) : Loggable(logger)
+{
+  m_Enabled = false;
+}
+
+SEEngineProfiler::~SEEngineProfiler()
+{
+  Clear();
+}
+
+void SEEngineProfiler::Clear()
+{
+  m_Slots.clear();
+}
+
+void SEEngineProfiler::Reset()
+{
+  for (Slot& s : m_Slots)
+  {
+    s.count = 0;
+    s.total_s = 0;
+    s.min_s = 0;
+    s.max_s = 0;
+    s.iterations = 0;
+    for (size_t& bin : s.histogram)
+      bin = 0;
+  }
+}
+
+size_t SEEngineProfiler::RegisterSlot(const std::string& category, const std::string& name)
+{
+  for (size_t i = 0; i < m_Slots.size(); i++)
+  {
+    if (m_Slots[i].category == category && m_Slots[i].name == name)
+      return i;
+  }
+  Slot s = Slot();// Zeroed statistics
+  s.category = category;
+  s.name = name;
+  m_Slots.push_back(s);
+  return m_Slots.size() - 1;
+}
+
+const SEEngineProfiler::Slot* SEEngineProfiler::GetSlot(const std::string& category, const std::string& name) const
+{
+  for (const Slot& s : m_Slots)
+  {
+    if (s.category == category && s.name == name)
+      return &s;
+  }
+  return nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Adds a call to the statistics of a slot
+///
+/// \param  slot        index returned by RegisterSlot
+/// \param  wallTime_s  wall time of the call
+/// \param  iterations  iterations the call took, if it iterates
+//--------------------------------------------------------------------------------------------------
+void SEEngineProfiler::Record(size_t slot, double wallTime_s, size_t iterations)
+{
+  Slot& s = m_Slots[slot];
+  if (s.count == 0 || wallTime_s < s.min_s)
+    s.min_s = wallTime_s;
+  if (s.count == 0 || wallTime_s > s.max_s)
+    s.max_s = wallTime_s;
+  s.count++;
+  s.total_s += wallTime_s;
+  s.iterations += iterations;
+
+  size_t bin = 0;
+  double bound_us = 1;
+  double time_us = wallTime_s * 1e6;
+  while (bin < NumHistogramBins - 1 && time_us >= bound_us)
+  {
+    bin++;
+    bound_us *= 2;
+  }
+  s.histogram[bin]++;
+}
+
+std::string SEEngineProfiler::ToCSV() const
+{
+  std::stringstream ss;
+  ss << std::setprecision(9);
+  ss << "Category,Name,Count,Total(s),Mean(s),Min(s),Max(s),Iterations";
+  for (size_t i = 0; i < NumHistogramBins; i++)
+    ss << ",Bin" << i;
+  ss << "\n";
+  for (const Slot& s : m_Slots)
+  {
+    ss << s.category << "," << s.name << "," << s.count << "," << s.total_s << "," << s.GetMean_s() << ","
+       << s.min_s << "," << s.max_s << "," << s.iterations;
+    for (size_t bin : s.histogram)
+      ss << "," << bin;
+    ss << "\n";
+  }
+  return ss.str();
+}
+
+std::string SEEngineProfiler::ToJSON() const
+{
+  std::stringstream ss;
+  ss << std::setprecision(9);
+  ss << "{\"Slots\":[";
+  for (size_t i = 0; i < m_Slots.size(); i++)
+  {
+    const Slot& s = m_Slots[i];
+    ss << (i == 0 ? "" : ",") << "\n  {\"Category\":\"" << EscapeJSON(s.category) << "\",\"Name\":\"" << EscapeJSON(s.name) << "\""
+       << ",\"Count\":" << s.count << ",\"Total_s\":" << s.total_s << ",\"Mean_s\":" << s.GetMean_s()
+       << ",\"Min_s\":" << s.min_s << ",\"Max_s\":" << s.max_s << ",\"Iterations\":" << s.iterations
+       << ",\"Histogram\":[";
+    for (size_t bin = 0; bin < NumHistogramBins; bin++)
+      ss << (bin == 0 ? "" : ",") << s.histogram[bin];
+    ss << "]}";
+  }
+  ss << "\n]}\n";
+  return ss.str();
+}
+
+bool SEEngineProfiler::WriteCSV(const std::string& filename) const
+{
+  if (!WriteText(filename, ToCSV()))
+  {
+    Error("Unable to write profile to " + filename);
+    return false;
+  }
+  return true;
+}
+
+bool SEEngineProfiler::WriteJSON(const std::string& filename) const
+{
+  if (!WriteText(filename, ToJSON()))
+  {
+    Error("Unable to write profile to " + filename);
+    return false;
+  }
+  return true;
+}
+
+SEEngineProfiler::ScopedTimer::ScopedTimer(SEEngineProfiler* profiler, size_t slot)
+{
+  m_Profiler = (profiler != nullptr && profiler->IsEnabled()) ? profiler : nullptr;
+  m_Slot = slot;
+  m_Iterations = 0;
+  if (m_Profiler != nullptr)
+    m_Start = std::chrono::steady_clock::now();
+}
+
+SEEngineProfiler::ScopedTimer::~ScopedTimer()
+{
+  if (m_Profiler != nullptr)
+    m_Profiler->Record(m_Slot, std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count(), m_Iterations);
+}
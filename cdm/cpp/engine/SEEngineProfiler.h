@@ -0,0 +1,88 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Wall time counters and histograms for the parts of an engine time step.
+///
+/// \details
+/// Each part to be timed is given a slot, by category and name, when the engine is set up;
+/// recording into a slot is then only an index into preallocated statistics.
+/// Nothing is recorded until the profiler is enabled, a disabled profiler costs a flag check per hook.
+/// Different slots may be recorded from different threads at the same time, but a slot must only
+/// be recorded from one thread at a time, which holds for every part of a time step.
+//--------------------------------------------------------------------------------------------------
+class CDM_DECL SEEngineProfiler : public Loggable
+{
+public:
+  // Histogram bin 0 counts calls under 1us, bin i counts calls in [2^(i-1), 2^i) us, the last bin counts everything longer
+  static const size_t NumHistogramBins = 24;
+
+  struct Slot
+  {
+    std::string category;
+    std::string name;
+    size_t      count;
+    double      total_s;
+    double      min_s;
+    double      max_s;
+    size_t      iterations;// Summed over all calls, e.g. valve iterations of a circuit solve
+    size_t      histogram[NumHistogramBins];
+
+    double GetMean_s() const { return count == 0 ? 0 : total_s / count; }
+  };
+
+  SEEngineProfiler(Logger* logger);
+  virtual ~SEEngineProfiler();
+
+  // Removes all slots
+  void Clear();
+  // Zeros the statistics of every slot, keeping the slots
+  void Reset();
+
+  void SetEnabled(bool b) { m_Enabled = b; }
+  bool IsEnabled() const { return m_Enabled; }
+
+  // Returns the index of the slot, the slot is added if it does not exist
+  // Slots must not be registered while the engine is advancing
+  size_t RegisterSlot(const std::string& category, const std::string& name);
+  size_t GetNumberOfSlots() const { return m_Slots.size(); }
+  const Slot& GetSlot(size_t slot) const { return m_Slots[slot]; }
+  const Slot* GetSlot(const std::string& category, const std::string& name) const;
+
+  void Record(size_t slot, double wallTime_s, size_t iterations = 0);
+
+  std::string ToCSV() const;
+  std::string ToJSON() const;
+  bool WriteCSV(const std::string& filename) const;
+  bool WriteJSON(const std::string& filename) const;
+
+  //--------------------------------------------------------------------------------------------------
+  /// \brief
+  /// Records the wall time from its construction to its destruction into a slot, if the profiler was
+  /// enabled when it was constructed.
+  //--------------------------------------------------------------------------------------------------
+  class CDM_DECL ScopedTimer
+  {
+  public:
+    ScopedTimer(SEEngineProfiler* profiler, size_t slot);
+    ~ScopedTimer();
+
+    void SetIterations(size_t n) { m_Iterations = n; }
+
+  protected:
+    SEEngineProfiler*                     m_Profiler;
+    size_t                                m_Slot;
+    size_t                                m_Iterations;
+    std::chrono::steady_clock::time_point m_Start;
+  };
+
+protected:
+  std::atomic<bool>  m_Enabled;
+  std::vector<Slot>  m_Slots;
+};
@@ -3,6 +3,7 @@
 
 #include "stdafx.h"
 #include "engine/SEEngineTracker.h"
+#include "engine/SEEngineProfiler.h"
 #include "PhysiologyEngine.h"
 #include "patient/SEPatient.h"
 // Compartments
@@ -97,10 +98,14 @@ SEEngineTracker::SEEngineTracker(PhysiologyEngine& engine) : Loggable(engine.Get
 
   m_Environment = (SEEnvironment*)engine.GetEnvironment();
 
+  m_Profiler = engine.GetProfiler();
+  m_TrackDataProfileSlot = m_Profiler == nullptr ? 0 : m_Profiler->RegisterSlot("Tracker", "TrackData");
+
   m_AnesthesiaMachine = (SEAnesthesiaMachine*)engine.GetAnesthesiaMachine();
   m_ECG = (SEElectroCardioGram*)engine.GetElectroCardioGram();
   m_Inhaler = (SEInhaler*)engine.GetInhaler();
   m_ForceConnection = false;
+  m_DefaultResultsWriter = true;
 }
 
 SEEngineTracker::~SEEngineTracker()
@@ -118,8 +123,18 @@ void SEEngineTracker::Clear()
 
 void SEEngineTracker::ResetFile()
 {
-  if (m_ResultsStream.is_open())
-    m_ResultsStream.close();
+  if (m_ResultsWriter != nullptr)
+    m_ResultsWriter->Close();
+  // The next file may want a different default writer
+  if (m_DefaultResultsWriter)
+    m_ResultsWriter.reset();
+}
+
+void SEEngineTracker::SetResultsWriter(std::unique_ptr<ResultsWriter> writer)
+{
+  ResetFile();
+  m_ResultsWriter = std::move(writer);
+  m_DefaultResultsWriter = m_ResultsWriter == nullptr;
 }
 
 DataTrack& SEEngineTracker::GetDataTrack()
@@ -137,7 +152,7 @@ const SEDataRequestScalar* SEEngineTracker::GetScalar(const SEDataRequest& dr) c
 
 void SEEngineTracker::SetupRequests()
 {
-  bool isOpen = m_ResultsStream.is_open();
+  bool isOpen = m_ResultsWriter != nullptr && m_ResultsWriter->IsOpen();
   if (!isOpen || m_ForceConnection)
   {// Process/Hook up all requests with their associated scalers
     for (SEDataRequest* dr : m_DataRequestMgr.GetDataRequests())
@@ -153,7 +168,18 @@ void SEEngineTracker::SetupRequests()
   // Create the file now that all probes and requests have been added to the track
   // So we get columns for all of our data
   if (!isOpen)
-    m_DataTrack.CreateFile(m_DataRequestMgr.GetResultFilename().c_str(), m_ResultsStream);
+  {
+    const std::string& filename = m_DataRequestMgr.GetResultFilename();
+    if (m_ResultsWriter == nullptr)
+    {
+      const std::string& ext = BinaryResultsWriter::Extension;
+      if (filename.size() > ext.size() && filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0)
+        m_ResultsWriter = std::unique_ptr<ResultsWriter>(new BinaryResultsWriter(GetLogger()));
+      else
+        m_ResultsWriter = std::unique_ptr<ResultsWriter>(new CSVResultsWriter(GetLogger()));
+    }
+    m_ResultsWriter->Open(filename, m_DataTrack);
+  }
 }
 
 void SEEngineTracker::TrackData(double time_s)
@@ -161,9 +187,10 @@ void SEEngineTracker::TrackData(double time_s)
   if (!m_DataRequestMgr.HasDataRequests())
     return;// Nothing to do here...
 
+  SEEngineProfiler::ScopedTimer timer(m_Profiler, m_TrackDataProfileSlot);
   SetupRequests();
   PullData();
-  m_DataTrack.StreamProbesToFile(time_s, m_ResultsStream);
+  m_ResultsWriter->Write(time_s, m_DataTrack);
 }
 void SEEngineTracker::PullData()
 {
@@ -179,7 +206,7 @@ void SEEngineTracker::PullData()
     }
     if (!ds->HasScalar())
     {
-      m_DataTrack.Probe(ds->Heading, SEScalar::dNaN());
+      m_DataTrack.Probe(ds->Column, SEScalar::dNaN());
       continue;
     }
     ds->UpdateScalar();// Update compartment if needed
@@ -189,15 +216,15 @@ void SEEngineTracker::PullData()
       {
         if (dr->GetUnit() == nullptr)
           dr->SetUnit(*ds->GetUnit());
-        m_DataTrack.Probe(ds->Heading, ds->GetValue(*dr->GetUnit()));
+        m_DataTrack.Probe(ds->Column, ds->GetValue(*dr->GetUnit()));
       }
       else
-        m_DataTrack.Probe(ds->Heading, ds->GetValue());
+        m_DataTrack.Probe(ds->Column, ds->GetValue());
     }
     else if (ds->IsInfinity())
-      m_DataTrack.Probe(ds->Heading, std::numeric_limits<double>::infinity());
+      m_DataTrack.Probe(ds->Column, std::numeric_limits<double>::infinity());
     else
-      m_DataTrack.Probe(ds->Heading, SEScalar::dNaN());
+      m_DataTrack.Probe(ds->Column, SEScalar::dNaN());
   }
 }
 
@@ -226,7 +253,8 @@ bool SEEngineTracker::TrackRequest(SEDataRequest& dr)
 
       ds->Heading = Space2Underscore(m_ss.str());
       m_ss.str("");//Reset Buffer
-      m_DataTrack.Probe(ds->Heading, 0);
+      ds->Column = m_DataTrack.AddHeading(ds->Heading);
+      m_DataTrack.Probe(ds->Column, 0);
       m_DataTrack.SetFormatting(ds->Heading, dr);
       return success;
     }
@@ -251,7 +279,8 @@ bool SEEngineTracker::TrackRequest(SEDataRequest& dr)
       }
       ds->Heading = Space2Underscore(m_ss.str());
       m_ss.str("");//Reset Buffer
-      m_DataTrack.Probe(ds->Heading, 0);
+      ds->Column = m_DataTrack.AddHeading(ds->Heading);
+      m_DataTrack.Probe(ds->Column, 0);
       m_DataTrack.SetFormatting(ds->Heading, dr);
       return success;
     }
@@ -265,7 +294,8 @@ bool SEEngineTracker::TrackRequest(SEDataRequest& dr)
           m_ss << dr.GetSubstanceName() << "-" << dr.GetCompartmentName() << "-" << dr.GetPropertyName() << "(" << *dr.GetUnit() << ")";
         ds->Heading = Space2Underscore(m_ss.str());
         m_ss.str("");//Reset Buffer
-        m_DataTrack.Probe(ds->Heading, 0);
+        ds->Column = m_DataTrack.AddHeading(ds->Heading);
+        m_DataTrack.Probe(ds->Column, 0);
         m_DataTrack.SetFormatting(ds->Heading, dr);
         return success;
       }
@@ -277,7 +307,8 @@ bool SEEngineTracker::TrackRequest(SEDataRequest& dr)
           m_ss << dr.GetSubstanceName() << "-" << dr.GetPropertyName() << "(" << *dr.GetUnit() << ")";
         ds->Heading = Space2Underscore(m_ss.str());
         m_ss.str("");//Reset Buffer
-        m_DataTrack.Probe(ds->Heading, 0);
+        ds->Column = m_DataTrack.AddHeading(ds->Heading);
+        m_DataTrack.Probe(ds->Column, 0);
         m_DataTrack.SetFormatting(ds->Heading, dr);
         return success;
       }
@@ -11,10 +11,12 @@
 #include "compartment/tissue/SETissueCompartment.h"
 #include "scenario/SEDataRequestManager.h"
 #include "utils/DataTrack.h"
+#include "utils/ResultsWriter.h"
 class SESystem; 
 class SEPatient;
 class SEEnvironment;
 class PhysiologyEngine;
+class SEEngineProfiler;
 class SESubstanceManager;
 class SECompartmentManager;
 
@@ -33,6 +35,7 @@ public:
   SEDataRequestScalar(Logger* logger) : SEGenericScalar(logger)
   {
     Heading.clear();
+    Column = 0;
 
     UpdateProperty = CompartmentUpdate::None;
     GasCmpt = nullptr;
@@ -46,6 +49,7 @@ public:
   void SetScalar(const SEScalar* s, SEDataRequest& dr);// SEScalar* in order to internnally throw error if the Track cannot find the requested property, it will pass in nullptr if it cannot find it
 
   std::string     Heading;
+  size_t          Column;// Index of our heading in the DataTrack
 
   // Compartment related variables
   CompartmentUpdate             UpdateProperty;
@@ -70,6 +74,11 @@ public:
 
   void ResetFile();// Close file, so next Track Data will re hook up everything and make a new file
 
+  // Writer for the results file, by default a buffered CSV writer,
+  // or a binary writer if the results filename ends with BinaryResultsWriter::Extension
+  void SetResultsWriter(std::unique_ptr<ResultsWriter> writer);
+  ResultsWriter* GetResultsWriter() { return m_ResultsWriter.get(); }
+
   bool ConnectRequest(SEDataRequest& dr, SEDataRequestScalar& ds);
 
   const SEDataRequestScalar* GetScalar(const SEDataRequest& dr) const;
@@ -85,7 +94,8 @@ protected:
   DataTrack                    m_DataTrack;
 
   std::stringstream            m_ss;
-  std::ofstream                m_ResultsStream;
+  std::unique_ptr<ResultsWriter> m_ResultsWriter;
+  bool                         m_DefaultResultsWriter;
   SEDataRequestManager         m_DataRequestMgr;
   
   SEPatient&                   m_Patient;
@@ -98,4 +108,7 @@ protected:
   SESystem*                    m_ECG;
   SESystem*                    m_Inhaler;
   std::map<const SEDataRequest*, SEDataRequestScalar*> m_Request2Scalar;
+
+  SEEngineProfiler*            m_Profiler;
+  size_t                       m_TrackDataProfileSlot;
 };
\ No newline at end of file
@@ -38,6 +38,12 @@ void SEMeal::Serialize(const cdm::MealData& src, SEMeal& dst)
     SEScalarTime::Load(src.elapsedtime(), dst.GetElapsedTime());
 }
 
+void SEMeal::Copy(const SEMeal& src, SEMeal& dst)
+{
+  SENutrition::Copy(src, dst);
+  CopyScalar(src.m_ElapsedTime, dst.m_ElapsedTime);
+}
+
 cdm::MealData* SEMeal::Unload(const SEMeal& src)
 {
   cdm::MealData* dst = new cdm::MealData();
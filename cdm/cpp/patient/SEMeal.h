@@ -16,6 +16,7 @@ public:
 
   static void Load(const cdm::MealData& src, SEMeal& dst);
   static cdm::MealData* Unload(const SEMeal& src);
+  static void Copy(const SEMeal& src, SEMeal& dst);
 protected:
   static void Serialize(const cdm::MealData& src, SEMeal& dst);
   static void Serialize(const SEMeal& src, cdm::MealData& dst);
@@ -130,6 +130,20 @@ void SENutrition::Serialize(const cdm::NutritionData& src, SENutrition& dst)
     SEScalarVolume::Load(src.water(),dst.GetWater());
 }
 
+void SENutrition::Copy(const SENutrition& src, SENutrition& dst)
+{
+  dst.Clear();
+  CopyScalar(src.m_Carbohydrate, dst.m_Carbohydrate);
+  CopyScalar(src.m_CarbohydrateDigestionRate, dst.m_CarbohydrateDigestionRate);
+  CopyScalar(src.m_Fat, dst.m_Fat);
+  CopyScalar(src.m_FatDigestionRate, dst.m_FatDigestionRate);
+  CopyScalar(src.m_Protein, dst.m_Protein);
+  CopyScalar(src.m_ProteinDigestionRate, dst.m_ProteinDigestionRate);
+  CopyScalar(src.m_Calcium, dst.m_Calcium);
+  CopyScalar(src.m_Sodium, dst.m_Sodium);
+  CopyScalar(src.m_Water, dst.m_Water);
+}
+
 cdm::NutritionData* SENutrition::Unload(const SENutrition& src)
 {
   cdm::NutritionData* dst = new cdm::NutritionData();
@@ -15,6 +15,7 @@ public:
 
  static void Load(const cdm::NutritionData& src, SENutrition& dst);
   static cdm::NutritionData* Unload(const SENutrition& src);
+  static void Copy(const SENutrition& src, SENutrition& dst);
 protected:
   static void Serialize(const cdm::NutritionData& src, SENutrition& dst);
   static void Serialize(const SENutrition& src, cdm::NutritionData& dst);
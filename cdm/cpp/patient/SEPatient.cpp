@@ -277,6 +277,40 @@ void SEPatient::Serialize(const cdm::PatientData& src, SEPatient& dst)
   }
 }
 
+void SEPatient::Copy(const SEPatient& src, SEPatient& dst)
+{
+  dst.m_Name = src.m_Name;
+  dst.m_Sex = src.m_Sex;
+  CopyScalar(src.m_Age, dst.m_Age);
+  CopyScalar(src.m_Weight, dst.m_Weight);
+  CopyScalar(src.m_Height, dst.m_Height);
+  CopyScalar(src.m_BodyDensity, dst.m_BodyDensity);
+  CopyScalar(src.m_BodyFatFraction, dst.m_BodyFatFraction);
+  CopyScalar(src.m_LeanBodyMass, dst.m_LeanBodyMass);
+  CopyScalar(src.m_AlveoliSurfaceArea, dst.m_AlveoliSurfaceArea);
+  CopyScalar(src.m_RightLungRatio, dst.m_RightLungRatio);
+  CopyScalar(src.m_SkinSurfaceArea, dst.m_SkinSurfaceArea);
+  CopyScalar(src.m_BasalMetabolicRate, dst.m_BasalMetabolicRate);
+  CopyScalar(src.m_BloodVolumeBaseline, dst.m_BloodVolumeBaseline);
+  CopyScalar(src.m_DiastolicArterialPressureBaseline, dst.m_DiastolicArterialPressureBaseline);
+  CopyScalar(src.m_HeartRateBaseline, dst.m_HeartRateBaseline);
+  CopyScalar(src.m_MeanArterialPressureBaseline, dst.m_MeanArterialPressureBaseline);
+  CopyScalar(src.m_RespirationRateBaseline, dst.m_RespirationRateBaseline);
+  CopyScalar(src.m_SystolicArterialPressureBaseline, dst.m_SystolicArterialPressureBaseline);
+  CopyScalar(src.m_TidalVolumeBaseline, dst.m_TidalVolumeBaseline);
+  CopyScalar(src.m_HeartRateMaximum, dst.m_HeartRateMaximum);
+  CopyScalar(src.m_HeartRateMinimum, dst.m_HeartRateMinimum);
+  CopyScalar(src.m_ExpiratoryReserveVolume, dst.m_ExpiratoryReserveVolume);
+  CopyScalar(src.m_FunctionalResidualCapacity, dst.m_FunctionalResidualCapacity);
+  CopyScalar(src.m_InspiratoryCapacity, dst.m_InspiratoryCapacity);
+  CopyScalar(src.m_InspiratoryReserveVolume, dst.m_InspiratoryReserveVolume);
+  CopyScalar(src.m_ResidualVolume, dst.m_ResidualVolume);
+  CopyScalar(src.m_TotalLungCapacity, dst.m_TotalLungCapacity);
+  CopyScalar(src.m_VitalCapacity, dst.m_VitalCapacity);
+  dst.m_EventState = src.m_EventState;
+  dst.m_EventDuration_s = src.m_EventDuration_s;
+}
+
 cdm::PatientData* SEPatient::Unload(const SEPatient& src)
 {
   cdm::PatientData* dst = new cdm::PatientData();
@@ -23,6 +23,7 @@ public:
 
   static void Load(const cdm::PatientData& src, SEPatient& dst);
   static cdm::PatientData* Unload(const SEPatient& src);
+  static void Copy(const SEPatient& src, SEPatient& dst);
 protected:
   static void Serialize(const cdm::PatientData& src, SEPatient& dst);
   static void Serialize(const SEPatient& src, cdm::PatientData& dst);
@@ -47,6 +47,12 @@ void SEAcuteStress::Serialize(const cdm::AcuteStressData& src, SEAcuteStress& ds
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEAcuteStress::Copy(const SEAcuteStress& src, SEAcuteStress& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::AcuteStressData* SEAcuteStress::Unload(const SEAcuteStress& src)
 {
   cdm::AcuteStressData* dst = new cdm::AcuteStressData();
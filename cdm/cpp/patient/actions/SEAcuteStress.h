@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::AcuteStressData& src, SEAcuteStress& dst);
   static cdm::AcuteStressData* Unload(const SEAcuteStress& src);
+  static void Copy(const SEAcuteStress& src, SEAcuteStress& dst);
 protected:
   static void Serialize(const cdm::AcuteStressData& src, SEAcuteStress& dst);
   static void Serialize(const SEAcuteStress& src, cdm::AcuteStressData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();  
 
+  virtual eActionType GetActionType() const { return eActionType::AcuteStress; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -47,6 +47,12 @@ void SEAirwayObstruction::Serialize(const cdm::AirwayObstructionData& src, SEAir
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEAirwayObstruction::Copy(const SEAirwayObstruction& src, SEAirwayObstruction& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::AirwayObstructionData* SEAirwayObstruction::Unload(const SEAirwayObstruction& src)
 {
   cdm::AirwayObstructionData* dst = new cdm::AirwayObstructionData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::AirwayObstructionData& src, SEAirwayObstruction& dst);
   static cdm::AirwayObstructionData* Unload(const SEAirwayObstruction& src);
+  static void Copy(const SEAirwayObstruction& src, SEAirwayObstruction& dst);
 protected:
   static void Serialize(const cdm::AirwayObstructionData& src, SEAirwayObstruction& dst);
   static void Serialize(const SEAirwayObstruction& src, cdm::AirwayObstructionData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();  
 
+  virtual eActionType GetActionType() const { return eActionType::AirwayObstruction; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -47,6 +47,12 @@ void SEApnea::Serialize(const cdm::ApneaData& src, SEApnea& dst)
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEApnea::Copy(const SEApnea& src, SEApnea& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::ApneaData* SEApnea::Unload(const SEApnea& src)
 {
   cdm::ApneaData* dst = new cdm::ApneaData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::ApneaData& src, SEApnea& dst);
   static cdm::ApneaData* Unload(const SEApnea& src);
+  static void Copy(const SEApnea& src, SEApnea& dst);
 protected:
   static void Serialize(const cdm::ApneaData& src, SEApnea& dst);
   static void Serialize(const SEApnea& src, cdm::ApneaData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();  
 
+  virtual eActionType GetActionType() const { return eActionType::Apnea; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -45,6 +45,12 @@ void SEAsthmaAttack::Serialize(const cdm::AsthmaAttackData& src, SEAsthmaAttack&
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEAsthmaAttack::Copy(const SEAsthmaAttack& src, SEAsthmaAttack& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::AsthmaAttackData* SEAsthmaAttack::Unload(const SEAsthmaAttack& src)
 {
   cdm::AsthmaAttackData* dst = new cdm::AsthmaAttackData();
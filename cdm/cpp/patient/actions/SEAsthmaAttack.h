@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::AsthmaAttackData& src, SEAsthmaAttack& dst);
   static cdm::AsthmaAttackData* Unload(const SEAsthmaAttack& src);
+  static void Copy(const SEAsthmaAttack& src, SEAsthmaAttack& dst);
 protected:
   static void Serialize(const cdm::AsthmaAttackData& src, SEAsthmaAttack& dst);
   static void Serialize(const SEAsthmaAttack& src, cdm::AsthmaAttackData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();  
 
+  virtual eActionType GetActionType() const { return eActionType::AsthmaAttack; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
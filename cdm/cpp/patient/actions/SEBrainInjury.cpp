@@ -49,6 +49,13 @@ void SEBrainInjury::Serialize(const cdm::BrainInjuryData& src, SEBrainInjury& ds
   dst.SetType(src.type());
 }
 
+void SEBrainInjury::Copy(const SEBrainInjury& src, SEBrainInjury& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+  dst.m_Type = src.m_Type;
+}
+
 cdm::BrainInjuryData* SEBrainInjury::Unload(const SEBrainInjury& src)
 {
   cdm::BrainInjuryData* dst = new cdm::BrainInjuryData();
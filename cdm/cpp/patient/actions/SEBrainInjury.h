@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::BrainInjuryData& src, SEBrainInjury& dst);
   static cdm::BrainInjuryData* Unload(const SEBrainInjury& src);
+  static void Copy(const SEBrainInjury& src, SEBrainInjury& dst);
 protected:
   static void Serialize(const cdm::BrainInjuryData& src, SEBrainInjury& dst);
   static void Serialize(const SEBrainInjury& src, cdm::BrainInjuryData& dst);
@@ -31,6 +32,7 @@ public:
   virtual cdm::BrainInjuryData_eType GetType() const;
   virtual void SetType(cdm::BrainInjuryData_eType t);
 
+  virtual eActionType GetActionType() const { return eActionType::BrainInjury; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
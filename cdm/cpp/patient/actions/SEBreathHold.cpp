@@ -45,6 +45,12 @@ void SEBreathHold::Serialize(const cdm::ConsciousRespirationData_BreathHoldData&
     SEScalarTime::Load(src.period(), dst.GetPeriod());
 }
 
+void SEBreathHold::Copy(const SEBreathHold& src, SEBreathHold& dst)
+{
+  dst.Clear();
+  CopyScalar(src.m_Period, dst.m_Period);
+}
+
 cdm::ConsciousRespirationData_BreathHoldData* SEBreathHold::Unload(const SEBreathHold& src)
 {
   cdm::ConsciousRespirationData_BreathHoldData* dst = new cdm::ConsciousRespirationData_BreathHoldData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::ConsciousRespirationData_BreathHoldData& src, SEBreathHold& dst);
   static cdm::ConsciousRespirationData_BreathHoldData* Unload(const SEBreathHold& src);
+  static void Copy(const SEBreathHold& src, SEBreathHold& dst);
 protected:
   static void Serialize(const cdm::ConsciousRespirationData_BreathHoldData& src, SEBreathHold& dst);
   static void Serialize(const SEBreathHold& src, cdm::ConsciousRespirationData_BreathHoldData& dst);
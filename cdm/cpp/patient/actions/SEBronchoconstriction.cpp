@@ -45,6 +45,12 @@ void SEBronchoconstriction::Serialize(const cdm::BronchoconstrictionData& src, S
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEBronchoconstriction::Copy(const SEBronchoconstriction& src, SEBronchoconstriction& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::BronchoconstrictionData* SEBronchoconstriction::Unload(const SEBronchoconstriction& src)
 {
   cdm::BronchoconstrictionData* dst = new cdm::BronchoconstrictionData();
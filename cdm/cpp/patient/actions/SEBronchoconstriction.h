@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::BronchoconstrictionData& src, SEBronchoconstriction& dst);
   static cdm::BronchoconstrictionData* Unload(const SEBronchoconstriction& src);
+  static void Copy(const SEBronchoconstriction& src, SEBronchoconstriction& dst);
 protected:
   static void Serialize(const cdm::BronchoconstrictionData& src, SEBronchoconstriction& dst);
   static void Serialize(const SEBronchoconstriction& src, cdm::BronchoconstrictionData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();  
 
+  virtual eActionType GetActionType() const { return eActionType::Bronchoconstriction; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -44,6 +44,13 @@ void SECardiacArrest::Serialize(const cdm::CardiacArrestData& src, SECardiacArre
     dst.SetState(src.state());
 }
 
+void SECardiacArrest::Copy(const SECardiacArrest& src, SECardiacArrest& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  if (src.m_State != cdm::eSwitch::NullSwitch)
+    dst.m_State = src.m_State;
+}
+
 cdm::CardiacArrestData* SECardiacArrest::Unload(const SECardiacArrest& src)
 {
   cdm::CardiacArrestData* dst = new cdm::CardiacArrestData();
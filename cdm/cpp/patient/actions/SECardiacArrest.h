@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::CardiacArrestData& src, SECardiacArrest& dst);
   static cdm::CardiacArrestData* Unload(const SECardiacArrest& src);
+  static void Copy(const SECardiacArrest& src, SECardiacArrest& dst);
 protected:
   static void Serialize(const cdm::CardiacArrestData& src, SECardiacArrest& dst);
   static void Serialize(const SECardiacArrest& src, cdm::CardiacArrestData& dst);
@@ -28,6 +29,7 @@ public:
   virtual cdm::eSwitch GetState() const { return m_State; }
   virtual void SetState(cdm::eSwitch s) { m_State = (s == cdm::eSwitch::NullSwitch) ? cdm::eSwitch::Off : s; }
 
+  virtual eActionType GetActionType() const { return eActionType::CardiacArrest; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
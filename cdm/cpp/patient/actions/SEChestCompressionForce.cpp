@@ -45,6 +45,12 @@ void SEChestCompressionForce::Serialize(const cdm::ChestCompressionForceData& sr
     SEScalarForce::Load(src.force(), dst.GetForce());
 }
 
+void SEChestCompressionForce::Copy(const SEChestCompressionForce& src, SEChestCompressionForce& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Force, dst.m_Force);
+}
+
 cdm::ChestCompressionForceData* SEChestCompressionForce::Unload(const SEChestCompressionForce& src)
 {
   cdm::ChestCompressionForceData* dst = new cdm::ChestCompressionForceData();
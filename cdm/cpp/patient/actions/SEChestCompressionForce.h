@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::ChestCompressionForceData& src, SEChestCompressionForce& dst);
   static cdm::ChestCompressionForceData* Unload(const SEChestCompressionForce& src);
+  static void Copy(const SEChestCompressionForce& src, SEChestCompressionForce& dst);
 protected:
   static void Serialize(const cdm::ChestCompressionForceData& src, SEChestCompressionForce& dst);
   static void Serialize(const SEChestCompressionForce& src, cdm::ChestCompressionForceData& dst);
@@ -29,6 +30,7 @@ public:
   virtual bool HasForce() const;
   virtual SEScalarForce& GetForce();
 
+  virtual eActionType GetActionType() const { return eActionType::ChestCompressionForce; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
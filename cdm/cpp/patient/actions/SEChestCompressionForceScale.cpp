@@ -50,6 +50,13 @@ void SEChestCompressionForceScale::Serialize(const cdm::ChestCompressionForceSca
     SEScalarTime::Load(src.forceperiod(), dst.GetForcePeriod());
 }
 
+void SEChestCompressionForceScale::Copy(const SEChestCompressionForceScale& src, SEChestCompressionForceScale& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_ForceScale, dst.m_ForceScale);
+  CopyScalar(src.m_ForcePeriod, dst.m_ForcePeriod);
+}
+
 cdm::ChestCompressionForceScaleData* SEChestCompressionForceScale::Unload(const SEChestCompressionForceScale& src)
 {
   cdm::ChestCompressionForceScaleData* dst = new cdm::ChestCompressionForceScaleData();
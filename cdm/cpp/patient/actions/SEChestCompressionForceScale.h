@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::ChestCompressionForceScaleData& src, SEChestCompressionForceScale& dst);
   static cdm::ChestCompressionForceScaleData* Unload(const SEChestCompressionForceScale& src);
+  static void Copy(const SEChestCompressionForceScale& src, SEChestCompressionForceScale& dst);
 protected:
   static void Serialize(const cdm::ChestCompressionForceScaleData& src, SEChestCompressionForceScale& dst);
   static void Serialize(const SEChestCompressionForceScale& src, cdm::ChestCompressionForceScaleData& dst);
@@ -30,6 +31,7 @@ public:
   virtual bool HasForcePeriod() const;
   virtual SEScalarTime& GetForcePeriod();
 
+  virtual eActionType GetActionType() const { return eActionType::ChestCompressionForceScale; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -47,6 +47,14 @@ void SEChestOcclusiveDressing::Serialize(const cdm::ChestOcclusiveDressingData&
     dst.SetState(src.state());
 }
 
+void SEChestOcclusiveDressing::Copy(const SEChestOcclusiveDressing& src, SEChestOcclusiveDressing& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_Side = src.m_Side;
+  if (src.m_State != cdm::eSwitch::NullSwitch)
+    dst.m_State = src.m_State;
+}
+
 cdm::ChestOcclusiveDressingData* SEChestOcclusiveDressing::Unload(const SEChestOcclusiveDressing& src)
 {
   cdm::ChestOcclusiveDressingData* dst = new cdm::ChestOcclusiveDressingData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::ChestOcclusiveDressingData& src, SEChestOcclusiveDressing& dst);
   static cdm::ChestOcclusiveDressingData* Unload(const SEChestOcclusiveDressing& src);
+  static void Copy(const SEChestOcclusiveDressing& src, SEChestOcclusiveDressing& dst);
 protected:
   static void Serialize(const cdm::ChestOcclusiveDressingData& src, SEChestOcclusiveDressing& dst);
   static void Serialize(const SEChestOcclusiveDressing& src, cdm::ChestOcclusiveDressingData& dst);
@@ -33,6 +34,7 @@ public:
   virtual bool HasSide() const;
   virtual void InvalidateSide();
 
+  virtual eActionType GetActionType() const { return eActionType::ChestOcclusiveDressing; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -76,6 +76,33 @@ void SEConsciousRespiration::Serialize(const cdm::ConsciousRespirationData& src,
   }
 }
 
+void SEConsciousRespiration::Copy(const SEConsciousRespiration& src, SEConsciousRespiration& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_ClearCommands = true;
+  for (const SEConsciousRespirationCommand* cmd : src.m_Commands)
+  {
+    const SEBreathHold* bh = dynamic_cast<const SEBreathHold*>(cmd);
+    const SEForcedExhale* fe = dynamic_cast<const SEForcedExhale*>(cmd);
+    const SEForcedInhale* fi = dynamic_cast<const SEForcedInhale*>(cmd);
+    const SEUseInhaler* ui = dynamic_cast<const SEUseInhaler*>(cmd);
+    if (bh != nullptr)
+      SEBreathHold::Copy(*bh, dst.AddBreathHold());
+    else if (fe != nullptr)
+      SEForcedExhale::Copy(*fe, dst.AddForcedExhale());
+    else if (fi != nullptr)
+      SEForcedInhale::Copy(*fi, dst.AddForcedInhale());
+    else if (ui != nullptr)
+      SEUseInhaler::Copy(*ui, dst.AddUseInhaler());
+    else
+    {
+      dst.Warning("Ignoring unknown Conscious Respiration Command");
+      continue;
+    }
+    dst.m_Commands.back()->SetComment(cmd->GetComment());
+  }
+}
+
 cdm::ConsciousRespirationData* SEConsciousRespiration::Unload(const SEConsciousRespiration& src)
 {
   cdm::ConsciousRespirationData* dst = new cdm::ConsciousRespirationData();
@@ -24,6 +24,7 @@ public:
 
   static void Load(const cdm::ConsciousRespirationData& src, SEConsciousRespiration& dst);
   static cdm::ConsciousRespirationData* Unload(const SEConsciousRespiration& src);
+  static void Copy(const SEConsciousRespiration& src, SEConsciousRespiration& dst);
 protected:
   static void Serialize(const cdm::ConsciousRespirationData& src, SEConsciousRespiration& dst);
   static void Serialize(const SEConsciousRespiration& src, cdm::ConsciousRespirationData& dst);
@@ -39,6 +40,7 @@ public:
   virtual SEBreathHold&   AddBreathHold();
   virtual SEUseInhaler&   AddUseInhaler();
 
+  virtual eActionType GetActionType() const { return eActionType::ConsciousRespiration; }
   virtual void ToString(std::ostream &str) const;
 protected:
 
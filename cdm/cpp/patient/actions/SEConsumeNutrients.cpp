@@ -51,6 +51,15 @@ void SEConsumeNutrients::Serialize(const cdm::ConsumeNutrientsData& src, SEConsu
     dst.SetNutritionFile(src.nutritionfile());
 }
 
+void SEConsumeNutrients::Copy(const SEConsumeNutrients& src, SEConsumeNutrients& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  if (src.HasNutrition())
+    SENutrition::Copy(*src.m_Nutrition, dst.GetNutrition());
+  else
+    dst.SetNutritionFile(src.m_NutritionFile);
+}
+
 cdm::ConsumeNutrientsData* SEConsumeNutrients::Unload(const SEConsumeNutrients& src)
 {
   cdm::ConsumeNutrientsData* dst = new cdm::ConsumeNutrientsData();
@@ -21,6 +21,7 @@ public:
 
   static void Load(const cdm::ConsumeNutrientsData& src, SEConsumeNutrients& dst);
   static cdm::ConsumeNutrientsData* Unload(const SEConsumeNutrients& src);
+  static void Copy(const SEConsumeNutrients& src, SEConsumeNutrients& dst);
 protected:
   static void Serialize(const cdm::ConsumeNutrientsData& src, SEConsumeNutrients& dst);
   static void Serialize(const SEConsumeNutrients& src, cdm::ConsumeNutrientsData& dst);
@@ -36,6 +37,7 @@ public:
   virtual bool HasNutritionFile() const;
   virtual void InvalidateNutritionFile();
 
+  virtual eActionType GetActionType() const { return eActionType::ConsumeNutrients; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
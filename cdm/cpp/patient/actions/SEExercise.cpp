@@ -47,6 +47,12 @@ void SEExercise::Serialize(const cdm::ExerciseData& src, SEExercise& dst)
     SEScalar0To1::Load(src.intensity(), dst.GetIntensity());
 }
 
+void SEExercise::Copy(const SEExercise& src, SEExercise& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Intensity, dst.m_Intensity);
+}
+
 cdm::ExerciseData* SEExercise::Unload(const SEExercise& src)
 {
   cdm::ExerciseData* dst = new cdm::ExerciseData();
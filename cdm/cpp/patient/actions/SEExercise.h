@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::ExerciseData& src, SEExercise& dst);
   static cdm::ExerciseData* Unload(const SEExercise& src);
+  static void Copy(const SEExercise& src, SEExercise& dst);
 protected:
   static void Serialize(const cdm::ExerciseData& src, SEExercise& dst);
   static void Serialize(const SEExercise& src, cdm::ExerciseData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasIntensity() const;
   virtual SEScalar0To1& GetIntensity();
   
+  virtual eActionType GetActionType() const { return eActionType::Exercise; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
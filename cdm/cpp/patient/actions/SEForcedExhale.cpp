@@ -50,6 +50,13 @@ void SEForcedExhale::Serialize(const cdm::ConsciousRespirationData_ForcedExhaleD
     SEScalarTime::Load(src.period(), dst.GetPeriod());
 }
 
+void SEForcedExhale::Copy(const SEForcedExhale& src, SEForcedExhale& dst)
+{
+  dst.Clear();
+  CopyScalar(src.m_ExpiratoryReserveVolumeFraction, dst.m_ExpiratoryReserveVolumeFraction);
+  CopyScalar(src.m_Period, dst.m_Period);
+}
+
 cdm::ConsciousRespirationData_ForcedExhaleData* SEForcedExhale::Unload(const SEForcedExhale& src)
 {
   cdm::ConsciousRespirationData_ForcedExhaleData* dst = new cdm::ConsciousRespirationData_ForcedExhaleData();
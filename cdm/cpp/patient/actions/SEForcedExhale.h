@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::ConsciousRespirationData_ForcedExhaleData& src, SEForcedExhale& dst);
   static cdm::ConsciousRespirationData_ForcedExhaleData* Unload(const SEForcedExhale& src);
+  static void Copy(const SEForcedExhale& src, SEForcedExhale& dst);
 protected:
   static void Serialize(const cdm::ConsciousRespirationData_ForcedExhaleData& src, SEForcedExhale& dst);
   static void Serialize(const SEForcedExhale& src, cdm::ConsciousRespirationData_ForcedExhaleData& dst);
@@ -50,6 +50,13 @@ void SEForcedInhale::Serialize(const cdm::ConsciousRespirationData_ForcedInhaleD
     SEScalarTime::Load(src.period(), dst.GetPeriod());
 }
 
+void SEForcedInhale::Copy(const SEForcedInhale& src, SEForcedInhale& dst)
+{
+  dst.Clear();
+  CopyScalar(src.m_InspiratoryCapacityFraction, dst.m_InspiratoryCapacityFraction);
+  CopyScalar(src.m_Period, dst.m_Period);
+}
+
 cdm::ConsciousRespirationData_ForcedInhaleData* SEForcedInhale::Unload(const SEForcedInhale& src)
 {
   cdm::ConsciousRespirationData_ForcedInhaleData* dst = new cdm::ConsciousRespirationData_ForcedInhaleData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::ConsciousRespirationData_ForcedInhaleData& src, SEForcedInhale& dst);
   static cdm::ConsciousRespirationData_ForcedInhaleData* Unload(const SEForcedInhale& src);
+  static void Copy(const SEForcedInhale& src, SEForcedInhale& dst);
 protected:
   static void Serialize(const cdm::ConsciousRespirationData_ForcedInhaleData& src, SEForcedInhale& dst);
   static void Serialize(const SEForcedInhale& src, cdm::ConsciousRespirationData_ForcedInhaleData& dst);
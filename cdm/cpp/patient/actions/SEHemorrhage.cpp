@@ -48,6 +48,13 @@ void SEHemorrhage::Serialize(const cdm::HemorrhageData& src, SEHemorrhage& dst)
   dst.m_Compartment = src.compartment();
 }
 
+void SEHemorrhage::Copy(const SEHemorrhage& src, SEHemorrhage& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Rate, dst.m_Rate);
+  dst.m_Compartment = src.m_Compartment;
+}
+
 cdm::HemorrhageData* SEHemorrhage::Unload(const SEHemorrhage& src)
 {
   cdm::HemorrhageData* dst = new cdm::HemorrhageData();
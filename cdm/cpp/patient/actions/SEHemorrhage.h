@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::HemorrhageData& src, SEHemorrhage& dst);
   static cdm::HemorrhageData* Unload(const SEHemorrhage& src);
+  static void Copy(const SEHemorrhage& src, SEHemorrhage& dst);
 protected:
   static void Serialize(const cdm::HemorrhageData& src, SEHemorrhage& dst);
   static void Serialize(const SEHemorrhage& src, cdm::HemorrhageData& dst);
@@ -33,6 +34,7 @@ public:
   virtual bool HasRate() const;
   virtual SEScalarVolumePerTime& GetRate();  
 
+  virtual eActionType GetActionType() const { return eActionType::Hemorrhage; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
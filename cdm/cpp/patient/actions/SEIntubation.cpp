@@ -43,6 +43,12 @@ void SEIntubation::Serialize(const cdm::IntubationData& src, SEIntubation& dst)
   dst.SetType(src.type());
 }
 
+void SEIntubation::Copy(const SEIntubation& src, SEIntubation& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_Type = src.m_Type;
+}
+
 cdm::IntubationData* SEIntubation::Unload(const SEIntubation& src)
 {
   cdm::IntubationData* dst = new cdm::IntubationData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::IntubationData& src, SEIntubation& dst);
   static cdm::IntubationData* Unload(const SEIntubation& src);
+  static void Copy(const SEIntubation& src, SEIntubation& dst);
 protected:
   static void Serialize(const cdm::IntubationData& src, SEIntubation& dst);
   static void Serialize(const SEIntubation& src, cdm::IntubationData& dst);
@@ -28,6 +29,7 @@ public:
   virtual cdm::IntubationData_eType GetType() const;
   virtual void SetType(cdm::IntubationData_eType t);
 
+  virtual eActionType GetActionType() const { return eActionType::Intubation; }
   virtual void ToString(std::ostream &str) const;
 protected:
   cdm::IntubationData_eType m_Type;
@@ -107,6 +107,26 @@ void SEMechanicalVentilation::Serialize(const cdm::MechanicalVentilationData& sr
   }
 }
 
+void SEMechanicalVentilation::Copy(const SEMechanicalVentilation& src, SEMechanicalVentilation& dst, const SESubstanceManager& subMgr)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.SetState(src.m_State);
+  CopyScalar(src.m_Flow, dst.m_Flow);
+  CopyScalar(src.m_Pressure, dst.m_Pressure);
+
+  SESubstance* sub;
+  for (const SESubstanceFraction* sf : src.m_GasFractions)
+  {
+    sub = subMgr.GetSubstance(sf->GetSubstance().GetName());
+    if (sub == nullptr)
+    {
+      dst.Error("MechanicalVentilation substance not found : " + sf->GetSubstance().GetName());
+      continue;
+    }
+    SESubstanceFraction::Copy(*sf, dst.GetGasFraction(*sub));
+  }
+}
+
 cdm::MechanicalVentilationData* SEMechanicalVentilation::Unload(const SEMechanicalVentilation& src)
 {
   cdm::MechanicalVentilationData* dst = new cdm::MechanicalVentilationData();
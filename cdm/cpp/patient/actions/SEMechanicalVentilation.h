@@ -25,6 +25,7 @@ public:
 
   static void Load(const cdm::MechanicalVentilationData& src, SEMechanicalVentilation& dst, const SESubstanceManager& subMgr);
   static cdm::MechanicalVentilationData* Unload(const SEMechanicalVentilation& src);
+  static void Copy(const SEMechanicalVentilation& src, SEMechanicalVentilation& dst, const SESubstanceManager& subMgr);
 protected:
   static void Serialize(const cdm::MechanicalVentilationData& src, SEMechanicalVentilation& dst, const SESubstanceManager& subMgr);
   static void Serialize(const SEMechanicalVentilation& src, cdm::MechanicalVentilationData& dst);
@@ -51,6 +52,7 @@ public:
   void RemoveGasFraction(const SESubstance& substance);
   void RemoveGasFractions();
 
+  virtual eActionType GetActionType() const { return eActionType::MechanicalVentilation; }
   virtual void ToString(std::ostream &str) const;
 protected:
 
@@ -52,6 +52,14 @@ void SENeedleDecompression::Serialize(const cdm::NeedleDecompressionData& src, S
     dst.SetState(src.state());
 }
 
+void SENeedleDecompression::Copy(const SENeedleDecompression& src, SENeedleDecompression& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_Side = src.m_Side;
+  if (src.m_State != cdm::eSwitch::NullSwitch)
+    dst.m_State = src.m_State;
+}
+
 cdm::NeedleDecompressionData* SENeedleDecompression::Unload(const SENeedleDecompression& src)
 {
   cdm::NeedleDecompressionData* dst = new cdm::NeedleDecompressionData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::NeedleDecompressionData& src, SENeedleDecompression& dst);
   static cdm::NeedleDecompressionData* Unload(const SENeedleDecompression& src);
+  static void Copy(const SENeedleDecompression& src, SENeedleDecompression& dst);
 protected:
   static void Serialize(const cdm::NeedleDecompressionData& src, SENeedleDecompression& dst);
   static void Serialize(const SENeedleDecompression& src, cdm::NeedleDecompressionData& dst);
@@ -34,6 +35,7 @@ public:
   virtual bool HasSide() const;
   virtual void InvalidateSide();
   
+  virtual eActionType GetActionType() const { return eActionType::NeedleDecompression; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -32,6 +32,11 @@ void SEPatientAction::Serialize(const cdm::PatientActionData& src, SEPatientActi
   SEAction::Serialize(src.action(), dst);
 }
 
+void SEPatientAction::Copy(const SEPatientAction& src, SEPatientAction& dst)
+{
+  SEAction::Copy(src, dst);
+}
+
 void SEPatientAction::Serialize(const SEPatientAction& src, cdm::PatientActionData& dst)
 {
   SEAction::Serialize(src, *dst.mutable_action());
@@ -23,8 +23,10 @@ public:
 protected:
   static void Serialize(const cdm::PatientActionData& src, SEPatientAction& dst);
   static void Serialize(const SEPatientAction& src, cdm::PatientActionData& dst);
+  static void Copy(const SEPatientAction& src, SEPatientAction& dst);
 
 public:
+  virtual eActionCategory GetActionCategory() const { return eActionCategory::Patient; }
   virtual void ToString(std::ostream &str) const = 0;
   
 };  
\ No newline at end of file
@@ -43,6 +43,12 @@ void SEPatientAssessmentRequest::Serialize(const cdm::PatientAssessmentRequestDa
   dst.SetType(src.type());
 }
 
+void SEPatientAssessmentRequest::Copy(const SEPatientAssessmentRequest& src, SEPatientAssessmentRequest& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_Type = src.m_Type;
+}
+
 cdm::PatientAssessmentRequestData* SEPatientAssessmentRequest::Unload(const SEPatientAssessmentRequest& src)
 {
   cdm::PatientAssessmentRequestData* dst = new cdm::PatientAssessmentRequestData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::PatientAssessmentRequestData& src, SEPatientAssessmentRequest& dst);
   static cdm::PatientAssessmentRequestData* Unload(const SEPatientAssessmentRequest& src);
+  static void Copy(const SEPatientAssessmentRequest& src, SEPatientAssessmentRequest& dst);
 protected:
   static void Serialize(const cdm::PatientAssessmentRequestData& src, SEPatientAssessmentRequest& dst);
   static void Serialize(const SEPatientAssessmentRequest& src, cdm::PatientAssessmentRequestData& dst);
@@ -28,6 +29,7 @@ public:
   virtual cdm::PatientAssessmentData_eType GetType() const;
   virtual void SetType(cdm::PatientAssessmentData_eType type);
 
+  virtual eActionType GetActionType() const { return eActionType::PatientAssessmentRequest; }
   virtual void ToString(std::ostream &str) const;
   
 protected:
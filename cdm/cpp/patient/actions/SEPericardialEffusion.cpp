@@ -45,6 +45,12 @@ void SEPericardialEffusion::Serialize(const cdm::PericardialEffusionData& src, S
     SEScalarVolumePerTime::Load(src.effusionrate(), dst.GetEffusionRate());
 }
 
+void SEPericardialEffusion::Copy(const SEPericardialEffusion& src, SEPericardialEffusion& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_EffusionRate, dst.m_EffusionRate);
+}
+
 cdm::PericardialEffusionData* SEPericardialEffusion::Unload(const SEPericardialEffusion& src)
 {
   cdm::PericardialEffusionData* dst = new cdm::PericardialEffusionData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::PericardialEffusionData& src, SEPericardialEffusion& dst);
   static cdm::PericardialEffusionData* Unload(const SEPericardialEffusion& src);
+  static void Copy(const SEPericardialEffusion& src, SEPericardialEffusion& dst);
 protected:
   static void Serialize(const cdm::PericardialEffusionData& src, SEPericardialEffusion& dst);
   static void Serialize(const SEPericardialEffusion& src, cdm::PericardialEffusionData& dst);
@@ -28,6 +29,7 @@ public:
   virtual bool HasEffusionRate() const;
   virtual SEScalarVolumePerTime& GetEffusionRate();
   
+  virtual eActionType GetActionType() const { return eActionType::PericardialEffusion; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
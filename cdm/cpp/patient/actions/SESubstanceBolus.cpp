@@ -58,6 +58,15 @@ void SESubstanceBolus::Serialize(const cdm::SubstanceBolusData& src, SESubstance
     SESubstanceBolusState::Load(src.state(), dst.m_State);
 }
 
+void SESubstanceBolus::Copy(const SESubstanceBolus& src, SESubstanceBolus& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_AdminRoute = src.m_AdminRoute;
+  CopyScalar(src.m_Dose, dst.m_Dose);
+  CopyScalar(src.m_Concentration, dst.m_Concentration);
+  SESubstanceBolusState::Copy(src.m_State, dst.m_State);
+}
+
 cdm::SubstanceBolusData* SESubstanceBolus::Unload(const SESubstanceBolus& src)
 {
   cdm::SubstanceBolusData* dst = new cdm::SubstanceBolusData();
@@ -152,6 +161,14 @@ void SESubstanceBolusState::Serialize(const cdm::SubstanceBolusData_StateData& s
     SEScalarVolume::Load(src.administereddose(), dst.GetAdministeredDose());
 }
 
+void SESubstanceBolusState::Copy(const SESubstanceBolusState& src, SESubstanceBolusState& dst)
+{
+  if (src.m_ElapsedTime.IsValid())
+    dst.m_ElapsedTime.Set(src.m_ElapsedTime);
+  if (src.m_AdministeredDose.IsValid())
+    dst.m_AdministeredDose.Set(src.m_AdministeredDose);
+}
+
 cdm::SubstanceBolusData_StateData* SESubstanceBolusState::Unload(const SESubstanceBolusState& src)
 {
   cdm::SubstanceBolusData_StateData* dst = new cdm::SubstanceBolusData_StateData();
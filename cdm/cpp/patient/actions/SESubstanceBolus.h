@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::SubstanceBolusData_StateData& src, SESubstanceBolusState& dst);
   static cdm::SubstanceBolusData_StateData* Unload(const SESubstanceBolusState& src);
+  static void Copy(const SESubstanceBolusState& src, SESubstanceBolusState& dst);
 protected:
   static void Serialize(const cdm::SubstanceBolusData_StateData& src, SESubstanceBolusState& dst);
   static void Serialize(const SESubstanceBolusState& src, cdm::SubstanceBolusData_StateData& dst);
@@ -46,6 +47,7 @@ public:
 
   static void Load(const cdm::SubstanceBolusData& src, SESubstanceBolus& dst);
   static cdm::SubstanceBolusData* Unload(const SESubstanceBolus& src);
+  static void Copy(const SESubstanceBolus& src, SESubstanceBolus& dst);
 protected:
   static void Serialize(const cdm::SubstanceBolusData& src, SESubstanceBolus& dst);
   static void Serialize(const SESubstanceBolus& src, cdm::SubstanceBolusData& dst);
@@ -66,6 +68,7 @@ public:
   virtual SESubstanceBolusState& GetState() { return m_State; }
   virtual const SESubstanceBolusState& GetState() const { return m_State; }
 
+  virtual eActionType GetActionType() const { return eActionType::SubstanceBolus; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -52,6 +52,13 @@ void SESubstanceCompoundInfusion::Serialize(const cdm::SubstanceCompoundInfusion
     SEScalarVolume::Load(src.bagvolume(), dst.GetBagVolume());
 }
 
+void SESubstanceCompoundInfusion::Copy(const SESubstanceCompoundInfusion& src, SESubstanceCompoundInfusion& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Rate, dst.m_Rate);
+  CopyScalar(src.m_BagVolume, dst.m_BagVolume);
+}
+
 cdm::SubstanceCompoundInfusionData* SESubstanceCompoundInfusion::Unload(const SESubstanceCompoundInfusion& src)
 {
   cdm::SubstanceCompoundInfusionData* dst = new cdm::SubstanceCompoundInfusionData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::SubstanceCompoundInfusionData& src, SESubstanceCompoundInfusion& dst);
   static cdm::SubstanceCompoundInfusionData* Unload(const SESubstanceCompoundInfusion& src);
+  static void Copy(const SESubstanceCompoundInfusion& src, SESubstanceCompoundInfusion& dst);
 protected:
   static void Serialize(const cdm::SubstanceCompoundInfusionData& src, SESubstanceCompoundInfusion& dst);
   static void Serialize(const SESubstanceCompoundInfusion& src, cdm::SubstanceCompoundInfusionData& dst);
@@ -34,6 +35,7 @@ public:
 
   virtual SESubstanceCompound& GetSubstanceCompound() const;
 
+  virtual eActionType GetActionType() const { return eActionType::SubstanceCompoundInfusion; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
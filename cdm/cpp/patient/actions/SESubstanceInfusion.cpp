@@ -54,6 +54,13 @@ void SESubstanceInfusion::Serialize(const cdm::SubstanceInfusionData& src, SESub
     SEScalarMassPerVolume::Load(src.concentration(), dst.GetConcentration());
 }
 
+void SESubstanceInfusion::Copy(const SESubstanceInfusion& src, SESubstanceInfusion& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  CopyScalar(src.m_Rate, dst.m_Rate);
+  CopyScalar(src.m_Concentration, dst.m_Concentration);
+}
+
 cdm::SubstanceInfusionData* SESubstanceInfusion::Unload(const SESubstanceInfusion& src)
 {
   cdm::SubstanceInfusionData* dst = new cdm::SubstanceInfusionData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::SubstanceInfusionData& src, SESubstanceInfusion& dst);
   static cdm::SubstanceInfusionData* Unload(const SESubstanceInfusion& src);
+  static void Copy(const SESubstanceInfusion& src, SESubstanceInfusion& dst);
 protected:
   static void Serialize(const cdm::SubstanceInfusionData& src, SESubstanceInfusion& dst);
   static void Serialize(const SESubstanceInfusion& src, cdm::SubstanceInfusionData& dst);
@@ -34,6 +35,7 @@ public:
 
   virtual SESubstance& GetSubstance() const;
 
+  virtual eActionType GetActionType() const { return eActionType::SubstanceInfusion; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -41,6 +41,14 @@ void SETensionPneumothorax::Serialize(const cdm::TensionPneumothoraxData& src, S
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SETensionPneumothorax::Copy(const SETensionPneumothorax& src, SETensionPneumothorax& dst)
+{
+  SEPatientAction::Copy(src, dst);
+  dst.m_Type = src.m_Type;
+  dst.m_Side = src.m_Side;
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::TensionPneumothoraxData* SETensionPneumothorax::Unload(const SETensionPneumothorax& src)
 {
   cdm::TensionPneumothoraxData* dst = new cdm::TensionPneumothoraxData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::TensionPneumothoraxData& src, SETensionPneumothorax& dst);
   static cdm::TensionPneumothoraxData* Unload(const SETensionPneumothorax& src);
+  static void Copy(const SETensionPneumothorax& src, SETensionPneumothorax& dst);
 protected:
   static void Serialize(const cdm::TensionPneumothoraxData& src, SETensionPneumothorax& dst);
   static void Serialize(const SETensionPneumothorax& src, cdm::TensionPneumothoraxData& dst);
@@ -38,6 +39,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::TensionPneumothorax; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -41,6 +41,11 @@ void SEUrinate::Serialize(const cdm::UrinateData& src, SEUrinate& dst)
   SEPatientAction::Serialize(src.patientaction(), dst);
 }
 
+void SEUrinate::Copy(const SEUrinate& src, SEUrinate& dst)
+{
+  SEPatientAction::Copy(src, dst);
+}
+
 cdm::UrinateData* SEUrinate::Unload(const SEUrinate& src)
 {
   cdm::UrinateData* dst = new cdm::UrinateData();
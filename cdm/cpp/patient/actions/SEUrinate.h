@@ -19,12 +19,14 @@ public:
 
   static void Load(const cdm::UrinateData& src, SEUrinate& dst);
   static cdm::UrinateData* Unload(const SEUrinate& src);
+  static void Copy(const SEUrinate& src, SEUrinate& dst);
 protected:
   static void Serialize(const cdm::UrinateData& src, SEUrinate& dst);
   static void Serialize(const SEUrinate& src, cdm::UrinateData& dst);
 
 public:  
   
+  virtual eActionType GetActionType() const { return eActionType::Urinate; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
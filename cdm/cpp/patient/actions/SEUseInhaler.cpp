@@ -44,6 +44,11 @@ void SEUseInhaler::Serialize(const cdm::ConsciousRespirationData_UseInhalerData&
   dst.Clear();
 }
 
+void SEUseInhaler::Copy(const SEUseInhaler& src, SEUseInhaler& dst)
+{
+  dst.Clear();
+}
+
 cdm::ConsciousRespirationData_UseInhalerData* SEUseInhaler::Unload(const SEUseInhaler& src)
 {
   cdm::ConsciousRespirationData_UseInhalerData* dst = new cdm::ConsciousRespirationData_UseInhalerData();
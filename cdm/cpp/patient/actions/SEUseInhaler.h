@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::ConsciousRespirationData_UseInhalerData& src, SEUseInhaler& dst);
   static cdm::ConsciousRespirationData_UseInhalerData* Unload(const SEUseInhaler& src);
+  static void Copy(const SEUseInhaler& src, SEUseInhaler& dst);
 protected:
   static void Serialize(const cdm::ConsciousRespirationData_UseInhalerData& src, SEUseInhaler& dst);
   static void Serialize(const SEUseInhaler& src, cdm::ConsciousRespirationData_UseInhalerData& dst);
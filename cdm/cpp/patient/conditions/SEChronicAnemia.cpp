@@ -40,6 +40,12 @@ void SEChronicAnemia::Serialize(const cdm::ChronicAnemiaData& src, SEChronicAnem
     SEScalar0To1::Load(src.reductionfactor(), dst.GetReductionFactor());
 }
 
+void SEChronicAnemia::Copy(const SEChronicAnemia& src, SEChronicAnemia& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  CopyScalar(src.m_ReductionFactor, dst.m_ReductionFactor);
+}
+
 cdm::ChronicAnemiaData* SEChronicAnemia::Unload(const SEChronicAnemia& src)
 {
   cdm::ChronicAnemiaData* dst = new cdm::ChronicAnemiaData();
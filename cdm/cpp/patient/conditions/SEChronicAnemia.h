@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::ChronicAnemiaData& src, SEChronicAnemia& dst);
   static cdm::ChronicAnemiaData* Unload(const SEChronicAnemia& src);
+  static void Copy(const SEChronicAnemia& src, SEChronicAnemia& dst);
 protected:
   static void Serialize(const cdm::ChronicAnemiaData& src, SEChronicAnemia& dst);
   static void Serialize(const SEChronicAnemia& src, cdm::ChronicAnemiaData& dst);
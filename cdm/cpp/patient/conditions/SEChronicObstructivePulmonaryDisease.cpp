@@ -45,6 +45,13 @@ void SEChronicObstructivePulmonaryDisease::Serialize(const cdm::ChronicObstructi
     SEScalar0To1::Load(src.emphysemaseverity(), dst.GetEmphysemaSeverity());
 }
 
+void SEChronicObstructivePulmonaryDisease::Copy(const SEChronicObstructivePulmonaryDisease& src, SEChronicObstructivePulmonaryDisease& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  CopyScalar(src.m_BronchitisSeverity, dst.m_BronchitisSeverity);
+  CopyScalar(src.m_EmphysemaSeverity, dst.m_EmphysemaSeverity);
+}
+
 cdm::ChronicObstructivePulmonaryDiseaseData* SEChronicObstructivePulmonaryDisease::Unload(const SEChronicObstructivePulmonaryDisease& src)
 {
   cdm::ChronicObstructivePulmonaryDiseaseData* dst = new cdm::ChronicObstructivePulmonaryDiseaseData();
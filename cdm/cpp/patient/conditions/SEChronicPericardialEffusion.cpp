@@ -40,6 +40,12 @@ void SEChronicPericardialEffusion::Serialize(const cdm::ChronicPericardialEffusi
     SEScalarVolume::Load(src.accumulatedvolume(), dst.GetAccumulatedVolume());
 }
 
+void SEChronicPericardialEffusion::Copy(const SEChronicPericardialEffusion& src, SEChronicPericardialEffusion& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  CopyScalar(src.m_AccumulatedVolume, dst.m_AccumulatedVolume);
+}
+
 cdm::ChronicPericardialEffusionData* SEChronicPericardialEffusion::Unload(const SEChronicPericardialEffusion& src)
 {
   cdm::ChronicPericardialEffusionData* dst = new cdm::ChronicPericardialEffusionData();
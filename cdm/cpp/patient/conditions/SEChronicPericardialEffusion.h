@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::ChronicPericardialEffusionData& src, SEChronicPericardialEffusion& dst);
   static cdm::ChronicPericardialEffusionData* Unload(const SEChronicPericardialEffusion& src);
+  static void Copy(const SEChronicPericardialEffusion& src, SEChronicPericardialEffusion& dst);
 protected:
   static void Serialize(const cdm::ChronicPericardialEffusionData& src, SEChronicPericardialEffusion& dst);
   static void Serialize(const SEChronicPericardialEffusion& src, cdm::ChronicPericardialEffusionData& dst);
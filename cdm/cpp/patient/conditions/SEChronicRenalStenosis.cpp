@@ -44,6 +44,13 @@ void SEChronicRenalStenosis::Serialize(const cdm::ChronicRenalStenosisData& src,
     SEScalar0To1::Load(src.rightkidneyseverity(), dst.GetRightKidneySeverity());
 }
 
+void SEChronicRenalStenosis::Copy(const SEChronicRenalStenosis& src, SEChronicRenalStenosis& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  CopyScalar(src.m_LeftKidneySeverity, dst.m_LeftKidneySeverity);
+  CopyScalar(src.m_RightKidneySeverity, dst.m_RightKidneySeverity);
+}
+
 cdm::ChronicRenalStenosisData* SEChronicRenalStenosis::Unload(const SEChronicRenalStenosis& src)
 {
   cdm::ChronicRenalStenosisData* dst = new cdm::ChronicRenalStenosisData();
@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::ChronicRenalStenosisData& src, SEChronicRenalStenosis& dst);
   static cdm::ChronicRenalStenosisData* Unload(const SEChronicRenalStenosis& src);
+  static void Copy(const SEChronicRenalStenosis& src, SEChronicRenalStenosis& dst);
 protected:
   static void Serialize(const cdm::ChronicRenalStenosisData& src, SEChronicRenalStenosis& dst);
   static void Serialize(const SEChronicRenalStenosis& src, cdm::ChronicRenalStenosisData& dst);
@@ -35,6 +35,11 @@ void SEChronicVentricularSystolicDysfunction::Serialize(const cdm::ChronicVentri
   SEPatientCondition::Serialize(src.patientcondition(), dst);
 }
 
+void SEChronicVentricularSystolicDysfunction::Copy(const SEChronicVentricularSystolicDysfunction& src, SEChronicVentricularSystolicDysfunction& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+}
+
 cdm::ChronicVentricularSystolicDysfunctionData* SEChronicVentricularSystolicDysfunction::Unload(const SEChronicVentricularSystolicDysfunction& src)
 {
   cdm::ChronicVentricularSystolicDysfunctionData* dst = new cdm::ChronicVentricularSystolicDysfunctionData();
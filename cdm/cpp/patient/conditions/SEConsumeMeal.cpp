@@ -46,6 +46,15 @@ void SEConsumeMeal::Serialize(const cdm::ConsumeMealData& src, SEConsumeMeal& ds
     dst.SetMealFile(src.mealfile());
 }
 
+void SEConsumeMeal::Copy(const SEConsumeMeal& src, SEConsumeMeal& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  if (src.HasMeal())
+    SEMeal::Copy(*src.m_Meal, dst.GetMeal());
+  else
+    dst.SetMealFile(src.m_MealFile);
+}
+
 cdm::ConsumeMealData* SEConsumeMeal::Unload(const SEConsumeMeal& src)
 {
   cdm::ConsumeMealData* dst = new cdm::ConsumeMealData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::ConsumeMealData& src, SEConsumeMeal& dst);
   static cdm::ConsumeMealData* Unload(const SEConsumeMeal& src);
+  static void Copy(const SEConsumeMeal& src, SEConsumeMeal& dst);
 protected:
   static void Serialize(const cdm::ConsumeMealData& src, SEConsumeMeal& dst);
   static void Serialize(const SEConsumeMeal& src, cdm::ConsumeMealData& dst);
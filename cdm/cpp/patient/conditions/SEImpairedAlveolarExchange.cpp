@@ -43,6 +43,13 @@ void SEImpairedAlveolarExchange::Serialize(const cdm::ImpairedAlveolarExchangeDa
     SEScalarArea::Load(src.impairedsurfacearea(), dst.GetImpairedSurfaceArea());
 }
 
+void SEImpairedAlveolarExchange::Copy(const SEImpairedAlveolarExchange& src, SEImpairedAlveolarExchange& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  CopyScalar(src.m_ImpairedFraction, dst.m_ImpairedFraction);
+  CopyScalar(src.m_ImpairedSurfaceArea, dst.m_ImpairedSurfaceArea);
+}
+
 cdm::ImpairedAlveolarExchangeData* SEImpairedAlveolarExchange::Unload(const SEImpairedAlveolarExchange& src)
 {
   cdm::ImpairedAlveolarExchangeData* dst = new cdm::ImpairedAlveolarExchangeData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::ImpairedAlveolarExchangeData& src, SEImpairedAlveolarExchange& dst);
   static cdm::ImpairedAlveolarExchangeData* Unload(const SEImpairedAlveolarExchange& src);
+  static void Copy(const SEImpairedAlveolarExchange& src, SEImpairedAlveolarExchange& dst);
 protected:
   static void Serialize(const cdm::ImpairedAlveolarExchangeData& src, SEImpairedAlveolarExchange& dst);
   static void Serialize(const SEImpairedAlveolarExchange& src, cdm::ImpairedAlveolarExchangeData& dst);
@@ -48,6 +48,14 @@ void SELobarPneumonia::Serialize(const cdm::LobarPneumoniaData& src, SELobarPneu
     SEScalar0To1::Load(src.rightlungaffected(), dst.GetRightLungAffected());
 }
 
+void SELobarPneumonia::Copy(const SELobarPneumonia& src, SELobarPneumonia& dst)
+{
+  SEPatientCondition::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+  CopyScalar(src.m_LeftLungAffected, dst.m_LeftLungAffected);
+  CopyScalar(src.m_RightLungAffected, dst.m_RightLungAffected);
+}
+
 cdm::LobarPneumoniaData* SELobarPneumonia::Unload(const SELobarPneumonia& src)
 {
   cdm::LobarPneumoniaData* dst = new cdm::LobarPneumoniaData();
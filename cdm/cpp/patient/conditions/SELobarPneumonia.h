@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::LobarPneumoniaData& src, SELobarPneumonia& dst);
   static cdm::LobarPneumoniaData* Unload(const SELobarPneumonia& src);
+  static void Copy(const SELobarPneumonia& src, SELobarPneumonia& dst);
 protected:
   static void Serialize(const cdm::LobarPneumoniaData& src, SELobarPneumonia& dst);
   static void Serialize(const SELobarPneumonia& src, cdm::LobarPneumoniaData& dst);
@@ -32,6 +32,11 @@ void SEPatientCondition::Serialize(const cdm::PatientConditionData& src, SEPatie
   SECondition::Serialize(src.condition(), dst);
 }
 
+void SEPatientCondition::Copy(const SEPatientCondition& src, SEPatientCondition& dst)
+{
+  SECondition::Copy(src, dst);
+}
+
 void SEPatientCondition::Serialize(const SEPatientCondition& src, cdm::PatientConditionData& dst)
 {
   SECondition::Serialize(src, *dst.mutable_condition());
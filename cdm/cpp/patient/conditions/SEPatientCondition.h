@@ -23,6 +23,7 @@ public:
 protected:
   static void Serialize(const cdm::PatientConditionData& src, SEPatientCondition& dst);
   static void Serialize(const SEPatientCondition& src, cdm::PatientConditionData& dst);
+  static void Copy(const SEPatientCondition& src, SEPatientCondition& dst);
 
 public:
   virtual void ToString(std::ostream &str) const = 0;
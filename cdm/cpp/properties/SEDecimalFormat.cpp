@@ -73,7 +73,7 @@ cdm::DecimalFormatData::eType SEDecimalFormat::GetNotation()
   return m_Notation;
 }
 
-void SEDecimalFormat::SetStream(std::ofstream& s)
+void SEDecimalFormat::SetStream(std::ostream& s)
 {
   switch (m_Notation)
   {
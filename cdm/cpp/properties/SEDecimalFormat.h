@@ -27,7 +27,7 @@ public:
   void SetNotation(cdm::DecimalFormatData::eType n);
   cdm::DecimalFormatData::eType GetNotation();
 
-  void SetStream(std::ofstream& s);
+  void SetStream(std::ostream& s);
 
 protected:
   std::streamsize               m_Precision;
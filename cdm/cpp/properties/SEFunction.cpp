@@ -61,6 +61,12 @@ void SEFunction::Serialize(const cdm::FunctionData& src, SEFunction& dst)
     dst.m_Independent.push_back(src.independent().value(i));
 }
 
+void SEFunction::Copy(const SEFunction& src, SEFunction& dst)
+{
+  dst.m_Dependent = src.m_Dependent;
+  dst.m_Independent = src.m_Independent;
+}
+
 cdm::FunctionData* SEFunction::Unload(const SEFunction& src)
 {
   if (!src.IsValid())
@@ -16,6 +16,7 @@ public:
 
   static void Load(const cdm::FunctionData& src, SEFunction& dst);
   static cdm::FunctionData* Unload(const SEFunction& src);
+  static void Copy(const SEFunction& src, SEFunction& dst);
 protected:
   static void Serialize(const cdm::FunctionData& src, SEFunction& dst);
   static void Serialize(const SEFunction& src, cdm::FunctionData& dst);
@@ -37,6 +37,13 @@ void SEFunctionElectricPotentialVsTime::Serialize(const cdm::FunctionElectricPot
   dst.m_ElectricPotentialUnit = &ElectricPotentialUnit::GetCompoundUnit(src.functionelectricpotentialvstime().dependentunit());
 }
 
+void SEFunctionElectricPotentialVsTime::Copy(const SEFunctionElectricPotentialVsTime& src, SEFunctionElectricPotentialVsTime& dst)
+{
+  SEFunction::Copy(src, dst);
+  dst.m_TimeUnit = src.m_TimeUnit;
+  dst.m_ElectricPotentialUnit = src.m_ElectricPotentialUnit;
+}
+
 cdm::FunctionElectricPotentialVsTimeData* SEFunctionElectricPotentialVsTime::Unload(const SEFunctionElectricPotentialVsTime& src)
 {
   if (!src.IsValid())
@@ -64,7 +71,11 @@ std::vector<double>& SEFunctionElectricPotentialVsTime::GetTime()
 {
   return m_Independent;
 }
-const TimeUnit* SEFunctionElectricPotentialVsTime::GetTimeUnit()
+const std::vector<double>& SEFunctionElectricPotentialVsTime::GetTime() const
+{
+  return m_Independent;
+}
+const TimeUnit* SEFunctionElectricPotentialVsTime::GetTimeUnit() const
 {
   return m_TimeUnit;
 }
@@ -85,7 +96,11 @@ std::vector<double>& SEFunctionElectricPotentialVsTime::GetElectricPotential()
 {
   return m_Dependent;
 }
-const ElectricPotentialUnit* SEFunctionElectricPotentialVsTime::GetElectricPotentialUnit()
+const std::vector<double>& SEFunctionElectricPotentialVsTime::GetElectricPotential() const
+{
+  return m_Dependent;
+}
+const ElectricPotentialUnit* SEFunctionElectricPotentialVsTime::GetElectricPotentialUnit() const
 {
   return m_ElectricPotentialUnit;
 }
@@ -15,6 +15,7 @@ public:
 
   static void Load(const cdm::FunctionElectricPotentialVsTimeData& src, SEFunctionElectricPotentialVsTime& dst);
   static cdm::FunctionElectricPotentialVsTimeData* Unload(const SEFunctionElectricPotentialVsTime& src);
+  static void Copy(const SEFunctionElectricPotentialVsTime& src, SEFunctionElectricPotentialVsTime& dst);
 protected:
   static void Serialize(const cdm::FunctionElectricPotentialVsTimeData& src, SEFunctionElectricPotentialVsTime& dst);
   static void Serialize(const SEFunctionElectricPotentialVsTime& src, cdm::FunctionElectricPotentialVsTimeData& dst);
@@ -23,13 +24,15 @@ public:
   double                               GetIndependentValue(size_t index) = delete;
   virtual double                       GetTimeValue(size_t index, const TimeUnit& unit);
   virtual std::vector<double>&         GetTime();
-  virtual const TimeUnit*              GetTimeUnit();
+  virtual const std::vector<double>&   GetTime() const;
+  virtual const TimeUnit*              GetTimeUnit() const;
   virtual void                         SetTimeUnit(const TimeUnit& unit);
 
   double                               GetDependentValue(size_t index) = delete;
   virtual double                       GetElectricPotentialValue(size_t index, const ElectricPotentialUnit& unit);
   virtual std::vector<double>&         GetElectricPotential();
-  virtual const ElectricPotentialUnit* GetElectricPotentialUnit();
+  virtual const std::vector<double>&   GetElectricPotential() const;
+  virtual const ElectricPotentialUnit* GetElectricPotentialUnit() const;
   virtual void                         SetElectricPotentialUnit(const ElectricPotentialUnit& unit);
 
   virtual SEFunctionElectricPotentialVsTime* InterpolateToTime(std::vector<double>& Independent, const TimeUnit& unit);
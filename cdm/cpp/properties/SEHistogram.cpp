@@ -66,6 +66,12 @@ void SEHistogram::Serialize(const cdm::HistogramData& src, SEHistogram& dst)
     dst.m_Independent.push_back(src.histogram().independent().value(i));
 }
 
+void SEHistogram::Copy(const SEHistogram& src, SEHistogram& dst)
+{
+  dst.m_Dependent = src.m_Dependent;
+  dst.m_Independent = src.m_Independent;
+}
+
 cdm::HistogramData* SEHistogram::Unload(const SEHistogram& src)
 {
   if (!src.IsValid())
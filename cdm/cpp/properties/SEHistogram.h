@@ -16,6 +16,7 @@ public:
 
   static void Load(const cdm::HistogramData& src, SEHistogram& dst);
   static cdm::HistogramData* Unload(const SEHistogram& src);
+  static void Copy(const SEHistogram& src, SEHistogram& dst);
 protected:
   static void Serialize(const cdm::HistogramData& src, SEHistogram& dst);
   static void Serialize(const SEHistogram& src, cdm::HistogramData& dst);
@@ -51,6 +51,12 @@ void SEHistogramFractionVsLength::Serialize(const cdm::HistogramFractionVsLength
     dst.m_Independent.push_back(src.histogramfractionvslength().histogram().independent().value(i));
 }
 
+void SEHistogramFractionVsLength::Copy(const SEHistogramFractionVsLength& src, SEHistogramFractionVsLength& dst)
+{
+  SEHistogram::Copy(src, dst);
+  dst.m_LengthUnit = src.m_LengthUnit;
+}
+
 cdm::HistogramFractionVsLengthData* SEHistogramFractionVsLength::Unload(const SEHistogramFractionVsLength& src)
 {
   if (!src.IsValid())
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::HistogramFractionVsLengthData& src, SEHistogramFractionVsLength& dst);
   static cdm::HistogramFractionVsLengthData* Unload(const SEHistogramFractionVsLength& src);
+  static void Copy(const SEHistogramFractionVsLength& src, SEHistogramFractionVsLength& dst);
 protected:
   static void Serialize(const cdm::HistogramFractionVsLengthData& src, SEHistogramFractionVsLength& dst);
   static void Serialize(const SEHistogramFractionVsLength& src, cdm::HistogramFractionVsLengthData& dst);
@@ -284,12 +284,50 @@ double SEGenericScalar::GetValue(const CCompoundUnit& unit) const
 }
 
 
+// Conversion factors between two units, cached by Convert
+struct UnitConversionFactors
+{
+  const CCompoundUnit* from = nullptr;
+  const CCompoundUnit* to = nullptr;
+  uint64_t fromRevision = 0;
+  uint64_t toRevision = 0;
+  bool     decibel = false;
+  double   fromBias = 0;
+  double   bignessRatio = 1;
+  double   toBias = 0;
+};
+#define UNIT_CONVERSION_CACHE_SIZE 256 // Must be a power of 2
+
 double Convert(double d, const CCompoundUnit& from, const CCompoundUnit& to)
 {
   if (&from == &to)
     return d;
+  // Almost all conversions are between the same handful of static units (mL, L, mmHg, cmH2O, ...)
+  // so the bias and bigness of each (from,to) pair is cached, turning a conversion into a multiply-add.
+  // The cache is per thread, so there is no locking, and entries are validated against the unit revisions
+  // so a unit that is modified, or a new unit allocated at the address of a deleted one, is recomputed.
+  thread_local UnitConversionFactors cache[UNIT_CONVERSION_CACHE_SIZE];
+  size_t hash = (reinterpret_cast<size_t>(&from) >> 4) * 31 + (reinterpret_cast<size_t>(&to) >> 4);
+  UnitConversionFactors& f = cache[hash & (UNIT_CONVERSION_CACHE_SIZE - 1)];
+  if (f.from != &from || f.to != &to || f.fromRevision != from.GetRevision() || f.toRevision != to.GetRevision())
+  {
+    f.from = &from;
+    f.to = &to;
+    f.fromRevision = from.GetRevision();
+    f.toRevision = to.GetRevision();
+    f.decibel = from.IsDecibel() || to.IsDecibel();
+    f.fromBias = from.GetBias();
+    f.bignessRatio = from.GetBigness() / to.GetBigness();
+    f.toBias = to.GetBias();
+  }
   // I am assuming we are not going to do Quantity A to Quantity B Conversions
-  return CUnitConversionEngine::GetEngine().QuickConvertValue(d,from,to);
+  if (f.decibel)
+    return CUnitConversionEngine::GetEngine().QuickConvertValue(d, from, to);
+  // Same operations, in the same order, as QuickConvertValue
+  d -= f.fromBias;
+  d *= f.bignessRatio;
+  d += f.toBias;
+  return d;
 }
 bool   CompatibleUnits(const CCompoundUnit& from, const CCompoundUnit& to)
 {  
@@ -271,4 +271,25 @@ inline void IncrementOverride(SEScalarQuantity<Unit>& s, double value, const Uni
   s.SetReadOnly(b);
 }
 
+// Mirrors everything about the scalar a member pointer holds, value, unit, validity and read only state,
+// as a Serialize/Load round trip would. A missing source scalar leaves the destination invalid.
+template<class ScalarType>
+inline void CopyScalar(const ScalarType* from, ScalarType*& to)
+{
+  if (from == nullptr)
+  {
+    if (to != nullptr)
+    {
+      to->SetReadOnly(false);
+      to->Invalidate();
+    }
+    return;
+  }
+  if (to == nullptr)
+    to = new ScalarType();
+  to->SetReadOnly(false);
+  to->Copy(*from);
+  to->SetReadOnly(from->IsReadOnly());
+}
+
 #include "properties/SEScalar.inl"
\ No newline at end of file
@@ -107,6 +107,12 @@ void SEAction::Serialize(const cdm::ActionData& src, SEAction& dst)
   dst.SetComment(src.comment());
 }
 
+void SEAction::Copy(const SEAction& src, SEAction& dst)
+{
+  dst.Clear();
+  dst.m_Comment = src.m_Comment;
+}
+
 void SEAction::Serialize(const SEAction& src, cdm::ActionData& dst)
 {
   dst.set_comment(src.m_Comment);
@@ -8,6 +8,68 @@ PROTO_PUSH
 #include "bind/cdm/Scenario.pb.h"
 PROTO_POP
 
+// The collection an action is processed by
+enum class eActionCategory
+{
+  Scenario,
+  Patient,
+  Environment,
+  AnesthesiaMachine,
+  Inhaler
+};
+
+// Every concrete action type, so actions can be dispatched with a switch rather than a chain of dynamic_casts
+enum class eActionType
+{
+  // Scenario
+  AdvanceTime,
+  SerializeState,
+  // Patient
+  PatientAssessmentRequest,
+  AcuteStress,
+  AirwayObstruction,
+  Apnea,
+  AsthmaAttack,
+  BrainInjury,
+  Bronchoconstriction,
+  CardiacArrest,
+  ChestCompressionForce,
+  ChestCompressionForceScale,
+  ChestOcclusiveDressing,
+  ConsciousRespiration,
+  ConsumeNutrients,
+  Exercise,
+  Hemorrhage,
+  Intubation,
+  MechanicalVentilation,
+  NeedleDecompression,
+  PericardialEffusion,
+  SubstanceBolus,
+  SubstanceCompoundInfusion,
+  SubstanceInfusion,
+  TensionPneumothorax,
+  Urinate,
+  // Environment
+  ChangeEnvironmentConditions,
+  ThermalApplication,
+  // Anesthesia Machine
+  AnesthesiaMachineConfiguration,
+  ExpiratoryValveLeak,
+  ExpiratoryValveObstruction,
+  InspiratoryValveLeak,
+  InspiratoryValveObstruction,
+  MaskLeak,
+  OxygenTankPressureLoss,
+  OxygenWallPortPressureLoss,
+  SodaLimeFailure,
+  TubeCuffLeak,
+  VaporizerFailure,
+  VentilatorPressureLoss,
+  YPieceDisconnect,
+  // Inhaler
+  InhalerConfiguration
+};
+
 class CDM_DECL SEAction : public Loggable
 {
 public:
@@ -23,6 +85,11 @@ public:
   *  This method will encapsulate that logic in a single function */
   virtual bool IsActive() const { return IsValid(); }
 
+  /** The collection this action belongs to, provided by each action category base class */
+  virtual eActionCategory GetActionCategory() const = 0;
+  /** The concrete type of this action, provided by each action class */
+  virtual eActionType GetActionType() const = 0;
+
   /** Create a new action based on the binding object, load that data into the new action, and return said action */
   static SEAction* Load(const cdm::AnyActionData& action, SESubstanceManager& subMgr);
   /** Create a new bind object, unload the action, put that in the bind object, and return said bind object */
@@ -30,6 +97,7 @@ public:
 protected:
   static void Serialize(const cdm::ActionData& src, SEAction& dst);
   static void Serialize(const SEAction& src, cdm::ActionData& dst);
+  static void Copy(const SEAction& src, SEAction& dst);
 
 public:
 
@@ -11,7 +11,7 @@ SEActionManager::SEActionManager(SESubstanceManager& substances) : Loggable(subs
                                                                    m_InhalerActions(substances),
                                                                    m_Substances(substances)
 {
-  
+  m_RecordProcessedActions = true;
 }
 
 SEActionManager::~SEActionManager()
@@ -42,6 +42,18 @@ void SEActionManager::Serialize(const cdm::ActionListData& src, SEActionManager&
   }
 }
 
+void SEActionManager::Copy(const SEActionManager& src, SEActionManager& dst)
+{
+  dst.Clear();
+  SEPatientActionCollection::Copy(src.m_PatientActions, dst.m_PatientActions);
+  SEEnvironmentActionCollection::Copy(src.m_EnvironmentActions, dst.m_EnvironmentActions);
+  SEAnesthesiaMachineActionCollection::Copy(src.m_AnesthesiaMachineActions, dst.m_AnesthesiaMachineActions);
+  SEInhalerActionCollection::Copy(src.m_InhalerActions, dst.m_InhalerActions);
+  // The copy carries on the record of the source
+  if (dst.m_RecordProcessedActions && src.m_RecordProcessedActions)
+    dst.m_ProcessedActions.CopyFrom(src.m_ProcessedActions);
+}
+
 cdm::ActionListData* SEActionManager::Unload(const SEActionManager& src)
 {
   cdm::ActionListData* dst = new cdm::ActionListData();
@@ -56,6 +68,23 @@ void SEActionManager::Serialize(const SEActionManager& src, cdm::ActionListData&
   SEInhalerActionCollection::Serialize(src.m_InhalerActions, dst);
 }
 
+void SEActionManager::RecordProcessedActions(bool b)
+{
+  if (m_RecordProcessedActions != b)
+    m_ProcessedActions.Clear();
+  m_RecordProcessedActions = b;
+}
+
+const cdm::ActionListData& SEActionManager::GetActionList()
+{
+  if (!m_RecordProcessedActions)
+  {// Only the latest state of each active action is kept
+    m_ProcessedActions.Clear();
+    SEActionManager::Serialize(*this, m_ProcessedActions);
+  }
+  return m_ProcessedActions;
+}
+
 bool SEActionManager::ProcessAction(const SEAction& action)
 {
   if (!action.IsValid())
@@ -64,31 +93,33 @@ bool SEActionManager::ProcessAction(const SEAction& action)
     Error(m_ss);
     return false;
   }
-  bool bRet;
-  cdm::AnyActionData* aData = m_ProcessedActions.add_anyaction();
-  
-  const SEPatientAction* pa = dynamic_cast<const SEPatientAction*>(&action);
-  if (pa != nullptr)
-    bRet = m_PatientActions.ProcessAction(*pa,*aData->mutable_patientaction());
-
-  const SEEnvironmentAction* ea = dynamic_cast<const SEEnvironmentAction*>(&action);
-  if (ea != nullptr)
-    bRet = m_EnvironmentActions.ProcessAction(*ea, *aData->mutable_environmentaction());
-
-  const SEAnesthesiaMachineAction* aa = dynamic_cast<const SEAnesthesiaMachineAction*>(&action);
-  if (aa != nullptr)
-    bRet = m_AnesthesiaMachineActions.ProcessAction(*aa, *aData->mutable_anesthesiamachineaction());
-
-  const SEInhalerAction* ia = dynamic_cast<const SEInhalerAction*>(&action);
-  if (ia != nullptr)
-    bRet = m_InhalerActions.ProcessAction(*ia, *aData->mutable_inhaleraction());
+  bool bRet = false;
+  switch (action.GetActionCategory())
+  {
+    case eActionCategory::Patient:
+      bRet = m_PatientActions.ProcessAction(static_cast<const SEPatientAction&>(action));
+      break;
+    case eActionCategory::Environment:
+      bRet = m_EnvironmentActions.ProcessAction(static_cast<const SEEnvironmentAction&>(action));
+      break;
+    case eActionCategory::AnesthesiaMachine:
+      bRet = m_AnesthesiaMachineActions.ProcessAction(static_cast<const SEAnesthesiaMachineAction&>(action));
+      break;
+    case eActionCategory::Inhaler:
+      bRet = m_InhalerActions.ProcessAction(static_cast<const SEInhalerAction&>(action));
+      break;
+    default:
+      Error("Unsupported Action");
+      break;
+  }
 
   if (!bRet)
   {
     m_ss << "Not including action due to processing error : " << action;
     Error(m_ss);
-    m_ProcessedActions.mutable_anyaction()->RemoveLast();
   }
+  else if (m_RecordProcessedActions)
+    m_ProcessedActions.mutable_anyaction()->AddAllocated(SEAction::Unload(action));
   return bRet;
 }
 
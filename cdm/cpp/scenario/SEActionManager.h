@@ -23,6 +23,7 @@ public:
 
   static void Load(const cdm::ActionListData& src, SEActionManager& dst);
   static cdm::ActionListData* Unload(const SEActionManager& src);
+  static void Copy(const SEActionManager& src, SEActionManager& dst);
 protected:
   static void Serialize(const cdm::ActionListData& src, SEActionManager& dst);
   static void Serialize(const SEActionManager& src, cdm::ActionListData& dst);
@@ -36,8 +37,14 @@ public:
   SEAnesthesiaMachineActionCollection& GetAnesthesiaMachineActions() { return m_AnesthesiaMachineActions; }
   SEInhalerActionCollection&           GetInhalerActions()           { return m_InhalerActions; }
 
+  // By default, every processed action is kept in the action list
+  // Engines processing actions at a high rate can turn that off, the list then holds the latest state of each active action
+  // Either way, the collections copy the action directly, it is only unloaded when it is recorded
+  void RecordProcessedActions(bool b);
+  bool IsRecordingProcessedActions() const { return m_RecordProcessedActions; }
+
   // This is here in case you want to take all the actions from an engine and write them out so you can reproduce the same engine state later
-  const cdm::ActionListData& GetActionList() { return m_ProcessedActions; }// I don't really have anything that does that yet...
+  const cdm::ActionListData& GetActionList();// I don't really have anything that does that yet...
 
 protected:
 
@@ -47,6 +54,7 @@ protected:
   SEAnesthesiaMachineActionCollection m_AnesthesiaMachineActions;
   SEInhalerActionCollection           m_InhalerActions;
 
+  bool                                m_RecordProcessedActions;
   cdm::ActionListData                 m_ProcessedActions;
   
   std::stringstream m_ss;
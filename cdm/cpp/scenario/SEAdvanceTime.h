@@ -23,6 +23,8 @@ protected:
 
 public:
 
+  virtual eActionCategory GetActionCategory() const { return eActionCategory::Scenario; }
+  virtual eActionType GetActionType() const { return eActionType::AdvanceTime; }
   virtual void ToString(std::ostream &str) const;
 
   virtual bool HasTime() const;
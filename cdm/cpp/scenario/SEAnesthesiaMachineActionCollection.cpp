@@ -87,162 +87,174 @@ void SEAnesthesiaMachineActionCollection::Serialize(const SEAnesthesiaMachineAct
     dst.mutable_anyaction()->AddAllocated(SEAction::Unload(*src.m_YPieceDisconnect));
 }
 
-bool SEAnesthesiaMachineActionCollection::ProcessAction(const SEAnesthesiaMachineAction& action, cdm::AnyAnesthesiaMachineActionData& any)
+void SEAnesthesiaMachineActionCollection::Copy(const SEAnesthesiaMachineActionCollection& src, SEAnesthesiaMachineActionCollection& dst)
 {
-  const SEAnesthesiaMachineConfiguration* config = dynamic_cast<const SEAnesthesiaMachineConfiguration*>(&action);
-  if (config != nullptr)
-  {
-    if (m_Configuration == nullptr)
-      m_Configuration = new SEAnesthesiaMachineConfiguration(m_Substances);
-    any.set_allocated_configuration(SEAnesthesiaMachineConfiguration::Unload(*config));
-    SEAnesthesiaMachineConfiguration::Load(any.configuration(), *m_Configuration);
-    if (!m_Configuration->IsActive())
-      RemoveConfiguration();
-    return true;
-  }
-
-  const SEOxygenTankPressureLoss* O2Tank = dynamic_cast<const SEOxygenTankPressureLoss*>(&action);
-  if (O2Tank != nullptr)
-  {
-    if (m_OxygenTankPressureLoss == nullptr)
-      m_OxygenTankPressureLoss = new SEOxygenTankPressureLoss();
-    any.set_allocated_oxygentankpressureloss(SEOxygenTankPressureLoss::Unload(*O2Tank));
-    SEOxygenTankPressureLoss::Load(any.oxygentankpressureloss(), *m_OxygenTankPressureLoss);
-    if (!m_OxygenTankPressureLoss->IsActive())
-      RemoveOxygenTankPressureLoss();
-    return true;
-  }
-
-  const SEOxygenWallPortPressureLoss* O2Wall = dynamic_cast<const SEOxygenWallPortPressureLoss*>(&action);
-  if (O2Wall != nullptr)
-  {
-    if (m_OxygenWallPortPressureLoss == nullptr)
-      m_OxygenWallPortPressureLoss = new SEOxygenWallPortPressureLoss();
-    any.set_allocated_oxygenwallportpressureloss(SEOxygenWallPortPressureLoss::Unload(*O2Wall));
-    SEOxygenWallPortPressureLoss::Load(any.oxygenwallportpressureloss(), *m_OxygenWallPortPressureLoss);
-    if (!m_OxygenWallPortPressureLoss->IsActive())
-      RemoveOxygenWallPortPressureLoss();
-    return true;
-  }
-
-  const SEExpiratoryValveLeak* eLeak = dynamic_cast<const SEExpiratoryValveLeak*>(&action);
-  if (eLeak != nullptr)
-  {
-    if (m_ExpiratoryValveLeak == nullptr)
-      m_ExpiratoryValveLeak = new SEExpiratoryValveLeak();
-    any.set_allocated_expiratoryvalveleak(SEExpiratoryValveLeak::Unload(*eLeak));
-    SEExpiratoryValveLeak::Load(any.expiratoryvalveleak(), *m_ExpiratoryValveLeak);
-    if (!m_ExpiratoryValveLeak->IsActive())
-      RemoveExpiratoryValveLeak();
-    return true;
-  }
-
-  const SEExpiratoryValveObstruction* eOb = dynamic_cast<const SEExpiratoryValveObstruction*>(&action);
-  if (eOb != nullptr)
-  {
-    if (m_ExpiratoryValveObstruction == nullptr)
-      m_ExpiratoryValveObstruction = new SEExpiratoryValveObstruction();
-    any.set_allocated_expiratoryvalveobstruction(SEExpiratoryValveObstruction::Unload(*eOb));
-    SEExpiratoryValveObstruction::Load(any.expiratoryvalveobstruction(), *m_ExpiratoryValveObstruction);
-    if (!m_ExpiratoryValveObstruction->IsActive())
-      RemoveExpiratoryValveObstruction();
-    return true;
-  }
-
-  const SEInspiratoryValveLeak* iLeak = dynamic_cast<const SEInspiratoryValveLeak*>(&action);
-  if (iLeak != nullptr)
-  {
-    if (m_InspiratoryValveLeak == nullptr)
-      m_InspiratoryValveLeak = new SEInspiratoryValveLeak();
-    any.set_allocated_inspiratoryvalveleak(SEInspiratoryValveLeak::Unload(*iLeak));
-    SEInspiratoryValveLeak::Load(any.inspiratoryvalveleak(), *m_InspiratoryValveLeak);
-    if (!m_InspiratoryValveLeak->IsActive())
-      RemoveInspiratoryValveLeak();
-    return true;
-  }
-
-  const SEInspiratoryValveObstruction* iOb = dynamic_cast<const SEInspiratoryValveObstruction*>(&action);
-  if (iOb != nullptr)
-  {
-    if (m_InspiratoryValveObstruction == nullptr)
-      m_InspiratoryValveObstruction = new SEInspiratoryValveObstruction();
-    any.set_allocated_inspiratoryvalveobstruction(SEInspiratoryValveObstruction::Unload(*iOb));
-    SEInspiratoryValveObstruction::Load(any.inspiratoryvalveobstruction(), *m_InspiratoryValveObstruction);
-    if (!m_InspiratoryValveObstruction->IsActive())
-      RemoveInspiratoryValveObstruction();
-    return true;
-  }
-
-  const SEMaskLeak* mask = dynamic_cast<const SEMaskLeak*>(&action);
-  if (mask != nullptr)
-  {
-    if (m_MaskLeak == nullptr)
-      m_MaskLeak = new SEMaskLeak();
-    any.set_allocated_maskleak(SEMaskLeak::Unload(*mask));
-    SEMaskLeak::Load(any.maskleak(), *m_MaskLeak);
-    if (!m_MaskLeak->IsActive())
-      RemoveMaskLeak();
-    return true;
-  }
-
-  const SESodaLimeFailure* soda = dynamic_cast<const SESodaLimeFailure*>(&action);
-  if (soda != nullptr)
-  {
-    if (m_SodaLimeFailure == nullptr)
-      m_SodaLimeFailure = new SESodaLimeFailure();
-    any.set_allocated_sodalimefailure(SESodaLimeFailure::Unload(*soda));
-    SESodaLimeFailure::Load(any.sodalimefailure(), *m_SodaLimeFailure);
-    if (!m_SodaLimeFailure->IsActive())
-      RemoveSodaLimeFailure();
-    return true;
-  }
-
-  const SETubeCuffLeak* tube = dynamic_cast<const SETubeCuffLeak*>(&action);
-  if (tube != nullptr)
-  {
-    if (m_TubeCuffLeak == nullptr)
-      m_TubeCuffLeak = new SETubeCuffLeak();
-    any.set_allocated_tubecuffleak(SETubeCuffLeak::Unload(*tube));
-    SETubeCuffLeak::Load(any.tubecuffleak(), *m_TubeCuffLeak);
-    if (!m_TubeCuffLeak->IsActive())
-      RemoveTubeCuffLeak();
-    return true;
-  }
+  if (src.HasConfiguration())
+    dst.ProcessAction(*src.m_Configuration);
 
-  const SEVaporizerFailure* vFail = dynamic_cast<const SEVaporizerFailure*>(&action);
-  if (vFail != nullptr)
-  {
-    if (m_VaporizerFailure == nullptr)
-      m_VaporizerFailure = new SEVaporizerFailure();
-    any.set_allocated_vaporizerfailure(SEVaporizerFailure::Unload(*vFail));
-    SEVaporizerFailure::Load(any.vaporizerfailure(), *m_VaporizerFailure);
-    if (!m_VaporizerFailure->IsActive())
-      RemoveVaporizerFailure();
-    return true;
-  }
+  if (src.HasOxygenTankPressureLoss())
+    dst.ProcessAction(*src.m_OxygenTankPressureLoss);
+  if (src.HasOxygenWallPortPressureLoss())
+    dst.ProcessAction(*src.m_OxygenWallPortPressureLoss);
 
-  const SEVentilatorPressureLoss* vLoss = dynamic_cast<const SEVentilatorPressureLoss*>(&action);
-  if (vLoss != nullptr)
-  {
-    if (m_VentilatorPressureLoss == nullptr)
-      m_VentilatorPressureLoss = new SEVentilatorPressureLoss();
-    any.set_allocated_ventilatorpressureloss(SEVentilatorPressureLoss::Unload(*vLoss));
-    SEVentilatorPressureLoss::Load(any.ventilatorpressureloss(), *m_VentilatorPressureLoss);
-    if (!m_VentilatorPressureLoss->IsActive())
-      RemoveVentilatorPressureLoss();
-    return true;
-  }
+  if (src.HasExpiratoryValveLeak())
+    dst.ProcessAction(*src.m_ExpiratoryValveLeak);
+  if (src.HasExpiratoryValveObstruction())
+    dst.ProcessAction(*src.m_ExpiratoryValveObstruction);
+  if (src.HasInspiratoryValveLeak())
+    dst.ProcessAction(*src.m_InspiratoryValveLeak);
+  if (src.HasInspiratoryValveObstruction())
+    dst.ProcessAction(*src.m_InspiratoryValveObstruction);
+  if (src.HasMaskLeak())
+    dst.ProcessAction(*src.m_MaskLeak);
+  if (src.HasSodaLimeFailure())
+    dst.ProcessAction(*src.m_SodaLimeFailure);
+  if (src.HasTubeCuffLeak())
+    dst.ProcessAction(*src.m_TubeCuffLeak);
+  if (src.HasVaporizerFailure())
+    dst.ProcessAction(*src.m_VaporizerFailure);
+  if (src.HasVentilatorPressureLoss())
+    dst.ProcessAction(*src.m_VentilatorPressureLoss);
+  if (src.HasYPieceDisconnect())
+    dst.ProcessAction(*src.m_YPieceDisconnect);
+}
 
-  const SEYPieceDisconnect* Y = dynamic_cast<const SEYPieceDisconnect*>(&action);
-  if (Y != nullptr)
+bool SEAnesthesiaMachineActionCollection::ProcessAction(const SEAnesthesiaMachineAction& action)
+{
+  switch (action.GetActionType())
   {
-    if (m_YPieceDisconnect == nullptr)
-      m_YPieceDisconnect = new SEYPieceDisconnect();
-    any.set_allocated_ypiecedisconnect(SEYPieceDisconnect::Unload(*Y));
-    SEYPieceDisconnect::Load(any.ypiecedisconnect(), *m_YPieceDisconnect);
-    if (!m_YPieceDisconnect->IsActive())
-      RemoveYPieceDisconnect();
-    return true;
+    case eActionType::AnesthesiaMachineConfiguration:
+    {
+      const SEAnesthesiaMachineConfiguration* config = static_cast<const SEAnesthesiaMachineConfiguration*>(&action);
+      if (m_Configuration == nullptr)
+        m_Configuration = new SEAnesthesiaMachineConfiguration(m_Substances);
+      SEAnesthesiaMachineConfiguration::Copy(*config, *m_Configuration);
+      if (!m_Configuration->IsActive())
+        RemoveConfiguration();
+      return true;
+    }
+    case eActionType::OxygenTankPressureLoss:
+    {
+      const SEOxygenTankPressureLoss* O2Tank = static_cast<const SEOxygenTankPressureLoss*>(&action);
+      if (m_OxygenTankPressureLoss == nullptr)
+        m_OxygenTankPressureLoss = new SEOxygenTankPressureLoss();
+      SEOxygenTankPressureLoss::Copy(*O2Tank, *m_OxygenTankPressureLoss);
+      if (!m_OxygenTankPressureLoss->IsActive())
+        RemoveOxygenTankPressureLoss();
+      return true;
+    }
+    case eActionType::OxygenWallPortPressureLoss:
+    {
+      const SEOxygenWallPortPressureLoss* O2Wall = static_cast<const SEOxygenWallPortPressureLoss*>(&action);
+      if (m_OxygenWallPortPressureLoss == nullptr)
+        m_OxygenWallPortPressureLoss = new SEOxygenWallPortPressureLoss();
+      SEOxygenWallPortPressureLoss::Copy(*O2Wall, *m_OxygenWallPortPressureLoss);
+      if (!m_OxygenWallPortPressureLoss->IsActive())
+        RemoveOxygenWallPortPressureLoss();
+      return true;
+    }
+    case eActionType::ExpiratoryValveLeak:
+    {
+      const SEExpiratoryValveLeak* eLeak = static_cast<const SEExpiratoryValveLeak*>(&action);
+      if (m_ExpiratoryValveLeak == nullptr)
+        m_ExpiratoryValveLeak = new SEExpiratoryValveLeak();
+      SEExpiratoryValveLeak::Copy(*eLeak, *m_ExpiratoryValveLeak);
+      if (!m_ExpiratoryValveLeak->IsActive())
+        RemoveExpiratoryValveLeak();
+      return true;
+    }
+    case eActionType::ExpiratoryValveObstruction:
+    {
+      const SEExpiratoryValveObstruction* eOb = static_cast<const SEExpiratoryValveObstruction*>(&action);
+      if (m_ExpiratoryValveObstruction == nullptr)
+        m_ExpiratoryValveObstruction = new SEExpiratoryValveObstruction();
+      SEExpiratoryValveObstruction::Copy(*eOb, *m_ExpiratoryValveObstruction);
+      if (!m_ExpiratoryValveObstruction->IsActive())
+        RemoveExpiratoryValveObstruction();
+      return true;
+    }
+    case eActionType::InspiratoryValveLeak:
+    {
+      const SEInspiratoryValveLeak* iLeak = static_cast<const SEInspiratoryValveLeak*>(&action);
+      if (m_InspiratoryValveLeak == nullptr)
+        m_InspiratoryValveLeak = new SEInspiratoryValveLeak();
+      SEInspiratoryValveLeak::Copy(*iLeak, *m_InspiratoryValveLeak);
+      if (!m_InspiratoryValveLeak->IsActive())
+        RemoveInspiratoryValveLeak();
+      return true;
+    }
+    case eActionType::InspiratoryValveObstruction:
+    {
+      const SEInspiratoryValveObstruction* iOb = static_cast<const SEInspiratoryValveObstruction*>(&action);
+      if (m_InspiratoryValveObstruction == nullptr)
+        m_InspiratoryValveObstruction = new SEInspiratoryValveObstruction();
+      SEInspiratoryValveObstruction::Copy(*iOb, *m_InspiratoryValveObstruction);
+      if (!m_InspiratoryValveObstruction->IsActive())
+        RemoveInspiratoryValveObstruction();
+      return true;
+    }
+    case eActionType::MaskLeak:
+    {
+      const SEMaskLeak* mask = static_cast<const SEMaskLeak*>(&action);
+      if (m_MaskLeak == nullptr)
+        m_MaskLeak = new SEMaskLeak();
+      SEMaskLeak::Copy(*mask, *m_MaskLeak);
+      if (!m_MaskLeak->IsActive())
+        RemoveMaskLeak();
+      return true;
+    }
+    case eActionType::SodaLimeFailure:
+    {
+      const SESodaLimeFailure* soda = static_cast<const SESodaLimeFailure*>(&action);
+      if (m_SodaLimeFailure == nullptr)
+        m_SodaLimeFailure = new SESodaLimeFailure();
+      SESodaLimeFailure::Copy(*soda, *m_SodaLimeFailure);
+      if (!m_SodaLimeFailure->IsActive())
+        RemoveSodaLimeFailure();
+      return true;
+    }
+    case eActionType::TubeCuffLeak:
+    {
+      const SETubeCuffLeak* tube = static_cast<const SETubeCuffLeak*>(&action);
+      if (m_TubeCuffLeak == nullptr)
+        m_TubeCuffLeak = new SETubeCuffLeak();
+      SETubeCuffLeak::Copy(*tube, *m_TubeCuffLeak);
+      if (!m_TubeCuffLeak->IsActive())
+        RemoveTubeCuffLeak();
+      return true;
+    }
+    case eActionType::VaporizerFailure:
+    {
+      const SEVaporizerFailure* vFail = static_cast<const SEVaporizerFailure*>(&action);
+      if (m_VaporizerFailure == nullptr)
+        m_VaporizerFailure = new SEVaporizerFailure();
+      SEVaporizerFailure::Copy(*vFail, *m_VaporizerFailure);
+      if (!m_VaporizerFailure->IsActive())
+        RemoveVaporizerFailure();
+      return true;
+    }
+    case eActionType::VentilatorPressureLoss:
+    {
+      const SEVentilatorPressureLoss* vLoss = static_cast<const SEVentilatorPressureLoss*>(&action);
+      if (m_VentilatorPressureLoss == nullptr)
+        m_VentilatorPressureLoss = new SEVentilatorPressureLoss();
+      SEVentilatorPressureLoss::Copy(*vLoss, *m_VentilatorPressureLoss);
+      if (!m_VentilatorPressureLoss->IsActive())
+        RemoveVentilatorPressureLoss();
+      return true;
+    }
+    case eActionType::YPieceDisconnect:
+    {
+      const SEYPieceDisconnect* Y = static_cast<const SEYPieceDisconnect*>(&action);
+      if (m_YPieceDisconnect == nullptr)
+        m_YPieceDisconnect = new SEYPieceDisconnect();
+      SEYPieceDisconnect::Copy(*Y, *m_YPieceDisconnect);
+      if (!m_YPieceDisconnect->IsActive())
+        RemoveYPieceDisconnect();
+      return true;
+    }
+    default:
+      break;
   }
   /// \error Unsupported Action
   Error("Unsupported Action");
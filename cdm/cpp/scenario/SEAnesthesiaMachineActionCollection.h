@@ -87,7 +87,8 @@ public:
 protected:
   void Clear();
   static void Serialize(const SEAnesthesiaMachineActionCollection& src, cdm::ActionListData& dst);
-  bool ProcessAction(const SEAnesthesiaMachineAction& action, cdm::AnyAnesthesiaMachineActionData& any);
+  static void Copy(const SEAnesthesiaMachineActionCollection& src, SEAnesthesiaMachineActionCollection& dst);
+  bool ProcessAction(const SEAnesthesiaMachineAction& action);
 
   SEAnesthesiaMachineConfiguration*           m_Configuration;
   //Anesthesia Machine Incidents
@@ -60,6 +60,12 @@ void SECondition::Serialize(const cdm::ConditionData& src, SECondition& dst)
   dst.SetComment(src.comment());
 }
 
+void SECondition::Copy(const SECondition& src, SECondition& dst)
+{
+  dst.Clear();
+  dst.m_Comment = src.m_Comment;
+}
+
 void SECondition::Serialize(const SECondition& src, cdm::ConditionData& dst)
 {
   dst.set_comment(src.m_Comment);
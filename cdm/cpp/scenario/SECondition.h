@@ -24,6 +24,7 @@ public:
 protected:
   static void Serialize(const cdm::ConditionData& src, SECondition& dst);
   static void Serialize(const SECondition& src, cdm::ConditionData& dst);
+  static void Copy(const SECondition& src, SECondition& dst);
 
 public:
   /** Test if the Condition has all data it needs */
@@ -50,6 +50,58 @@ void SEConditionManager::Serialize(const cdm::ConditionListData& src, SEConditio
   }
 }
 
+void SEConditionManager::Copy(const SEConditionManager& src, SEConditionManager& dst)
+{
+  dst.Clear();
+  // The list only records what was processed, it is copied as is
+  dst.m_Conditions.CopyFrom(src.m_Conditions);
+  if (src.m_Anemia != nullptr)
+  {
+    dst.m_Anemia = new SEChronicAnemia();
+    SEChronicAnemia::Copy(*src.m_Anemia, *dst.m_Anemia);
+  }
+  if (src.m_COPD != nullptr)
+  {
+    dst.m_COPD = new SEChronicObstructivePulmonaryDisease();
+    SEChronicObstructivePulmonaryDisease::Copy(*src.m_COPD, *dst.m_COPD);
+  }
+  if (src.m_ChronicVentricularSystolicDysfunction != nullptr)
+  {
+    dst.m_ChronicVentricularSystolicDysfunction = new SEChronicVentricularSystolicDysfunction();
+    SEChronicVentricularSystolicDysfunction::Copy(*src.m_ChronicVentricularSystolicDysfunction, *dst.m_ChronicVentricularSystolicDysfunction);
+  }
+  if (src.m_RenalStenosis != nullptr)
+  {
+    dst.m_RenalStenosis = new SEChronicRenalStenosis();
+    SEChronicRenalStenosis::Copy(*src.m_RenalStenosis, *dst.m_RenalStenosis);
+  }
+  if (src.m_ConsumeMeal != nullptr)
+  {
+    dst.m_ConsumeMeal = new SEConsumeMeal();
+    SEConsumeMeal::Copy(*src.m_ConsumeMeal, *dst.m_ConsumeMeal);
+  }
+  if (src.m_LobarPneumonia != nullptr)
+  {
+    dst.m_LobarPneumonia = new SELobarPneumonia();
+    SELobarPneumonia::Copy(*src.m_LobarPneumonia, *dst.m_LobarPneumonia);
+  }
+  if (src.m_PericardialEffusion != nullptr)
+  {
+    dst.m_PericardialEffusion = new SEChronicPericardialEffusion();
+    SEChronicPericardialEffusion::Copy(*src.m_PericardialEffusion, *dst.m_PericardialEffusion);
+  }
+  if (src.m_ImpairedAlveolarExchange != nullptr)
+  {
+    dst.m_ImpairedAlveolarExchange = new SEImpairedAlveolarExchange();
+    SEImpairedAlveolarExchange::Copy(*src.m_ImpairedAlveolarExchange, *dst.m_ImpairedAlveolarExchange);
+  }
+  if (src.m_InitialEnvironmentConditions != nullptr)
+  {
+    dst.m_InitialEnvironmentConditions = new SEInitialEnvironmentConditions(dst.m_Substances);
+    SEInitialEnvironmentConditions::Copy(*src.m_InitialEnvironmentConditions, *dst.m_InitialEnvironmentConditions);
+  }
+}
+
 cdm::ConditionListData* SEConditionManager::Unload(const SEConditionManager& src)
 {
   cdm::ConditionListData* dst = new cdm::ConditionListData();
@@ -30,6 +30,7 @@ public:
 
   static void Load(const cdm::ConditionListData& src, SEConditionManager& dst);
   static cdm::ConditionListData* Unload(const SEConditionManager& src);
+  static void Copy(const SEConditionManager& src, SEConditionManager& dst);
 protected:
   static void Serialize(const cdm::ConditionListData& src, SEConditionManager& dst);
   static void Serialize(const SEConditionManager& src, cdm::ConditionListData& dst);
@@ -37,30 +37,40 @@ void SEEnvironmentActionCollection::Serialize(const SEEnvironmentActionCollectio
     dst.mutable_anyaction()->AddAllocated(SEAction::Unload(*src.m_ThermalApplication));
 }
 
-bool SEEnvironmentActionCollection::ProcessAction(const SEEnvironmentAction& action, cdm::AnyEnvironmentActionData& any)
+void SEEnvironmentActionCollection::Copy(const SEEnvironmentActionCollection& src, SEEnvironmentActionCollection& dst)
 {
-  const SEChangeEnvironmentConditions* conditions = dynamic_cast<const SEChangeEnvironmentConditions*>(&action);
-  if (conditions != nullptr)
-  {
-    if (m_Change == nullptr)
-      m_Change = new SEChangeEnvironmentConditions(m_Substances);
-    any.set_allocated_conditions(SEChangeEnvironmentConditions::Unload(*conditions));
-    SEChangeEnvironmentConditions::Load(any.conditions(), *m_Change);
-    if (!m_Change->IsActive())
-      RemoveChange();
-    return true;
-  }
+  if (src.HasChange())
+    dst.ProcessAction(*src.m_Change);
+  if (src.HasThermalApplication())
+    dst.ProcessAction(*src.m_ThermalApplication);
+}
 
-  const SEThermalApplication *thermal = dynamic_cast<const SEThermalApplication*>(&action);
-  if (thermal != nullptr)
-  {    
-    if (m_ThermalApplication == nullptr)
-      m_ThermalApplication = new SEThermalApplication();
-    any.set_allocated_thermalapplication(SEThermalApplication::Unload(*thermal));
-    SEThermalApplication::Load(any.thermalapplication(), *m_ThermalApplication);
-    if (!m_ThermalApplication->IsActive())
-      RemoveThermalApplication();     
-    return true;
+bool SEEnvironmentActionCollection::ProcessAction(const SEEnvironmentAction& action)
+{
+  switch (action.GetActionType())
+  {
+    case eActionType::ChangeEnvironmentConditions:
+    {
+      const SEChangeEnvironmentConditions* conditions = static_cast<const SEChangeEnvironmentConditions*>(&action);
+      if (m_Change == nullptr)
+        m_Change = new SEChangeEnvironmentConditions(m_Substances);
+      SEChangeEnvironmentConditions::Copy(*conditions, *m_Change);
+      if (!m_Change->IsActive())
+        RemoveChange();
+      return true;
+    }
+    case eActionType::ThermalApplication:
+    {
+      const SEThermalApplication* thermal = static_cast<const SEThermalApplication*>(&action);
+      if (m_ThermalApplication == nullptr)
+        m_ThermalApplication = new SEThermalApplication();
+      SEThermalApplication::Copy(*thermal, *m_ThermalApplication);
+      if (!m_ThermalApplication->IsActive())
+        RemoveThermalApplication();     
+      return true;
+    }
+    default:
+      break;
   }
 
   /// \error Unsupported Action
@@ -26,7 +26,8 @@ public:
 protected:
   void Clear();
   static void Serialize(const SEEnvironmentActionCollection& src, cdm::ActionListData& dst);
-  bool ProcessAction(const SEEnvironmentAction& action, cdm::AnyEnvironmentActionData& any);
+  static void Copy(const SEEnvironmentActionCollection& src, SEEnvironmentActionCollection& dst);
+  bool ProcessAction(const SEEnvironmentAction& action);
   
   SEChangeEnvironmentConditions*  m_Change;
   SEThermalApplication*           m_ThermalApplication;
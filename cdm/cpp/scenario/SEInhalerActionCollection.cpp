@@ -27,18 +27,28 @@ void SEInhalerActionCollection::Serialize(const SEInhalerActionCollection& src,
     dst.mutable_anyaction()->AddAllocated(SEAction::Unload(*src.m_Configuration));
 }
 
-bool SEInhalerActionCollection::ProcessAction(const SEInhalerAction& action, cdm::AnyInhalerActionData& any)
+void SEInhalerActionCollection::Copy(const SEInhalerActionCollection& src, SEInhalerActionCollection& dst)
 {
-  const SEInhalerConfiguration* config = dynamic_cast<const SEInhalerConfiguration*>(&action);
-  if (config != nullptr)
+  if (src.HasConfiguration())
+    dst.ProcessAction(*src.m_Configuration);
+}
+
+bool SEInhalerActionCollection::ProcessAction(const SEInhalerAction& action)
+{
+  switch (action.GetActionType())
   {
-    if (m_Configuration == nullptr)
-      m_Configuration = new SEInhalerConfiguration(m_Substances);
-    any.set_allocated_configuration(SEInhalerConfiguration::Unload(*config));
-    SEInhalerConfiguration::Load(any.configuration(), *m_Configuration);
-    if (!m_Configuration->IsActive())
-      RemoveConfiguration();
-    return true;
+    case eActionType::InhalerConfiguration:
+    {
+      const SEInhalerConfiguration* config = static_cast<const SEInhalerConfiguration*>(&action);
+      if (m_Configuration == nullptr)
+        m_Configuration = new SEInhalerConfiguration(m_Substances);
+      SEInhalerConfiguration::Copy(*config, *m_Configuration);
+      if (!m_Configuration->IsActive())
+        RemoveConfiguration();
+      return true;
+    }
+    default:
+      break;
   }
 
   /// \error Unsupported Action
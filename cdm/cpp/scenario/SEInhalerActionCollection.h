@@ -23,7 +23,8 @@ public:
 protected:
   void Clear();
   static void Serialize(const SEInhalerActionCollection& src, cdm::ActionListData& dst);
-  bool ProcessAction(const SEInhalerAction& action, cdm::AnyInhalerActionData& any);
+  static void Copy(const SEInhalerActionCollection& src, SEInhalerActionCollection& dst);
+  bool ProcessAction(const SEInhalerAction& action);
 
   SEInhalerConfiguration*   m_Configuration;
   // General
@@ -132,21 +132,70 @@ void SEPatientActionCollection::Serialize(const SEPatientActionCollection& src,
     dst.mutable_anyaction()->AddAllocated(SEAction::Unload(*src.m_Urinate));
 }
 
-
-bool SEPatientActionCollection::ProcessAction(const SEPatientAction& action, cdm::AnyPatientActionData& any)
+void SEPatientActionCollection::Copy(const SEPatientActionCollection& src, SEPatientActionCollection& dst)
 {
-  const SEPatientAssessmentRequest* patientAss = dynamic_cast<const SEPatientAssessmentRequest*>(&action);
-  if (patientAss != nullptr)
+  if (src.HasAcuteStress())
+    dst.ProcessAction(*src.m_AcuteStress);
+  if (src.HasAirwayObstruction())
+    dst.ProcessAction(*src.m_AirwayObstruction);
+  if (src.HasApnea())
+    dst.ProcessAction(*src.m_Apnea);
+  if (src.HasAsthmaAttack())
+    dst.ProcessAction(*src.m_AsthmaAttack);
+  if (src.HasBrainInjury())
+    dst.ProcessAction(*src.m_BrainInjury);
+  if (src.HasBronchoconstriction())
+    dst.ProcessAction(*src.m_Bronchoconstriction);
+  if (src.HasCardiacArrest())
+    dst.ProcessAction(*src.m_CardiacArrest);
+  if (src.HasChestCompression())
+    dst.ProcessAction(*src.m_ChestCompression);
+  if (src.HasLeftChestOcclusiveDressing())
+    dst.ProcessAction(*src.m_LeftChestOcclusiveDressing);
+  if (src.HasRightChestOcclusiveDressing())
+    dst.ProcessAction(*src.m_RightChestOcclusiveDressing);
+  if (src.HasConsciousRespiration())
+    dst.ProcessAction(*src.m_ConsciousRespiration);
+  if (src.HasConsumeNutrients())
+    dst.ProcessAction(*src.m_ConsumeNutrients);
+  if (src.HasExercise())
+    dst.ProcessAction(*src.m_Exercise);
+  if (src.HasHemorrhage())
   {
-    // TODO just add this to a list?
-    // Not doing anything with this, assessment actions
-    // are currently only being handled by the Engine ScenarioExec methods.
-    // Which probably just write out the assessment requested to a file
-    // Assessments are really a real time API thing, not really a scenario thing
-    // If they are a scenario thing, its just to write out the data.
-    return true;//?
+    for (auto itr : src.m_Hemorrhages)
+      dst.ProcessAction(*itr.second);
   }
+  if (src.HasIntubation())
+    dst.ProcessAction(*src.m_Intubation);
+  if (src.HasMechanicalVentilation())
+    dst.ProcessAction(*src.m_MechanicalVentilation);
+  if (src.HasLeftNeedleDecompression())
+    dst.ProcessAction(*src.m_LeftNeedleDecompression);
+  if (src.HasRightNeedleDecompression())
+    dst.ProcessAction(*src.m_RightNeedleDecompression);
+  if (src.HasPericardialEffusion())
+    dst.ProcessAction(*src.m_PericardialEffusion);
+  if (src.HasLeftClosedTensionPneumothorax())
+    dst.ProcessAction(*src.m_LeftClosedTensionPneumothorax);
+  if (src.HasLeftOpenTensionPneumothorax())
+    dst.ProcessAction(*src.m_LeftOpenTensionPneumothorax);
+  if (src.HasRightClosedTensionPneumothorax())
+    dst.ProcessAction(*src.m_RightClosedTensionPneumothorax);
+  if (src.HasRightOpenTensionPneumothorax())
+    dst.ProcessAction(*src.m_RightOpenTensionPneumothorax);
+  for (auto itr : src.m_SubstanceBolus)
+    dst.ProcessAction(*itr.second);
+  for (auto itr : src.m_SubstanceInfusions)
+    dst.ProcessAction(*itr.second);
+  for (auto itr : src.m_SubstanceCompoundInfusions)
+    dst.ProcessAction(*itr.second);
+  if (src.HasUrinate())
+    dst.ProcessAction(*src.m_Urinate);
+}
 
+
+bool SEPatientActionCollection::ProcessAction(const SEPatientAction& action)
+{
   // We are creating our own copy of these actions
   // There can be multiple actions in a Scenario that are associated
   // with a specific function, such as hemorrhage, and we only need
@@ -157,398 +206,358 @@ bool SEPatientActionCollection::ProcessAction(const SEPatientAction& action, cdm
   // with that compartment. 
   // SO, we make our own copy and manage that copy (i.e. by updating a single action)
 
-  const SEAcuteStress* aStress = dynamic_cast<const SEAcuteStress*>(&action);
-  if (aStress != nullptr)
-  {
-    if (m_AcuteStress == nullptr)
-      m_AcuteStress = new SEAcuteStress();
-    any.set_allocated_acutestress(SEAcuteStress::Unload(*aStress));
-    SEAcuteStress::Load(any.acutestress(), *m_AcuteStress);
-    if (!m_AcuteStress->IsActive())
-      RemoveAcuteStress();
-    return true;
-  }
-
-  const SEAirwayObstruction* airwayObst = dynamic_cast<const SEAirwayObstruction*>(&action);
-  if (airwayObst != nullptr)
-  {
-    if (m_AirwayObstruction == nullptr)
-      m_AirwayObstruction = new SEAirwayObstruction();
-    any.set_allocated_airwayobstruction(SEAirwayObstruction::Unload(*airwayObst));
-    SEAirwayObstruction::Load(any.airwayobstruction(), *m_AirwayObstruction);
-    if (!m_AirwayObstruction->IsActive())
-      RemoveAirwayObstruction();
-    return true;
-  }
-
-  const SEApnea* apnea = dynamic_cast<const SEApnea*>(&action);
-  if (apnea != nullptr)
+  switch (action.GetActionType())
   {
-    if (m_Apnea == nullptr)
-      m_Apnea = new SEApnea();
-    any.set_allocated_apnea(SEApnea::Unload(*apnea));
-    SEApnea::Load(any.apnea(), *m_Apnea);
-    if (!m_Apnea->IsActive())
-      RemoveApnea();
-    return true;
-  }
-
-  const SEAsthmaAttack* asthmaattack = dynamic_cast<const SEAsthmaAttack*>(&action);
-  if (asthmaattack != nullptr)
-  {
-    if (m_AsthmaAttack == nullptr)
-      m_AsthmaAttack = new SEAsthmaAttack();
-    any.set_allocated_asthmaattack(SEAsthmaAttack::Unload(*asthmaattack));
-    SEAsthmaAttack::Load(any.asthmaattack(), *m_AsthmaAttack);
-    if (!m_AsthmaAttack->IsActive())
-      RemoveAsthmaAttack();
-    return true;
-  }
-
-  const SEBrainInjury* brainInjury = dynamic_cast<const SEBrainInjury*>(&action);
-  if (brainInjury != nullptr)
-  {
-    if (m_BrainInjury == nullptr)
-      m_BrainInjury = new SEBrainInjury();
-    any.set_allocated_braininjury(SEBrainInjury::Unload(*brainInjury));
-    SEBrainInjury::Load(any.braininjury(), *m_BrainInjury);
-    if (!m_BrainInjury->IsActive())
-      RemoveBrainInjury();
-    return true;
-  }
-
-  const SEBronchoconstriction* bronchoconstr = dynamic_cast<const SEBronchoconstriction*>(&action);
-  if (bronchoconstr != nullptr)
-  {
-    if (m_Bronchoconstriction == nullptr)
-      m_Bronchoconstriction = new SEBronchoconstriction();
-    any.set_allocated_bronchoconstriction(SEBronchoconstriction::Unload(*bronchoconstr));
-    SEBronchoconstriction::Load(any.bronchoconstriction(), *m_Bronchoconstriction);
-    if (!m_Bronchoconstriction->IsActive())
-      RemoveBronchoconstriction();
-    return true;
-  }
-
-  const SECardiacArrest* cardiacarrest = dynamic_cast<const SECardiacArrest*>(&action);
-  if (cardiacarrest != nullptr)
-  {
-    if (m_CardiacArrest == nullptr)
-      m_CardiacArrest = new SECardiacArrest();
-    any.set_allocated_cardiacarrest(SECardiacArrest::Unload(*cardiacarrest));
-    SECardiacArrest::Load(any.cardiacarrest(), *m_CardiacArrest);
-    if (!m_CardiacArrest->IsActive())
-      RemoveCardiacArrest();
-    return true;
-  }
-
-  const SEChestCompression* chestcomp = dynamic_cast<const SEChestCompression*>(&action);
-  if (chestcomp != nullptr)
-  {
-    const SEChestCompressionForce* cprForce = dynamic_cast<const SEChestCompressionForce*>(chestcomp);
-    if (cprForce != nullptr)
+    case eActionType::PatientAssessmentRequest:
+    {
+      // TODO just add this to a list?
+      // Not doing anything with this, assessment actions
+      // are currently only being handled by the Engine ScenarioExec methods.
+      // Which probably just write out the assessment requested to a file
+      // Assessments are really a real time API thing, not really a scenario thing
+      // If they are a scenario thing, its just to write out the data.
+      return true;//?
+    }
+    case eActionType::AcuteStress:
+    {
+      const SEAcuteStress* aStress = static_cast<const SEAcuteStress*>(&action);
+      if (m_AcuteStress == nullptr)
+        m_AcuteStress = new SEAcuteStress();
+      SEAcuteStress::Copy(*aStress, *m_AcuteStress);
+      if (!m_AcuteStress->IsActive())
+        RemoveAcuteStress();
+      return true;
+    }
+    case eActionType::AirwayObstruction:
+    {
+      const SEAirwayObstruction* airwayObst = static_cast<const SEAirwayObstruction*>(&action);
+      if (m_AirwayObstruction == nullptr)
+        m_AirwayObstruction = new SEAirwayObstruction();
+      SEAirwayObstruction::Copy(*airwayObst, *m_AirwayObstruction);
+      if (!m_AirwayObstruction->IsActive())
+        RemoveAirwayObstruction();
+      return true;
+    }
+    case eActionType::Apnea:
     {
+      const SEApnea* apnea = static_cast<const SEApnea*>(&action);
+      if (m_Apnea == nullptr)
+        m_Apnea = new SEApnea();
+      SEApnea::Copy(*apnea, *m_Apnea);
+      if (!m_Apnea->IsActive())
+        RemoveApnea();
+      return true;
+    }
+    case eActionType::AsthmaAttack:
+    {
+      const SEAsthmaAttack* asthmaattack = static_cast<const SEAsthmaAttack*>(&action);
+      if (m_AsthmaAttack == nullptr)
+        m_AsthmaAttack = new SEAsthmaAttack();
+      SEAsthmaAttack::Copy(*asthmaattack, *m_AsthmaAttack);
+      if (!m_AsthmaAttack->IsActive())
+        RemoveAsthmaAttack();
+      return true;
+    }
+    case eActionType::BrainInjury:
+    {
+      const SEBrainInjury* brainInjury = static_cast<const SEBrainInjury*>(&action);
+      if (m_BrainInjury == nullptr)
+        m_BrainInjury = new SEBrainInjury();
+      SEBrainInjury::Copy(*brainInjury, *m_BrainInjury);
+      if (!m_BrainInjury->IsActive())
+        RemoveBrainInjury();
+      return true;
+    }
+    case eActionType::Bronchoconstriction:
+    {
+      const SEBronchoconstriction* bronchoconstr = static_cast<const SEBronchoconstriction*>(&action);
+      if (m_Bronchoconstriction == nullptr)
+        m_Bronchoconstriction = new SEBronchoconstriction();
+      SEBronchoconstriction::Copy(*bronchoconstr, *m_Bronchoconstriction);
+      if (!m_Bronchoconstriction->IsActive())
+        RemoveBronchoconstriction();
+      return true;
+    }
+    case eActionType::CardiacArrest:
+    {
+      const SECardiacArrest* cardiacarrest = static_cast<const SECardiacArrest*>(&action);
+      if (m_CardiacArrest == nullptr)
+        m_CardiacArrest = new SECardiacArrest();
+      SECardiacArrest::Copy(*cardiacarrest, *m_CardiacArrest);
+      if (!m_CardiacArrest->IsActive())
+        RemoveCardiacArrest();
+      return true;
+    }
+    case eActionType::ChestCompressionForce:
+    {
+      const SEChestCompressionForce* cprForce = static_cast<const SEChestCompressionForce*>(&action);
       if (HasChestCompressionForceScale())
         RemoveChestCompression();
       if (m_ChestCompression == nullptr)
         m_ChestCompression = new SEChestCompressionForce();
-      any.set_allocated_chestcompressionforce(SEChestCompressionForce::Unload(*cprForce));
-      SEChestCompressionForce::Load(any.chestcompressionforce(), (SEChestCompressionForce&)*m_ChestCompression);
+      SEChestCompressionForce::Copy(*cprForce, (SEChestCompressionForce&)*m_ChestCompression);
       if (!m_ChestCompression->IsActive())
         RemoveChestCompression();
       return true;
     }
-    const SEChestCompressionForceScale* cprScale = dynamic_cast<const SEChestCompressionForceScale*>(chestcomp);
-    if (cprScale != nullptr)
+    case eActionType::ChestCompressionForceScale:
     {
+      const SEChestCompressionForceScale* cprScale = static_cast<const SEChestCompressionForceScale*>(&action);
       if (HasChestCompressionForce())
         RemoveChestCompression();
       if (m_ChestCompression == nullptr)
         m_ChestCompression = new SEChestCompressionForceScale();
-      any.set_allocated_chestcompressionforcescale(SEChestCompressionForceScale::Unload(*cprScale));
-      SEChestCompressionForceScale::Load(any.chestcompressionforcescale(), (SEChestCompressionForceScale&)*m_ChestCompression);
+      SEChestCompressionForceScale::Copy(*cprScale, (SEChestCompressionForceScale&)*m_ChestCompression);
       if (!m_ChestCompression->IsActive())
         RemoveChestCompression();
       return true;
     }
-    Error("Unknown Chest Compression Type");
-    /// \error Unknown ChestCompression type 
-    return false;
-  }
-
-
-  const SEChestOcclusiveDressing* chestOccl = dynamic_cast<const SEChestOcclusiveDressing*>(&action);
-  if (chestOccl != nullptr)
-  {
-    if (chestOccl->GetSide() == cdm::eSide::Left)
+    case eActionType::ChestOcclusiveDressing:
     {
-      if (m_LeftChestOcclusiveDressing == nullptr)
-        m_LeftChestOcclusiveDressing = new SEChestOcclusiveDressing();
-      any.set_allocated_chestocclusivedressing(SEChestOcclusiveDressing::Unload(*chestOccl));
-      SEChestOcclusiveDressing::Load(any.chestocclusivedressing(), *m_LeftChestOcclusiveDressing);
-      if (!m_LeftChestOcclusiveDressing->IsActive())
-        RemoveLeftChestOcclusiveDressing();
-      return true;
+      const SEChestOcclusiveDressing* chestOccl = static_cast<const SEChestOcclusiveDressing*>(&action);
+      if (chestOccl->GetSide() == cdm::eSide::Left)
+      {
+        if (m_LeftChestOcclusiveDressing == nullptr)
+          m_LeftChestOcclusiveDressing = new SEChestOcclusiveDressing();
+        SEChestOcclusiveDressing::Copy(*chestOccl, *m_LeftChestOcclusiveDressing);
+        if (!m_LeftChestOcclusiveDressing->IsActive())
+          RemoveLeftChestOcclusiveDressing();
+        return true;
+      }
+      else if (chestOccl->GetSide() == cdm::eSide::Right)
+      {
+        if (m_RightChestOcclusiveDressing == nullptr)
+          m_RightChestOcclusiveDressing = new SEChestOcclusiveDressing();
+        SEChestOcclusiveDressing::Copy(*chestOccl, *m_RightChestOcclusiveDressing);
+        if (!m_RightChestOcclusiveDressing->IsActive())
+          RemoveRightChestOcclusiveDressing();
+        return true;
+      }
+      Error("Unknown Chest Occlusive Dressing Type");
+      return false;
     }
-    else if (chestOccl->GetSide() == cdm::eSide::Right)
+    case eActionType::ConsciousRespiration:
     {
-      if (m_RightChestOcclusiveDressing == nullptr)
-        m_RightChestOcclusiveDressing = new SEChestOcclusiveDressing();
-      any.set_allocated_chestocclusivedressing(SEChestOcclusiveDressing::Unload(*chestOccl));
-      SEChestOcclusiveDressing::Load(any.chestocclusivedressing(), *m_RightChestOcclusiveDressing);
-      if (!m_RightChestOcclusiveDressing->IsActive())
-        RemoveRightChestOcclusiveDressing();
+      const SEConsciousRespiration* conResp = static_cast<const SEConsciousRespiration*>(&action);
+      if (m_ConsciousRespiration == nullptr)
+        m_ConsciousRespiration = new SEConsciousRespiration();
+      SEConsciousRespiration::Copy(*conResp, *m_ConsciousRespiration);
+      if (!m_ConsciousRespiration->IsActive())
+        RemoveConsciousRespiration();
       return true;
     }
-  }
-
-  const SEConsciousRespiration* conResp = dynamic_cast<const SEConsciousRespiration*>(&action);
-  if (conResp != nullptr)
-  {
-    if (m_ConsciousRespiration == nullptr)
-      m_ConsciousRespiration = new SEConsciousRespiration();
-    any.set_allocated_consciousrespiration(SEConsciousRespiration::Unload(*conResp));
-    SEConsciousRespiration::Load(any.consciousrespiration(), *m_ConsciousRespiration);
-    if (!m_ConsciousRespiration->IsActive())
-      RemoveConsciousRespiration();
-    return true;
-  }
-
-  const SEConsumeNutrients* consume = dynamic_cast<const SEConsumeNutrients*>(&action);
-  if (consume != nullptr)
-  {
-    if (m_ConsumeNutrients == nullptr)
-      m_ConsumeNutrients = new SEConsumeNutrients();
-    any.set_allocated_consumenutrients(SEConsumeNutrients::Unload(*consume));
-    SEConsumeNutrients::Load(any.consumenutrients(), *m_ConsumeNutrients);
-    if (!m_ConsumeNutrients->IsActive())
-      RemoveConsumeNutrients();
-    return true;
-  }
-
-  const SEExercise* exercise = dynamic_cast<const SEExercise*>(&action);
-  if (exercise != nullptr)
-  {
-    if (m_Exercise == nullptr)
-      m_Exercise = new SEExercise();
-    any.set_allocated_exercise(SEExercise::Unload(*exercise));
-    SEExercise::Load(any.exercise(), *m_Exercise);
-    if (!m_Exercise->IsActive())
-      RemoveExercise();
-    return true;
-  }
-
-  const SEHemorrhage* hem = dynamic_cast<const SEHemorrhage*>(&action);
-  if (hem != nullptr)
-  {
-    SEHemorrhage* myHem = m_Hemorrhages[hem->GetCompartment()];
-    if (myHem == nullptr)
+    case eActionType::ConsumeNutrients:
     {
-      myHem = new SEHemorrhage();
-      m_Hemorrhages[hem->GetCompartment()] = myHem;
+      const SEConsumeNutrients* consume = static_cast<const SEConsumeNutrients*>(&action);
+      if (m_ConsumeNutrients == nullptr)
+        m_ConsumeNutrients = new SEConsumeNutrients();
+      SEConsumeNutrients::Copy(*consume, *m_ConsumeNutrients);
+      if (!m_ConsumeNutrients->IsActive())
+        RemoveConsumeNutrients();
+      return true;
     }
-    any.set_allocated_hemorrhage(SEHemorrhage::Unload(*hem));
-    SEHemorrhage::Load(any.hemorrhage(), *myHem);
-    if (!myHem->IsActive())
-      RemoveHemorrhage(hem->GetCompartment());
-    return true;
-  }
-
-  const SEIntubation* intubation = dynamic_cast<const SEIntubation*>(&action);
-  if (intubation != nullptr)
-  {
-    if (m_Intubation == nullptr)
-      m_Intubation = new SEIntubation();
-    any.set_allocated_intubation(SEIntubation::Unload(*intubation));
-    SEIntubation::Load(any.intubation(), *m_Intubation);
-    if (!m_Intubation->IsActive())
-      RemoveIntubation();
-    return true;
-  }
-
-  const SEMechanicalVentilation* mvData = dynamic_cast<const SEMechanicalVentilation*>(&action);
-  if (mvData != nullptr)
-  {
-    if (m_MechanicalVentilation == nullptr)
-      m_MechanicalVentilation = new SEMechanicalVentilation();
-    any.set_allocated_mechanicalventilation(SEMechanicalVentilation::Unload(*mvData));
-    SEMechanicalVentilation::Load(any.mechanicalventilation(), *m_MechanicalVentilation, m_Substances);
-    if (!m_MechanicalVentilation->IsActive())
-      RemoveMechanicalVentilation();
-    return true;
-  }
-
-  const SENeedleDecompression* needleDecomp = dynamic_cast<const SENeedleDecompression*>(&action);
-  if (needleDecomp != nullptr)
-  {
-    if (needleDecomp->GetSide() == cdm::eSide::Left)
+    case eActionType::Exercise:
     {
-      if (m_LeftNeedleDecompression == nullptr)
-        m_LeftNeedleDecompression = new SENeedleDecompression();
-      any.set_allocated_needledecompression(SENeedleDecompression::Unload(*needleDecomp));
-      SENeedleDecompression::Load(any.needledecompression(), *m_LeftNeedleDecompression);
-      if (!m_LeftNeedleDecompression->IsActive())
-        RemoveLeftNeedleDecompression();
+      const SEExercise* exercise = static_cast<const SEExercise*>(&action);
+      if (m_Exercise == nullptr)
+        m_Exercise = new SEExercise();
+      SEExercise::Copy(*exercise, *m_Exercise);
+      if (!m_Exercise->IsActive())
+        RemoveExercise();
       return true;
     }
-    else if (needleDecomp->GetSide() == cdm::eSide::Right)
+    case eActionType::Hemorrhage:
     {
-      if (m_RightNeedleDecompression == nullptr)
-        m_RightNeedleDecompression = new SENeedleDecompression();
-      any.set_allocated_needledecompression(SENeedleDecompression::Unload(*needleDecomp));
-      SENeedleDecompression::Load(any.needledecompression(), *m_RightNeedleDecompression);
-      if (!m_RightNeedleDecompression->IsActive())
-        RemoveRightNeedleDecompression();
+      const SEHemorrhage* hem = static_cast<const SEHemorrhage*>(&action);
+      SEHemorrhage* myHem = m_Hemorrhages[hem->GetCompartment()];
+      if (myHem == nullptr)
+      {
+        myHem = new SEHemorrhage();
+        m_Hemorrhages[hem->GetCompartment()] = myHem;
+      }
+      SEHemorrhage::Copy(*hem, *myHem);
+      if (!myHem->IsActive())
+        RemoveHemorrhage(hem->GetCompartment());
       return true;
     }
-    Error("Unknown Needle Decompression Type");
-    return false;
-  }
-
-  const SEPericardialEffusion* pericardialEff = dynamic_cast<const SEPericardialEffusion*>(&action);
-  if (pericardialEff != nullptr)
-  {
-    if (m_PericardialEffusion == nullptr)
-      m_PericardialEffusion = new SEPericardialEffusion();
-    any.set_allocated_pericardialeffusion(SEPericardialEffusion::Unload(*pericardialEff));
-    SEPericardialEffusion::Load(any.pericardialeffusion(), *m_PericardialEffusion);
-    if (!m_PericardialEffusion->IsActive())
-      RemovePericardialEffusion();
-    return true;
-
-  }
-
-  const SESubstanceBolus* bolus = dynamic_cast<const SESubstanceBolus*>(&action);
-  if (bolus != nullptr)
-  {
-    SESubstance* sub = m_Substances.GetSubstance(bolus->GetSubstance().GetName());
-    if (sub == nullptr)//Make sure this substance manager has it
+    case eActionType::Intubation:
     {
-      Error("Ignoring SESubstanceBolus action due to unknown substance in action: " + bolus->GetSubstance().GetName());
-      return false;
+      const SEIntubation* intubation = static_cast<const SEIntubation*>(&action);
+      if (m_Intubation == nullptr)
+        m_Intubation = new SEIntubation();
+      SEIntubation::Copy(*intubation, *m_Intubation);
+      if (!m_Intubation->IsActive())
+        RemoveIntubation();
+      return true;
     }
-    SESubstanceBolus* myBolus = m_SubstanceBolus[sub];
-    if (myBolus == nullptr)
+    case eActionType::MechanicalVentilation:
     {
-      myBolus = new SESubstanceBolus(*sub);
-      m_SubstanceBolus[sub] = myBolus;
-      m_Substances.AddActiveSubstance(*sub);
+      const SEMechanicalVentilation* mvData = static_cast<const SEMechanicalVentilation*>(&action);
+      if (m_MechanicalVentilation == nullptr)
+        m_MechanicalVentilation = new SEMechanicalVentilation();
+      SEMechanicalVentilation::Copy(*mvData, *m_MechanicalVentilation, m_Substances);
+      if (!m_MechanicalVentilation->IsActive())
+        RemoveMechanicalVentilation();
+      return true;
     }
-    any.set_allocated_substancebolus(SESubstanceBolus::Unload(*bolus));
-    SESubstanceBolus::Load(any.substancebolus(), *myBolus);
-    if (!myBolus->IsActive())
-      RemoveSubstanceBolus(*sub);
-    return true;
-  }
-
-  const SESubstanceInfusion* subInfusion = dynamic_cast<const SESubstanceInfusion*>(&action);
-  if (subInfusion != nullptr)
-  {
-    SESubstance* sub = m_Substances.GetSubstance(subInfusion->GetSubstance().GetName());
-    if (sub == nullptr)//Make sure this substance manager has it
+    case eActionType::NeedleDecompression:
     {
-      Error("Ignoring SESubstanceInfusion action due to unknown substance in action: " + subInfusion->GetSubstance().GetName());
+      const SENeedleDecompression* needleDecomp = static_cast<const SENeedleDecompression*>(&action);
+      if (needleDecomp->GetSide() == cdm::eSide::Left)
+      {
+        if (m_LeftNeedleDecompression == nullptr)
+          m_LeftNeedleDecompression = new SENeedleDecompression();
+        SENeedleDecompression::Copy(*needleDecomp, *m_LeftNeedleDecompression);
+        if (!m_LeftNeedleDecompression->IsActive())
+          RemoveLeftNeedleDecompression();
+        return true;
+      }
+      else if (needleDecomp->GetSide() == cdm::eSide::Right)
+      {
+        if (m_RightNeedleDecompression == nullptr)
+          m_RightNeedleDecompression = new SENeedleDecompression();
+        SENeedleDecompression::Copy(*needleDecomp, *m_RightNeedleDecompression);
+        if (!m_RightNeedleDecompression->IsActive())
+          RemoveRightNeedleDecompression();
+        return true;
+      }
+      Error("Unknown Needle Decompression Type");
       return false;
     }
-    SESubstanceInfusion* mySubInfuse = m_SubstanceInfusions[sub];
-    if (mySubInfuse == nullptr)
+    case eActionType::PericardialEffusion:
     {
-      mySubInfuse = new SESubstanceInfusion(*sub);
-      m_SubstanceInfusions[sub] = mySubInfuse;
-      m_Substances.AddActiveSubstance(*sub);
-    }
-    any.set_allocated_substanceinfusion(SESubstanceInfusion::Unload(*subInfusion));
-    SESubstanceInfusion::Load(any.substanceinfusion(), *mySubInfuse);
-    if (!mySubInfuse->IsActive())
-      RemoveSubstanceInfusion(*sub);
-    return true;
-  }
+      const SEPericardialEffusion* pericardialEff = static_cast<const SEPericardialEffusion*>(&action);
+      if (m_PericardialEffusion == nullptr)
+        m_PericardialEffusion = new SEPericardialEffusion();
+      SEPericardialEffusion::Copy(*pericardialEff, *m_PericardialEffusion);
+      if (!m_PericardialEffusion->IsActive())
+        RemovePericardialEffusion();
+      return true;
 
-  const SESubstanceCompoundInfusion* cSubInfusion = dynamic_cast<const SESubstanceCompoundInfusion*>(&action);
-  if (cSubInfusion != nullptr)
-  {
-    SESubstanceCompound* cmpd = m_Substances.GetCompound(cSubInfusion->GetSubstanceCompound().GetName());
-    if (cmpd == nullptr)//Make sure this substance manager has it
-    {
-      Error("Ignoring SESubstanceCompoundInfusion action due to unknown substance in action: " + cSubInfusion->GetSubstanceCompound().GetName());
-      return false;
     }
-    SESubstanceCompoundInfusion* mySubCompInfuse = m_SubstanceCompoundInfusions[cmpd];
-    if (mySubCompInfuse == nullptr)
+    case eActionType::SubstanceBolus:
     {
-      mySubCompInfuse = new SESubstanceCompoundInfusion(*cmpd);
-      m_SubstanceCompoundInfusions[cmpd] = mySubCompInfuse;
-      m_Substances.AddActiveCompound(*cmpd);
-      // Activate the compound component substances
-      const SESubstanceCompound& sc = mySubCompInfuse->GetSubstanceCompound();
-      for (const SESubstanceConcentration* scc : sc.GetComponents())
+      const SESubstanceBolus* bolus = static_cast<const SESubstanceBolus*>(&action);
+      SESubstance* sub = m_Substances.GetSubstance(bolus->GetSubstance().GetName());
+      if (sub == nullptr)//Make sure this substance manager has it
       {
-        m_Substances.AddActiveSubstance(scc->GetSubstance());
+        Error("Ignoring SESubstanceBolus action due to unknown substance in action: " + bolus->GetSubstance().GetName());
+        return false;
       }
+      SESubstanceBolus* myBolus = m_SubstanceBolus[sub];
+      if (myBolus == nullptr)
+      {
+        myBolus = new SESubstanceBolus(*sub);
+        m_SubstanceBolus[sub] = myBolus;
+        m_Substances.AddActiveSubstance(*sub);
+      }
+      SESubstanceBolus::Copy(*bolus, *myBolus);
+      if (!myBolus->IsActive())
+        RemoveSubstanceBolus(*sub);
+      return true;
     }
-    any.set_allocated_substancecompoundinfusion(SESubstanceCompoundInfusion::Unload(*cSubInfusion));
-    SESubstanceCompoundInfusion::Load(any.substancecompoundinfusion(), *mySubCompInfuse);
-    if (!mySubCompInfuse->IsActive())
-      RemoveSubstanceCompoundInfusion(*cmpd);
-    return true;
-  }
-
-  const SETensionPneumothorax* pneumo = dynamic_cast<const SETensionPneumothorax*>(&action);
-  if (pneumo != nullptr)
-  {
-    if (pneumo->GetSide() == cdm::eSide::Left&&pneumo->GetType() == cdm::eGate::Open)
+    case eActionType::SubstanceInfusion:
     {
-      if (m_LeftOpenTensionPneumothorax == nullptr)
-        m_LeftOpenTensionPneumothorax = new SETensionPneumothorax();
-      any.set_allocated_tensionpneumothorax(SETensionPneumothorax::Unload(*pneumo));
-      SETensionPneumothorax::Load(any.tensionpneumothorax(), *m_LeftOpenTensionPneumothorax);
-      if (!m_LeftOpenTensionPneumothorax->IsActive())
-        RemoveLeftOpenTensionPneumothorax();
+      const SESubstanceInfusion* subInfusion = static_cast<const SESubstanceInfusion*>(&action);
+      SESubstance* sub = m_Substances.GetSubstance(subInfusion->GetSubstance().GetName());
+      if (sub == nullptr)//Make sure this substance manager has it
+      {
+        Error("Ignoring SESubstanceInfusion action due to unknown substance in action: " + subInfusion->GetSubstance().GetName());
+        return false;
+      }
+      SESubstanceInfusion* mySubInfuse = m_SubstanceInfusions[sub];
+      if (mySubInfuse == nullptr)
+      {
+        mySubInfuse = new SESubstanceInfusion(*sub);
+        m_SubstanceInfusions[sub] = mySubInfuse;
+        m_Substances.AddActiveSubstance(*sub);
+      }
+      SESubstanceInfusion::Copy(*subInfusion, *mySubInfuse);
+      if (!mySubInfuse->IsActive())
+        RemoveSubstanceInfusion(*sub);
       return true;
     }
-    else if (pneumo->GetSide() == cdm::eSide::Left&&pneumo->GetType() == cdm::eGate::Closed)
+    case eActionType::SubstanceCompoundInfusion:
     {
-      if (m_LeftClosedTensionPneumothorax == nullptr)
-        m_LeftClosedTensionPneumothorax = new SETensionPneumothorax();
-      any.set_allocated_tensionpneumothorax(SETensionPneumothorax::Unload(*pneumo));
-      SETensionPneumothorax::Load(any.tensionpneumothorax(), *m_LeftClosedTensionPneumothorax);
-      if (!m_LeftClosedTensionPneumothorax->IsActive())
-        RemoveLeftClosedTensionPneumothorax();
+      const SESubstanceCompoundInfusion* cSubInfusion = static_cast<const SESubstanceCompoundInfusion*>(&action);
+      SESubstanceCompound* cmpd = m_Substances.GetCompound(cSubInfusion->GetSubstanceCompound().GetName());
+      if (cmpd == nullptr)//Make sure this substance manager has it
+      {
+        Error("Ignoring SESubstanceCompoundInfusion action due to unknown substance in action: " + cSubInfusion->GetSubstanceCompound().GetName());
+        return false;
+      }
+      SESubstanceCompoundInfusion* mySubCompInfuse = m_SubstanceCompoundInfusions[cmpd];
+      if (mySubCompInfuse == nullptr)
+      {
+        mySubCompInfuse = new SESubstanceCompoundInfusion(*cmpd);
+        m_SubstanceCompoundInfusions[cmpd] = mySubCompInfuse;
+        m_Substances.AddActiveCompound(*cmpd);
+        // Activate the compound component substances
+        const SESubstanceCompound& sc = mySubCompInfuse->GetSubstanceCompound();
+        for (const SESubstanceConcentration* scc : sc.GetComponents())
+        {
+          m_Substances.AddActiveSubstance(scc->GetSubstance());
+        }
+      }
+      SESubstanceCompoundInfusion::Copy(*cSubInfusion, *mySubCompInfuse);
+      if (!mySubCompInfuse->IsActive())
+        RemoveSubstanceCompoundInfusion(*cmpd);
       return true;
     }
-    else if (pneumo->GetSide() == cdm::eSide::Right&&pneumo->GetType() == cdm::eGate::Open)
+    case eActionType::TensionPneumothorax:
     {
-      if (m_RightOpenTensionPneumothorax == nullptr)
-        m_RightOpenTensionPneumothorax = new SETensionPneumothorax();
-      any.set_allocated_tensionpneumothorax(SETensionPneumothorax::Unload(*pneumo));
-      SETensionPneumothorax::Load(any.tensionpneumothorax(), *m_RightOpenTensionPneumothorax);
-      if (!m_RightOpenTensionPneumothorax->IsActive())
-        RemoveRightOpenTensionPneumothorax();
-      return true;
+      const SETensionPneumothorax* pneumo = static_cast<const SETensionPneumothorax*>(&action);
+      if (pneumo->GetSide() == cdm::eSide::Left&&pneumo->GetType() == cdm::eGate::Open)
+      {
+        if (m_LeftOpenTensionPneumothorax == nullptr)
+          m_LeftOpenTensionPneumothorax = new SETensionPneumothorax();
+        SETensionPneumothorax::Copy(*pneumo, *m_LeftOpenTensionPneumothorax);
+        if (!m_LeftOpenTensionPneumothorax->IsActive())
+          RemoveLeftOpenTensionPneumothorax();
+        return true;
+      }
+      else if (pneumo->GetSide() == cdm::eSide::Left&&pneumo->GetType() == cdm::eGate::Closed)
+      {
+        if (m_LeftClosedTensionPneumothorax == nullptr)
+          m_LeftClosedTensionPneumothorax = new SETensionPneumothorax();
+        SETensionPneumothorax::Copy(*pneumo, *m_LeftClosedTensionPneumothorax);
+        if (!m_LeftClosedTensionPneumothorax->IsActive())
+          RemoveLeftClosedTensionPneumothorax();
+        return true;
+      }
+      else if (pneumo->GetSide() == cdm::eSide::Right&&pneumo->GetType() == cdm::eGate::Open)
+      {
+        if (m_RightOpenTensionPneumothorax == nullptr)
+          m_RightOpenTensionPneumothorax = new SETensionPneumothorax();
+        SETensionPneumothorax::Copy(*pneumo, *m_RightOpenTensionPneumothorax);
+        if (!m_RightOpenTensionPneumothorax->IsActive())
+          RemoveRightOpenTensionPneumothorax();
+        return true;
+      }
+      else if (pneumo->GetSide() == cdm::eSide::Right&&pneumo->GetType() == cdm::eGate::Closed)
+      {
+        if (m_RightClosedTensionPneumothorax == nullptr)
+          m_RightClosedTensionPneumothorax = new SETensionPneumothorax();
+        SETensionPneumothorax::Copy(*pneumo, *m_RightClosedTensionPneumothorax);
+        if (!m_RightClosedTensionPneumothorax->IsActive())
+          RemoveRightClosedTensionPneumothorax();
+        return true;
+      }
+      Error("Unknown Tension Pnumothorax Type");
+      return false;// Duno what this is...
     }
-    else if (pneumo->GetSide() == cdm::eSide::Right&&pneumo->GetType() == cdm::eGate::Closed)
+    case eActionType::Urinate:
     {
-      if (m_RightClosedTensionPneumothorax == nullptr)
-        m_RightClosedTensionPneumothorax = new SETensionPneumothorax();
-      any.set_allocated_tensionpneumothorax(SETensionPneumothorax::Unload(*pneumo));
-      SETensionPneumothorax::Load(any.tensionpneumothorax(), *m_RightClosedTensionPneumothorax);
-      if (!m_RightClosedTensionPneumothorax->IsActive())
-        RemoveRightClosedTensionPneumothorax();
+      const SEUrinate* urinate = static_cast<const SEUrinate*>(&action);
+      if (m_Urinate == nullptr)
+        m_Urinate = new SEUrinate();
+      SEUrinate::Copy(*urinate, *m_Urinate);
+      if (!m_Urinate->IsActive())
+        RemoveUrinate();
       return true;
     }
-    Error("Unknown Tension Pnumothorax Type");
-    return false;// Duno what this is...
-  }
-
-  const SEUrinate* urinate = dynamic_cast<const SEUrinate*>(&action);
-  if (urinate != nullptr)
-  {
-    if (m_Urinate == nullptr)
-      m_Urinate = new SEUrinate();
-    any.set_allocated_urinate(SEUrinate::Unload(*urinate));
-    SEUrinate::Load(any.urinate(), *m_Urinate);
-    if (!m_Urinate->IsActive())
-      RemoveUrinate();
-    return true;
+    default:
+      break;
   }
 
   /// \error Unsupported Action
@@ -155,7 +155,8 @@ public:
 protected:
   void Clear();
   static void Serialize(const SEPatientActionCollection& src, cdm::ActionListData& dst);
-  bool ProcessAction(const SEPatientAction& action, cdm::AnyPatientActionData& any);
+  static void Copy(const SEPatientActionCollection& src, SEPatientActionCollection& dst);
+  bool ProcessAction(const SEPatientAction& action);
 
   SEAcuteStress*                m_AcuteStress;
   SEAirwayObstruction*          m_AirwayObstruction;
@@ -10,6 +10,7 @@
 #include "scenario/SEAdvanceTime.h"
 #include "PhysiologyEngine.h"
 #include "engine/SEEngineTracker.h"
+#include "engine/SEEngineProfiler.h"
 #include "engine/SEEngineConfiguration.h"
 #include "patient/SEPatient.h"
 #include "properties/SEScalarTime.h"
@@ -137,7 +138,23 @@ bool SEScenarioExec::Execute(const SEScenario& scenario, const std::string& resu
       return false;
     }
 
-    return ProcessActions(scenario);
+    SEEngineProfiler* profiler = m_ProfileFilename.empty() ? nullptr : m_Engine.GetProfiler();
+    if (profiler != nullptr)
+    {
+      profiler->Reset();
+      profiler->SetEnabled(true);
+    }
+    bool success = ProcessActions(scenario);
+    if (profiler != nullptr)
+    {
+      profiler->SetEnabled(false);
+      const std::string json = ".json";
+      if (m_ProfileFilename.size() > json.size() && m_ProfileFilename.compare(m_ProfileFilename.size() - json.size(), json.size(), json) == 0)
+        profiler->WriteJSON(m_ProfileFilename);
+      else
+        profiler->WriteCSV(m_ProfileFilename);
+    }
+    return success;
   }
   catch (CommonDataModelException& ex)
   {
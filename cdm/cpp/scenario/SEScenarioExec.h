@@ -26,6 +26,11 @@ public:
 
   virtual bool Execute(const std::string& scenarioFile, const std::string& resultsFile, SEScenarioCustomExec* cExec = nullptr);
   virtual bool Execute(const SEScenario& scenario,      const std::string& resultsFile, SEScenarioCustomExec* cExec = nullptr);
+
+  // When set, the engine profiler is enabled while the scenario actions run,
+  // and its statistics are written to this file at the end, as JSON if it ends with .json, CSV otherwise
+  virtual void SetProfileFilename(const std::string& filename) { m_ProfileFilename = filename; }
+  virtual const std::string& GetProfileFilename() const { return m_ProfileFilename; }
   
 protected:
 
@@ -39,6 +44,7 @@ protected:
   SEScenarioCustomExec*        m_CustomExec;
   PhysiologyEngine&            m_Engine;
   const SEEngineConfiguration* m_EngineConfiguration;
+  std::string                  m_ProfileFilename;
 
   std::stringstream     m_ss;
 };
\ No newline at end of file
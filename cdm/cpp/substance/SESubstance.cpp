@@ -208,6 +208,45 @@ void SESubstance::Serialize(const cdm::SubstanceData& src, SESubstance& dst)
     SESubstancePharmacodynamics::Load(src.pharmacodynamics(), dst.GetPD());
 }
 
+void SESubstance::Copy(const SESubstance& src, SESubstance& dst)
+{
+  dst.m_Name = src.m_Name;
+  dst.m_State = src.m_State;
+  CopyScalar(src.m_Density, dst.m_Density);
+  CopyScalar(src.m_MolarMass, dst.m_MolarMass);
+  CopyScalar(src.m_MaximumDiffusionFlux, dst.m_MaximumDiffusionFlux);
+  CopyScalar(src.m_MichaelisCoefficient, dst.m_MichaelisCoefficient);
+  if (src.m_Aerosolization != nullptr)
+    SESubstanceAerosolization::Copy(*src.m_Aerosolization, dst.GetAerosolization());
+  else
+    SAFE_DELETE(dst.m_Aerosolization);
+  CopyScalar(src.m_BloodConcentration, dst.m_BloodConcentration);
+  CopyScalar(src.m_MassInBody, dst.m_MassInBody);
+  CopyScalar(src.m_MassInBlood, dst.m_MassInBlood);
+  CopyScalar(src.m_MassInTissue, dst.m_MassInTissue);
+  CopyScalar(src.m_PlasmaConcentration, dst.m_PlasmaConcentration);
+  CopyScalar(src.m_SystemicMassCleared, dst.m_SystemicMassCleared);
+  CopyScalar(src.m_TissueConcentration, dst.m_TissueConcentration);
+  CopyScalar(src.m_AlveolarTransfer, dst.m_AlveolarTransfer);
+  CopyScalar(src.m_DiffusingCapacity, dst.m_DiffusingCapacity);
+  CopyScalar(src.m_EndTidalFraction, dst.m_EndTidalFraction);
+  CopyScalar(src.m_EndTidalPressure, dst.m_EndTidalPressure);
+  CopyScalar(src.m_RelativeDiffusionCoefficient, dst.m_RelativeDiffusionCoefficient);
+  CopyScalar(src.m_SolubilityCoefficient, dst.m_SolubilityCoefficient);
+  if (src.m_Clearance != nullptr)
+    SESubstanceClearance::Copy(*src.m_Clearance, dst.GetClearance());
+  else
+    SAFE_DELETE(dst.m_Clearance);
+  if (src.m_PK != nullptr)
+    SESubstancePharmacokinetics::Copy(*src.m_PK, dst.GetPK());
+  else
+    SAFE_DELETE(dst.m_PK);
+  if (src.m_PD != nullptr)
+    SESubstancePharmacodynamics::Copy(*src.m_PD, dst.GetPD());
+  else
+    SAFE_DELETE(dst.m_PD);
+}
+
 cdm::SubstanceData* SESubstance::Unload(const SESubstance& src)
 {
   cdm::SubstanceData* dst = new cdm::SubstanceData();
@@ -24,6 +24,7 @@ public:
 
   static void Load(const cdm::SubstanceData& src, SESubstance& dst);
   static cdm::SubstanceData* Unload(const SESubstance& src);
+  static void Copy(const SESubstance& src, SESubstance& dst);
 protected:
   static void Serialize(const cdm::SubstanceData& src, SESubstance& dst);
   static void Serialize(const SESubstance& src, cdm::SubstanceData& dst);
@@ -63,6 +63,16 @@ void SESubstanceAerosolization::Serialize(const cdm::SubstanceData_Aerosolizatio
     SEHistogramFractionVsLength::Load(src.particulatesizedistribution(), dst.GetParticulateSizeDistribution());
 }
 
+void SESubstanceAerosolization::Copy(const SESubstanceAerosolization& src, SESubstanceAerosolization& dst)
+{
+  CopyScalar(src.m_BronchioleModifier, dst.m_BronchioleModifier);
+  CopyScalar(src.m_InflammationCoefficient, dst.m_InflammationCoefficient);
+  if (src.m_ParticulateSizeDistribution != nullptr)
+    SEHistogramFractionVsLength::Copy(*src.m_ParticulateSizeDistribution, dst.GetParticulateSizeDistribution());
+  else
+    SAFE_DELETE(dst.m_ParticulateSizeDistribution);
+}
+
 cdm::SubstanceData_AerosolizationData* SESubstanceAerosolization::Unload(const SESubstanceAerosolization& src)
 {
   cdm::SubstanceData_AerosolizationData* dst = new cdm::SubstanceData_AerosolizationData();
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::SubstanceData_AerosolizationData& src, SESubstanceAerosolization& dst);
   static cdm::SubstanceData_AerosolizationData* Unload(const SESubstanceAerosolization& src);
+  static void Copy(const SESubstanceAerosolization& src, SESubstanceAerosolization& dst);
 protected:
   static void Serialize(const cdm::SubstanceData_AerosolizationData& src, SESubstanceAerosolization& dst);
   static void Serialize(const SESubstanceAerosolization& src, cdm::SubstanceData_AerosolizationData& dst);
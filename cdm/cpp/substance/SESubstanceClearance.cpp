@@ -185,6 +185,26 @@ void SESubstanceClearance::Serialize(const cdm::SubstanceData_ClearanceData& src
   }
 }
 
+void SESubstanceClearance::Copy(const SESubstanceClearance& src, SESubstanceClearance& dst)
+{
+  dst.m_hasSystemic = src.m_hasSystemic;
+  dst.m_ChargeInBlood = src.m_ChargeInBlood;
+  dst.m_RenalDynamic = src.m_RenalDynamic;
+  CopyScalar(src.m_FractionExcretedInFeces, dst.m_FractionExcretedInFeces);
+  CopyScalar(src.m_FractionExcretedInUrine, dst.m_FractionExcretedInUrine);
+  CopyScalar(src.m_FractionMetabolizedInGut, dst.m_FractionMetabolizedInGut);
+  CopyScalar(src.m_FractionUnboundInPlasma, dst.m_FractionUnboundInPlasma);
+  CopyScalar(src.m_IntrinsicClearance, dst.m_IntrinsicClearance);
+  CopyScalar(src.m_RenalClearance, dst.m_RenalClearance);
+  CopyScalar(src.m_RenalReabsorptionRatio, dst.m_RenalReabsorptionRatio);
+  CopyScalar(src.m_RenalTransportMaximum, dst.m_RenalTransportMaximum);
+  CopyScalar(src.m_RenalFiltrationRate, dst.m_RenalFiltrationRate);
+  CopyScalar(src.m_RenalReabsorptionRate, dst.m_RenalReabsorptionRate);
+  CopyScalar(src.m_RenalExcretionRate, dst.m_RenalExcretionRate);
+  CopyScalar(src.m_GlomerularFilterability, dst.m_GlomerularFilterability);
+  CopyScalar(src.m_SystemicClearance, dst.m_SystemicClearance);
+}
+
 cdm::SubstanceData_ClearanceData* SESubstanceClearance::Unload(const SESubstanceClearance& src)
 {
   cdm::SubstanceData_ClearanceData* dst = new cdm::SubstanceData_ClearanceData();
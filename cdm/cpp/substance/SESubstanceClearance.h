@@ -22,6 +22,7 @@ public:
 
   static void Load(const cdm::SubstanceData_ClearanceData& src, SESubstanceClearance& dst);
   static cdm::SubstanceData_ClearanceData* Unload(const SESubstanceClearance& src);
+  static void Copy(const SESubstanceClearance& src, SESubstanceClearance& dst);
 protected:
   static void Serialize(const cdm::SubstanceData_ClearanceData& src, SESubstanceClearance& dst);
   static void Serialize(const SESubstanceClearance& src, cdm::SubstanceData_ClearanceData& dst);
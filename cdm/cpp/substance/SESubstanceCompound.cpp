@@ -54,6 +54,33 @@ void SESubstanceCompound::Serialize(const cdm::SubstanceData_CompoundData& src,
   }
 }
 
+void SESubstanceCompound::Copy(const SESubstanceCompound& src, SESubstanceCompound& dst, const SESubstanceManager& subMgr)
+{
+  dst.m_Name = src.m_Name;
+  bool sameComponents = src.m_Components.size() == dst.m_Components.size();
+  for (size_t i = 0; sameComponents && i < src.m_Components.size(); i++)
+    sameComponents = src.m_Components[i]->GetSubstance().GetName() == dst.m_Components[i]->GetSubstance().GetName();
+  if (!sameComponents)
+  {
+    DELETE_VECTOR(dst.m_Components);
+    dst.m_cComponents.clear();
+    for (const SESubstanceConcentration* c : src.m_Components)
+    {
+      SESubstance* substance = subMgr.GetSubstance(c->GetSubstance().GetName());
+      if (substance == nullptr)
+      {
+        dst.Fatal("Could not find substance compound component : " + c->GetSubstance().GetName(), "SESubstanceCompound::Copy");
+        continue;
+      }
+      SESubstanceConcentration* cc = new SESubstanceConcentration(*substance);
+      dst.m_Components.push_back(cc);
+      dst.m_cComponents.push_back(cc);
+    }
+  }
+  for (size_t i = 0; i < src.m_Components.size() && i < dst.m_Components.size(); i++)
+    SESubstanceConcentration::Copy(*src.m_Components[i], *dst.m_Components[i]);
+}
+
 cdm::SubstanceData_CompoundData* SESubstanceCompound::Unload(const SESubstanceCompound& src)
 {
   cdm::SubstanceData_CompoundData* dst = new cdm::SubstanceData_CompoundData();
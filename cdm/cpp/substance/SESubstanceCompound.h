@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::SubstanceData_CompoundData& src, SESubstanceCompound& dst, const SESubstanceManager& subMgr);
   static cdm::SubstanceData_CompoundData* Unload(const SESubstanceCompound& src);
+  static void Copy(const SESubstanceCompound& src, SESubstanceCompound& dst, const SESubstanceManager& subMgr);
 protected:
   static void Serialize(const cdm::SubstanceData_CompoundData& src, SESubstanceCompound& dst, const SESubstanceManager& subMgr);
   static void Serialize(const SESubstanceCompound& src, cdm::SubstanceData_CompoundData& dst);
@@ -33,6 +33,11 @@ void SESubstanceConcentration::Serialize(const cdm::SubstanceData_ConcentrationD
 
 }
 
+void SESubstanceConcentration::Copy(const SESubstanceConcentration& src, SESubstanceConcentration& dst)
+{
+  CopyScalar(src.m_Concentration, dst.m_Concentration);
+}
+
 cdm::SubstanceData_ConcentrationData* SESubstanceConcentration::Unload(const SESubstanceConcentration& src)
 {
   cdm::SubstanceData_ConcentrationData* dst = new cdm::SubstanceData_ConcentrationData();
@@ -22,6 +22,7 @@ public:
 
   static void Load(const cdm::SubstanceData_ConcentrationData& src, SESubstanceConcentration& dst);
   static cdm::SubstanceData_ConcentrationData* Unload(const SESubstanceConcentration& src);
+  static void Copy(const SESubstanceConcentration& src, SESubstanceConcentration& dst);
 protected:
   static void Serialize(const cdm::SubstanceData_ConcentrationData& src, SESubstanceConcentration& dst);
   static void Serialize(const SESubstanceConcentration& src, cdm::SubstanceData_ConcentrationData& dst);
@@ -32,6 +32,11 @@ void SESubstanceFraction::Serialize(const cdm::SubstanceData_FractionAmountData&
     SEScalar0To1::Load(src.amount(), dst.GetFractionAmount());
 }
 
+void SESubstanceFraction::Copy(const SESubstanceFraction& src, SESubstanceFraction& dst)
+{
+  CopyScalar(src.m_FractionAmount, dst.m_FractionAmount);
+}
+
 cdm::SubstanceData_FractionAmountData* SESubstanceFraction::Unload(const SESubstanceFraction& src)
 {
   cdm::SubstanceData_FractionAmountData* dst = new cdm::SubstanceData_FractionAmountData();
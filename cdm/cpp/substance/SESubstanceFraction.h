@@ -22,6 +22,7 @@ public:
 
   static void Load(const cdm::SubstanceData_FractionAmountData& src, SESubstanceFraction& dst);
   static cdm::SubstanceData_FractionAmountData* Unload(const SESubstanceFraction& src);
+  static void Copy(const SESubstanceFraction& src, SESubstanceFraction& dst);
 protected:
   static void Serialize(const cdm::SubstanceData_FractionAmountData& src, SESubstanceFraction& dst);
   static void Serialize(const SESubstanceFraction& src, cdm::SubstanceData_FractionAmountData& dst);
@@ -0,0 +1,262 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "substance/SESubstanceLibrary.h"
+#include "utils/FileUtils.h"
+#include "utils/ContentHash.h"
+#include "dirent.h"
+#include <google/protobuf/text_format.h>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+  const char     BundleMagic[8] = { 'P','U','L','S','E','S','U','B' };
+  const uint32_t BundleVersion = 1;
+
+  std::mutex                                                       g_LibraryMutex;
+  std::map<std::string, std::shared_ptr<const SESubstanceLibrary>> g_Libraries;
+  std::shared_ptr<const SESubstanceLibrary>                        g_DefaultLibrary;
+}
+
+SESubstanceLibrary::SESubstanceLibrary()
+{
+  m_Complete = true;
+}
+
+SESubstanceLibrary::~SESubstanceLibrary()
+{
+  DELETE_VECTOR(m_Substances);
+  DELETE_VECTOR(m_Compounds);
+}
+
+std::shared_ptr<const SESubstanceLibrary> SESubstanceLibrary::GetDirectory(const std::string& directory, Logger* logger)
+{
+  // Hold the lock while parsing, so concurrent engines wait for the first one instead of parsing too
+  std::lock_guard<std::mutex> lock(g_LibraryMutex);
+  auto found = g_Libraries.find("dir:" + directory);
+  if (found != g_Libraries.end())
+    return found->second;
+  SESubstanceLibrary* lib = new SESubstanceLibrary();
+  lib->LoadDirectory(directory, logger);
+  lib->ComputeContentHash();
+  std::shared_ptr<const SESubstanceLibrary> library(lib);
+  // Don't hold on to a directory we could not find anything in, it may be there later
+  if (!lib->m_Substances.empty())
+    g_Libraries["dir:" + directory] = library;
+  return library;
+}
+
+std::shared_ptr<const SESubstanceLibrary> SESubstanceLibrary::GetBundle(const std::string& filename, Logger* logger)
+{
+  std::lock_guard<std::mutex> lock(g_LibraryMutex);
+  auto found = g_Libraries.find("bundle:" + filename);
+  if (found != g_Libraries.end())
+    return found->second;
+  SESubstanceLibrary* lib = new SESubstanceLibrary();
+  if (!lib->LoadBundle(filename, logger))
+  {
+    delete lib;
+    return nullptr;
+  }
+  lib->ComputeContentHash();
+  std::shared_ptr<const SESubstanceLibrary> library(lib);
+  g_Libraries["bundle:" + filename] = library;
+  return library;
+}
+
+void SESubstanceLibrary::SetDefault(std::shared_ptr<const SESubstanceLibrary> library)
+{
+  std::lock_guard<std::mutex> lock(g_LibraryMutex);
+  g_DefaultLibrary = library;
+}
+
+std::shared_ptr<const SESubstanceLibrary> SESubstanceLibrary::GetDefault()
+{
+  std::lock_guard<std::mutex> lock(g_LibraryMutex);
+  return g_DefaultLibrary;
+}
+
+void SESubstanceLibrary::ClearCache()
+{
+  std::lock_guard<std::mutex> lock(g_LibraryMutex);
+  g_Libraries.clear();
+  g_DefaultLibrary = nullptr;
+}
+
+bool SESubstanceLibrary::LoadDirectory(const std::string& directory, Logger* logger)
+{
+  Loggable log(logger);
+  DIR* dir;
+  struct dirent* ent;
+  std::string filename;
+
+  dir = opendir((directory + "/").c_str());
+  if (dir == nullptr)
+  {
+    log.Error("Unable to open substance directory " + directory);
+    m_Complete = false;
+    return false;
+  }
+  while ((ent = readdir(dir)) != nullptr)
+  {
+    filename = directory + "/" + ent->d_name;
+    if (IsDirectory(ent) || strlen(ent->d_name) <= 2)
+      continue;
+    std::ifstream input(filename);
+    std::string fmsg((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    cdm::SubstanceData* subData = new cdm::SubstanceData();
+    if (!google::protobuf::TextFormat::ParseFromString(fmsg, subData))
+    {
+      m_Complete = false;
+      log.Error("Unable to read substance " + filename);
+      delete subData;
+      continue;
+    }
+    m_Substances.push_back(subData);
+  }
+  closedir(dir);
+
+  dir = opendir((directory + "/compounds/").c_str());
+  if (dir == nullptr)
+    return m_Complete;
+  while ((ent = readdir(dir)) != nullptr)
+  {
+    filename = directory + "/compounds/" + ent->d_name;
+    if (IsDirectory(ent) || strlen(ent->d_name) <= 2)
+      continue;
+    std::ifstream input(filename);
+    std::string fmsg((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    cdm::SubstanceData_CompoundData* compoundData = new cdm::SubstanceData_CompoundData();
+    if (!google::protobuf::TextFormat::ParseFromString(fmsg, compoundData))
+    {
+      m_Complete = false;
+      log.Error("Unable to read compound " + filename);
+      delete compoundData;
+      continue;
+    }
+    m_Compounds.push_back(compoundData);
+  }
+  closedir(dir);
+  return m_Complete;
+}
+
+void SESubstanceLibrary::ComputeContentHash()
+{
+  // Directories are read in file system order, so hash each definition on its own and combine them sorted
+  std::vector<uint64_t> hashes;
+  for (const cdm::SubstanceData* subData : m_Substances)
+  {
+    ContentHash hash;
+    hash.Add(*subData);
+    hashes.push_back(hash.GetValue());
+  }
+  for (const cdm::SubstanceData_CompoundData* compoundData : m_Compounds)
+  {
+    ContentHash hash;
+    hash.Add(*compoundData);
+    hashes.push_back(hash.GetValue());
+  }
+  std::sort(hashes.begin(), hashes.end());
+  ContentHash hash;
+  hash.Add(hashes.data(), hashes.size() * sizeof(uint64_t));
+  m_ContentHash = hash.ToString();
+}
+
+bool SESubstanceLibrary::WriteBundle(const std::string& filename, Logger* logger) const
+{
+  Loggable log(logger);
+  std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+  if (!file.is_open())
+  {
+    log.Error("Unable to write substance bundle " + filename);
+    return false;
+  }
+  uint32_t numSubstances = (uint32_t)m_Substances.size();
+  uint32_t numCompounds = (uint32_t)m_Compounds.size();
+  file.write(BundleMagic, sizeof(BundleMagic));
+  file.write((const char*)&BundleVersion, sizeof(BundleVersion));
+  file.write((const char*)&numSubstances, sizeof(numSubstances));
+  file.write((const char*)&numCompounds, sizeof(numCompounds));
+
+  std::string bytes;
+  auto writeMessage = [&file, &bytes](const google::protobuf::Message& msg)
+  {
+    bytes.clear();
+    msg.SerializeToString(&bytes);
+    uint32_t size = (uint32_t)bytes.size();
+    file.write((const char*)&size, sizeof(size));
+    file.write(bytes.c_str(), bytes.size());
+  };
+  for (const cdm::SubstanceData* subData : m_Substances)
+    writeMessage(*subData);
+  for (const cdm::SubstanceData_CompoundData* compoundData : m_Compounds)
+    writeMessage(*compoundData);
+  file.close();
+  return !file.fail();
+}
+
+bool SESubstanceLibrary::LoadBundle(const std::string& filename, Logger* logger)
+{
+  Loggable log(logger);
+  std::ifstream file(filename, std::ifstream::in | std::ifstream::binary);
+  if (!file.is_open())
+  {
+    log.Error("Unable to open substance bundle " + filename);
+    return false;
+  }
+  std::string bundle((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  size_t pos = 0;
+  auto read = [&bundle, &pos](void* dst, size_t size)
+  {
+    if (pos + size > bundle.size())
+      return false;
+    std::memcpy(dst, bundle.data() + pos, size);
+    pos += size;
+    return true;
+  };
+  auto readMessage = [&bundle, &pos, &read](google::protobuf::Message& msg)
+  {
+    uint32_t size;
+    if (!read(&size, sizeof(size)) || pos + size > bundle.size())
+      return false;
+    bool parsed = msg.ParseFromArray(bundle.data() + pos, (int)size);
+    pos += size;
+    return parsed;
+  };
+
+  char magic[8];
+  uint32_t version, numSubstances, numCompounds;
+  if (!read(magic, sizeof(magic)) || std::memcmp(magic, BundleMagic, sizeof(magic)) != 0 ||
+      !read(&version, sizeof(version)) || version != BundleVersion ||
+      !read(&numSubstances, sizeof(numSubstances)) || !read(&numCompounds, sizeof(numCompounds)))
+  {
+    log.Error(filename + " is not a supported substance bundle");
+    return false;
+  }
+  for (uint32_t i = 0; i < numSubstances; i++)
+  {
+    cdm::SubstanceData* subData = new cdm::SubstanceData();
+    if (!readMessage(*subData))
+    {
+      log.Error("Unable to read substance from bundle " + filename);
+      delete subData;
+      return false;
+    }
+    m_Substances.push_back(subData);
+  }
+  for (uint32_t i = 0; i < numCompounds; i++)
+  {
+    cdm::SubstanceData_CompoundData* compoundData = new cdm::SubstanceData_CompoundData();
+    if (!readMessage(*compoundData))
+    {
+      log.Error("Unable to read compound from bundle " + filename);
+      delete compoundData;
+      return false;
+    }
+    m_Compounds.push_back(compoundData);
+  }
+  return true;
+}
@@ -0,0 +1,55 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+PROTO_PUSH
+#include "bind/cdm/Substance.pb.h"
+PROTO_POP
+#include <memory>
+
+/**
+ * Read only substance and compound definitions, parsed once and shared by every engine in the process.
+ * Only the protobuf data is shared, this saves the file parsing but not the cost of the substances themselves.
+ * Each SESubstanceManager still creates and owns a full set of SESubstance and SESubstanceCompound objects
+ * from these definitions, as those hold the mutable state of an engine, and reloads them from here on Reset.
+ * The physicochemical, PK and PD data is not split out into shared objects either, the drugs system writes
+ * the tissue partition coefficients of each engine into the PK of its own substances.
+ * Libraries are never modified after they are loaded, so they can be used from any thread.
+ */
+class CDM_DECL SESubstanceLibrary
+{
+public:
+  virtual ~SESubstanceLibrary();
+
+  // Parses all substance files in the directory, and its compounds sub directory, the first time a directory is requested
+  static std::shared_ptr<const SESubstanceLibrary> GetDirectory(const std::string& directory, Logger* logger = nullptr);
+  // Reads a file written by WriteBundle the first time a bundle is requested
+  static std::shared_ptr<const SESubstanceLibrary> GetBundle(const std::string& filename, Logger* logger = nullptr);
+  // The library SESubstanceManager::LoadSubstanceDirectory uses instead of the substances directory
+  static void SetDefault(std::shared_ptr<const SESubstanceLibrary> library);
+  static std::shared_ptr<const SESubstanceLibrary> GetDefault();
+  // Forget any loaded directories and bundles, libraries already in use remain valid
+  static void ClearCache();
+
+  // Writes all definitions as binary protobuf messages into one file
+  bool WriteBundle(const std::string& filename, Logger* logger = nullptr) const;
+
+  // False if any file could not be read
+  bool IsComplete() const { return m_Complete; }
+  const std::vector<const cdm::SubstanceData*>& GetSubstances() const { return m_Substances; }
+  const std::vector<const cdm::SubstanceData_CompoundData*>& GetCompounds() const { return m_Compounds; }
+  // Hash of all definitions, independent of the order they were read in
+  const std::string& GetContentHash() const { return m_ContentHash; }
+
+protected:
+  SESubstanceLibrary();
+
+  bool LoadDirectory(const std::string& directory, Logger* logger);
+  bool LoadBundle(const std::string& filename, Logger* logger);
+  void ComputeContentHash();
+
+  bool                                                m_Complete;
+  std::vector<const cdm::SubstanceData*>              m_Substances;
+  std::vector<const cdm::SubstanceData_CompoundData*> m_Compounds;
+  std::string                                         m_ContentHash;
+};
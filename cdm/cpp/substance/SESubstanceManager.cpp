@@ -7,8 +7,6 @@
 #include "substance/SESubstanceCompound.h"
 #include "utils/FileUtils.h"
 #include "../utils/unitconversion/UnitConversionEngine.h"
-#include "dirent.h"
-#include <google/protobuf/text_format.h>
 
 SESubstanceManager::SESubstanceManager(Logger* logger) : Loggable(logger)
 {
@@ -28,8 +26,9 @@ void SESubstanceManager::Clear()
   m_ActiveCompounds.clear();
   m_ActiveGases.clear();
   m_ActiveLiquids.clear();
-  DELETE_MAP_SECOND(m_OriginalCompoundData);
-  DELETE_MAP_SECOND(m_OriginalSubstanceData);
+  m_OriginalCompoundData.clear();
+  m_OriginalSubstanceData.clear();
+  m_Library = nullptr;
 }
 
 void SESubstanceManager::Reset()
@@ -240,93 +239,38 @@ void SESubstanceManager::RemoveActiveCompounds(const std::vector<SESubstanceComp
 
 bool SESubstanceManager::LoadSubstanceDirectory()
 {
-  bool succeed = true;
-  Clear();
-  std::stringstream ss;
-  DIR *sdir;
-  DIR *cdir;
-  struct dirent *ent;
-
-  std::string workingDirectory = GetCurrentWorkingDirectory();
-
+  std::shared_ptr<const SESubstanceLibrary> library = SESubstanceLibrary::GetDefault();
+  if (library == nullptr)
+  {
 #if defined(_WIN32)
-  sdir = opendir("./substances/");
-  cdir = opendir("./substances/compounds");
+    library = SESubstanceLibrary::GetDirectory("./substances", GetLogger());
 #else
-  sdir = opendir(std::string(workingDirectory + std::string("/substances/")).c_str());
-  cdir = opendir(std::string(workingDirectory + std::string("/substances/compounds/")).c_str());
+    library = SESubstanceLibrary::GetDirectory(GetCurrentWorkingDirectory() + "/substances", GetLogger());
 #endif
+  }
+  return LoadSubstanceLibrary(library);
+}
 
-  cdm::SubstanceData* subData;
-  cdm::SubstanceData_CompoundData* compoundData;
-
-  if (sdir != nullptr)
+bool SESubstanceManager::LoadSubstanceLibrary(std::shared_ptr<const SESubstanceLibrary> library)
+{
+  Clear();
+  if (library == nullptr)
+    return false;
+  m_Library = library;
+  for (const cdm::SubstanceData* subData : m_Library->GetSubstances())
   {
-    while ((ent = readdir(sdir)) != nullptr)
-    {
-      ss.str("");
-      ss << workingDirectory << "/substances/" << ent->d_name;
-      if (!IsDirectory(ent) && strlen(ent->d_name) > 2)
-      {
-        try
-        {
-          //Info("Reading substance file : " + ss.str());
-          std::ifstream input(ss.str());
-          std::string fmsg((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
-
-          subData = new cdm::SubstanceData();
-          if (!google::protobuf::TextFormat::ParseFromString(fmsg, subData))
-          {
-            succeed = false;
-            Error("Unable to read substance " + ss.str());
-            delete subData;
-            continue;
-          }
-        }
-        catch(...)
-        {
-          Info("I caught something in "+ss.str());
-          delete subData;
-          continue;
-        }
-        SESubstance* sub = new SESubstance(GetLogger());
-        SESubstance::Load(*subData, *sub);
-        //SESubstance::Unload(*sub); // This is here to debug serialization if I have to
-        m_OriginalSubstanceData[sub] = subData;
-        AddSubstance(*sub);
-      }
-    }
+    SESubstance* sub = new SESubstance(GetLogger());
+    SESubstance::Load(*subData, *sub);
+    m_OriginalSubstanceData[sub] = subData;
+    AddSubstance(*sub);
   }
-  closedir(sdir);
-
-  if (cdir != nullptr)
+  // Compounds refer to our substances, so load them last
+  for (const cdm::SubstanceData_CompoundData* compoundData : m_Library->GetCompounds())
   {
-    while ((ent = readdir(cdir)) != nullptr)
-    {
-      ss.str("");
-      ss << workingDirectory << "/substances/compounds/" << ent->d_name;
-      if (!IsDirectory(ent) && strlen(ent->d_name) > 2)
-      {
-        std::ifstream input(ss.str());
-        std::string fmsg((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
-
-        //Info("Reading compound file : ./substances/compounds/" + ent->d_name);
-        compoundData = new cdm::SubstanceData_CompoundData();
-        if (!google::protobuf::TextFormat::ParseFromString(fmsg, compoundData))
-        {
-          succeed = false;
-          Error("Unable to read compound " + ss.str());
-          delete compoundData;
-          continue;
-        }
-        SESubstanceCompound* compound = new SESubstanceCompound(GetLogger());
-        SESubstanceCompound::Load(*compoundData, *compound, *this);
-        m_OriginalCompoundData[compound] = compoundData;
-        AddCompound(*compound);
-      }
-    }
+    SESubstanceCompound* compound = new SESubstanceCompound(GetLogger());
+    SESubstanceCompound::Load(*compoundData, *compound, *this);
+    m_OriginalCompoundData[compound] = compoundData;
+    AddCompound(*compound);
   }
-  closedir(cdir);
-  return succeed;
+  return m_Library->IsComplete();
 }
-
@@ -4,9 +4,7 @@
 #pragma once
 #include "substance/SESubstance.h"
 #include "substance/SESubstanceCompound.h"
-PROTO_PUSH
-#include "bind/cdm/Substance.pb.h"
-PROTO_POP
+#include "substance/SESubstanceLibrary.h"
 
 class CDM_DECL SESubstanceManager : public Loggable
 {
@@ -17,6 +15,9 @@ public:
   virtual void                                     Clear();  
   virtual void                                     Reset();
   virtual bool                                     LoadSubstanceDirectory();
+  // Creates our substances and compounds from the shared definitions of the library
+  virtual bool                                     LoadSubstanceLibrary(std::shared_ptr<const SESubstanceLibrary> library);
+  virtual const SESubstanceLibrary*                GetSubstanceLibrary() const { return m_Library.get(); }
 
   virtual const std::vector<SESubstance*>&         GetSubstances() const;
   virtual SESubstance*                             GetSubstance(const std::string& name) const;  
@@ -66,6 +67,8 @@ protected:
   std::vector<SESubstanceCompound*>  m_ActiveCompounds;
 
 private:
+  // Definitions are owned by the shared library
+  std::shared_ptr<const SESubstanceLibrary>         m_Library;
   std::map<SESubstance*, const cdm::SubstanceData*> m_OriginalSubstanceData;  
   std::map<SESubstanceCompound*, const cdm::SubstanceData_CompoundData*> m_OriginalCompoundData;
 };
\ No newline at end of file
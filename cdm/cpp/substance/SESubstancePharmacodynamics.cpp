@@ -135,6 +135,25 @@ void SESubstancePharmacodynamics::Serialize(const cdm::SubstanceData_Pharmacodyn
     SEScalarNegative1To1::Load(src.tubularpermeabilitymodifier(), dst.GetTubularPermeabilityModifier());
 }
 
+void SESubstancePharmacodynamics::Copy(const SESubstancePharmacodynamics& src, SESubstancePharmacodynamics& dst)
+{
+  CopyScalar(src.m_Bronchodilation, dst.m_Bronchodilation);
+  CopyScalar(src.m_DiastolicPressureModifier, dst.m_DiastolicPressureModifier);
+  CopyScalar(src.m_EC50, dst.m_EC50);
+  CopyScalar(src.m_EMaxShapeParameter, dst.m_EMaxShapeParameter);
+  CopyScalar(src.m_HeartRateModifier, dst.m_HeartRateModifier);
+  CopyScalar(src.m_NeuromuscularBlock, dst.m_NeuromuscularBlock);
+  if (src.m_PupillaryResponse != nullptr)
+    SEPupillaryResponse::Copy(*src.m_PupillaryResponse, dst.GetPupillaryResponse());
+  else
+    SAFE_DELETE(dst.m_PupillaryResponse);
+  CopyScalar(src.m_RespirationRateModifier, dst.m_RespirationRateModifier);
+  CopyScalar(src.m_Sedation, dst.m_Sedation);
+  CopyScalar(src.m_SystolicPressureModifier, dst.m_SystolicPressureModifier);
+  CopyScalar(src.m_TidalVolumeModifier, dst.m_TidalVolumeModifier);
+  CopyScalar(src.m_TubularPermeabilityModifier, dst.m_TubularPermeabilityModifier);
+}
+
 cdm::SubstanceData_PharmacodynamicsData* SESubstancePharmacodynamics::Unload(const SESubstancePharmacodynamics& src)
 {
   if (!src.IsValid())
@@ -60,6 +60,31 @@ void SESubstancePharmacokinetics::Serialize(const cdm::SubstanceData_Pharmacokin
   }
 }
 
+void SESubstancePharmacokinetics::Copy(const SESubstancePharmacokinetics& src, SESubstancePharmacokinetics& dst)
+{
+  if (src.m_Physicochemicals != nullptr)
+    SESubstancePhysicochemicals::Copy(*src.m_Physicochemicals, dst.GetPhysicochemicals());
+  else
+    SAFE_DELETE(dst.m_Physicochemicals);
+  for (auto itr = dst.m_TissueKinetics.begin(); itr != dst.m_TissueKinetics.end();)
+  {
+    if (src.m_TissueKinetics.find(itr->first) == src.m_TissueKinetics.end())
+    {
+      delete itr->second;
+      itr = dst.m_TissueKinetics.erase(itr);
+    }
+    else
+      ++itr;
+  }
+  for (auto itr : src.m_TissueKinetics)
+  {
+    SESubstanceTissuePharmacokinetics*& fx = dst.m_TissueKinetics[itr.first];
+    if (fx == nullptr)
+      fx = new SESubstanceTissuePharmacokinetics(itr.first, dst.GetLogger());
+    SESubstanceTissuePharmacokinetics::Copy(*itr.second, *fx);
+  }
+}
+
 cdm::SubstanceData_PharmacokineticsData* SESubstancePharmacokinetics::Unload(const SESubstancePharmacokinetics& src)
 {
   if (!src.IsValid())
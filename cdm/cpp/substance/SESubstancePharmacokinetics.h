@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::SubstanceData_PharmacokineticsData& src, SESubstancePharmacokinetics& dst);
   static cdm::SubstanceData_PharmacokineticsData* Unload(const SESubstancePharmacokinetics& src);
+  static void Copy(const SESubstancePharmacokinetics& src, SESubstancePharmacokinetics& dst);
 protected:
   static void Serialize(const cdm::SubstanceData_PharmacokineticsData& src, SESubstancePharmacokinetics& dst);
   static void Serialize(const SESubstancePharmacokinetics& src, cdm::SubstanceData_PharmacokineticsData& dst);
@@ -86,6 +86,17 @@ void SESubstancePhysicochemicals::Serialize(const cdm::SubstanceData_Physicochem
     SEScalar::Load(src.oralabsorptionrateconstant(), dst.GetOralAbsorptionRateConstant());
 }
 
+void SESubstancePhysicochemicals::Copy(const SESubstancePhysicochemicals& src, SESubstancePhysicochemicals& dst)
+{
+  CopyScalar(src.m_AcidDissociationConstant, dst.m_AcidDissociationConstant);
+  dst.m_BindingProtein = src.m_BindingProtein;
+  CopyScalar(src.m_BloodPlasmaRatio, dst.m_BloodPlasmaRatio);
+  CopyScalar(src.m_FractionUnboundInPlasma, dst.m_FractionUnboundInPlasma);
+  dst.m_IonicState = src.m_IonicState;
+  CopyScalar(src.m_LogP, dst.m_LogP);
+  CopyScalar(src.m_OralAbsorptionRateConstant, dst.m_OralAbsorptionRateConstant);
+}
+
 cdm::SubstanceData_PhysicochemicalData* SESubstancePhysicochemicals::Unload(const SESubstancePhysicochemicals& src)
 {
   if (!src.IsValid())
@@ -20,6 +20,7 @@ public:
 
   static void Load(const cdm::SubstanceData_PhysicochemicalData& src, SESubstancePhysicochemicals& dst);
   static cdm::SubstanceData_PhysicochemicalData* Unload(const SESubstancePhysicochemicals& src);
+  static void Copy(const SESubstancePhysicochemicals& src, SESubstancePhysicochemicals& dst);
 protected:
   static void Serialize(const cdm::SubstanceData_PhysicochemicalData& src, SESubstancePhysicochemicals& dst);
   static void Serialize(const SESubstancePhysicochemicals& src, cdm::SubstanceData_PhysicochemicalData& dst);
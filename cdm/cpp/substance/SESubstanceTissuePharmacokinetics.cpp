@@ -31,6 +31,11 @@ void SESubstanceTissuePharmacokinetics::Serialize(const cdm::SubstanceData_Tissu
     SEScalar::Load(src.partitioncoefficient(),dst.GetPartitionCoefficient());
 }
 
+void SESubstanceTissuePharmacokinetics::Copy(const SESubstanceTissuePharmacokinetics& src, SESubstanceTissuePharmacokinetics& dst)
+{
+  CopyScalar(src.m_PartitionCoefficient, dst.m_PartitionCoefficient);
+}
+
 cdm::SubstanceData_TissuePharmacokineticsData* SESubstanceTissuePharmacokinetics::Unload(const SESubstanceTissuePharmacokinetics& src)
 {
   cdm::SubstanceData_TissuePharmacokineticsData* dst = new cdm::SubstanceData_TissuePharmacokineticsData();
@@ -5,6 +5,9 @@
 #ifdef MSVC
   #pragma warning(disable : 4503)
 #endif
+#include "Eigen/Core"
+#include "Eigen/SparseCore"
+#include "Eigen/SparseLU"
 
 #define SUBSTANCE_TRANSPORTER_TEMPLATE typename GraphType, typename FluxUnit, typename QuantityUnit, typename ExtensiveUnit, typename IntensiveUnit
 
@@ -93,6 +96,20 @@ public:
   void Transport(GraphType& graph, double timeStep_s);
 
 protected:
+  bool IsSparsePatternAnalyzed() const;
+
+  // These are transient and set every Transport call, kept to avoid reallocating every time-step
+  std::vector<Eigen::Triplet<double>> m_AMatrixTriplets;
+  Eigen::SparseMatrix<double>         m_AMatrix;
+  Eigen::MatrixXd                     m_bMatrix;// One column per substance
+  Eigen::MatrixXd                     m_xMatrix;
+
+  // The non-zero pattern of A only changes when a flux changes direction or goes to/from zero,
+  // so the symbolic analysis (ordering) of the solver is kept until it does
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> m_SparseLU;
+  std::vector<int>                             m_SparseOuterIndex;
+  std::vector<int>                             m_SparseInnerIndex;
+
   const FluxUnit      &m_FluxUnit;
   const QuantityUnit  &m_QuantityUnit;
   const ExtensiveUnit &m_ExtensiveUnit;
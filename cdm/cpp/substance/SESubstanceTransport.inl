@@ -5,6 +5,8 @@
 #include "substance/SESubstanceTransport.h"
 
 #include "Eigen/Core"
+#include "Eigen/SparseCore"
+#include "Eigen/SparseLU"
 
 #include "properties/SEScalarVolume.h"
 
@@ -35,7 +37,9 @@ SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, Intensi
 /// \details
 /// Calculates the intensive (liquid concentration or gas volume fraction) and extensive (mass in liquid or volume of gas)
 /// properties for all vertexs in the graph.
-/// This uses an Eigen solver.
+/// This uses an Eigen sparse LU solver.
+/// The A matrix is the same for all substances, so it is factorized once and all substances are solved together,
+/// one column of the right hand side per substance.
 /// An INTENSIVE property is a bulk property, meaning that it is a physical property of a system that does not depend on the system size or the amount of material in the system.
 /// For us, this includes Concentration and VolumeFraction
 /// An EXTENSIVE property is additive for independent, non-interacting subsystems. The property is proportional to the amount of material in the system.
@@ -55,10 +59,9 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
     return;
 
   // The A matrix is a square matrix for all nodes
-  //All zeros - we'll modify the values later
+  //Assembled from triplets, duplicate entries are summed
   //Ax=b
-  Eigen::MatrixXd AMatrix = Eigen::MatrixXd::Zero(numVerts, numVerts);
-  Eigen::MatrixXd AMatrixInverse = Eigen::MatrixXd::Zero(numVerts, numVerts);
+  m_AMatrixTriplets.clear();
 
   //1) Determine A matrix - this will be the same for all substances -------------------------------------------------
   for (size_t i = 0; i < numVerts; i++)
@@ -70,7 +73,7 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
     if (quantity.IsInfinity())
     {
       //Infinite quantity means intensive property is constant
-      AMatrix(i, i) = 1.0;
+      m_AMatrixTriplets.emplace_back(int(i), int(i), 1.0);
       continue;
     }
     else if (!quantity.IsValid() || quantity.IsZero())
@@ -80,7 +83,7 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
       //Also setting it to a constant value of zero and no adding the in and out path will not solve
       //Basically divide by zero / un-invertable matrix issues
       //The solution is to use an approximately zero quantity
-      AMatrix(i, i) += 1e-20;// ZERO_APPROX;
+      m_AMatrixTriplets.emplace_back(int(i), int(i), 1e-20);// ZERO_APPROX;
     }
     else
     {
@@ -94,7 +97,7 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
         Fatal(ss);
       }
 
-      AMatrix(i, i) += quantity.GetValue(m_QuantityUnit);
+      m_AMatrixTriplets.emplace_back(int(i), int(i), quantity.GetValue(m_QuantityUnit));
     }
 
     auto* sEdges = graph.GetSourceEdges(*v);
@@ -115,12 +118,12 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
           if (flux < 0.0)
           {
             //Flow in
-            AMatrix(i, graph.GetVertexIndex(srcEdge->GetTargetVertex())) -= std::abs(flux) * timeStep_s;
+            m_AMatrixTriplets.emplace_back(int(i), int(graph.GetVertexIndex(srcEdge->GetTargetVertex())), -std::abs(flux) * timeStep_s);
           }
           else
           {
             //Flow out
-            AMatrix(i, i) += std::abs(flux) * timeStep_s;
+            m_AMatrixTriplets.emplace_back(int(i), int(i), std::abs(flux) * timeStep_s);
           }
         }
       }
@@ -144,66 +147,87 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
           if (flux < 0.0)
           {
             //Flow out
-            AMatrix(i, i) += std::abs(flux) * timeStep_s;
+            m_AMatrixTriplets.emplace_back(int(i), int(i), std::abs(flux) * timeStep_s);
           }
           else
           {
             //Flow in          
-            AMatrix(i, graph.GetVertexIndex(tgtEdge->GetSourceVertex())) -= std::abs(flux) * timeStep_s;
+            m_AMatrixTriplets.emplace_back(int(i), int(graph.GetVertexIndex(tgtEdge->GetSourceVertex())), -std::abs(flux) * timeStep_s);
           }
         }
       }
     }
   }
 
-  //Since A doesn't change, we'll just calculate it's inverse and reuse it to solve for x for each substance
-  AMatrixInverse = AMatrix.inverse();
+  m_AMatrix.resize(numVerts, numVerts);
+  m_AMatrix.setFromTriplets(m_AMatrixTriplets.begin(), m_AMatrixTriplets.end());
+  m_AMatrix.makeCompressed();
 
-  //2) Loop over the extensive/intensive properties per substances -------------------------------------------------  
-  for (size_t s=0; s<numSubstances; s++)
+  //2) Gather the extensive/intensive properties of all substances into the b matrix, one column per substance ---------
+  m_bMatrix.setZero(numVerts, numSubstances);
+  for (size_t i = 0; i < numVerts; i++)
   {
-    //Ax = b
-    Eigen::VectorXd xVector(numVerts); //x
-    Eigen::VectorXd bVector(numVerts); //b
-    bVector = Eigen::VectorXd::Zero(numVerts);
-
-    //2a) Put the extensive property in the b vector for each node -------------------------------------------------
-    for (size_t i = 0; i<numVerts; i++)
+    auto* v = verticies[i];
+    if (!v->HasQuantity())
+      continue;
+    bool constantIntensive = v->GetQuantity().IsInfinity();
+    auto& substances = v->GetTransportSubstances();
+    for (size_t s = 0; s < numSubstances; s++)
     {
-      auto* v = verticies[i];
-      if (!v->HasQuantity())
-        continue;
-      auto* q = v->GetTransportSubstances()[s];
+      auto* q = substances[s];
       if (q->HasIntensive())
       {
-        if (v->GetQuantity().IsInfinity())
+        if (constantIntensive)
         {
           //Concentration doesn't change - this happens at reference nodes a lot (e.g. the Environment)
-          bVector(i) = q->GetIntensive().GetValue(m_IntensiveUnit);
+          m_bMatrix(i, s) = q->GetIntensive().GetValue(m_IntensiveUnit);
         }
         else
         {
-          bVector(i) += q->GetExtensive().GetValue(m_ExtensiveUnit);
+          m_bMatrix(i, s) += q->GetExtensive().GetValue(m_ExtensiveUnit);
         }
       }
     }
+  }
 
-    //2b) Solve for the intensive property x vector -------------------------------------------------
-  xVector = AMatrixInverse * bVector;
+  //3) Solve for the intensive property of all substances at once -------------------------------------------------
+  //Since A is the same for all substances, we only factorize it once
+  //Only redo the symbolic analysis (column ordering) when the non-zero pattern changes
+  if (!IsSparsePatternAnalyzed())
+  {
+    m_SparseLU.analyzePattern(m_AMatrix);
+    m_SparseOuterIndex.assign(m_AMatrix.outerIndexPtr(), m_AMatrix.outerIndexPtr() + m_AMatrix.outerSize() + 1);
+    m_SparseInnerIndex.assign(m_AMatrix.innerIndexPtr(), m_AMatrix.innerIndexPtr() + m_AMatrix.nonZeros());
+  }
+  m_SparseLU.factorize(m_AMatrix);
+  if (m_SparseLU.info() == Eigen::Success)
+    m_xMatrix = m_SparseLU.solve(m_bMatrix);
+  else
+  {
+    ///\error Warning: Sparse transport solve failed, using a dense solver.
+    Warning("Sparse transport solve failed, using a dense solver.", "SESubstanceTransporter::Transport");
+    m_SparseOuterIndex.clear();
+    m_SparseInnerIndex.clear();
+    m_xMatrix = Eigen::MatrixXd(m_AMatrix).partialPivLu().solve(m_bMatrix);
+  }
 
-    //2c) Parse the intensive property and calculate the new intensive property -------------------------------------------------
-    for (size_t i = 0; i<numVerts; i++)
+  //4) Scatter the new intensive properties back out to the substances -------------------------------------------------
+  for (size_t i = 0; i < numVerts; i++)
+  {
+    auto* v = verticies[i];
+    bool hasQuantity = v->HasQuantity();
+    auto& substances = v->GetTransportSubstances();
+    for (size_t s = 0; s < numSubstances; s++)
     {
-      auto* v = verticies[i];
-      auto* q = v->GetTransportSubstances()[s];
+      auto* q = substances[s];
       if (q->HasExtensive())
       {
-        if (!v->HasQuantity())
+        if (!hasQuantity)
         {
           q->Invalidate();
           continue;
         }
-        double newIntensiveVlaue = xVector(i);
+        double newIntensiveVlaue = m_xMatrix(i, s);
         if (std::abs(newIntensiveVlaue) < ZERO_APPROX)
         {
           newIntensiveVlaue = 0.0;
@@ -211,9 +235,25 @@ void SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, In
         //We force this value becuase it can get above 1 when there is a disconinuity that causes numerical error.
         //That generally only occurs when an extreme action or condition is applied.
         //The balance call after this loop will adjust everything to sum nicely to 1.0.
-        q->GetIntensive().ForceValue(newIntensiveVlaue, m_IntensiveUnit);        
+        q->GetIntensive().ForceValue(newIntensiveVlaue, m_IntensiveUnit);
       }
     }
   }
   graph.BalanceByIntensive();
 }
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Check if the sparse solver has already analyzed the non-zero pattern of the current A matrix.
+///
+/// \return true if the pattern matches the last pattern analyzed, false if a new analysis is needed.
+//--------------------------------------------------------------------------------------------------
+template <typename GraphType, typename FluxUnit, typename QuantityUnit, typename ExtensiveUnit, typename IntensiveUnit>
+bool SESubstanceTransporter<GraphType, FluxUnit, QuantityUnit, ExtensiveUnit, IntensiveUnit>::IsSparsePatternAnalyzed() const
+{
+  if (m_SparseOuterIndex.size() != size_t(m_AMatrix.outerSize() + 1) ||
+      m_SparseInnerIndex.size() != size_t(m_AMatrix.nonZeros()))
+    return false;
+  return std::equal(m_SparseOuterIndex.begin(), m_SparseOuterIndex.end(), m_AMatrix.outerIndexPtr()) &&
+         std::equal(m_SparseInnerIndex.begin(), m_SparseInnerIndex.end(), m_AMatrix.innerIndexPtr());
+}
@@ -56,6 +56,13 @@ void SEActiveConditioning::Serialize(const cdm::EnvironmentData_ActiveConditioni
   if (src.has_surfaceareafraction())
     SEScalar0To1::Load(src.surfaceareafraction(),dst.GetSurfaceAreaFraction());
 }
+
+void SEActiveConditioning::Copy(const SEActiveConditioning& src, SEActiveConditioning& dst)
+{
+  CopyScalar(src.m_Power, dst.m_Power);
+  CopyScalar(src.m_SurfaceArea, dst.m_SurfaceArea);
+  CopyScalar(src.m_SurfaceAreaFraction, dst.m_SurfaceAreaFraction);
+}
 cdm::EnvironmentData_ActiveConditioningData* SEActiveConditioning::Unload(const SEActiveConditioning& src)
 {
   cdm::EnvironmentData_ActiveConditioningData* dst = new cdm::EnvironmentData_ActiveConditioningData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::EnvironmentData_ActiveConditioningData& src, SEActiveConditioning& dst);
   static cdm::EnvironmentData_ActiveConditioningData* Unload(const SEActiveConditioning& src);
+  static void Copy(const SEActiveConditioning& src, SEActiveConditioning& dst);
 protected:
   static void Serialize(const cdm::EnvironmentData_ActiveConditioningData& src, SEActiveConditioning& dst);
   static void Serialize(const SEActiveConditioning& src, cdm::EnvironmentData_ActiveConditioningData& dst);
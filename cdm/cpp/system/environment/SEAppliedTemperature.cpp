@@ -57,6 +57,14 @@ void SEAppliedTemperature::Serialize(const cdm::EnvironmentData_AppliedTemperatu
     SEScalar0To1::Load(src.surfaceareafraction(), dst.GetSurfaceAreaFraction());
 }
 
+void SEAppliedTemperature::Copy(const SEAppliedTemperature& src, SEAppliedTemperature& dst)
+{
+  dst.m_State = src.m_State == cdm::eSwitch::NullSwitch ? cdm::eSwitch::Off : src.m_State;
+  CopyScalar(src.m_Temperature, dst.m_Temperature);
+  CopyScalar(src.m_SurfaceArea, dst.m_SurfaceArea);
+  CopyScalar(src.m_SurfaceAreaFraction, dst.m_SurfaceAreaFraction);
+}
+
 cdm::EnvironmentData_AppliedTemperatureData* SEAppliedTemperature::Unload(const SEAppliedTemperature& src)
 {
   cdm::EnvironmentData_AppliedTemperatureData* dst = new cdm::EnvironmentData_AppliedTemperatureData();
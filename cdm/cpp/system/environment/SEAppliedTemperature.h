@@ -16,6 +16,7 @@ public:
 
   static void Load(const cdm::EnvironmentData_AppliedTemperatureData& src, SEAppliedTemperature& dst);
   static cdm::EnvironmentData_AppliedTemperatureData* Unload(const SEAppliedTemperature& src);
+  static void Copy(const SEAppliedTemperature& src, SEAppliedTemperature& dst);
 protected:
   static void Serialize(const cdm::EnvironmentData_AppliedTemperatureData& src, SEAppliedTemperature& dst);
   static void Serialize(const SEAppliedTemperature& src, cdm::EnvironmentData_AppliedTemperatureData& dst);
@@ -127,6 +127,34 @@ void SEEnvironment::Serialize(const cdm::EnvironmentData& src, SEEnvironment& ds
 
 }
 
+void SEEnvironment::Copy(const SEEnvironment& src, SEEnvironment& dst)
+{
+  CopyScalar(src.m_ConvectiveHeatLoss, dst.m_ConvectiveHeatLoss);
+  CopyScalar(src.m_ConvectiveHeatTranferCoefficient, dst.m_ConvectiveHeatTranferCoefficient);
+  CopyScalar(src.m_EvaporativeHeatLoss, dst.m_EvaporativeHeatLoss);
+  CopyScalar(src.m_EvaporativeHeatTranferCoefficient, dst.m_EvaporativeHeatTranferCoefficient);
+  CopyScalar(src.m_RadiativeHeatLoss, dst.m_RadiativeHeatLoss);
+  CopyScalar(src.m_RadiativeHeatTranferCoefficient, dst.m_RadiativeHeatTranferCoefficient);
+  CopyScalar(src.m_RespirationHeatLoss, dst.m_RespirationHeatLoss);
+  CopyScalar(src.m_SkinHeatLoss, dst.m_SkinHeatLoss);
+  if (src.m_Conditions != nullptr)
+    SEEnvironmentalConditions::Copy(*src.m_Conditions, dst.GetConditions());
+  else
+    SAFE_DELETE(dst.m_Conditions);
+  if (src.m_ActiveHeating != nullptr)
+    SEActiveConditioning::Copy(*src.m_ActiveHeating, dst.GetActiveHeating());
+  else
+    SAFE_DELETE(dst.m_ActiveHeating);
+  if (src.m_ActiveCooling != nullptr)
+    SEActiveConditioning::Copy(*src.m_ActiveCooling, dst.GetActiveCooling());
+  else
+    SAFE_DELETE(dst.m_ActiveCooling);
+  if (src.m_AppliedTemperature != nullptr)
+    SEAppliedTemperature::Copy(*src.m_AppliedTemperature, dst.GetAppliedTemperature());
+  else
+    SAFE_DELETE(dst.m_AppliedTemperature);
+}
+
 cdm::EnvironmentData* SEEnvironment::Unload(const SEEnvironment& src)
 {
   cdm::EnvironmentData* dst = new cdm::EnvironmentData();
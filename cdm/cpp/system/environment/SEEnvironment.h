@@ -23,6 +23,7 @@ public:
 
   static void Load(const cdm::EnvironmentData& src, SEEnvironment& dst);
   static cdm::EnvironmentData* Unload(const SEEnvironment& src);
+  static void Copy(const SEEnvironment& src, SEEnvironment& dst);
 protected:
   static void Serialize(const cdm::EnvironmentData& src, SEEnvironment& dst);
   static void Serialize(const SEEnvironment& src, cdm::EnvironmentData& dst);
@@ -142,6 +142,69 @@ void SEEnvironmentalConditions::Serialize(const cdm::EnvironmentData_ConditionsD
   }
 }
 
+void SEEnvironmentalConditions::Copy(const SEEnvironmentalConditions& src, SEEnvironmentalConditions& dst)
+{
+  dst.m_SurroundingType = src.m_SurroundingType;
+  CopyScalar(src.m_AirDensity, dst.m_AirDensity);
+  CopyScalar(src.m_AirVelocity, dst.m_AirVelocity);
+  CopyScalar(src.m_AmbientTemperature, dst.m_AmbientTemperature);
+  CopyScalar(src.m_AtmosphericPressure, dst.m_AtmosphericPressure);
+  CopyScalar(src.m_ClothingResistance, dst.m_ClothingResistance);
+  CopyScalar(src.m_Emissivity, dst.m_Emissivity);
+  CopyScalar(src.m_MeanRadiantTemperature, dst.m_MeanRadiantTemperature);
+  CopyScalar(src.m_RelativeHumidity, dst.m_RelativeHumidity);
+  CopyScalar(src.m_RespirationAmbientTemperature, dst.m_RespirationAmbientTemperature);
+  // Keep the fraction and concentration objects we have when they are for the same substances
+  SESubstance* sub;
+  bool sameGases = src.m_AmbientGases.size() == dst.m_AmbientGases.size();
+  for (size_t i = 0; sameGases && i < src.m_AmbientGases.size(); i++)
+    sameGases = src.m_AmbientGases[i]->GetSubstance().GetName() == dst.m_AmbientGases[i]->GetSubstance().GetName();
+  if (!sameGases)
+  {
+    DELETE_VECTOR(dst.m_AmbientGases);
+    dst.m_cAmbientGases.clear();
+  }
+  for (size_t i = 0; i < src.m_AmbientGases.size(); i++)
+  {
+    if (sameGases)
+    {
+      SESubstanceFraction::Copy(*src.m_AmbientGases[i], *dst.m_AmbientGases[i]);
+      continue;
+    }
+    sub = dst.m_Substances.GetSubstance(src.m_AmbientGases[i]->GetSubstance().GetName());
+    if (sub == nullptr)
+    {
+      dst.Error("Ignoring an environmental conditions ambient gas that was not found : " + src.m_AmbientGases[i]->GetSubstance().GetName());
+      continue;
+    }
+    SESubstanceFraction::Copy(*src.m_AmbientGases[i], dst.GetAmbientGas(*sub));
+  }
+
+  bool sameAerosols = src.m_AmbientAerosols.size() == dst.m_AmbientAerosols.size();
+  for (size_t i = 0; sameAerosols && i < src.m_AmbientAerosols.size(); i++)
+    sameAerosols = src.m_AmbientAerosols[i]->GetSubstance().GetName() == dst.m_AmbientAerosols[i]->GetSubstance().GetName();
+  if (!sameAerosols)
+  {
+    DELETE_VECTOR(dst.m_AmbientAerosols);
+    dst.m_cAmbientAerosols.clear();
+  }
+  for (size_t i = 0; i < src.m_AmbientAerosols.size(); i++)
+  {
+    if (sameAerosols)
+    {
+      SESubstanceConcentration::Copy(*src.m_AmbientAerosols[i], *dst.m_AmbientAerosols[i]);
+      continue;
+    }
+    sub = dst.m_Substances.GetSubstance(src.m_AmbientAerosols[i]->GetSubstance().GetName());
+    if (sub == nullptr)
+    {
+      dst.Error("Ignoring an environmental conditions ambient aerosol that was not found : " + src.m_AmbientAerosols[i]->GetSubstance().GetName());
+      continue;
+    }
+    SESubstanceConcentration::Copy(*src.m_AmbientAerosols[i], dst.GetAmbientAerosol(*sub));
+  }
+}
+
 cdm::EnvironmentData_ConditionsData* SEEnvironmentalConditions::Unload(const SEEnvironmentalConditions& src)
 {
   cdm::EnvironmentData_ConditionsData* dst = new cdm::EnvironmentData_ConditionsData();
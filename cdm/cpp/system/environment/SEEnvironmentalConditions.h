@@ -25,6 +25,7 @@ public:
 
   static void Load(const cdm::EnvironmentData_ConditionsData& src, SEEnvironmentalConditions& dst);
   static cdm::EnvironmentData_ConditionsData* Unload(const SEEnvironmentalConditions& src);
+  static void Copy(const SEEnvironmentalConditions& src, SEEnvironmentalConditions& dst);
 protected:
   static void Serialize(const cdm::EnvironmentData_ConditionsData& src, SEEnvironmentalConditions& dst);
   static void Serialize(const SEEnvironmentalConditions& src, cdm::EnvironmentData_ConditionsData& dst);
@@ -54,6 +54,15 @@ void SEChangeEnvironmentConditions::Serialize(const cdm::ChangeEnvironmentCondit
     dst.SetConditionsFile(src.conditionsfile());
 }
 
+void SEChangeEnvironmentConditions::Copy(const SEChangeEnvironmentConditions& src, SEChangeEnvironmentConditions& dst)
+{
+  SEEnvironmentAction::Copy(src, dst);
+  if (src.HasConditions())
+    SEEnvironmentalConditions::Copy(*src.m_Conditions, dst.GetConditions());
+  else
+    dst.SetConditionsFile(src.m_ConditionsFile);
+}
+
 cdm::ChangeEnvironmentConditionsData* SEChangeEnvironmentConditions::Unload(const SEChangeEnvironmentConditions& src)
 {
   cdm::ChangeEnvironmentConditionsData* dst = new cdm::ChangeEnvironmentConditionsData();
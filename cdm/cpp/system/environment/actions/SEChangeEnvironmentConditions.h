@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::ChangeEnvironmentConditionsData& src, SEChangeEnvironmentConditions& dst);
   static cdm::ChangeEnvironmentConditionsData* Unload(const SEChangeEnvironmentConditions& src);
+  static void Copy(const SEChangeEnvironmentConditions& src, SEChangeEnvironmentConditions& dst);
 protected:
   static void Serialize(const cdm::ChangeEnvironmentConditionsData& src, SEChangeEnvironmentConditions& dst);
   static void Serialize(const SEChangeEnvironmentConditions& src, cdm::ChangeEnvironmentConditionsData& dst);
@@ -32,6 +33,7 @@ public:
   virtual bool HasConditionsFile() const;
   virtual void InvalidateConditionsFile();
   
+  virtual eActionType GetActionType() const { return eActionType::ChangeEnvironmentConditions; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -28,6 +28,11 @@ void SEEnvironmentAction::Serialize(const cdm::EnvironmentActionData& src, SEEnv
   SEAction::Serialize(src.action(), dst);
 }
 
+void SEEnvironmentAction::Copy(const SEEnvironmentAction& src, SEEnvironmentAction& dst)
+{
+  SEAction::Copy(src, dst);
+}
+
 void SEEnvironmentAction::Serialize(const SEEnvironmentAction& src, cdm::EnvironmentActionData& dst)
 {
   SEAction::Serialize(src, *dst.mutable_action());
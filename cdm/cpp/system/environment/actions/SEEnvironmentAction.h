@@ -24,7 +24,9 @@ public:
 protected:
   static void Serialize(const cdm::EnvironmentActionData& src, SEEnvironmentAction& dst);
   static void Serialize(const SEEnvironmentAction& src, cdm::EnvironmentActionData& dst);
+  static void Copy(const SEEnvironmentAction& src, SEEnvironmentAction& dst);
 
 public:
+  virtual eActionCategory GetActionCategory() const { return eActionCategory::Environment; }
   virtual void ToString(std::ostream &str) const = 0;
 };  
\ No newline at end of file
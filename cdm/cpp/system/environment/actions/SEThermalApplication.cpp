@@ -65,6 +65,17 @@ void SEThermalApplication::Serialize(const cdm::ThermalApplicationData& src, SET
   dst.m_ClearContents = true;
 }
 
+void SEThermalApplication::Copy(const SEThermalApplication& src, SEThermalApplication& dst)
+{
+  SEEnvironmentAction::Copy(src, dst);
+  if (src.HasActiveCooling())
+    SEActiveConditioning::Copy(*src.m_ActiveCooling, dst.GetActiveCooling());
+  if (src.HasActiveHeating())
+    SEActiveConditioning::Copy(*src.m_ActiveHeating, dst.GetActiveHeating());
+  if (src.HasAppliedTemperature())
+    SEAppliedTemperature::Copy(*src.m_AppliedTemperature, dst.GetAppliedTemperature());
+}
+
 cdm::ThermalApplicationData* SEThermalApplication::Unload(const SEThermalApplication& src)
 {
   cdm::ThermalApplicationData* dst = new cdm::ThermalApplicationData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::ThermalApplicationData& src, SEThermalApplication& dst);
   static cdm::ThermalApplicationData* Unload(const SEThermalApplication& src);
+  static void Copy(const SEThermalApplication& src, SEThermalApplication& dst);
 protected:
   static void Serialize(const cdm::ThermalApplicationData& src, SEThermalApplication& dst);
   static void Serialize(const SEThermalApplication& src, cdm::ThermalApplicationData& dst);
@@ -37,6 +38,7 @@ public:
   virtual SEAppliedTemperature& GetAppliedTemperature();
   virtual void RemoveAppliedTemperature();
 
+  virtual eActionType GetActionType() const { return eActionType::ThermalApplication; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
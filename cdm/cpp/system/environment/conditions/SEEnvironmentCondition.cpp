@@ -28,6 +28,11 @@ void SEEnvironmentCondition::Serialize(const cdm::EnvironmentConditionData& src,
   SECondition::Serialize(src.condition(), dst);
 }
 
+void SEEnvironmentCondition::Copy(const SEEnvironmentCondition& src, SEEnvironmentCondition& dst)
+{
+  SECondition::Copy(src, dst);
+}
+
 void SEEnvironmentCondition::Serialize(const SEEnvironmentCondition& src, cdm::EnvironmentConditionData& dst)
 {
   SECondition::Serialize(src, *dst.mutable_condition());
@@ -24,6 +24,7 @@ public:
 protected:
   static void Serialize(const cdm::EnvironmentConditionData& src, SEEnvironmentCondition& dst);
   static void Serialize(const SEEnvironmentCondition& src, cdm::EnvironmentConditionData& dst);
+  static void Copy(const SEEnvironmentCondition& src, SEEnvironmentCondition& dst);
 
 public:
   virtual void ToString(std::ostream &str) const = 0;
@@ -48,6 +48,15 @@ void SEInitialEnvironmentConditions::Serialize(const cdm::InitialEnvironmentCond
     dst.SetConditionsFile(src.conditionsfile());
 }
 
+void SEInitialEnvironmentConditions::Copy(const SEInitialEnvironmentConditions& src, SEInitialEnvironmentConditions& dst)
+{
+  SEEnvironmentCondition::Copy(src, dst);
+  if (src.HasConditions())
+    SEEnvironmentalConditions::Copy(*src.m_Conditions, dst.GetConditions());
+  else
+    dst.SetConditionsFile(src.m_ConditionsFile);
+}
+
 cdm::InitialEnvironmentConditionsData* SEInitialEnvironmentConditions::Unload(const SEInitialEnvironmentConditions& src)
 {
   cdm::InitialEnvironmentConditionsData* dst = new cdm::InitialEnvironmentConditionsData();
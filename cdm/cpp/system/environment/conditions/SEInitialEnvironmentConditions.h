@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::InitialEnvironmentConditionsData& src, SEInitialEnvironmentConditions& dst);
   static cdm::InitialEnvironmentConditionsData* Unload(const SEInitialEnvironmentConditions& src);
+  static void Copy(const SEInitialEnvironmentConditions& src, SEInitialEnvironmentConditions& dst);
 protected:
   static void Serialize(const cdm::InitialEnvironmentConditionsData& src, SEInitialEnvironmentConditions& dst);
   static void Serialize(const SEInitialEnvironmentConditions& src, cdm::InitialEnvironmentConditionsData& dst);
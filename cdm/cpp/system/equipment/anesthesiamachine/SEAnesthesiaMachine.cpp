@@ -172,6 +172,40 @@ void SEAnesthesiaMachine::Serialize(const cdm::AnesthesiaMachineData& src, SEAne
   dst.StateChange();
 }
 
+void SEAnesthesiaMachine::Copy(const SEAnesthesiaMachine& src, SEAnesthesiaMachine& dst)
+{
+  dst.m_EventState = src.m_EventState;
+  dst.m_EventDuration_s = src.m_EventDuration_s;
+  dst.m_Connection = src.m_Connection;
+  CopyScalar(src.m_InletFlow, dst.m_InletFlow);
+  CopyScalar(src.m_InspiratoryExpiratoryRatio, dst.m_InspiratoryExpiratoryRatio);
+  CopyScalar(src.m_OxygenFraction, dst.m_OxygenFraction);
+  dst.m_OxygenSource = src.m_OxygenSource;
+  CopyScalar(src.m_PositiveEndExpiredPressure, dst.m_PositiveEndExpiredPressure);
+  dst.m_PrimaryGas = src.m_PrimaryGas;
+  CopyScalar(src.m_RespiratoryRate, dst.m_RespiratoryRate);
+  CopyScalar(src.m_ReliefValvePressure, dst.m_ReliefValvePressure);
+  CopyScalar(src.m_VentilatorPressure, dst.m_VentilatorPressure);
+  if (src.m_LeftChamber != nullptr)
+    SEAnesthesiaMachineChamber::Copy(*src.m_LeftChamber, dst.GetLeftChamber());
+  else
+    SAFE_DELETE(dst.m_LeftChamber);
+  if (src.m_RightChamber != nullptr)
+    SEAnesthesiaMachineChamber::Copy(*src.m_RightChamber, dst.GetRightChamber());
+  else
+    SAFE_DELETE(dst.m_RightChamber);
+  if (src.m_OxygenBottleOne != nullptr)
+    SEAnesthesiaMachineOxygenBottle::Copy(*src.m_OxygenBottleOne, dst.GetOxygenBottleOne());
+  else
+    SAFE_DELETE(dst.m_OxygenBottleOne);
+  if (src.m_OxygenBottleTwo != nullptr)
+    SEAnesthesiaMachineOxygenBottle::Copy(*src.m_OxygenBottleTwo, dst.GetOxygenBottleTwo());
+  else
+    SAFE_DELETE(dst.m_OxygenBottleTwo);
+
+  dst.StateChange();
+}
+
 cdm::AnesthesiaMachineData* SEAnesthesiaMachine::Unload(const SEAnesthesiaMachine& src)
 {
   cdm::AnesthesiaMachineData* dst = new cdm::AnesthesiaMachineData();
@@ -27,6 +27,7 @@ public:
 
   static void Load(const cdm::AnesthesiaMachineData& src, SEAnesthesiaMachine& dst);
   static cdm::AnesthesiaMachineData* Unload(const SEAnesthesiaMachine& src);
+  static void Copy(const SEAnesthesiaMachine& src, SEAnesthesiaMachine& dst);
 protected:
   static void Serialize(const cdm::AnesthesiaMachineData& src, SEAnesthesiaMachine& dst);
   static void Serialize(const SEAnesthesiaMachine& src, cdm::AnesthesiaMachineData& dst);
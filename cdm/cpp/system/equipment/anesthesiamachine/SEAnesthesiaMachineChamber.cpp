@@ -48,6 +48,19 @@ void SEAnesthesiaMachineChamber::Serialize(const cdm::AnesthesiaMachineData_Cham
   }
 }
 
+void SEAnesthesiaMachineChamber::Copy(const SEAnesthesiaMachineChamber& src, SEAnesthesiaMachineChamber& dst)
+{
+  dst.m_State = src.m_State == cdm::eSwitch::NullSwitch ? cdm::eSwitch::Off : src.m_State;
+  CopyScalar(src.m_SubstanceFraction, dst.m_SubstanceFraction);
+  dst.m_Substance = nullptr;
+  if (src.m_Substance != nullptr)
+  {
+    dst.m_Substance = dst.m_Substances.GetSubstance(src.m_Substance->GetName());
+    if (dst.m_Substance == nullptr)
+      dst.Error("Do not have substance : " + src.m_Substance->GetName(), "SEAnesthesiaMachineChamber::Copy");
+  }
+}
+
 cdm::AnesthesiaMachineData_ChamberData* SEAnesthesiaMachineChamber::Unload(const SEAnesthesiaMachineChamber& src)
 {
   cdm::AnesthesiaMachineData_ChamberData* dst = new cdm::AnesthesiaMachineData_ChamberData();
@@ -32,6 +32,11 @@ void SEAnesthesiaMachineOxygenBottle::Serialize(const cdm::AnesthesiaMachineData
     SEScalarVolume::Load(src.volume(), dst.GetVolume());
 }
 
+void SEAnesthesiaMachineOxygenBottle::Copy(const SEAnesthesiaMachineOxygenBottle& src, SEAnesthesiaMachineOxygenBottle& dst)
+{
+  CopyScalar(src.m_Volume, dst.m_Volume);
+}
+
 cdm::AnesthesiaMachineData_OxygenBottleData* SEAnesthesiaMachineOxygenBottle::Unload(const SEAnesthesiaMachineOxygenBottle& src)
 {
   cdm::AnesthesiaMachineData_OxygenBottleData* dst = new cdm::AnesthesiaMachineData_OxygenBottleData();
@@ -28,6 +28,11 @@ void SEAnesthesiaMachineAction::Serialize(const cdm::AnesthesiaMachineActionData
   SEAction::Serialize(src.action(), dst);
 }
 
+void SEAnesthesiaMachineAction::Copy(const SEAnesthesiaMachineAction& src, SEAnesthesiaMachineAction& dst)
+{
+  SEAction::Copy(src, dst);
+}
+
 void SEAnesthesiaMachineAction::Serialize(const SEAnesthesiaMachineAction& src, cdm::AnesthesiaMachineActionData& dst)
 {
   SEAction::Serialize(src, *dst.mutable_action());
@@ -25,7 +25,9 @@ public:
 protected:
   static void Serialize(const cdm::AnesthesiaMachineActionData& src, SEAnesthesiaMachineAction& dst);
   static void Serialize(const SEAnesthesiaMachineAction& src, cdm::AnesthesiaMachineActionData& dst);
+  static void Copy(const SEAnesthesiaMachineAction& src, SEAnesthesiaMachineAction& dst);
 
 public:
+  virtual eActionCategory GetActionCategory() const { return eActionCategory::AnesthesiaMachine; }
   virtual void ToString(std::ostream &str) const = 0;
 };  
\ No newline at end of file
@@ -50,6 +50,15 @@ void SEAnesthesiaMachineConfiguration::Serialize(const cdm::AnesthesiaMachineCon
     dst.SetConfigurationFile(src.configurationfile());
 }
 
+void SEAnesthesiaMachineConfiguration::Copy(const SEAnesthesiaMachineConfiguration& src, SEAnesthesiaMachineConfiguration& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  if (src.HasConfiguration())
+    SEAnesthesiaMachine::Copy(*src.m_Configuration, dst.GetConfiguration());
+  else
+    dst.SetConfigurationFile(src.m_ConfigurationFile);
+}
+
 cdm::AnesthesiaMachineConfigurationData* SEAnesthesiaMachineConfiguration::Unload(const SEAnesthesiaMachineConfiguration& src)
 {
   cdm::AnesthesiaMachineConfigurationData* dst = new cdm::AnesthesiaMachineConfigurationData();
@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::AnesthesiaMachineConfigurationData& src, SEAnesthesiaMachineConfiguration& dst);
   static cdm::AnesthesiaMachineConfigurationData* Unload(const SEAnesthesiaMachineConfiguration& src);
+  static void Copy(const SEAnesthesiaMachineConfiguration& src, SEAnesthesiaMachineConfiguration& dst);
 protected:
   static void Serialize(const cdm::AnesthesiaMachineConfigurationData& src, SEAnesthesiaMachineConfiguration& dst);
   static void Serialize(const SEAnesthesiaMachineConfiguration& src, cdm::AnesthesiaMachineConfigurationData& dst);
@@ -33,6 +34,7 @@ public:
   virtual bool HasConfigurationFile() const;
   virtual void InvalidateConfigurationFile();
 
+  virtual eActionType GetActionType() const { return eActionType::AnesthesiaMachineConfiguration; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
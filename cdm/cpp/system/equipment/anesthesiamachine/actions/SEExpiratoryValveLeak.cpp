@@ -41,6 +41,12 @@ void SEExpiratoryValveLeak::Serialize(const cdm::ExpiratoryValveLeakData& src, S
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEExpiratoryValveLeak::Copy(const SEExpiratoryValveLeak& src, SEExpiratoryValveLeak& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::ExpiratoryValveLeakData* SEExpiratoryValveLeak::Unload(const SEExpiratoryValveLeak& src)
 {
   cdm::ExpiratoryValveLeakData* dst = new cdm::ExpiratoryValveLeakData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::ExpiratoryValveLeakData& src, SEExpiratoryValveLeak& dst);
   static cdm::ExpiratoryValveLeakData* Unload(const SEExpiratoryValveLeak& src);
+  static void Copy(const SEExpiratoryValveLeak& src, SEExpiratoryValveLeak& dst);
 protected:
   static void Serialize(const cdm::ExpiratoryValveLeakData& src, SEExpiratoryValveLeak& dst);
   static void Serialize(const SEExpiratoryValveLeak& src, cdm::ExpiratoryValveLeakData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::ExpiratoryValveLeak; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
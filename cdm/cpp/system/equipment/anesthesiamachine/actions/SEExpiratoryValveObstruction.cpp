@@ -41,6 +41,12 @@ void SEExpiratoryValveObstruction::Serialize(const cdm::ExpiratoryValveObstructi
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEExpiratoryValveObstruction::Copy(const SEExpiratoryValveObstruction& src, SEExpiratoryValveObstruction& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::ExpiratoryValveObstructionData* SEExpiratoryValveObstruction::Unload(const SEExpiratoryValveObstruction& src)
 {
   cdm::ExpiratoryValveObstructionData* dst = new cdm::ExpiratoryValveObstructionData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::ExpiratoryValveObstructionData& src, SEExpiratoryValveObstruction& dst);
   static cdm::ExpiratoryValveObstructionData* Unload(const SEExpiratoryValveObstruction& src);
+  static void Copy(const SEExpiratoryValveObstruction& src, SEExpiratoryValveObstruction& dst);
 protected:
   static void Serialize(const cdm::ExpiratoryValveObstructionData& src, SEExpiratoryValveObstruction& dst);
   static void Serialize(const SEExpiratoryValveObstruction& src, cdm::ExpiratoryValveObstructionData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::ExpiratoryValveObstruction; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
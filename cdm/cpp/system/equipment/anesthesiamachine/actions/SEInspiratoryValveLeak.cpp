@@ -41,6 +41,12 @@ void SEInspiratoryValveLeak::Serialize(const cdm::InspiratoryValveLeakData& src,
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEInspiratoryValveLeak::Copy(const SEInspiratoryValveLeak& src, SEInspiratoryValveLeak& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::InspiratoryValveLeakData* SEInspiratoryValveLeak::Unload(const SEInspiratoryValveLeak& src)
 {
   cdm::InspiratoryValveLeakData* dst = new cdm::InspiratoryValveLeakData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::InspiratoryValveLeakData& src, SEInspiratoryValveLeak& dst);
   static cdm::InspiratoryValveLeakData* Unload(const SEInspiratoryValveLeak& src);
+  static void Copy(const SEInspiratoryValveLeak& src, SEInspiratoryValveLeak& dst);
 protected:
   static void Serialize(const cdm::InspiratoryValveLeakData& src, SEInspiratoryValveLeak& dst);
   static void Serialize(const SEInspiratoryValveLeak& src, cdm::InspiratoryValveLeakData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::InspiratoryValveLeak; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -41,6 +41,12 @@ void SEInspiratoryValveObstruction::Serialize(const cdm::InspiratoryValveObstruc
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEInspiratoryValveObstruction::Copy(const SEInspiratoryValveObstruction& src, SEInspiratoryValveObstruction& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::InspiratoryValveObstructionData* SEInspiratoryValveObstruction::Unload(const SEInspiratoryValveObstruction& src)
 {
   cdm::InspiratoryValveObstructionData* dst = new cdm::InspiratoryValveObstructionData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::InspiratoryValveObstructionData& src, SEInspiratoryValveObstruction& dst);
   static cdm::InspiratoryValveObstructionData* Unload(const SEInspiratoryValveObstruction& src);
+  static void Copy(const SEInspiratoryValveObstruction& src, SEInspiratoryValveObstruction& dst);
 protected:
   static void Serialize(const cdm::InspiratoryValveObstructionData& src, SEInspiratoryValveObstruction& dst);
   static void Serialize(const SEInspiratoryValveObstruction& src, cdm::InspiratoryValveObstructionData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::InspiratoryValveObstruction; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
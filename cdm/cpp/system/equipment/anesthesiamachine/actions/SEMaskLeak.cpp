@@ -41,6 +41,12 @@ void SEMaskLeak::Serialize(const cdm::MaskLeakData& src, SEMaskLeak& dst)
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEMaskLeak::Copy(const SEMaskLeak& src, SEMaskLeak& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::MaskLeakData* SEMaskLeak::Unload(const SEMaskLeak& src)
 {
   cdm::MaskLeakData* dst = new cdm::MaskLeakData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::MaskLeakData& src, SEMaskLeak& dst);
   static cdm::MaskLeakData* Unload(const SEMaskLeak& src);
+  static void Copy(const SEMaskLeak& src, SEMaskLeak& dst);
 protected:
   static void Serialize(const cdm::MaskLeakData& src, SEMaskLeak& dst);
   static void Serialize(const SEMaskLeak& src, cdm::MaskLeakData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::MaskLeak; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -43,6 +43,12 @@ void SEOxygenTankPressureLoss::Serialize(const cdm::OxygenTankPressureLossData&
   dst.SetActive(src.state() == cdm::eSwitch::On ? true : false);
 }
 
+void SEOxygenTankPressureLoss::Copy(const SEOxygenTankPressureLoss& src, SEOxygenTankPressureLoss& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  dst.m_State = src.m_State;
+}
+
 cdm::OxygenTankPressureLossData* SEOxygenTankPressureLoss::Unload(const SEOxygenTankPressureLoss& src)
 {
   cdm::OxygenTankPressureLossData* dst = new cdm::OxygenTankPressureLossData();
@@ -17,12 +17,14 @@ public:
 
   static void Load(const cdm::OxygenTankPressureLossData& src, SEOxygenTankPressureLoss& dst);
   static cdm::OxygenTankPressureLossData* Unload(const SEOxygenTankPressureLoss& src);
+  static void Copy(const SEOxygenTankPressureLoss& src, SEOxygenTankPressureLoss& dst);
 protected:
   static void Serialize(const cdm::OxygenTankPressureLossData& src, SEOxygenTankPressureLoss& dst);
   static void Serialize(const SEOxygenTankPressureLoss& src, cdm::OxygenTankPressureLossData& dst);
 
 public:
 
+  virtual eActionType GetActionType() const { return eActionType::OxygenTankPressureLoss; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
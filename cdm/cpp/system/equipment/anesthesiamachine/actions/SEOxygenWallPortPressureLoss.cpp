@@ -43,6 +43,12 @@ void SEOxygenWallPortPressureLoss::Serialize(const cdm::OxygenWallPortPressureLo
   dst.SetActive(src.state() == cdm::eSwitch::On ? true : false);
 }
 
+void SEOxygenWallPortPressureLoss::Copy(const SEOxygenWallPortPressureLoss& src, SEOxygenWallPortPressureLoss& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  dst.m_State = src.m_State;
+}
+
 cdm::OxygenWallPortPressureLossData* SEOxygenWallPortPressureLoss::Unload(const SEOxygenWallPortPressureLoss& src)
 {
   cdm::OxygenWallPortPressureLossData* dst = new cdm::OxygenWallPortPressureLossData();
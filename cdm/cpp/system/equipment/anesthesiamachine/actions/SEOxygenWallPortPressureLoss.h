@@ -17,12 +17,14 @@ public:
 
   static void Load(const cdm::OxygenWallPortPressureLossData& src, SEOxygenWallPortPressureLoss& dst);
   static cdm::OxygenWallPortPressureLossData* Unload(const SEOxygenWallPortPressureLoss& src);
+  static void Copy(const SEOxygenWallPortPressureLoss& src, SEOxygenWallPortPressureLoss& dst);
 protected:
   static void Serialize(const cdm::OxygenWallPortPressureLossData& src, SEOxygenWallPortPressureLoss& dst);
   static void Serialize(const SEOxygenWallPortPressureLoss& src, cdm::OxygenWallPortPressureLossData& dst);
 
 public:
 
+  virtual eActionType GetActionType() const { return eActionType::OxygenWallPortPressureLoss; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -41,6 +41,12 @@ void SESodaLimeFailure::Serialize(const cdm::SodaLimeFailureData& src, SESodaLim
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SESodaLimeFailure::Copy(const SESodaLimeFailure& src, SESodaLimeFailure& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::SodaLimeFailureData* SESodaLimeFailure::Unload(const SESodaLimeFailure& src)
 {
   cdm::SodaLimeFailureData* dst = new cdm::SodaLimeFailureData();
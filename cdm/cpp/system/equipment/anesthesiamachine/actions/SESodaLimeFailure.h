@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::SodaLimeFailureData& src, SESodaLimeFailure& dst);
   static cdm::SodaLimeFailureData* Unload(const SESodaLimeFailure& src);
+  static void Copy(const SESodaLimeFailure& src, SESodaLimeFailure& dst);
 protected:
   static void Serialize(const cdm::SodaLimeFailureData& src, SESodaLimeFailure& dst);
   static void Serialize(const SESodaLimeFailure& src, cdm::SodaLimeFailureData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::SodaLimeFailure; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
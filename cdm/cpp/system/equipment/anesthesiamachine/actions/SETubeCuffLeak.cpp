@@ -41,6 +41,12 @@ void SETubeCuffLeak::Serialize(const cdm::TubeCuffLeakData& src, SETubeCuffLeak&
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SETubeCuffLeak::Copy(const SETubeCuffLeak& src, SETubeCuffLeak& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::TubeCuffLeakData* SETubeCuffLeak::Unload(const SETubeCuffLeak& src)
 {
   cdm::TubeCuffLeakData* dst = new cdm::TubeCuffLeakData();
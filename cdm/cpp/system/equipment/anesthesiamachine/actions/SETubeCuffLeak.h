@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::TubeCuffLeakData& src, SETubeCuffLeak& dst);
   static cdm::TubeCuffLeakData* Unload(const SETubeCuffLeak& src);
+  static void Copy(const SETubeCuffLeak& src, SETubeCuffLeak& dst);
 protected:
   static void Serialize(const cdm::TubeCuffLeakData& src, SETubeCuffLeak& dst);
   static void Serialize(const SETubeCuffLeak& src, cdm::TubeCuffLeakData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::TubeCuffLeak; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
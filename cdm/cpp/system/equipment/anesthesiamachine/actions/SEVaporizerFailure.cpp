@@ -41,6 +41,12 @@ void SEVaporizerFailure::Serialize(const cdm::VaporizerFailureData& src, SEVapor
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEVaporizerFailure::Copy(const SEVaporizerFailure& src, SEVaporizerFailure& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::VaporizerFailureData* SEVaporizerFailure::Unload(const SEVaporizerFailure& src)
 {
   cdm::VaporizerFailureData* dst = new cdm::VaporizerFailureData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::VaporizerFailureData& src, SEVaporizerFailure& dst);
   static cdm::VaporizerFailureData* Unload(const SEVaporizerFailure& src);
+  static void Copy(const SEVaporizerFailure& src, SEVaporizerFailure& dst);
 protected:
   static void Serialize(const cdm::VaporizerFailureData& src, SEVaporizerFailure& dst);
   static void Serialize(const SEVaporizerFailure& src, cdm::VaporizerFailureData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::VaporizerFailure; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -41,6 +41,12 @@ void SEVentilatorPressureLoss::Serialize(const cdm::VentilatorPressureLossData&
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEVentilatorPressureLoss::Copy(const SEVentilatorPressureLoss& src, SEVentilatorPressureLoss& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::VentilatorPressureLossData* SEVentilatorPressureLoss::Unload(const SEVentilatorPressureLoss& src)
 {
   cdm::VentilatorPressureLossData* dst = new cdm::VentilatorPressureLossData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::VentilatorPressureLossData& src, SEVentilatorPressureLoss& dst);
   static cdm::VentilatorPressureLossData* Unload(const SEVentilatorPressureLoss& src);
+  static void Copy(const SEVentilatorPressureLoss& src, SEVentilatorPressureLoss& dst);
 protected:
   static void Serialize(const cdm::VentilatorPressureLossData& src, SEVentilatorPressureLoss& dst);
   static void Serialize(const SEVentilatorPressureLoss& src, cdm::VentilatorPressureLossData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::VentilatorPressureLoss; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
@@ -41,6 +41,12 @@ void SEYPieceDisconnect::Serialize(const cdm::YPieceDisconnectData& src, SEYPiec
     SEScalar0To1::Load(src.severity(), dst.GetSeverity());
 }
 
+void SEYPieceDisconnect::Copy(const SEYPieceDisconnect& src, SEYPieceDisconnect& dst)
+{
+  SEAnesthesiaMachineAction::Copy(src, dst);
+  CopyScalar(src.m_Severity, dst.m_Severity);
+}
+
 cdm::YPieceDisconnectData* SEYPieceDisconnect::Unload(const SEYPieceDisconnect& src)
 {
   cdm::YPieceDisconnectData* dst = new cdm::YPieceDisconnectData();
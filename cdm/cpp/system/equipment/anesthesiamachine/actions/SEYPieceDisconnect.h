@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::YPieceDisconnectData& src, SEYPieceDisconnect& dst);
   static cdm::YPieceDisconnectData* Unload(const SEYPieceDisconnect& src);
+  static void Copy(const SEYPieceDisconnect& src, SEYPieceDisconnect& dst);
 protected:
   static void Serialize(const cdm::YPieceDisconnectData& src, SEYPieceDisconnect& dst);
   static void Serialize(const SEYPieceDisconnect& src, cdm::YPieceDisconnectData& dst);
@@ -26,6 +27,7 @@ public:
   virtual bool HasSeverity() const;
   virtual SEScalar0To1& GetSeverity();
 
+  virtual eActionType GetActionType() const { return eActionType::YPieceDisconnect; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
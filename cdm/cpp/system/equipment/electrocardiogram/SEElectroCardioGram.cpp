@@ -75,6 +75,22 @@ void SEElectroCardioGram::Serialize(const cdm::ElectroCardioGramData& src, SEEle
     SEScalarElectricPotential::Load(src.lead12electricpotential(), dst.GetLead12ElectricPotential());
 }
 
+void SEElectroCardioGram::Copy(const SEElectroCardioGram& src, SEElectroCardioGram& dst)
+{
+  CopyScalar(src.m_Lead1ElectricPotential, dst.m_Lead1ElectricPotential);
+  CopyScalar(src.m_Lead2ElectricPotential, dst.m_Lead2ElectricPotential);
+  CopyScalar(src.m_Lead3ElectricPotential, dst.m_Lead3ElectricPotential);
+  CopyScalar(src.m_Lead4ElectricPotential, dst.m_Lead4ElectricPotential);
+  CopyScalar(src.m_Lead5ElectricPotential, dst.m_Lead5ElectricPotential);
+  CopyScalar(src.m_Lead6ElectricPotential, dst.m_Lead6ElectricPotential);
+  CopyScalar(src.m_Lead7ElectricPotential, dst.m_Lead7ElectricPotential);
+  CopyScalar(src.m_Lead8ElectricPotential, dst.m_Lead8ElectricPotential);
+  CopyScalar(src.m_Lead9ElectricPotential, dst.m_Lead9ElectricPotential);
+  CopyScalar(src.m_Lead10ElectricPotential, dst.m_Lead10ElectricPotential);
+  CopyScalar(src.m_Lead11ElectricPotential, dst.m_Lead11ElectricPotential);
+  CopyScalar(src.m_Lead12ElectricPotential, dst.m_Lead12ElectricPotential);
+}
+
 cdm::ElectroCardioGramData* SEElectroCardioGram::Unload(const SEElectroCardioGram& src)
 {
   cdm::ElectroCardioGramData* dst = new cdm::ElectroCardioGramData();
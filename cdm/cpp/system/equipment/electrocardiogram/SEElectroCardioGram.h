@@ -22,6 +22,7 @@ public:
 
   static void Load(const cdm::ElectroCardioGramData& src, SEElectroCardioGram& dst);
   static cdm::ElectroCardioGramData* Unload(const SEElectroCardioGram& src);
+  static void Copy(const SEElectroCardioGram& src, SEElectroCardioGram& dst);
 protected:
   static void Serialize(const cdm::ElectroCardioGramData& src, SEElectroCardioGram& dst);
   static void Serialize(const SEElectroCardioGram& src, cdm::ElectroCardioGramData& dst);
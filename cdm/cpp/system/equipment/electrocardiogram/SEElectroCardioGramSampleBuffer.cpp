@@ -0,0 +1,33 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "system/equipment/electrocardiogram/SEElectroCardioGramSampleBuffer.h"
+
+SEElectroCardioGramSampleBuffer::SEElectroCardioGramSampleBuffer(double* samples_mV, size_t capacity)
+{
+  m_Samples = samples_mV;
+  m_Capacity = samples_mV == nullptr ? 0 : capacity;
+  Clear();
+}
+
+SEElectroCardioGramSampleBuffer::~SEElectroCardioGramSampleBuffer()
+{
+  
+}
+
+void SEElectroCardioGramSampleBuffer::Clear()
+{
+  m_WriteIndex = 0;
+  m_SampleCount = 0;
+}
+
+void SEElectroCardioGramSampleBuffer::Write(double sample_mV)
+{
+  if (m_Capacity == 0)
+    return;
+  m_Samples[m_WriteIndex] = sample_mV;
+  if (++m_WriteIndex == m_Capacity)
+    m_WriteIndex = 0;
+  m_SampleCount++;
+}
@@ -0,0 +1,37 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+/**
+* @brief
+* Ring buffer of electric potential samples (mV) for a single lead.
+* The sample memory is provided and owned by the caller, samples are written in order
+* and wrap around to the start of the memory once it is full.
+*/
+class CDM_DECL SEElectroCardioGramSampleBuffer
+{
+public:
+
+  SEElectroCardioGramSampleBuffer(double* samples_mV, size_t capacity);
+  virtual ~SEElectroCardioGramSampleBuffer();
+
+  virtual void Clear();// Resets the write position, does not touch the sample memory
+
+  virtual void Write(double sample_mV);
+
+  virtual const double* GetSamples() const { return m_Samples; }
+  virtual size_t GetCapacity() const { return m_Capacity; }
+  // Index the next sample will be written to
+  virtual size_t GetWriteIndex() const { return m_WriteIndex; }
+  // Number of samples written since the last Clear, readers can compare this
+  // to what they have read to know how many new samples there are (or if they fell behind)
+  virtual size_t GetSampleCount() const { return m_SampleCount; }
+
+protected:
+
+  double* m_Samples;
+  size_t  m_Capacity;
+  size_t  m_WriteIndex;
+  size_t  m_SampleCount;
+};
@@ -46,6 +46,18 @@ void SEElectroCardioGramWaveform::Serialize(const cdm::ElectroCardioGramWaveform
     dst.m_ActiveIndicies.push_back(src.activeindicies()[i]);
 }
 
+void SEElectroCardioGramWaveform::Copy(const SEElectroCardioGramWaveform& src, SEElectroCardioGramWaveform& dst)
+{
+  dst.m_Rhythm = src.m_Rhythm;
+  dst.m_LeadNumber = src.m_LeadNumber;
+  CopyScalar(src.m_TimeStep, dst.m_TimeStep);
+  if (src.HasData())
+    SEFunctionElectricPotentialVsTime::Copy(*src.m_Data, dst.GetData());
+  else
+    SAFE_DELETE(dst.m_Data);
+  dst.m_ActiveIndicies = src.m_ActiveIndicies;
+}
+
 cdm::ElectroCardioGramWaveformData* SEElectroCardioGramWaveform::Unload(const SEElectroCardioGramWaveform& src)
 {
   cdm::ElectroCardioGramWaveformData* dst = new cdm::ElectroCardioGramWaveformData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::ElectroCardioGramWaveformData& src, SEElectroCardioGramWaveform& dst);
   static cdm::ElectroCardioGramWaveformData* Unload(const SEElectroCardioGramWaveform& src);
+  static void Copy(const SEElectroCardioGramWaveform& src, SEElectroCardioGramWaveform& dst);
 protected:
   static void Serialize(const cdm::ElectroCardioGramWaveformData& src, SEElectroCardioGramWaveform& dst);
   static void Serialize(const SEElectroCardioGramWaveform& src, cdm::ElectroCardioGramWaveformData& dst);
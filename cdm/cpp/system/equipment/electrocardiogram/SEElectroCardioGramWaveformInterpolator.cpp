@@ -3,14 +3,18 @@
 
 #include "stdafx.h"
 #include "system/equipment/electrocardiogram/SEElectroCardioGramWaveformInterpolator.h"
+#include "system/equipment/electrocardiogram/SEElectroCardioGramSampleBuffer.h"
 #include "properties/SEScalarTime.h"
+#include "properties/SEScalarFrequency.h"
 #include "properties/SEScalarElectricPotential.h"
 #include "properties/SEFunctionElectricPotentialVsTime.h"
+#include "utils/GeneralMath.h"
 #include <google/protobuf/text_format.h>
 
 SEElectroCardioGramWaveformInterpolator::SEElectroCardioGramWaveformInterpolator(Logger* logger) : Loggable(logger)
 {
-
+  m_SamplePeriod_s = 0;
+  m_UnsampledTime_s = 0;
 }
 
 SEElectroCardioGramWaveformInterpolator::~SEElectroCardioGramWaveformInterpolator()
@@ -25,6 +29,10 @@ void SEElectroCardioGramWaveformInterpolator::Clear()
       delete j.second;
   m_Waveforms.clear();
   m_Leads.clear();
+  // The sample tables come from the source waveforms and the sample buffers belong to the caller,
+  // only the beats being synthesized go with the waveforms
+  m_ActiveSamples.clear();
+  m_UnsampledTime_s = 0;
 }
 
 void SEElectroCardioGramWaveformInterpolator::Load(const cdm::ElectroCardioGramWaveformListData& src, SEElectroCardioGramWaveformInterpolator& dst)
@@ -42,6 +50,30 @@ void SEElectroCardioGramWaveformInterpolator::Serialize(const cdm::ElectroCardio
   }
 }
 
+void SEElectroCardioGramWaveformInterpolator::Copy(const SEElectroCardioGramWaveformInterpolator& src, SEElectroCardioGramWaveformInterpolator& dst)
+{
+  // Waveforms are copied in place, only the ones the source does not have are deleted
+  for (auto& i : dst.m_Waveforms)
+  {
+    for (auto& j : i.second)
+    {
+      if (src.GetWaveform(i.first, j.first) == nullptr)
+        SAFE_DELETE(j.second);
+    }
+  }
+  for (auto i : src.m_Waveforms)
+  {
+    for (auto j : i.second)
+    {
+      if (j.second != nullptr)
+        SEElectroCardioGramWaveform::Copy(*j.second, dst.GetWaveform(i.first, j.first));
+    }
+  }
+  dst.m_Leads.clear();
+  dst.m_ActiveSamples.clear();
+  dst.m_UnsampledTime_s = 0;
+}
+
 cdm::ElectroCardioGramWaveformListData* SEElectroCardioGramWaveformInterpolator::Unload(const SEElectroCardioGramWaveformInterpolator& src)
 {
   cdm::ElectroCardioGramWaveformListData* dst = new cdm::ElectroCardioGramWaveformListData();
@@ -111,9 +143,11 @@ void SEElectroCardioGramWaveformInterpolator::Interpolate(SEElectroCardioGramWav
       currentTime_s += timeStep_s;
     }
     SEFunctionElectricPotentialVsTime* iWaveForm = data.InterpolateToTime(iTime, TimeUnit::s); // creates the new waveform data
-    cdm::FunctionElectricPotentialVsTimeData* wfData = SEFunctionElectricPotentialVsTime::Unload(*iWaveForm);
-    SEFunctionElectricPotentialVsTime::Load(*wfData, data);
-    delete wfData;
+    // Take the interpolated data as our own
+    wTime.swap(iWaveForm->GetTime());
+    wEleP.swap(iWaveForm->GetElectricPotential());
+    data.SetTimeUnit(*iWaveForm->GetTimeUnit());
+    data.SetElectricPotentialUnit(*iWaveForm->GetElectricPotentialUnit());
     delete iWaveForm;
   }
 }
@@ -145,6 +179,15 @@ bool SEElectroCardioGramWaveformInterpolator::StartNewCycle(cdm::eHeartRhythm rh
     }
     l2rw.second[rhythm]->GetActiveIndicies().push_back(0);
   }
+  if (HasSampleRate())
+  {
+    for (auto& l2b : m_SampleBuffers)
+    {
+      auto& r2t = m_SampleTables[l2b.first];
+      if (r2t.find(rhythm) != r2t.end())
+        m_ActiveSamples[l2b.first][rhythm].push_back(0);
+    }
+  }
   return true;
 }
 
@@ -190,6 +233,119 @@ void SEElectroCardioGramWaveformInterpolator::CalculateWaveformsElectricPotentia
 
 }
 
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Precomputes the high rate sample tables
+///
+/// \details
+/// Each waveform of the source is linearly interpolated once, at the sample period, into a table of
+/// potentials in mV. Synthesizing samples is then a sum of table lookups for every active beat.
+//--------------------------------------------------------------------------------------------------
+bool SEElectroCardioGramWaveformInterpolator::SetSampleRate(const SEScalarFrequency& rate, const SEElectroCardioGramWaveformInterpolator& source)
+{
+  InvalidateSampleRate();
+  double rate_Per_s = rate.GetValue(FrequencyUnit::Per_s);
+  if (rate_Per_s <= 0)
+  {
+    Error("ECG sample rate must be greater than zero");
+    return false;
+  }
+  double samplePeriod_s = 1 / rate_Per_s;
+
+  for (auto& l2rw : source.m_Waveforms)
+  {
+    for (auto& r2w : l2rw.second)
+    {
+      const SEElectroCardioGramWaveform* w = r2w.second;
+      if (w == nullptr || !w->HasData())
+        continue;
+      const SEFunctionElectricPotentialVsTime& data = *w->GetData();
+      const std::vector<double>& wTime = data.GetTime();
+      const std::vector<double>& wEleP = data.GetElectricPotential();
+      if (wTime.size() < 2 || data.GetTimeUnit() == nullptr || data.GetElectricPotentialUnit() == nullptr)
+        continue;
+      double toS = Convert(1, *data.GetTimeUnit(), TimeUnit::s);
+      double toMV = Convert(1, *data.GetElectricPotentialUnit(), ElectricPotentialUnit::mV);
+
+      // NOTE: This assumes that the data is a SINGLE waveform
+      std::vector<double>& table = m_SampleTables[l2rw.first][r2w.first];
+      double endTime_s = wTime.back() * toS;
+      size_t x1 = 0;
+      for (size_t n = 0; n * samplePeriod_s <= endTime_s; n++)
+      {
+        double t_s = n * samplePeriod_s;
+        while (x1 < wTime.size() - 2 && wTime[x1 + 1] * toS <= t_s)
+          x1++;
+        table.push_back(GeneralMath::LinearInterpolator(wTime[x1] * toS, wTime[x1 + 1] * toS, wEleP[x1] * toMV, wEleP[x1 + 1] * toMV, t_s));
+      }
+    }
+  }
+  if (m_SampleTables.empty())
+  {
+    Error("No ECG waveforms to sample");
+    return false;
+  }
+  m_SamplePeriod_s = samplePeriod_s;
+  return true;
+}
+void SEElectroCardioGramWaveformInterpolator::InvalidateSampleRate()
+{
+  m_SamplePeriod_s = 0;
+  m_UnsampledTime_s = 0;
+  m_SampleTables.clear();
+  m_ActiveSamples.clear();
+}
+void SEElectroCardioGramWaveformInterpolator::SetLeadSampleBuffer(cdm::ElectroCardioGramWaveformData_eLead lead, SEElectroCardioGramSampleBuffer* buffer)
+{
+  m_ActiveSamples.erase(lead);
+  if (buffer == nullptr)
+    m_SampleBuffers.erase(lead);
+  else
+    m_SampleBuffers[lead] = buffer;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Writes the high rate ECG output
+///
+/// \details
+/// Every sample period that has elapsed over the time step is written to each lead sample buffer, any
+/// remaining time is carried over to the next time step. Like CalculateWaveformsElectricPotential,
+/// each sample is the sum of all active beats, which start at the first sample of the time step their
+/// cycle started in.
+//--------------------------------------------------------------------------------------------------
+void SEElectroCardioGramWaveformInterpolator::SynthesizeSamples(double timeStep_s)
+{
+  if (!HasSampleRate())
+    return;
+  m_UnsampledTime_s += timeStep_s;
+  size_t numSamples = (size_t)(m_UnsampledTime_s / m_SamplePeriod_s + 1e-9);
+  m_UnsampledTime_s = std::max(0.0, m_UnsampledTime_s - numSamples * m_SamplePeriod_s);
+
+  for (auto& l2b : m_SampleBuffers)
+  {
+    SEElectroCardioGramSampleBuffer* buffer = l2b.second;
+    auto& r2t = m_SampleTables[l2b.first];
+    auto& r2a = m_ActiveSamples[l2b.first];
+    for (size_t n = 0; n < numSamples; n++)
+    {
+      double sample_mV = 0;
+      for (auto& r : r2a)
+      {
+        const std::vector<double>& table = r2t[r.first];
+        std::vector<size_t>& active = r.second;
+        for (size_t i = 0; i < active.size(); i++)
+        {
+          sample_mV += table[active[i]];
+          if (++active[i] == table.size())
+            active.erase(active.begin() + i--);// Remove the beat once we are at the end of its table
+        }
+      }
+      buffer->Write(sample_mV);
+    }
+  }
+}
+
 bool SEElectroCardioGramWaveformInterpolator::HasWaveform(cdm::ElectroCardioGramWaveformData_eLead lead, cdm::eHeartRhythm rhythm) const
 {
   auto l = m_Waveforms.find(lead);
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "system/equipment/electrocardiogram/SEElectroCardioGramWaveform.h"
+class SEElectroCardioGramSampleBuffer;
 
 
 class CDM_DECL SEElectroCardioGramWaveformInterpolator : public Loggable
@@ -18,6 +19,7 @@ public:
 
   static void Load(const cdm::ElectroCardioGramWaveformListData& src, SEElectroCardioGramWaveformInterpolator& dst);
   static cdm::ElectroCardioGramWaveformListData* Unload(const SEElectroCardioGramWaveformInterpolator& src);
+  static void Copy(const SEElectroCardioGramWaveformInterpolator& src, SEElectroCardioGramWaveformInterpolator& dst);
 protected:
   static void Serialize(const cdm::ElectroCardioGramWaveformListData& src, SEElectroCardioGramWaveformInterpolator& dst);
   static void Serialize(const SEElectroCardioGramWaveformInterpolator& src, cdm::ElectroCardioGramWaveformListData& dst);
@@ -38,10 +40,30 @@ public:
   virtual const SEElectroCardioGramWaveform* GetWaveform(cdm::ElectroCardioGramWaveformData_eLead lead, cdm::eHeartRhythm rhythm) const;
   virtual void RemoveWaveform(cdm::ElectroCardioGramWaveformData_eLead lead, cdm::eHeartRhythm rhythm);
 
+  // High rate output, lead waveforms can also be synthesized at a sample rate independent of the time step
+  // A sample table for every lead and rhythm is resampled once from the provided source waveforms,
+  // which should be at their original resolution (i.e. not yet interpolated to the time step)
+  virtual bool SetSampleRate(const SEScalarFrequency& rate, const SEElectroCardioGramWaveformInterpolator& source);
+  virtual bool HasSampleRate() const { return m_SamplePeriod_s > 0; }
+  virtual void InvalidateSampleRate();
+  // Samples of the lead are written to the caller provided buffer, pass nullptr to stop writing samples for the lead
+  virtual void SetLeadSampleBuffer(cdm::ElectroCardioGramWaveformData_eLead lead, SEElectroCardioGramSampleBuffer* buffer);
+  // Writes every sample that falls within the time step into each lead sample buffer
+  virtual void SynthesizeSamples(double timeStep_s);
+
 protected:
 
   virtual void Interpolate(SEElectroCardioGramWaveform& waveform, const SEScalarTime& timeStep);
   
   std::map<cdm::ElectroCardioGramWaveformData_eLead, SEScalarElectricPotential*> m_Leads;
   std::map<cdm::ElectroCardioGramWaveformData_eLead, std::map<cdm::eHeartRhythm, SEElectroCardioGramWaveform*>> m_Waveforms;
+
+  // High rate output is not part of the state, it is set up by whoever wants the samples
+  double                                                                                   m_SamplePeriod_s;
+  double                                                                                   m_UnsampledTime_s;
+  std::map<cdm::ElectroCardioGramWaveformData_eLead, SEElectroCardioGramSampleBuffer*>    m_SampleBuffers;
+  // Waveform potential (mV) at each sample period, per lead and rhythm
+  std::map<cdm::ElectroCardioGramWaveformData_eLead, std::map<cdm::eHeartRhythm, std::vector<double>>> m_SampleTables;
+  // Sample table index of each beat still being written, per lead and rhythm
+  std::map<cdm::ElectroCardioGramWaveformData_eLead, std::map<cdm::eHeartRhythm, std::vector<size_t>>> m_ActiveSamples;
 };
\ No newline at end of file
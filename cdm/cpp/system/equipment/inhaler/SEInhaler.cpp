@@ -58,6 +58,21 @@ void SEInhaler::Serialize(const cdm::InhalerData& src, SEInhaler& dst)
     dst.SetSubstance(dst.m_Substances.GetSubstance(src.substance()));
 }
 
+void SEInhaler::Copy(const SEInhaler& src, SEInhaler& dst)
+{
+  if (src.m_State != cdm::eSwitch::NullSwitch)
+    dst.SetState(src.m_State);
+  if (src.HasMeteredDose())
+    dst.GetMeteredDose().Set(*src.m_MeteredDose);
+  if (src.HasNozzleLoss())
+    dst.GetNozzleLoss().Set(*src.m_NozzleLoss);
+  if (src.HasSpacerVolume())
+    dst.GetSpacerVolume().Set(*src.m_SpacerVolume);
+  if (src.HasSubstance())
+    dst.SetSubstance(dst.m_Substances.GetSubstance(src.m_Substance->GetName()));
+  dst.StateChange();
+}
+
 cdm::InhalerData* SEInhaler::Unload(const SEInhaler& src)
 {
   cdm::InhalerData* dst = new cdm::InhalerData();
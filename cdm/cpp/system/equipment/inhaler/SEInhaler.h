@@ -34,6 +34,7 @@ public:
 
   static void Load(const cdm::InhalerData& src, SEInhaler& dst);
   static cdm::InhalerData* Unload(const SEInhaler& src);
+  static void Copy(const SEInhaler& src, SEInhaler& dst);
 protected:
   static void Serialize(const cdm::InhalerData& src, SEInhaler& dst);
   static void Serialize(const SEInhaler& src, cdm::InhalerData& dst);
@@ -28,6 +28,11 @@ void SEInhalerAction::Serialize(const cdm::InhalerActionData& src, SEInhalerActi
   SEAction::Serialize(src.action(), dst);
 }
 
+void SEInhalerAction::Copy(const SEInhalerAction& src, SEInhalerAction& dst)
+{
+  SEAction::Copy(src, dst);
+}
+
 void SEInhalerAction::Serialize(const SEInhalerAction& src, cdm::InhalerActionData& dst)
 {
   SEAction::Serialize(src, *dst.mutable_action());
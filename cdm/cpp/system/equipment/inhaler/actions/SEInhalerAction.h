@@ -23,7 +23,9 @@ public:
 protected:
   static void Serialize(const cdm::InhalerActionData& src, SEInhalerAction& dst);
   static void Serialize(const SEInhalerAction& src, cdm::InhalerActionData& dst);
+  static void Copy(const SEInhalerAction& src, SEInhalerAction& dst);
 
 public:
+  virtual eActionCategory GetActionCategory() const { return eActionCategory::Inhaler; }
   virtual void ToString(std::ostream &str) const = 0;
 };  
\ No newline at end of file
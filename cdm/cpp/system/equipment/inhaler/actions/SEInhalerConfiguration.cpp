@@ -48,6 +48,15 @@ void SEInhalerConfiguration::Serialize(const cdm::InhalerConfigurationData& src,
     dst.SetConfigurationFile(src.configurationfile());
 }
 
+void SEInhalerConfiguration::Copy(const SEInhalerConfiguration& src, SEInhalerConfiguration& dst)
+{
+  SEInhalerAction::Copy(src, dst);
+  if (src.HasConfiguration())
+    SEInhaler::Copy(*src.m_Configuration, dst.GetConfiguration());
+  else
+    dst.SetConfigurationFile(src.m_ConfigurationFile);
+}
+
 cdm::InhalerConfigurationData* SEInhalerConfiguration::Unload(const SEInhalerConfiguration& src)
 {
   cdm::InhalerConfigurationData* dst = new cdm::InhalerConfigurationData();
@@ -19,6 +19,7 @@ public:
 
   static void Load(const cdm::InhalerConfigurationData& src, SEInhalerConfiguration& dst);
   static cdm::InhalerConfigurationData* Unload(const SEInhalerConfiguration& src);
+  static void Copy(const SEInhalerConfiguration& src, SEInhalerConfiguration& dst);
 protected:
   static void Serialize(const cdm::InhalerConfigurationData& src, SEInhalerConfiguration& dst);
   static void Serialize(const SEInhalerConfiguration& src, cdm::InhalerConfigurationData& dst);
@@ -34,6 +35,7 @@ public:
   virtual bool HasConfigurationFile() const;
   virtual void InvalidateConfigurationFile();
 
+  virtual eActionType GetActionType() const { return eActionType::InhalerConfiguration; }
   virtual void ToString(std::ostream &str) const;
 
 protected:
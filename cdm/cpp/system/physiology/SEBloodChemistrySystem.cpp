@@ -208,6 +208,37 @@ void SEBloodChemistrySystem::Serialize(const cdm::BloodChemistrySystemData& src,
     SEScalarPressure::Load(src.venousoxygenpressure(), dst.GetVenousOxygenPressure());
 }
 
+void SEBloodChemistrySystem::Copy(const SEBloodChemistrySystem& src, SEBloodChemistrySystem& dst)
+{
+  CopyScalar(src.m_BloodDensity, dst.m_BloodDensity);
+  CopyScalar(src.m_BloodPH, dst.m_BloodPH);
+  CopyScalar(src.m_BloodSpecificHeat, dst.m_BloodSpecificHeat);
+  CopyScalar(src.m_BloodUreaNitrogenConcentration, dst.m_BloodUreaNitrogenConcentration);
+  CopyScalar(src.m_CarbonDioxideSaturation, dst.m_CarbonDioxideSaturation);
+  CopyScalar(src.m_CarbonMonoxideSaturation, dst.m_CarbonMonoxideSaturation);
+  CopyScalar(src.m_Hematocrit, dst.m_Hematocrit);
+  CopyScalar(src.m_HemoglobinContent, dst.m_HemoglobinContent);
+  CopyScalar(src.m_OxygenSaturation, dst.m_OxygenSaturation);
+  CopyScalar(src.m_Phosphate, dst.m_Phosphate);
+  CopyScalar(src.m_PlasmaVolume, dst.m_PlasmaVolume);
+  CopyScalar(src.m_PulseOximetry, dst.m_PulseOximetry);
+  CopyScalar(src.m_RedBloodCellCount, dst.m_RedBloodCellCount);
+  CopyScalar(src.m_ShuntFraction, dst.m_ShuntFraction);
+  CopyScalar(src.m_StrongIonDifference, dst.m_StrongIonDifference);
+  CopyScalar(src.m_TotalProteinConcentration, dst.m_TotalProteinConcentration);
+  CopyScalar(src.m_VolumeFractionNeutralPhospholipidInPlasma, dst.m_VolumeFractionNeutralPhospholipidInPlasma);
+  CopyScalar(src.m_VolumeFractionNeutralLipidInPlasma, dst.m_VolumeFractionNeutralLipidInPlasma);
+  CopyScalar(src.m_WhiteBloodCellCount, dst.m_WhiteBloodCellCount);
+  CopyScalar(src.m_ArterialCarbonDioxidePressure, dst.m_ArterialCarbonDioxidePressure);
+  CopyScalar(src.m_ArterialOxygenPressure, dst.m_ArterialOxygenPressure);
+  CopyScalar(src.m_PulmonaryArterialCarbonDioxidePressure, dst.m_PulmonaryArterialCarbonDioxidePressure);
+  CopyScalar(src.m_PulmonaryArterialOxygenPressure, dst.m_PulmonaryArterialOxygenPressure);
+  CopyScalar(src.m_PulmonaryVenousOxygenPressure, dst.m_PulmonaryVenousOxygenPressure);
+  CopyScalar(src.m_PulmonaryVenousCarbonDioxidePressure, dst.m_PulmonaryVenousCarbonDioxidePressure);
+  CopyScalar(src.m_VenousCarbonDioxidePressure, dst.m_VenousCarbonDioxidePressure);
+  CopyScalar(src.m_VenousOxygenPressure, dst.m_VenousOxygenPressure);
+}
+
 cdm::BloodChemistrySystemData* SEBloodChemistrySystem::Unload(const SEBloodChemistrySystem& src)
 {
   cdm::BloodChemistrySystemData* dst = new cdm::BloodChemistrySystemData();
@@ -20,6 +20,7 @@ public:
                                                                                                       /**  @name Serialization *///@{
   static void Load(const cdm::BloodChemistrySystemData& src, SEBloodChemistrySystem& dst);            /**< @copydoc DOXY_CDM_LOAD    */
   static cdm::BloodChemistrySystemData* Unload(const SEBloodChemistrySystem& src);                    /**< @copydoc DOXY_CDM_UNLLOAD */
+  static void Copy(const SEBloodChemistrySystem& src, SEBloodChemistrySystem& dst);                   /**< @copydoc DOXY_CDM_COPY_FROM */
 protected:
   static void Serialize(const cdm::BloodChemistrySystemData& src, SEBloodChemistrySystem& dst);       /**< @copydoc DOXY_CDM_SERIALIZE_IN  */
   static void Serialize(const SEBloodChemistrySystem& src, cdm::BloodChemistrySystemData& dst);       /**< @copydoc DOXY_CDM_SERIALIZE_OUT *///@}
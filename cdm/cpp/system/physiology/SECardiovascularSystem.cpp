@@ -221,6 +221,40 @@ void SECardiovascularSystem::Serialize(const cdm::CardiovascularSystemData& src,
     SEScalarPressure::Load(src.systolicarterialpressure(), dst.GetSystolicArterialPressure());
 }
 
+void SECardiovascularSystem::Copy(const SECardiovascularSystem& src, SECardiovascularSystem& dst)
+{
+  CopyScalar(src.m_ArterialPressure, dst.m_ArterialPressure);
+  CopyScalar(src.m_BloodVolume, dst.m_BloodVolume);
+  CopyScalar(src.m_CardiacIndex, dst.m_CardiacIndex);
+  CopyScalar(src.m_CardiacOutput, dst.m_CardiacOutput);
+  CopyScalar(src.m_CentralVenousPressure, dst.m_CentralVenousPressure);
+  CopyScalar(src.m_CerebralBloodFlow, dst.m_CerebralBloodFlow);
+  CopyScalar(src.m_CerebralPerfusionPressure, dst.m_CerebralPerfusionPressure);
+  CopyScalar(src.m_DiastolicArterialPressure, dst.m_DiastolicArterialPressure);
+  CopyScalar(src.m_HeartEjectionFraction, dst.m_HeartEjectionFraction);
+  CopyScalar(src.m_HeartRate, dst.m_HeartRate);
+  dst.m_HeartRhythm = src.m_HeartRhythm;
+  CopyScalar(src.m_HeartStrokeVolume, dst.m_HeartStrokeVolume);
+  CopyScalar(src.m_IntracranialPressure, dst.m_IntracranialPressure);
+  CopyScalar(src.m_MeanArterialPressure, dst.m_MeanArterialPressure);
+  CopyScalar(src.m_MeanArterialCarbonDioxidePartialPressure, dst.m_MeanArterialCarbonDioxidePartialPressure);
+  CopyScalar(src.m_MeanArterialCarbonDioxidePartialPressureDelta, dst.m_MeanArterialCarbonDioxidePartialPressureDelta);
+  CopyScalar(src.m_MeanCentralVenousPressure, dst.m_MeanCentralVenousPressure);
+  CopyScalar(src.m_MeanSkinFlow, dst.m_MeanSkinFlow);
+  CopyScalar(src.m_PulmonaryArterialPressure, dst.m_PulmonaryArterialPressure);
+  CopyScalar(src.m_PulmonaryCapillariesWedgePressure, dst.m_PulmonaryCapillariesWedgePressure);
+  CopyScalar(src.m_PulmonaryDiastolicArterialPressure, dst.m_PulmonaryDiastolicArterialPressure);
+  CopyScalar(src.m_PulmonaryMeanArterialPressure, dst.m_PulmonaryMeanArterialPressure);
+  CopyScalar(src.m_PulmonaryMeanCapillaryFlow, dst.m_PulmonaryMeanCapillaryFlow);
+  CopyScalar(src.m_PulmonaryMeanShuntFlow, dst.m_PulmonaryMeanShuntFlow);
+  CopyScalar(src.m_PulmonarySystolicArterialPressure, dst.m_PulmonarySystolicArterialPressure);
+  CopyScalar(src.m_PulmonaryVascularResistance, dst.m_PulmonaryVascularResistance);
+  CopyScalar(src.m_PulmonaryVascularResistanceIndex, dst.m_PulmonaryVascularResistanceIndex);
+  CopyScalar(src.m_PulsePressure, dst.m_PulsePressure);
+  CopyScalar(src.m_SystemicVascularResistance, dst.m_SystemicVascularResistance);
+  CopyScalar(src.m_SystolicArterialPressure, dst.m_SystolicArterialPressure);
+}
+
 cdm::CardiovascularSystemData* SECardiovascularSystem::Unload(const SECardiovascularSystem& src)
 {
   cdm::CardiovascularSystemData* dst = new cdm::CardiovascularSystemData();
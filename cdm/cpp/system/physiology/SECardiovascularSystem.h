@@ -17,6 +17,7 @@ public:
   
   static void Load(const cdm::CardiovascularSystemData& src, SECardiovascularSystem& dst);    
   static cdm::CardiovascularSystemData* Unload(const SECardiovascularSystem& src);            
+  static void Copy(const SECardiovascularSystem& src, SECardiovascularSystem& dst);
 protected:                                                                                    
   static void Serialize(const cdm::CardiovascularSystemData& src, SECardiovascularSystem& dst);
   static void Serialize(const SECardiovascularSystem& src, cdm::CardiovascularSystemData& dst);
@@ -76,6 +76,23 @@ void SEDrugSystem::Serialize(const cdm::DrugSystemData& src, SEDrugSystem& dst)
     SEScalarNegative1To1::Load(src.tubularpermeabilitychange(), dst.GetTubularPermeabilityChange());
 }
 
+void SEDrugSystem::Copy(const SEDrugSystem& src, SEDrugSystem& dst)
+{
+  CopyScalar(src.m_BronchodilationLevel, dst.m_BronchodilationLevel);
+  CopyScalar(src.m_HeartRateChange, dst.m_HeartRateChange);
+  CopyScalar(src.m_MeanBloodPressureChange, dst.m_MeanBloodPressureChange);
+  CopyScalar(src.m_NeuromuscularBlockLevel, dst.m_NeuromuscularBlockLevel);
+  CopyScalar(src.m_PulsePressureChange, dst.m_PulsePressureChange);
+  if (src.m_PupillaryResponse != nullptr)
+    SEPupillaryResponse::Copy(*src.m_PupillaryResponse, dst.GetPupillaryResponse());
+  else
+    SAFE_DELETE(dst.m_PupillaryResponse);
+  CopyScalar(src.m_RespirationRateChange, dst.m_RespirationRateChange);
+  CopyScalar(src.m_SedationLevel, dst.m_SedationLevel);
+  CopyScalar(src.m_TidalVolumeChange, dst.m_TidalVolumeChange);
+  CopyScalar(src.m_TubularPermeabilityChange, dst.m_TubularPermeabilityChange);
+}
+
 cdm::DrugSystemData* SEDrugSystem::Unload(const SEDrugSystem& src)
 {
   cdm::DrugSystemData* dst = new cdm::DrugSystemData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::DrugSystemData& src, SEDrugSystem& dst);
   static cdm::DrugSystemData* Unload(const SEDrugSystem& src);
+  static void Copy(const SEDrugSystem& src, SEDrugSystem& dst);
 protected:
   static void Serialize(const cdm::DrugSystemData& src, SEDrugSystem& dst);
   static void Serialize(const SEDrugSystem& src, cdm::DrugSystemData& dst);
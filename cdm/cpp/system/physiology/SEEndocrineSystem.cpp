@@ -39,6 +39,11 @@ void SEEndocrineSystem::Serialize(const cdm::EndocrineSystemData& src, SEEndocri
     SEScalarAmountPerTime::Load(src.insulinsynthesisrate(), dst.GetInsulinSynthesisRate());
 }
 
+void SEEndocrineSystem::Copy(const SEEndocrineSystem& src, SEEndocrineSystem& dst)
+{
+  CopyScalar(src.m_InsulinSynthesisRate, dst.m_InsulinSynthesisRate);
+}
+
 cdm::EndocrineSystemData* SEEndocrineSystem::Unload(const SEEndocrineSystem& src)
 {
   cdm::EndocrineSystemData* dst = new cdm::EndocrineSystemData();
@@ -17,6 +17,7 @@ public:
   
   static void Load(const cdm::EndocrineSystemData& src, SEEndocrineSystem& dst);
   static cdm::EndocrineSystemData* Unload(const SEEndocrineSystem& src);
+  static void Copy(const SEEndocrineSystem& src, SEEndocrineSystem& dst);
 protected:
   static void Serialize(const cdm::EndocrineSystemData& src, SEEndocrineSystem& dst);
   static void Serialize(const SEEndocrineSystem& src, cdm::EndocrineSystemData& dst);
@@ -108,6 +108,21 @@ void SEEnergySystem::Serialize(const cdm::EnergySystemData& src, SEEnergySystem&
     SEScalar0To1::Load(src.totalworkratelevel(), dst.GetTotalWorkRateLevel());
 }
 
+void SEEnergySystem::Copy(const SEEnergySystem& src, SEEnergySystem& dst)
+{
+  CopyScalar(src.m_AchievedExerciseLevel, dst.m_AchievedExerciseLevel);
+  CopyScalar(src.m_CoreTemperature, dst.m_CoreTemperature);
+  CopyScalar(src.m_CreatinineProductionRate, dst.m_CreatinineProductionRate);
+  CopyScalar(src.m_ExerciseMeanArterialPressureDelta, dst.m_ExerciseMeanArterialPressureDelta);
+  CopyScalar(src.m_FatigueLevel, dst.m_FatigueLevel);
+  CopyScalar(src.m_KetoneProductionRate, dst.m_KetoneProductionRate);
+  CopyScalar(src.m_LactateProductionRate, dst.m_LactateProductionRate);
+  CopyScalar(src.m_SkinTemperature, dst.m_SkinTemperature);
+  CopyScalar(src.m_SweatRate, dst.m_SweatRate);
+  CopyScalar(src.m_TotalMetabolicRate, dst.m_TotalMetabolicRate);
+  CopyScalar(src.m_TotalWorkRateLevel, dst.m_TotalWorkRateLevel);
+}
+
 cdm::EnergySystemData* SEEnergySystem::Unload(const SEEnergySystem& src)
 {
   cdm::EnergySystemData* dst = new cdm::EnergySystemData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::EnergySystemData& src, SEEnergySystem& dst);
   static cdm::EnergySystemData* Unload(const SEEnergySystem& src);
+  static void Copy(const SEEnergySystem& src, SEEnergySystem& dst);
 protected:
   static void Serialize(const cdm::EnergySystemData& src, SEEnergySystem& dst);
   static void Serialize(const SEEnergySystem& src, cdm::EnergySystemData& dst);
@@ -58,6 +58,15 @@ void SEGastrointestinalSystem::Serialize(const cdm::GastrointestinalSystemData&
     SENutrition::Load(src.stomachcontents(), dst.GetStomachContents());
 }
 
+void SEGastrointestinalSystem::Copy(const SEGastrointestinalSystem& src, SEGastrointestinalSystem& dst)
+{
+  CopyScalar(src.m_ChymeAbsorptionRate, dst.m_ChymeAbsorptionRate);
+  if (src.m_StomachContents != nullptr)
+    SENutrition::Copy(*src.m_StomachContents, dst.GetStomachContents());
+  else
+    SAFE_DELETE(dst.m_StomachContents);
+}
+
 cdm::GastrointestinalSystemData* SEGastrointestinalSystem::Unload(const SEGastrointestinalSystem& src)
 {
   cdm::GastrointestinalSystemData* dst = new cdm::GastrointestinalSystemData();
@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::GastrointestinalSystemData& src, SEGastrointestinalSystem& dst);
   static cdm::GastrointestinalSystemData* Unload(const SEGastrointestinalSystem& src);
+  static void Copy(const SEGastrointestinalSystem& src, SEGastrointestinalSystem& dst);
 protected:
   static void Serialize(const cdm::GastrointestinalSystemData& src, SEGastrointestinalSystem& dst);
   static void Serialize(const SEGastrointestinalSystem& src, cdm::GastrointestinalSystemData& dst);
@@ -35,6 +35,10 @@ void SEHepaticSystem::Serialize(const cdm::HepaticSystemData& src, SEHepaticSyst
   
 }
 
+void SEHepaticSystem::Copy(const SEHepaticSystem& src, SEHepaticSystem& dst)
+{
+}
+
 cdm::HepaticSystemData* SEHepaticSystem::Unload(const SEHepaticSystem& src)
 {
   cdm::HepaticSystemData* dst = new cdm::HepaticSystemData();
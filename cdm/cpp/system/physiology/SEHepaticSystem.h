@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::HepaticSystemData& src, SEHepaticSystem& dst);
   static cdm::HepaticSystemData* Unload(const SEHepaticSystem& src);
+  static void Copy(const SEHepaticSystem& src, SEHepaticSystem& dst);
 protected:
   static void Serialize(const cdm::HepaticSystemData& src, SEHepaticSystem& dst);
   static void Serialize(const SEHepaticSystem& src, cdm::HepaticSystemData& dst);
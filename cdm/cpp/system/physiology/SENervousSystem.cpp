@@ -91,6 +91,24 @@ void SENervousSystem::Serialize(const cdm::NervousSystemData& src, SENervousSyst
     SEPupillaryResponse::Load(src.righteyepupillaryresponse(), dst.GetRightEyePupillaryResponse());
 }
 
+void SENervousSystem::Copy(const SENervousSystem& src, SENervousSystem& dst)
+{
+  CopyScalar(src.m_BaroreceptorHeartRateScale, dst.m_BaroreceptorHeartRateScale);
+  CopyScalar(src.m_BaroreceptorHeartElastanceScale, dst.m_BaroreceptorHeartElastanceScale);
+  CopyScalar(src.m_BaroreceptorResistanceScale, dst.m_BaroreceptorResistanceScale);
+  CopyScalar(src.m_BaroreceptorComplianceScale, dst.m_BaroreceptorComplianceScale);
+  CopyScalar(src.m_ChemoreceptorHeartRateScale, dst.m_ChemoreceptorHeartRateScale);
+  CopyScalar(src.m_ChemoreceptorHeartElastanceScale, dst.m_ChemoreceptorHeartElastanceScale);
+  if (src.m_LeftEyePupillaryResponse != nullptr)
+    SEPupillaryResponse::Copy(*src.m_LeftEyePupillaryResponse, dst.GetLeftEyePupillaryResponse());
+  else
+    SAFE_DELETE(dst.m_LeftEyePupillaryResponse);
+  if (src.m_RightEyePupillaryResponse != nullptr)
+    SEPupillaryResponse::Copy(*src.m_RightEyePupillaryResponse, dst.GetRightEyePupillaryResponse());
+  else
+    SAFE_DELETE(dst.m_RightEyePupillaryResponse);
+}
+
 cdm::NervousSystemData* SENervousSystem::Unload(const SENervousSystem& src)
 {
   cdm::NervousSystemData* dst = new cdm::NervousSystemData();
@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::NervousSystemData& src, SENervousSystem& dst);
   static cdm::NervousSystemData* Unload(const SENervousSystem& src);
+  static void Copy(const SENervousSystem& src, SENervousSystem& dst);
 protected:
   static void Serialize(const cdm::NervousSystemData& src, SENervousSystem& dst);
   static void Serialize(const SENervousSystem& src, cdm::NervousSystemData& dst);
@@ -50,6 +50,13 @@ void SEPupillaryResponse::Serialize(const cdm::PupillaryResponseData& src, SEPup
     SEScalarNegative1To1::Load(src.sizemodifier(), dst.GetSizeModifier());
 }
 
+void SEPupillaryResponse::Copy(const SEPupillaryResponse& src, SEPupillaryResponse& dst)
+{
+  CopyScalar(src.m_ReactivityModifier, dst.m_ReactivityModifier);
+  CopyScalar(src.m_ShapeModifier, dst.m_ShapeModifier);
+  CopyScalar(src.m_SizeModifier, dst.m_SizeModifier);
+}
+
 cdm::PupillaryResponseData* SEPupillaryResponse::Unload(const SEPupillaryResponse& src)
 {
   cdm::PupillaryResponseData* dst = new cdm::PupillaryResponseData();
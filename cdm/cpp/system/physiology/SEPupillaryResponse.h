@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::PupillaryResponseData& src, SEPupillaryResponse& dst);
   static cdm::PupillaryResponseData* Unload(const SEPupillaryResponse& src);
+  static void Copy(const SEPupillaryResponse& src, SEPupillaryResponse& dst);
 protected:
   static void Serialize(const cdm::PupillaryResponseData& src, SEPupillaryResponse& dst);
   static void Serialize(const SEPupillaryResponse& src, cdm::PupillaryResponseData& dst);
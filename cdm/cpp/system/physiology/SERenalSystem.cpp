@@ -390,6 +390,64 @@ void SERenalSystem::Serialize(const cdm::RenalSystemData& src, SERenalSystem& ds
     SEScalarMassPerVolume::Load(src.urineureanitrogenconcentration(), dst.GetUrineUreaNitrogenConcentration());
 }
 
+void SERenalSystem::Copy(const SERenalSystem& src, SERenalSystem& dst)
+{
+  CopyScalar(src.m_GlomerularFiltrationRate, dst.m_GlomerularFiltrationRate);
+  CopyScalar(src.m_FiltrationFraction, dst.m_FiltrationFraction);
+  CopyScalar(src.m_LeftAfferentArterioleResistance, dst.m_LeftAfferentArterioleResistance);
+  CopyScalar(src.m_LeftBowmansCapsulesHydrostaticPressure, dst.m_LeftBowmansCapsulesHydrostaticPressure);
+  CopyScalar(src.m_LeftBowmansCapsulesOsmoticPressure, dst.m_LeftBowmansCapsulesOsmoticPressure);
+  CopyScalar(src.m_LeftEfferentArterioleResistance, dst.m_LeftEfferentArterioleResistance);
+  CopyScalar(src.m_LeftGlomerularCapillariesHydrostaticPressure, dst.m_LeftGlomerularCapillariesHydrostaticPressure);
+  CopyScalar(src.m_LeftGlomerularCapillariesOsmoticPressure, dst.m_LeftGlomerularCapillariesOsmoticPressure);
+  CopyScalar(src.m_LeftGlomerularFiltrationCoefficient, dst.m_LeftGlomerularFiltrationCoefficient);
+  CopyScalar(src.m_LeftGlomerularFiltrationRate, dst.m_LeftGlomerularFiltrationRate);
+  CopyScalar(src.m_LeftGlomerularFiltrationSurfaceArea, dst.m_LeftGlomerularFiltrationSurfaceArea);
+  CopyScalar(src.m_LeftGlomerularFluidPermeability, dst.m_LeftGlomerularFluidPermeability);
+  CopyScalar(src.m_LeftFiltrationFraction, dst.m_LeftFiltrationFraction);
+  CopyScalar(src.m_LeftNetFiltrationPressure, dst.m_LeftNetFiltrationPressure);
+  CopyScalar(src.m_LeftNetReabsorptionPressure, dst.m_LeftNetReabsorptionPressure);
+  CopyScalar(src.m_LeftPeritubularCapillariesHydrostaticPressure, dst.m_LeftPeritubularCapillariesHydrostaticPressure);
+  CopyScalar(src.m_LeftPeritubularCapillariesOsmoticPressure, dst.m_LeftPeritubularCapillariesOsmoticPressure);
+  CopyScalar(src.m_LeftReabsorptionFiltrationCoefficient, dst.m_LeftReabsorptionFiltrationCoefficient);
+  CopyScalar(src.m_LeftReabsorptionRate, dst.m_LeftReabsorptionRate);
+  CopyScalar(src.m_LeftTubularReabsorptionFiltrationSurfaceArea, dst.m_LeftTubularReabsorptionFiltrationSurfaceArea);
+  CopyScalar(src.m_LeftTubularReabsorptionFluidPermeability, dst.m_LeftTubularReabsorptionFluidPermeability);
+  CopyScalar(src.m_LeftTubularHydrostaticPressure, dst.m_LeftTubularHydrostaticPressure);
+  CopyScalar(src.m_LeftTubularOsmoticPressure, dst.m_LeftTubularOsmoticPressure);
+  CopyScalar(src.m_RenalBloodFlow, dst.m_RenalBloodFlow);
+  CopyScalar(src.m_RenalPlasmaFlow, dst.m_RenalPlasmaFlow);
+  CopyScalar(src.m_RenalVascularResistance, dst.m_RenalVascularResistance);
+  CopyScalar(src.m_RightAfferentArterioleResistance, dst.m_RightAfferentArterioleResistance);
+  CopyScalar(src.m_RightBowmansCapsulesHydrostaticPressure, dst.m_RightBowmansCapsulesHydrostaticPressure);
+  CopyScalar(src.m_RightBowmansCapsulesOsmoticPressure, dst.m_RightBowmansCapsulesOsmoticPressure);
+  CopyScalar(src.m_RightEfferentArterioleResistance, dst.m_RightEfferentArterioleResistance);
+  CopyScalar(src.m_RightGlomerularCapillariesHydrostaticPressure, dst.m_RightGlomerularCapillariesHydrostaticPressure);
+  CopyScalar(src.m_RightGlomerularCapillariesOsmoticPressure, dst.m_RightGlomerularCapillariesOsmoticPressure);
+  CopyScalar(src.m_RightGlomerularFiltrationCoefficient, dst.m_RightGlomerularFiltrationCoefficient);
+  CopyScalar(src.m_RightGlomerularFiltrationRate, dst.m_RightGlomerularFiltrationRate);
+  CopyScalar(src.m_RightGlomerularFiltrationSurfaceArea, dst.m_RightGlomerularFiltrationSurfaceArea);
+  CopyScalar(src.m_RightGlomerularFluidPermeability, dst.m_RightGlomerularFluidPermeability);
+  CopyScalar(src.m_RightFiltrationFraction, dst.m_RightFiltrationFraction);
+  CopyScalar(src.m_RightNetFiltrationPressure, dst.m_RightNetFiltrationPressure);
+  CopyScalar(src.m_RightNetReabsorptionPressure, dst.m_RightNetReabsorptionPressure);
+  CopyScalar(src.m_RightPeritubularCapillariesHydrostaticPressure, dst.m_RightPeritubularCapillariesHydrostaticPressure);
+  CopyScalar(src.m_RightPeritubularCapillariesOsmoticPressure, dst.m_RightPeritubularCapillariesOsmoticPressure);
+  CopyScalar(src.m_RightReabsorptionFiltrationCoefficient, dst.m_RightReabsorptionFiltrationCoefficient);
+  CopyScalar(src.m_RightReabsorptionRate, dst.m_RightReabsorptionRate);
+  CopyScalar(src.m_RightTubularReabsorptionFiltrationSurfaceArea, dst.m_RightTubularReabsorptionFiltrationSurfaceArea);
+  CopyScalar(src.m_RightTubularReabsorptionFluidPermeability, dst.m_RightTubularReabsorptionFluidPermeability);
+  CopyScalar(src.m_RightTubularHydrostaticPressure, dst.m_RightTubularHydrostaticPressure);
+  CopyScalar(src.m_RightTubularOsmoticPressure, dst.m_RightTubularOsmoticPressure);
+  CopyScalar(src.m_UrinationRate, dst.m_UrinationRate);
+  CopyScalar(src.m_UrineOsmolality, dst.m_UrineOsmolality);
+  CopyScalar(src.m_UrineOsmolarity, dst.m_UrineOsmolarity);
+  CopyScalar(src.m_UrineProductionRate, dst.m_UrineProductionRate);
+  CopyScalar(src.m_UrineSpecificGravity, dst.m_UrineSpecificGravity);
+  CopyScalar(src.m_UrineVolume, dst.m_UrineVolume);
+  CopyScalar(src.m_UrineUreaNitrogenConcentration, dst.m_UrineUreaNitrogenConcentration);
+}
+
 cdm::RenalSystemData* SERenalSystem::Unload(const SERenalSystem& src)
 {
   cdm::RenalSystemData* dst = new cdm::RenalSystemData();
@@ -17,6 +17,7 @@ public:
 
   static void Load(const cdm::RenalSystemData& src, SERenalSystem& dst);
   static cdm::RenalSystemData* Unload(const SERenalSystem& src);
+  static void Copy(const SERenalSystem& src, SERenalSystem& dst);
 protected:
   static void Serialize(const cdm::RenalSystemData& src, SERenalSystem& dst);
   static void Serialize(const SERenalSystem& src, cdm::RenalSystemData& dst);
@@ -156,6 +156,29 @@ void SERespiratorySystem::Serialize(const cdm::RespiratorySystemData& src, SERes
     SEScalarPressure::Load(src.transpulmonarypressure(), dst.GetTranspulmonaryPressure());
 }
 
+void SERespiratorySystem::Copy(const SERespiratorySystem& src, SERespiratorySystem& dst)
+{
+  CopyScalar(src.m_AlveolarArterialGradient, dst.m_AlveolarArterialGradient);
+  CopyScalar(src.m_CarricoIndex, dst.m_CarricoIndex);
+  CopyScalar(src.m_EndTidalCarbonDioxideFraction, dst.m_EndTidalCarbonDioxideFraction);
+  CopyScalar(src.m_EndTidalCarbonDioxidePressure, dst.m_EndTidalCarbonDioxidePressure);
+  CopyScalar(src.m_ExpiratoryFlow, dst.m_ExpiratoryFlow);
+  CopyScalar(src.m_InspiratoryExpiratoryRatio, dst.m_InspiratoryExpiratoryRatio);
+  CopyScalar(src.m_InspiratoryFlow, dst.m_InspiratoryFlow);
+  CopyScalar(src.m_PulmonaryCompliance, dst.m_PulmonaryCompliance);
+  CopyScalar(src.m_PulmonaryResistance, dst.m_PulmonaryResistance);
+  CopyScalar(src.m_RespirationDriverPressure, dst.m_RespirationDriverPressure);
+  CopyScalar(src.m_RespirationMusclePressure, dst.m_RespirationMusclePressure);
+  CopyScalar(src.m_RespirationRate, dst.m_RespirationRate);
+  CopyScalar(src.m_SpecificVentilation, dst.m_SpecificVentilation);
+  CopyScalar(src.m_TidalVolume, dst.m_TidalVolume);
+  CopyScalar(src.m_TotalAlveolarVentilation, dst.m_TotalAlveolarVentilation);
+  CopyScalar(src.m_TotalDeadSpaceVentilation, dst.m_TotalDeadSpaceVentilation);
+  CopyScalar(src.m_TotalLungVolume, dst.m_TotalLungVolume);
+  CopyScalar(src.m_TotalPulmonaryVentilation, dst.m_TotalPulmonaryVentilation);
+  CopyScalar(src.m_TranspulmonaryPressure, dst.m_TranspulmonaryPressure);
+}
+
 cdm::RespiratorySystemData* SERespiratorySystem::Unload(const SERespiratorySystem& src)
 {
   cdm::RespiratorySystemData* dst = new cdm::RespiratorySystemData();
@@ -18,6 +18,7 @@ public:
 
   static void Load(const cdm::RespiratorySystemData& src, SERespiratorySystem& dst);
   static cdm::RespiratorySystemData* Unload(const SERespiratorySystem& src);
+  static void Copy(const SERespiratorySystem& src, SERespiratorySystem& dst);
 protected:
   static void Serialize(const cdm::RespiratorySystemData& src, SERespiratorySystem& dst);
   static void Serialize(const SERespiratorySystem& src, cdm::RespiratorySystemData& dst);
@@ -76,6 +76,17 @@ void SETissueSystem::Serialize(const cdm::TissueSystemData& src, SETissueSystem&
     SEScalar::Load(src.respiratoryexchangeratio(), dst.GetRespiratoryExchangeRatio());
 }
 
+void SETissueSystem::Copy(const SETissueSystem& src, SETissueSystem& dst)
+{
+  CopyScalar(src.m_CarbonDioxideProductionRate, dst.m_CarbonDioxideProductionRate);
+  CopyScalar(src.m_ExtracellularFluidVolume, dst.m_ExtracellularFluidVolume);
+  CopyScalar(src.m_ExtravascularFluidVolume, dst.m_ExtravascularFluidVolume);
+  CopyScalar(src.m_IntracellularFluidPH, dst.m_IntracellularFluidPH);
+  CopyScalar(src.m_IntracellularFluidVolume, dst.m_IntracellularFluidVolume);
+  CopyScalar(src.m_OxygenConsumptionRate, dst.m_OxygenConsumptionRate);
+  CopyScalar(src.m_RespiratoryExchangeRatio, dst.m_RespiratoryExchangeRatio);
+}
+
 cdm::TissueSystemData* SETissueSystem::Unload(const SETissueSystem& src)
 {
   cdm::TissueSystemData* dst = new cdm::TissueSystemData();
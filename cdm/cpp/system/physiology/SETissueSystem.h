@@ -17,6 +17,7 @@ public:
   
   static void Load(const cdm::TissueSystemData& src, SETissueSystem& dst);
   static cdm::TissueSystemData* Unload(const SETissueSystem& src);
+  static void Copy(const SETissueSystem& src, SETissueSystem& dst);
 protected:
   static void Serialize(const cdm::TissueSystemData& src, SETissueSystem& dst);
   static void Serialize(const SETissueSystem& src, cdm::TissueSystemData& dst);
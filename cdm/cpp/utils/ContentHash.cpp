@@ -0,0 +1,56 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "utils/ContentHash.h"
+#include <google/protobuf/message.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace
+{
+  const uint64_t FNVOffsetBasis = 14695981039346656037ULL;
+  const uint64_t FNVPrime = 1099511628211ULL;
+}
+
+ContentHash::ContentHash()
+{
+  m_Value = FNVOffsetBasis;
+}
+
+void ContentHash::Add(const void* data, size_t size)
+{
+  const unsigned char* bytes = (const unsigned char*)data;
+  for (size_t i = 0; i < size; i++)
+  {
+    m_Value ^= bytes[i];
+    m_Value *= FNVPrime;
+  }
+}
+
+void ContentHash::Add(const std::string& str)
+{
+  // Include the size so consecutive strings can't run into each other
+  uint64_t size = str.size();
+  Add(&size, sizeof(size));
+  Add(str.data(), str.size());
+}
+
+void ContentHash::Add(const google::protobuf::Message& msg)
+{
+  std::string bytes;
+  {
+    google::protobuf::io::StringOutputStream stream(&bytes);
+    google::protobuf::io::CodedOutputStream coded(&stream);
+    coded.SetSerializationDeterministic(true);
+    msg.SerializeToCodedStream(&coded);
+  }
+  Add(bytes);
+}
+
+std::string ContentHash::ToString() const
+{
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)m_Value);
+  return std::string(hex);
+}
@@ -0,0 +1,30 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+namespace google { namespace protobuf { class Message; } }
+
+/**
+ * 64 bit FNV-1a hash of a sequence of bytes and protobuf messages.
+ * The value only depends on the content added, so it is stable across runs
+ * and can be used to name files that are reused between processes.
+ */
+class CDM_DECL ContentHash
+{
+public:
+  ContentHash();
+  virtual ~ContentHash() = default;
+
+  void Add(const void* data, size_t size);
+  void Add(const std::string& str);
+  // Messages are hashed through their deterministic wire format, so maps hash the same regardless of insertion order
+  void Add(const google::protobuf::Message& msg);
+
+  uint64_t GetValue() const { return m_Value; }
+  // 16 hex characters
+  std::string ToString() const;
+
+protected:
+  uint64_t m_Value;
+};
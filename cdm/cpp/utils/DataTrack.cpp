@@ -42,6 +42,9 @@ void DataTrack::Clear()
   if(m_FileStream.is_open())
     m_FileStream.close();
   m_HeadingOrder.clear();
+  m_HeadingIndex.clear();
+  m_Probe.clear();
+  m_Formatting.clear();
 }
 
 void DataTrack::Reset()
@@ -53,8 +56,10 @@ void DataTrack::Reset()
     delete itr->second;
   }
   m_Track.clear();
-  m_Probe.clear();
-  m_Formatting.clear(); 
+  // Keep our columns, but forget their values and formatting
+  std::fill(m_Probe.begin(), m_Probe.end(), std::numeric_limits<double>::quiet_NaN());
+  for (SEDecimalFormat& f : m_Formatting)
+    f.Clear();
 }
 
 std::vector<std::string>& DataTrack::GetHeadings()
@@ -62,42 +67,51 @@ std::vector<std::string>& DataTrack::GetHeadings()
   return m_HeadingOrder;
 }
 
+size_t DataTrack::AddHeading(const std::string& name)
+{
+  auto itr = m_HeadingIndex.find(name);
+  if (itr != m_HeadingIndex.end())
+    return itr->second;
+  size_t column = m_HeadingOrder.size();
+  m_HeadingIndex[name] = column;
+  m_HeadingOrder.push_back(name);
+  m_Probe.push_back(std::numeric_limits<double>::quiet_NaN());
+  m_Formatting.emplace_back();
+  return column;
+}
+
 void DataTrack::SetFormatting(const std::string& name, const SEDecimalFormat& f)
 {
-  if (std::find(m_HeadingOrder.begin(), m_HeadingOrder.end(), name) == m_HeadingOrder.end())
-    m_HeadingOrder.push_back(name);
-  m_Formatting[name].Set(f);
+  m_Formatting[AddHeading(name)].Set(f);
 }
 void DataTrack::SetFormatting(const std::string& name, std::streamsize precision)
 {
-  if (std::find(m_HeadingOrder.begin(), m_HeadingOrder.end(), name) == m_HeadingOrder.end())
-    m_HeadingOrder.push_back(name);
-  m_Formatting[name].SetPrecision(precision);
+  m_Formatting[AddHeading(name)].SetPrecision(precision);
 }
 void DataTrack::SetDefaultFormatting(std::streamsize precision)
 {
   m_DefaultPrecision = precision;
 }
+SEDecimalFormat& DataTrack::GetFormatting(size_t column)
+{
+  return m_Formatting[column];
+}
 
 void DataTrack::Probe(const std::string& name, double value, int i)
 {
   std::stringstream ss;
   ss << name << i;
-  std::string count = ss.str();
-  if (std::find(m_HeadingOrder.begin(), m_HeadingOrder.end(), count) == m_HeadingOrder.end())
-  {
-    m_HeadingOrder.push_back(count);
-  }
-  m_Probe[count]=value;
+  m_Probe[AddHeading(ss.str())]=value;
 }
 
 void DataTrack::Probe(const std::string& name, double value)
 {
-  if (std::find(m_HeadingOrder.begin(), m_HeadingOrder.end(), name) == m_HeadingOrder.end())
-  {
-    m_HeadingOrder.push_back(name);
-  }
-  m_Probe[name]=value;
+  m_Probe[AddHeading(name)]=value;
+}
+
+void DataTrack::Probe(size_t column, double value)
+{
+  m_Probe[column]=value;
 }
 
 void DataTrack::Probe(const SEFluidCircuit& c)
@@ -324,22 +338,27 @@ void DataTrack::Probe(const SELiquidCompartmentGraph& graph)
 
 double DataTrack::GetProbe(const std::string& name)
 {
-  if(m_Probe.find(name)==m_Probe.end())
+  auto itr = m_HeadingIndex.find(name);
+  if(itr==m_HeadingIndex.end())
     return std::numeric_limits<double>::quiet_NaN();
-  return m_Probe[name];
+  return m_Probe[itr->second];
 }
 
-ProbeMap* DataTrack::GetProbes()
+double DataTrack::GetProbe(size_t column)
 {
-  return &m_Probe;
+  if (column >= m_Probe.size())
+    return std::numeric_limits<double>::quiet_NaN();
+  return m_Probe[column];
+}
+
+std::vector<double>& DataTrack::GetProbes()
+{
+  return m_Probe;
 }
 
 void DataTrack::Track(const std::string& name, double time, double value)
 {
-  if (std::find(m_HeadingOrder.begin(), m_HeadingOrder.end(), name) == m_HeadingOrder.end())
-  {
-    m_HeadingOrder.push_back(name);
-  }
+  AddHeading(name);
   std::vector<double>* v;
   if(m_LastTime!=time)
   {
@@ -814,7 +833,7 @@ void DataTrack::StreamTrackToFile(std::ofstream& file)
       }
       else
       {
-        m_Formatting[s].SetStream(file);
+        m_Formatting[h].SetStream(file);
         file << d;
       }
       if (h<(m_HeadingOrder.size() - 1))
@@ -833,36 +852,40 @@ void DataTrack::StreamTrackToFile(std::ofstream& file)
 }
 
 void DataTrack::StreamProbesToFile(double time, std::ofstream& file)
+{
+  StreamProbes(time, file);
+  file.flush();
+}
+
+void DataTrack::StreamProbes(double time, std::ostream& stream)
 {
   double d;
   // Write out probe values in heading order
-  file << std::fixed << std::setprecision(2) << time << m_Delimiter;
+  stream << std::fixed << std::setprecision(2) << time << m_Delimiter;
   for(unsigned int h=0; h<m_HeadingOrder.size(); h++) 
   {
-    const std::string& s = m_HeadingOrder[h];
-    d = GetProbe(s);
+    d = m_Probe[h];
     if (d == 0)
     {
-      file << std::fixed << std::setprecision(0);
-      file << 0;
+      stream << std::fixed << std::setprecision(0);
+      stream << 0;
     }
     else if (d-((int)d) == 0)
     {
-      file << std::fixed << std::setprecision(0);
-      file << d;
+      stream << std::fixed << std::setprecision(0);
+      stream << d;
     }
     else if (std::isnan(d))
     {
-      file << "-1.$";
+      stream << "-1.$";
     }
     else
     {
-       m_Formatting[s].SetStream(file);
-      file << d;
+      m_Formatting[h].SetStream(stream);
+      stream << d;
     }
     if(h<(m_HeadingOrder.size()-1))
-      file << m_Delimiter;
+      stream << m_Delimiter;
   }
-  file<<std::endl;
-  file.flush();
+  stream << '\n';
 }
@@ -12,15 +12,11 @@ class SEThermalCircuit;
 class SEGasCompartmentGraph;
 class SELiquidCompartmentGraph;
 
-class SEDecimalFormat;
-typedef std::map<std::string, double> ProbeMap;
-typedef std::map<std::string, double>::iterator ProbeMapItr;
+#include "properties/SEDecimalFormat.h"
+#include <unordered_map>
 typedef std::map<std::string, std::vector<double>*> TrackMap;
 typedef std::map<std::string, std::vector<double>*>::iterator TrackMapItr;
 
-
-typedef std::map<std::string, SEDecimalFormat> FormattingMap;
-
 class CDM_DECL DataTrack : public Loggable
 {
 public:
@@ -35,19 +31,26 @@ public:
   void UseCommaDelimiter() { m_Delimiter = ','; }
 
   std::vector<std::string>&  GetHeadings();
+  // Returns the column index of the heading, appending a new column if needed
+  // The index is stable until Clear is called
+  size_t AddHeading(const std::string& name);
 
   void SetFormatting(const std::string& name, const SEDecimalFormat& f);
   void SetFormatting(const std::string& name, std::streamsize precision);
   void SetDefaultFormatting(std::streamsize precision);
+  SEDecimalFormat& GetFormatting(size_t column);
 
   void Probe(const std::string& name, double value, int i);
   void Probe(const std::string& name, double value);
+  void Probe(size_t column, double value);
   void Probe(const SEFluidCircuit& c);
   void Probe(const SEElectricalCircuit& c);
   void Probe(const SEThermalCircuit& c);
   void Probe(const SELiquidCompartmentGraph& graph);
   double GetProbe(const std::string& name);
-  ProbeMap* GetProbes();
+  double GetProbe(size_t column);
+  // Probe values in heading order
+  std::vector<double>& GetProbes();
 
   void Track(const std::string& name, double time, double value);  
   void Track(double time, const SEElectricalCircuit& circuit);
@@ -82,11 +85,15 @@ public:
   void StreamTrackToFile(std::ofstream& file);
   // Writes prob values to file in the order things were tracked
   void StreamProbesToFile(double time, std::ofstream& file);
+  // Writes a line of probe values to the stream without flushing it
+  void StreamProbes(double time, std::ostream& stream);
 
 protected:
   TrackMap m_Track;
-  ProbeMap m_Probe;
-  FormattingMap m_Formatting;
+  // Columns are indexed by heading order
+  std::unordered_map<std::string, size_t> m_HeadingIndex;
+  std::vector<double>                     m_Probe;
+  std::vector<SEDecimalFormat>            m_Formatting;
 
   char                              m_Delimiter;
   double                            m_LastTime = -1.0;
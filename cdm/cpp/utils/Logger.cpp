@@ -125,6 +125,7 @@ std::string Logger::FormatLogMessage(const std::string&  msg, const std::string&
 
 void Logger::Debug(const std::string&  msg, const std::string&  origin)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   m_Log->debug(FormatLogMessage(msg, origin));
   //m_Log->debugStream().flush();
   if (m_Forward != nullptr)
@@ -146,6 +147,7 @@ void Logger::Debug(std::ostream &msg, const std::string&  origin)
 
 void Logger::Info(const std::string&  msg, const std::string&  origin)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   //std::cout<<"Number of appenders"<< m_Log->getAllAppenders().size() << std::endl;
   m_Log->info(FormatLogMessage(msg, origin));
   //m_Log->infoStream().flush();
@@ -174,6 +176,7 @@ void Logger::Info(std::ostream &msg, const std::string&  origin)
 
 void Logger::Warning(const std::string&  msg, const std::string&  origin)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   m_Log->warn(FormatLogMessage(msg, origin));
   //m_Log->warnStream().flush();
   if (m_Forward != nullptr)
@@ -194,6 +197,7 @@ void Logger::Warning(std::ostream &msg, const std::string&  origin)
 
 void Logger::Error(const std::string&  msg, const std::string&  origin)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   m_Log->error(FormatLogMessage(msg, origin));
   //m_Log->errorStream().flush();
   if (m_Forward != nullptr)
@@ -214,6 +218,7 @@ void Logger::Error(std::ostream &msg, const std::string&  origin)
 
 void Logger::Fatal(const std::string&  msg, const std::string&  origin)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   m_Log->fatal(FormatLogMessage(msg, origin));
   //m_Log->fatalStream().flush();
   if (m_Forward != nullptr)
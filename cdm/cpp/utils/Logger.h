@@ -8,6 +8,7 @@
 #pragma warning(disable:4290) // C++ exception specification ignored except to indicate a function is not __declspec(nothrow)
 #include "log4cpp/Category.hh"
 #pragma  warning(pop)
+#include <mutex>
 
 class Logger;
 class SEScalarTime;
@@ -111,5 +112,7 @@ protected:
   log4cpp::Appender*  m_ConsoleAppender;
   const SEScalarTime* m_time;
   std::stringstream   m_ss;
+  // Systems may log from scheduler worker threads, m_ss is shared by every message
+  std::recursive_mutex m_Mutex;
 };
 
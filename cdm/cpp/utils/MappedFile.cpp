@@ -0,0 +1,91 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "utils/MappedFile.h"
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+{
+  m_Data = nullptr;
+  m_Size = 0;
+#if defined(_WIN32)
+  m_FileHandle = INVALID_HANDLE_VALUE;
+  m_MappingHandle = nullptr;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+void MappedFile::Close()
+{
+#if defined(_WIN32)
+  if (m_Data != nullptr)
+    UnmapViewOfFile(m_Data);
+  if (m_MappingHandle != nullptr)
+    CloseHandle(m_MappingHandle);
+  if (m_FileHandle != INVALID_HANDLE_VALUE)
+    CloseHandle(m_FileHandle);
+  m_FileHandle = INVALID_HANDLE_VALUE;
+  m_MappingHandle = nullptr;
+#else
+  if (m_Data != nullptr)
+    munmap((void*)m_Data, m_Size);
+#endif
+  m_Data = nullptr;
+  m_Size = 0;
+}
+
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+#if defined(_WIN32)
+  m_FileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  LARGE_INTEGER size;
+  if (m_FileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_FileHandle, &size) || size.QuadPart == 0)
+  {
+    Close();
+    return false;
+  }
+  m_MappingHandle = CreateFileMappingA(m_FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (m_MappingHandle != nullptr)
+    m_Data = (const char*)MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if (m_Data == nullptr)
+  {
+    Close();
+    return false;
+  }
+  m_Size = (size_t)size.QuadPart;
+#else
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+  void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);// The mapping keeps its own reference to the file
+  if (data == MAP_FAILED)
+    return false;
+  m_Data = (const char*)data;
+  m_Size = (size_t)st.st_size;
+#endif
+  return true;
+}
@@ -0,0 +1,29 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+/**
+ * Read only memory mapping of an entire file
+ */
+class CDM_DECL MappedFile
+{
+public:
+  MappedFile();
+  virtual ~MappedFile();
+
+  bool Open(const std::string& filename);
+  void Close();
+  bool IsOpen() const { return m_Data != nullptr; }
+
+  const char* GetData() const { return m_Data; }
+  size_t GetSize() const { return m_Size; }
+
+protected:
+  const char* m_Data;
+  size_t      m_Size;
+#if defined(_WIN32)
+  void*       m_FileHandle;
+  void*       m_MappingHandle;
+#endif
+};
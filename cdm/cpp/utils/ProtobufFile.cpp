@@ -0,0 +1,69 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "utils/ProtobufFile.h"
+#include "utils/MappedFile.h"
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <climits>
+#include <cstring>
+
+SerializationFormat GetSerializationFormat(const std::string& filename)
+{
+  const std::string ext = BINARY_PROTOBUF_EXTENSION;
+  if (filename.size() > ext.size() && filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0)
+    return SerializationFormat::BINARY;
+  return SerializationFormat::ASCII;
+}
+
+bool SaveProtobufFile(const google::protobuf::Message& msg, const std::string& filename, SerializationFormat format, Logger* logger)
+{
+  Loggable log(logger);
+  std::string content;
+  bool serialized;
+  if (format == SerializationFormat::BINARY)
+  {
+    content = BINARY_PROTOBUF_HEADER;
+    serialized = msg.AppendToString(&content);
+  }
+  else
+    serialized = google::protobuf::TextFormat::PrintToString(msg, &content);
+  if (!serialized)
+  {
+    log.Error("Unable to serialize " + filename);
+    return false;
+  }
+  std::ofstream file(filename, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!file.is_open())
+  {
+    log.Error("Unable to open " + filename);
+    return false;
+  }
+  file.write(content.c_str(), content.size());
+  file.close();
+  return !file.fail();
+}
+
+bool LoadProtobufFile(const std::string& filename, google::protobuf::Message& msg, Logger* logger)
+{
+  Loggable log(logger);
+  MappedFile file;
+  if (!file.Open(filename))
+  {
+    log.Error("Unable to open " + filename);
+    return false;
+  }
+  if (file.GetSize() > INT_MAX)
+  {
+    log.Error(filename + " is too large to parse");
+    return false;
+  }
+  const char* data = file.GetData();
+  int size = (int)file.GetSize();
+  if (size >= BINARY_PROTOBUF_HEADER_SIZE && std::memcmp(data, BINARY_PROTOBUF_HEADER, BINARY_PROTOBUF_HEADER_SIZE) == 0)
+    return msg.ParseFromArray(data + BINARY_PROTOBUF_HEADER_SIZE, size - BINARY_PROTOBUF_HEADER_SIZE);
+  google::protobuf::io::ArrayInputStream input(data, size);
+  return google::protobuf::TextFormat::Parse(&input, &msg);
+}
@@ -0,0 +1,19 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+namespace google { namespace protobuf { class Message; } }
+
+enum class SerializationFormat { ASCII = 0, BINARY };
+
+// Binary files start with this header, followed by the protobuf wire format of the message
+#define BINARY_PROTOBUF_HEADER "PULSEPBB"
+#define BINARY_PROTOBUF_HEADER_SIZE 8
+#define BINARY_PROTOBUF_EXTENSION ".pbb"
+
+// Binary if the file has the binary extension, ASCII otherwise
+SerializationFormat CDM_DECL GetSerializationFormat(const std::string& filename);
+bool CDM_DECL SaveProtobufFile(const google::protobuf::Message& msg, const std::string& filename, SerializationFormat format, Logger* logger = nullptr);
+// Detects the format from the file header, both formats are parsed straight out of a memory mapping of the file
+bool CDM_DECL LoadProtobufFile(const std::string& filename, google::protobuf::Message& msg, Logger* logger = nullptr);
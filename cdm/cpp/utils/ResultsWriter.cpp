@@ -0,0 +1,325 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "utils/ResultsWriter.h"
+#include "utils/DataTrack.h"
+#include <cstring>
+
+ResultsWriter::ResultsWriter(Logger* logger) : Loggable(logger)
+{
+  m_FlushSize_bytes = 1024 * 1024;
+  m_FlushPeriod_s = 1.0;
+  m_Pending_bytes = 0;
+}
+
+ResultsWriter::~ResultsWriter()
+{
+  Close();
+}
+
+void ResultsWriter::SetFlushThreshold(size_t size_bytes, double period_s)
+{
+  m_FlushSize_bytes = size_bytes;
+  m_FlushPeriod_s = period_s;
+}
+
+bool ResultsWriter::PrepareFile(const std::string& filename)
+{
+  Close();
+  if (filename.empty())
+    return false;
+  // Let the stream hold everything between flushes
+  m_Buffer.resize(m_FlushSize_bytes > 0 ? m_FlushSize_bytes : 1);
+  m_File.rdbuf()->pubsetbuf(m_Buffer.data(), m_Buffer.size());
+  return true;
+}
+
+bool ResultsWriter::FileOpened(const std::string& filename)
+{
+  if (!m_File.is_open())
+  {
+    Error("Unable to open results file " + filename);
+    return false;
+  }
+  m_Pending_bytes = 0;
+  m_LastFlush = std::chrono::steady_clock::now();
+  return true;
+}
+
+void ResultsWriter::Wrote(size_t size_bytes)
+{
+  m_Pending_bytes += size_bytes;
+  if (m_Pending_bytes >= m_FlushSize_bytes)
+  {
+    Flush();
+    return;
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_LastFlush;
+  if (elapsed.count() >= m_FlushPeriod_s)
+    Flush();
+}
+
+void ResultsWriter::Flush()
+{
+  if (!m_File.is_open())
+    return;
+  m_File.flush();
+  m_Pending_bytes = 0;
+  m_LastFlush = std::chrono::steady_clock::now();
+}
+
+void ResultsWriter::Close()
+{
+  if (!m_File.is_open())
+    return;
+  Flush();
+  m_File.close();
+}
+
+bool ResultsWriter::IsOpen() const
+{
+  return m_File.is_open();
+}
+
+CSVResultsWriter::CSVResultsWriter(Logger* logger) : ResultsWriter(logger)
+{
+
+}
+
+CSVResultsWriter::~CSVResultsWriter()
+{
+
+}
+
+bool CSVResultsWriter::Open(const std::string& filename, DataTrack& track)
+{
+  if (!PrepareFile(filename))
+    return false;
+  track.CreateFile(filename.c_str(), m_File);
+  m_Row.str("");
+  m_Row.clear();
+  return FileOpened(filename);
+}
+
+void CSVResultsWriter::Write(double time_s, DataTrack& track)
+{
+  if (!m_File.is_open())
+    return;
+  m_Row.str("");
+  track.StreamProbes(time_s, m_Row);
+  const std::string& row = m_Row.str();
+  m_File.write(row.c_str(), row.size());
+  Wrote(row.size());
+}
+
+const std::string BinaryResultsWriter::Extension = ".pbr";
+const char        BinaryResultsWriter::Magic[8] = { 'P','U','L','S','E','R','E','S' };
+const uint32_t    BinaryResultsWriter::Version = 1;
+
+BinaryResultsWriter::BinaryResultsWriter(Logger* logger) : ResultsWriter(logger)
+{
+
+}
+
+BinaryResultsWriter::~BinaryResultsWriter()
+{
+
+}
+
+void BinaryResultsWriter::SplitHeading(const std::string& heading, std::string& name, std::string& unit)
+{
+  name = heading;
+  unit.clear();
+  size_t open = heading.rfind('(');
+  if (open == std::string::npos || open == 0 || heading.back() != ')' || open + 2 >= heading.size())
+    return;
+  name = heading.substr(0, open);
+  unit = heading.substr(open + 1, heading.size() - open - 2);
+}
+
+bool BinaryResultsWriter::Open(const std::string& filename, DataTrack& track)
+{
+  if (!PrepareFile(filename))
+    return false;
+  m_File.open(filename, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+  if (!FileOpened(filename))
+    return false;
+
+  const std::vector<std::string>& headings = track.GetHeadings();
+  uint32_t numColumns = (uint32_t)headings.size() + 1;
+  std::string header(Magic, sizeof(Magic));
+  auto append = [&header](const void* data, size_t size) { header.append((const char*)data, size); };
+  auto appendColumn = [&append](const std::string& name, const std::string& unit, SEDecimalFormat& fmt)
+  {
+    uint32_t length = (uint32_t)name.size();
+    append(&length, sizeof(length));
+    append(name.c_str(), name.size());
+    length = (uint32_t)unit.size();
+    append(&length, sizeof(length));
+    append(unit.c_str(), unit.size());
+    int32_t notation = (int32_t)fmt.GetNotation();
+    int32_t precision = (int32_t)fmt.GetPrecision();
+    append(&notation, sizeof(notation));
+    append(&precision, sizeof(precision));
+  };
+  append(&Version, sizeof(Version));
+  append(&numColumns, sizeof(numColumns));
+  size_t offsetPos = header.size();
+  uint64_t offset = 0;
+  append(&offset, sizeof(offset));
+
+  SEDecimalFormat timeFormat;
+  timeFormat.SetNotation(cdm::DecimalFormatData_eType_FixedMantissa);
+  timeFormat.SetPrecision(2);
+  appendColumn("Time", "s", timeFormat);
+  std::string name, unit;
+  for (size_t i = 0; i < headings.size(); i++)
+  {
+    SplitHeading(headings[i], name, unit);
+    appendColumn(name, unit, track.GetFormatting(i));
+  }
+  // Pad so rows are aligned when the file is mapped
+  header.append((8 - header.size() % 8) % 8, '\0');
+  offset = header.size();
+  std::memcpy(&header[offsetPos], &offset, sizeof(offset));
+
+  m_File.write(header.c_str(), header.size());
+  m_File.flush();
+  m_Row.resize(numColumns);
+  return true;
+}
+
+void BinaryResultsWriter::Write(double time_s, DataTrack& track)
+{
+  if (!m_File.is_open())
+    return;
+  const std::vector<double>& probes = track.GetProbes();
+  m_Row[0] = time_s;
+  for (size_t i = 1; i < m_Row.size(); i++)
+    m_Row[i] = i <= probes.size() ? probes[i - 1] : std::numeric_limits<double>::quiet_NaN();
+  size_t size = m_Row.size() * sizeof(double);
+  m_File.write((const char*)m_Row.data(), size);
+  Wrote(size);
+}
+
+BinaryResultsReader::BinaryResultsReader(Logger* logger) : Loggable(logger)
+{
+  m_NumColumns = 0;
+  m_NumRows = 0;
+  m_Rows = nullptr;
+}
+
+BinaryResultsReader::~BinaryResultsReader()
+{
+  Close();
+}
+
+void BinaryResultsReader::Close()
+{
+  m_File.Close();
+  m_Rows = nullptr;
+  m_NumColumns = 0;
+  m_NumRows = 0;
+  m_Headings.clear();
+  m_Formatting.clear();
+}
+
+bool BinaryResultsReader::Open(const std::string& filename)
+{
+  Close();
+  if (!m_File.Open(filename))
+  {
+    Error("Unable to open binary results file " + filename);
+    return false;
+  }
+  const char* data = m_File.GetData();
+  size_t dataSize = m_File.GetSize();
+
+  // Parse the header
+  size_t pos = 0;
+  auto read = [data, dataSize, &pos](void* dst, size_t size)
+  {
+    if (pos + size > dataSize)
+      return false;
+    std::memcpy(dst, data + pos, size);
+    pos += size;
+    return true;
+  };
+  auto readString = [data, dataSize, &pos, &read](std::string& str)
+  {
+    uint32_t length;
+    if (!read(&length, sizeof(length)) || pos + length > dataSize)
+      return false;
+    str.assign(data + pos, length);
+    pos += length;
+    return true;
+  };
+
+  char magic[8];
+  uint32_t version, numColumns;
+  uint64_t offset;
+  if (!read(magic, sizeof(magic)) || std::memcmp(magic, BinaryResultsWriter::Magic, sizeof(magic)) != 0 ||
+      !read(&version, sizeof(version)) || version != BinaryResultsWriter::Version ||
+      !read(&numColumns, sizeof(numColumns)) || numColumns == 0 ||
+      !read(&offset, sizeof(offset)) || offset % 8 != 0 || offset > dataSize)
+  {
+    Error(filename + " is not a supported binary results file");
+    Close();
+    return false;
+  }
+  std::string name, unit;
+  int32_t notation, precision;
+  m_Formatting.resize(numColumns);
+  for (uint32_t c = 0; c < numColumns; c++)
+  {
+    if (!readString(name) || !readString(unit) || !read(&notation, sizeof(notation)) || !read(&precision, sizeof(precision)))
+    {
+      Error(filename + " has a truncated header");
+      Close();
+      return false;
+    }
+    if (c > 0)// Time is not a heading
+      m_Headings.push_back(unit.empty() ? name : name + "(" + unit + ")");
+    m_Formatting[c].SetNotation((cdm::DecimalFormatData::eType)notation);
+    m_Formatting[c].SetPrecision(precision);
+  }
+  m_NumColumns = numColumns;
+  m_Rows = (const double*)(data + offset);
+  // Ignore any partially written row at the end
+  m_NumRows = (dataSize - (size_t)offset) / (m_NumColumns * sizeof(double));
+  return true;
+}
+
+SEDecimalFormat& BinaryResultsReader::GetFormatting(size_t column)
+{
+  return m_Formatting[column];
+}
+
+const double* BinaryResultsReader::GetRow(size_t row) const
+{
+  if (row >= m_NumRows)
+    return nullptr;
+  return m_Rows + row * m_NumColumns;
+}
+
+bool BinaryResultsReader::WriteCSV(const std::string& filename)
+{
+  if (!IsOpen())
+    return false;
+  DataTrack track(GetLogger());
+  for (size_t h = 0; h < m_Headings.size(); h++)
+    track.SetFormatting(m_Headings[h], m_Formatting[h + 1]);
+  CSVResultsWriter csv(GetLogger());
+  if (!csv.Open(filename, track))
+    return false;
+  for (size_t r = 0; r < m_NumRows; r++)
+  {
+    const double* row = GetRow(r);
+    for (size_t h = 0; h < m_Headings.size(); h++)
+      track.Probe(h, row[h + 1]);
+    csv.Write(row[0], track);
+  }
+  csv.Close();
+  return true;
+}
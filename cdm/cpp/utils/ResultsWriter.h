@@ -0,0 +1,125 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+#include "properties/SEDecimalFormat.h"
+#include "utils/MappedFile.h"
+#include <chrono>
+class DataTrack;
+
+/**
+ * Destination for the rows of probe values an SEEngineTracker pulls each time step.
+ * Writers buffer rows in memory and only go to disk when the buffered size or
+ * the time since the last flush exceeds the flush threshold, or on Close.
+ */
+class CDM_DECL ResultsWriter : public Loggable
+{
+public:
+  ResultsWriter(Logger* logger);
+  virtual ~ResultsWriter();
+
+  // Creates the file and writes the headings of the track to it
+  virtual bool Open(const std::string& filename, DataTrack& track) = 0;
+  // Appends the current probe values of the track
+  virtual void Write(double time_s, DataTrack& track) = 0;
+  virtual void Flush();
+  virtual void Close();
+  virtual bool IsOpen() const;
+
+  void SetFlushThreshold(size_t size_bytes, double period_s);
+
+protected:
+  // Closes any open file and sizes the stream buffer to the flush threshold
+  bool PrepareFile(const std::string& filename);
+  bool FileOpened(const std::string& filename);
+  void Wrote(size_t size_bytes);
+
+  std::ofstream                         m_File;
+  std::vector<char>                     m_Buffer;
+  size_t                                m_FlushSize_bytes;
+  double                                m_FlushPeriod_s;
+  size_t                                m_Pending_bytes;
+  std::chrono::steady_clock::time_point m_LastFlush;
+};
+
+/**
+ * Writes the same text layout as DataTrack::StreamProbesToFile
+ */
+class CDM_DECL CSVResultsWriter : public ResultsWriter
+{
+public:
+  CSVResultsWriter(Logger* logger);
+  virtual ~CSVResultsWriter();
+
+  virtual bool Open(const std::string& filename, DataTrack& track);
+  virtual void Write(double time_s, DataTrack& track);
+
+protected:
+  std::stringstream m_Row;
+};
+
+/**
+ * Binary columnar results file, all values are stored in native byte order
+ *   char[8]  "PULSERES"
+ *   uint32   Version
+ *   uint32   Number of columns, including the time column
+ *   uint64   Byte offset of the first row, a multiple of 8
+ *   Per column : uint32 name length, name, uint32 unit length, unit, int32 notation, int32 precision
+ *   Rows of float64, time first, then the probes in heading order
+ * The number of rows is implied by the file size, so a file that is still being written can be read.
+ */
+class CDM_DECL BinaryResultsWriter : public ResultsWriter
+{
+public:
+  BinaryResultsWriter(Logger* logger);
+  virtual ~BinaryResultsWriter();
+
+  static const std::string Extension;
+  static const char        Magic[8];
+  static const uint32_t    Version;
+
+  virtual bool Open(const std::string& filename, DataTrack& track);
+  virtual void Write(double time_s, DataTrack& track);
+
+  // Splits a "Name(unit)" heading into its name and unit
+  static void SplitHeading(const std::string& heading, std::string& name, std::string& unit);
+
+protected:
+  std::vector<double> m_Row;
+};
+
+/**
+ * Memory maps a BinaryResultsWriter file for reading
+ */
+class CDM_DECL BinaryResultsReader : public Loggable
+{
+public:
+  BinaryResultsReader(Logger* logger = nullptr);
+  virtual ~BinaryResultsReader();
+
+  bool Open(const std::string& filename);
+  void Close();
+  bool IsOpen() const { return m_File.IsOpen(); }
+
+  // Column headings, in "Name(unit)" form, excluding the time column
+  const std::vector<std::string>& GetHeadings() const { return m_Headings; }
+  SEDecimalFormat& GetFormatting(size_t column);
+
+  size_t GetNumberOfColumns() const { return m_NumColumns; }
+  size_t GetNumberOfRows() const { return m_NumRows; }
+  // Time followed by the probe values of each heading
+  const double* GetRow(size_t row) const;
+
+  // Writes the file in the layout of a CSVResultsWriter
+  bool WriteCSV(const std::string& filename);
+
+protected:
+  std::vector<std::string>     m_Headings;
+  std::vector<SEDecimalFormat> m_Formatting;
+  size_t                       m_NumColumns;
+  size_t                       m_NumRows;
+
+  MappedFile                   m_File;
+  const double*                m_Rows;
+};
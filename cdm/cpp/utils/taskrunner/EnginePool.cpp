@@ -0,0 +1,256 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "utils/taskrunner/EnginePool.h"
+#include "properties/SEScalarTime.h"
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Constructor
+///
+/// \param  threadCount     number of threads to advance engines on, 0 uses one per core
+/// \param  logger          logger engine failures are reported to
+//--------------------------------------------------------------------------------------------------
+EnginePool::EnginePool(size_t threadCount, Logger* logger) : Loggable(logger)
+{
+    m_Batch = 0;
+    m_Advancing = false;
+    m_Stop = false;
+    m_BatchTime_s = 0;
+    m_Remaining = 0;
+    m_BatchFailed = false;
+    m_SimulatedTime_s = 0;
+    m_WallTime_s = 0;
+
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t i = 0; i < threadCount; i++)
+        m_Workers.push_back(std::unique_ptr<Worker>(new Worker()));
+    for (size_t i = 0; i < threadCount; i++)
+        m_Threads.push_back(std::thread(&EnginePool::ThreadLoop, this, i));
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Destructor, waits for the current batch to finish before stopping the threads
+//--------------------------------------------------------------------------------------------------
+EnginePool::~EnginePool()
+{
+    Wait();
+    {
+        std::lock_guard<std::mutex> lock(m_BatchMutex);
+        m_Stop = true;
+    }
+    m_BatchStarted.notify_all();
+    for (std::thread& thread : m_Threads)
+        thread.join();
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Adds an engine to the pool, it will be advanced with every following batch
+///
+/// \param  engine  engine to take ownership of, it should be initialized or loaded from a state
+/// \return index of the engine in the pool
+//--------------------------------------------------------------------------------------------------
+size_t EnginePool::AddEngine(std::unique_ptr<PhysiologyEngine> engine)
+{
+    Wait();
+    PooledEngine* pooled = new PooledEngine();
+    pooled->engine = std::move(engine);
+    pooled->active = true;
+    m_Engines.push_back(std::unique_ptr<PooledEngine>(pooled));
+    return m_Engines.size() - 1;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Advances all active engines and waits for them to finish
+///
+/// \return false if any engine failed during this batch
+//--------------------------------------------------------------------------------------------------
+bool EnginePool::AdvanceAll(double time, const TimeUnit& unit)
+{
+    AdvanceAllAsync(time, unit);
+    Wait();
+    return !m_BatchFailed;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Starts advancing all active engines, waiting for any batch in progress first
+///
+/// \details
+/// The callback is run on the pool thread that finished the last engine, before the batch is
+/// considered done, so engines can be read from it, but it must not start another batch.
+//--------------------------------------------------------------------------------------------------
+void EnginePool::AdvanceAllAsync(double time, const TimeUnit& unit, std::function<void(bool)> onComplete)
+{
+    Wait();
+    std::unique_lock<std::mutex> lock(m_BatchMutex);
+    m_BatchTime_s = Convert(time, unit, TimeUnit::s);
+    m_BatchFailed = false;
+    m_OnComplete = onComplete;
+
+    std::vector<size_t> active;
+    for (size_t i = 0; i < m_Engines.size(); i++)
+    {
+        if (m_Engines[i]->active)
+            active.push_back(i);
+    }
+    if (active.empty())
+    {
+        m_OnComplete = nullptr;
+        lock.unlock();
+        if (onComplete)
+            onComplete(true);
+        return;
+    }
+    // Threads still looking for work from the last batch may pick up engines as soon as they are queued
+    m_Remaining = active.size();
+    m_SimulatedTime_s += m_BatchTime_s * active.size();
+    m_BatchStart = std::chrono::steady_clock::now();
+    m_Advancing = true;
+    // Engines always go to the same thread's queue first, threads only take from another queue once their own is empty
+    for (size_t i : active)
+    {
+        Worker& worker = *m_Workers[i % m_Workers.size()];
+        std::lock_guard<std::mutex> workerLock(worker.mutex);
+        worker.engines.push_back(i);
+    }
+    m_Batch++;
+    lock.unlock();
+    m_BatchStarted.notify_all();
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Blocks until the current batch, and its callback, are done
+//--------------------------------------------------------------------------------------------------
+void EnginePool::Wait()
+{
+    std::unique_lock<std::mutex> lock(m_BatchMutex);
+    m_BatchDone.wait(lock, [this]() { return !m_Advancing; });
+}
+
+bool EnginePool::IsAdvancing() const
+{
+    std::lock_guard<std::mutex> lock(m_BatchMutex);
+    return m_Advancing;
+}
+
+double EnginePool::GetThroughput() const
+{
+    std::lock_guard<std::mutex> lock(m_BatchMutex);
+    return m_WallTime_s > 0 ? m_SimulatedTime_s / m_WallTime_s : 0;
+}
+
+double EnginePool::GetSimulatedTime(const TimeUnit& unit) const
+{
+    std::lock_guard<std::mutex> lock(m_BatchMutex);
+    return Convert(m_SimulatedTime_s, TimeUnit::s, unit);
+}
+
+double EnginePool::GetWallTime(const TimeUnit& unit) const
+{
+    std::lock_guard<std::mutex> lock(m_BatchMutex);
+    return Convert(m_WallTime_s, TimeUnit::s, unit);
+}
+
+void EnginePool::ResetStatistics()
+{
+    Wait();
+    std::lock_guard<std::mutex> lock(m_BatchMutex);
+    m_SimulatedTime_s = 0;
+    m_WallTime_s = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Advances engines of each batch until there are none left, in this thread's queue or any other
+//--------------------------------------------------------------------------------------------------
+void EnginePool::ThreadLoop(size_t thread)
+{
+    uint64_t batch = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_BatchMutex);
+            m_BatchStarted.wait(lock, [this, batch]() { return m_Stop || m_Batch != batch; });
+            if (m_Stop)
+                return;
+            batch = m_Batch;
+        }
+
+        size_t engine;
+        while (NextEngine(thread, engine))
+        {
+            AdvanceEngine(engine);
+            if (--m_Remaining > 0)
+                continue;
+            // Last engine of the batch
+            std::function<void(bool)> onComplete;
+            {
+                std::lock_guard<std::mutex> lock(m_BatchMutex);
+                m_WallTime_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_BatchStart).count();
+                onComplete = std::move(m_OnComplete);
+                m_OnComplete = nullptr;
+            }
+            if (onComplete)
+                onComplete(!m_BatchFailed);
+            {
+                std::lock_guard<std::mutex> lock(m_BatchMutex);
+                m_Advancing = false;
+            }
+            m_BatchDone.notify_all();
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Takes the next engine from the front of our own queue, or steals one from the back of another
+//--------------------------------------------------------------------------------------------------
+bool EnginePool::NextEngine(size_t thread, size_t& engine)
+{
+    for (size_t i = 0; i < m_Workers.size(); i++)
+    {
+        Worker& worker = *m_Workers[(thread + i) % m_Workers.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.engines.empty())
+            continue;
+        if (i == 0)
+        {
+            engine = worker.engines.front();
+            worker.engines.pop_front();
+        }
+        else
+        {
+            engine = worker.engines.back();
+            worker.engines.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+void EnginePool::AdvanceEngine(size_t engine)
+{
+    PooledEngine& pooled = *m_Engines[engine];
+    try
+    {
+        pooled.engine->AdvanceModelTime(m_BatchTime_s, TimeUnit::s);
+        return;
+    }
+    catch (std::exception& ex)
+    {
+        Error("Engine " + std::to_string(engine) + " failed to advance, it will no longer be advanced : " + ex.what(), "EnginePool::AdvanceEngine");
+    }
+    catch (...)
+    {
+        Error("Engine " + std::to_string(engine) + " failed to advance, it will no longer be advanced", "EnginePool::AdvanceEngine");
+    }
+    pooled.active = false;
+    m_BatchFailed = true;
+}
@@ -0,0 +1,100 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+
+#include "CommonDataModel.h"
+#include "PhysiologyEngine.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Owns a set of engines and advances them together, in lock-step, on a pool of threads.
+///
+/// \details
+/// Each engine is queued on the same pool thread every batch, unless another thread runs out of its
+/// own engines first and steals it. This is only an affinity to a queue, threads are not pinned to cores,
+/// so the operating system is still free to move a thread, and its engines, to another core.
+/// Between batches, engines can be accessed freely from the calling thread,
+/// e.g. to process actions or read vitals.
+/// An engine that throws while advancing is logged and left out of every following batch.
+//--------------------------------------------------------------------------------------------------
+class CDM_DECL EnginePool : public Loggable
+{
+public:
+    // A thread count of 0 uses one thread per core
+    EnginePool(size_t threadCount = 0, Logger* logger = nullptr);
+    virtual ~EnginePool();
+
+    EnginePool(const EnginePool& other) = delete;
+    EnginePool& operator=(const EnginePool& other) = delete;
+
+    // Takes ownership of the engine, returns its index in the pool
+    size_t AddEngine(std::unique_ptr<PhysiologyEngine> engine);
+    size_t GetEngineCount() const { return m_Engines.size(); }
+    PhysiologyEngine& GetEngine(size_t idx) { return *m_Engines[idx]->engine; }
+    // False if the engine threw while advancing
+    bool IsEngineActive(size_t idx) const { return m_Engines[idx]->active; }
+    size_t GetThreadCount() const { return m_Threads.size(); }
+
+    // Advances every active engine by the given time, returns once all of them are done
+    // Returns false if any engine failed during this batch
+    bool AdvanceAll(double time, const TimeUnit& unit);
+    // Starts advancing every active engine and returns immediately
+    // The callback is called on a pool thread once all engines are done, with the AdvanceAll result
+    void AdvanceAllAsync(double time, const TimeUnit& unit, std::function<void(bool)> onComplete = nullptr);
+    // Blocks until the current batch, if any, is done
+    void Wait();
+    bool IsAdvancing() const;
+
+    // Simulated seconds of all engines per second of wall time, over all batches since the last reset
+    double GetThroughput() const;
+    double GetSimulatedTime(const TimeUnit& unit) const;
+    double GetWallTime(const TimeUnit& unit) const;
+    void ResetStatistics();
+
+protected:
+    struct PooledEngine
+    {
+        std::unique_ptr<PhysiologyEngine> engine;
+        bool                              active;
+    };
+    struct Worker
+    {
+        std::mutex         mutex;
+        std::deque<size_t> engines;// Indexes of the engines this thread has yet to advance in this batch
+    };
+
+    void ThreadLoop(size_t thread);
+    bool NextEngine(size_t thread, size_t& engine);
+    void AdvanceEngine(size_t engine);
+
+    std::vector<std::unique_ptr<PooledEngine>> m_Engines;
+    std::vector<std::unique_ptr<Worker>>       m_Workers;
+    std::vector<std::thread>                   m_Threads;
+
+    // Batch state
+    mutable std::mutex                         m_BatchMutex;
+    std::condition_variable                    m_BatchStarted;
+    std::condition_variable                    m_BatchDone;
+    uint64_t                                   m_Batch;
+    bool                                       m_Advancing;
+    bool                                       m_Stop;
+    double                                     m_BatchTime_s;
+    std::atomic<size_t>                        m_Remaining;
+    std::atomic<bool>                          m_BatchFailed;
+    std::function<void(bool)>                  m_OnComplete;
+    std::chrono::steady_clock::time_point      m_BatchStart;
+
+    // Statistics
+    double                                     m_SimulatedTime_s;
+    double                                     m_WallTime_s;
+};
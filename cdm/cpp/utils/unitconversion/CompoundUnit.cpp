@@ -7,6 +7,14 @@
 //----------------------------------------------------------------------------
 #include "stdafx.h"
 #include "utils/unitconversion/UCCommon.h"
+#include <atomic>
+
+//----------------------------------------------------------------------------
+uint64_t CCompoundUnit::NewRevision()
+{
+  static std::atomic<uint64_t> revision(0);
+  return ++revision;
+}
 
 //----------------------------------------------------------------------------
 void CCompoundUnit::ParseString(const std::string &unitString)
@@ -432,6 +440,7 @@ void CCompoundUnit::ComputeBigness() const
 //----------------------------------------------------------------------------
 CCompoundUnitElement & CCompoundUnit::AddElement(const CCompoundUnitElement &elem)
 {
+  m_uRevision = NewRevision();
   m_CUEVec.push_back(elem);
   m_bStaleBigness = true;
   m_bStaleDimension = true;
@@ -441,6 +450,7 @@ CCompoundUnitElement & CCompoundUnit::AddElement(const CCompoundUnitElement &ele
 //----------------------------------------------------------------------------
 CCompoundUnit & CCompoundUnit::operator*=(const CCompoundUnit &rhs)
 {
+  m_uRevision = NewRevision();
   // Let's try to do this semi-intelligently. If we encounter
   // a compound unit element on the right hand side that denotes
   // the SAME UNIT (including prefix) as one on the left hand side, then add the 
@@ -514,6 +524,7 @@ CCompoundUnit & CCompoundUnit::operator*=(const CCompoundUnit &rhs)
 //----------------------------------------------------------------------------
 CCompoundUnit & CCompoundUnit::operator/=(const CCompoundUnit &rhs)
 {
+  m_uRevision = NewRevision();
   // Let's try to do this semi-intelligently. If we encounter
   // a compound unit element on the right hand side that denotes
   // the SAME UNIT as one on the left hand side, then add the exponents
@@ -593,6 +604,7 @@ CCompoundUnit & CCompoundUnit::operator/=(const CCompoundUnit &rhs)
 //----------------------------------------------------------------------------
 CCompoundUnit & CCompoundUnit::Raise(CCompoundUnitElement::ExponentType exp)
 {
+  m_uRevision = NewRevision();
   for (auto CUERef = m_CUEVec.begin(); CUERef != m_CUEVec.end(); CUERef++)
   {
     CUERef->MultExponent(exp);
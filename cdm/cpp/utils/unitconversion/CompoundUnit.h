@@ -45,14 +45,14 @@ public:
   // Default ctor
   CCompoundUnit()
     :m_CUD(nullptr), m_dBigness(1.0), m_bStaleBigness(true), m_bStaleDimension(true), 
-    m_bDBFlag(false), m_bExplicitDBFlag(false), m_bExplicitNonDBFlag(false)
+    m_bDBFlag(false), m_bExplicitDBFlag(false), m_bExplicitNonDBFlag(false), m_uRevision(NewRevision())
   {
   };
 
   // Construct directly from a unit string specification
   CCompoundUnit(const std::string &unitString)
     :m_CUD(nullptr), m_dBigness(1.0), m_bStaleBigness(true), m_bStaleDimension(true), 
-    m_bDBFlag(false), m_bExplicitDBFlag(false), m_bExplicitNonDBFlag(false)
+    m_bDBFlag(false), m_bExplicitDBFlag(false), m_bExplicitNonDBFlag(false), m_uRevision(NewRevision())
   {
     ParseString(unitString);
   }
@@ -61,7 +61,7 @@ public:
   CCompoundUnit(const CCompoundUnit &src) // Copy constructor
     :m_CUEVec(src.m_CUEVec), m_dBigness(src.m_dBigness), m_bStaleBigness(src.m_bStaleBigness),
     m_strUnit(src.m_strUnit), m_bStaleDimension(src.m_bStaleDimension),m_bDBFlag(src.m_bDBFlag),
-    m_bExplicitDBFlag(src.m_bExplicitDBFlag), m_bExplicitNonDBFlag(src.m_bExplicitNonDBFlag)
+    m_bExplicitDBFlag(src.m_bExplicitDBFlag), m_bExplicitNonDBFlag(src.m_bExplicitNonDBFlag), m_uRevision(NewRevision())
   {
     // In the initializer list, I'm assuming that initializing one vector with another 
     // copies the vector correctly. For the CUnitDimension object, we can't just
@@ -144,6 +144,7 @@ public:
       }
       m_bStaleBigness = rhs.m_bStaleBigness;
       m_bStaleDimension = rhs.m_bStaleDimension;
+      m_uRevision = NewRevision();
     }
     return *this;
   };
@@ -213,6 +214,7 @@ public:
     m_bExplicitDBFlag = true;
     m_bExplicitNonDBFlag = false;
     m_bDBFlag = true;
+    m_uRevision = NewRevision();
   }
 
   void DecibelModeOff()
@@ -221,6 +223,7 @@ public:
     m_bExplicitDBFlag = false;
     m_bExplicitNonDBFlag = true;
     m_bDBFlag = false;
+    m_uRevision = NewRevision();
   }
 
   // Used for incrementally building up a CompoundUnit
@@ -245,6 +248,7 @@ public:
     m_bDBFlag = false;
     m_CUEVec.clear();
     m_strUnit.clear();
+    m_uRevision = NewRevision();
   }
 
   // Build up my internals from a string specification.
@@ -252,12 +256,17 @@ public:
 
   std::string GetString() const {return m_strUnit;}
 
+  // Unique to this object and its current definition, it changes whenever the unit is modified.
+  // Unlike the address of the object, it is never reused, so it can safely key cached conversion factors.
+  uint64_t GetRevision() const { return m_uRevision; }
+
   // Auxiliary output routine
   std::ostream & PrintSelf(std::ostream &output) const;
 
 protected:
   void BuildDimension() const;
   void ComputeBigness() const;
+  static uint64_t NewRevision();
 
 private:
   // Many of these are declared "mutable" so that they can be changed on a "const"
@@ -274,6 +283,7 @@ private:
   mutable bool m_bExplicitNonDBFlag;
   mutable bool m_bExplicitDBFlag;
   mutable bool m_bDBFlag;
+  uint64_t m_uRevision;
 };
 
 inline CCompoundUnit pow(const CCompoundUnit &baseref, CCompoundUnitElement::ExponentType exp)
@@ -101,6 +101,15 @@ PulseController::PulseController(Logger* logger) : Loggable(logger)
   m_Compartments = std::unique_ptr<PulseCompartments>(new PulseCompartments(*this));
 
   m_Circuits = std::unique_ptr<PulseCircuits>(new PulseCircuits(*this));
+  // Compartment aggregates are cached until our circuits change
+  m_Compartments->SetCircuitEpoch(&m_Circuits->GetCircuitEpoch());
+
+  m_Profiler = std::unique_ptr<SEEngineProfiler>(new SEEngineProfiler(GetLogger()));
+  m_TimeStepProfileSlot = m_Profiler->RegisterSlot("Engine", "TimeStep");
+
+  m_Scheduler = std::unique_ptr<SystemScheduler>(new SystemScheduler(GetLogger()));
+  m_Scheduler->SetProfiler(m_Profiler.get());
+  SetupScheduler();
 }
 
 DataTrack& PulseController::GetDataTrack()
@@ -140,6 +149,9 @@ bool PulseController::Initialize(const PulseConfiguration* config)
     Info("Merging Provided Configuration");
     m_Config->Merge(*config);
   }
+  CheckSystemUpdateIntervals();
+  ResetSystemUpdates();
+  m_Actions->RecordProcessedActions(m_Config->IsRecordingProcessedActions());
 
   if (!m_Config->IsPDEnabled())
     Info("PD IS DISABLED!!!!");
@@ -852,59 +864,160 @@ void PulseController::AtSteadyState(EngineState state)
   m_ECG->AtSteadyState();
 }
 
+void PulseController::SetupScheduler()
+{
+  typedef SystemScheduler::Phase Phase;
+  const std::vector<std::string> engine = { SystemScheduler::Engine };
+  const std::vector<std::string> none;
+  // Circuits only ever touched by the system that solves them, everything else is the Engine
+  const std::string cardiovascularCircuit = "CardiovascularCircuit";
+  const std::string respiratoryCircuit = "RespiratoryCircuit";
+  const std::string temperatureCircuit = "TemperatureCircuit";
+  // Vascular blood gases, split over enough tasks to keep every worker busy
+  const std::string bloodGases = "BloodGases";
+  const size_t bloodGasTasks = 8;
+  SystemScheduler& s = *m_Scheduler;
+  s.Clear();
+
+  // Slow systems skip the time steps they are not updated in, their next update covers the skipped time
+  m_SystemUpdates.clear();
+  auto updatedBy = [this](const std::string& name, PulseSystem& system)
+  {
+    SystemUpdate u;
+    u.name = name;
+    u.system = &system;
+    u.elapsedSteps = 0;
+    u.updating = true;
+    m_SystemUpdates.push_back(u);
+    size_t idx = m_SystemUpdates.size() - 1;
+    return [this, idx](std::function<void()> task) { return [this, idx, task]() { if (m_SystemUpdates[idx].updating) task(); }; };
+  };
+  auto endocrineUpdate = updatedBy("Endocrine", *m_EndocrineSystem);
+  auto energyUpdate = updatedBy("Energy", *m_EnergySystem);
+  auto gastrointestinalUpdate = updatedBy("Gastrointestinal", *m_GastrointestinalSystem);
+  auto hepaticUpdate = updatedBy("Hepatic", *m_HepaticSystem);
+  auto renalUpdate = updatedBy("Renal", *m_RenalSystem);
+
+  s.AddTask(Phase::PreProcess, "Environment", [this]() { m_Environment->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Cardiovascular", [this]() { m_CardiovascularSystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Inhaler", [this]() { m_Inhaler->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Respiratory", [this]() { m_RespiratorySystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "AnesthesiaMachine", [this]() { m_AnesthesiaMachine->PreProcess(); }, engine, engine);
+  // Circuit sources only last a time step, so slow systems set theirs every time step from their last update
+  s.AddTask(Phase::PreProcess, "GastrointestinalSecretion", [this]() { m_GastrointestinalSystem->GastricSecretion(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Gastrointestinal", gastrointestinalUpdate([this]() { m_GastrointestinalSystem->PreProcess(); }), engine, engine);
+  s.AddTask(Phase::PreProcess, "GastrointestinalAbsorption", [this]() { m_GastrointestinalSystem->ChymeAbsorption(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Hepatic", hepaticUpdate([this]() { m_HepaticSystem->PreProcess(); }), engine, engine);
+  s.AddTask(Phase::PreProcess, "Renal", [this]() { m_RenalSystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Nervous", [this]() { m_NervousSystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Energy", energyUpdate([this]() { m_EnergySystem->PreProcess(); }), engine, engine);
+  s.AddTask(Phase::PreProcess, "EnergySweat", [this]() { m_EnergySystem->Sweat(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Endocrine", endocrineUpdate([this]() { m_EndocrineSystem->PreProcess(); }), engine, engine);
+  s.AddTask(Phase::PreProcess, "Drugs", [this]() { m_DrugSystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "Tissue", [this]() { m_TissueSystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "BloodChemistry", [this]() { m_BloodChemistrySystem->PreProcess(); }, engine, engine);
+  s.AddTask(Phase::PreProcess, "ECG", [this]() { m_ECG->PreProcess(); }, engine, engine);
+
+  // The temperature circuit is set up in PreProcess and only read again by Energy,
+  // so it can be solved while the systems before Energy process
+  s.AddTask(Phase::Process, "Environment", [this]() { m_Environment->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "Cardiovascular", [this]() { m_CardiovascularSystem->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "Inhaler", [this]() { m_Inhaler->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "Respiratory", [this]() { m_RespiratorySystem->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "AnesthesiaMachine", [this]() { m_AnesthesiaMachine->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "Gastrointestinal", gastrointestinalUpdate([this]() { m_GastrointestinalSystem->Process(); }), engine, engine);
+  s.AddTask(Phase::Process, "Hepatic", hepaticUpdate([this]() { m_HepaticSystem->Process(); }), engine, engine);
+  s.AddTask(Phase::Process, "Renal", renalUpdate([this]() { m_RenalSystem->Process(); }), engine, engine);
+  s.AddTask(Phase::Process, "Nervous", [this]() { m_NervousSystem->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "EnergyTemperatureCircuit", energyUpdate([this]() { m_EnergySystem->SolveTemperatureCircuit(); }), none, { temperatureCircuit });
+  s.AddTask(Phase::Process, "Energy", energyUpdate([this]() { m_EnergySystem->CalculateVitalSigns(); }), { SystemScheduler::Engine, temperatureCircuit }, engine);
+  s.AddTask(Phase::Process, "Endocrine", endocrineUpdate([this]() { m_EndocrineSystem->Process(); }), engine, engine);
+  s.AddTask(Phase::Process, "Drugs", [this]() { m_DrugSystem->Process(); }, engine, engine);
+  // Blood gases of each vascular compartment are distributed independently of the others, and of anything
+  // outside the vascular compartments, so every worker takes compartments from the same batch at once
+  s.AddTask(Phase::Process, "TissueSubstanceTransport", [this, bloodGasTasks]() { m_TissueSystem->ProcessSubstanceTransport(bloodGasTasks); }, engine, { SystemScheduler::Engine, bloodGases });
+  for (size_t i = 0; i < bloodGasTasks; i++)
+    s.AddTask(Phase::Process, "TissueBloodGases" + std::to_string(i), [this, i]() { m_TissueSystem->ProcessBloodGases(i); }, { bloodGases }, { bloodGases + std::to_string(i) });
+  s.AddTask(Phase::Process, "Tissue", [this]() { m_TissueSystem->ProcessVitals(); }, { SystemScheduler::Engine, bloodGases }, { SystemScheduler::Engine, bloodGases });
+  s.AddTask(Phase::Process, "BloodChemistry", [this]() { m_BloodChemistrySystem->Process(); }, engine, engine);
+  s.AddTask(Phase::Process, "ECG", [this]() { m_ECG->Process(); }, engine, engine);
+
+  // Moving each circuit to its next state is independent of the others
+  s.AddTask(Phase::PostProcess, "Environment", [this]() { m_Environment->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "Cardiovascular", [this]() { m_CardiovascularSystem->PostProcess(); }, none, { cardiovascularCircuit });
+  s.AddTask(Phase::PostProcess, "Inhaler", [this]() { m_Inhaler->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "Respiratory", [this]() { m_RespiratorySystem->PostProcess(); }, none, { respiratoryCircuit });
+  s.AddTask(Phase::PostProcess, "AnesthesiaMachine", [this]() { m_AnesthesiaMachine->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "Gastrointestinal", gastrointestinalUpdate([this]() { m_GastrointestinalSystem->PostProcess(); }), engine, engine);
+  s.AddTask(Phase::PostProcess, "Hepatic", hepaticUpdate([this]() { m_HepaticSystem->PostProcess(); }), engine, engine);
+  s.AddTask(Phase::PostProcess, "Renal", [this]() { m_RenalSystem->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "Nervous", [this]() { m_NervousSystem->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "Energy", energyUpdate([this]() { m_EnergySystem->PostProcess(); }), none, { temperatureCircuit });
+  s.AddTask(Phase::PostProcess, "Endocrine", endocrineUpdate([this]() { m_EndocrineSystem->PostProcess(); }), engine, engine);
+  s.AddTask(Phase::PostProcess, "Drugs", [this]() { m_DrugSystem->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "Tissue", [this]() { m_TissueSystem->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "BloodChemistry", [this]() { m_BloodChemistrySystem->PostProcess(); }, engine, engine);
+  s.AddTask(Phase::PostProcess, "ECG", [this]() { m_ECG->PostProcess(); }, engine, engine);
+}
+
+void PulseController::ScheduleSystemUpdates()
+{
+  // Slow systems are only updated every few time steps once active, stabilization updates every system every time step
+  const std::map<std::string, unsigned int>& intervals = m_Config->GetSystemUpdateIntervals();
+  double dt_s = m_Config->GetTimeStep(TimeUnit::s);
+  for (SystemUpdate& u : m_SystemUpdates)
+  {
+    unsigned int interval = 1;
+    if (m_State == EngineState::Active && !intervals.empty())
+    {
+      auto itr = intervals.find(u.name);
+      if (itr != intervals.end())
+        interval = itr->second;
+    }
+    u.elapsedSteps++;
+    u.updating = u.elapsedSteps >= interval;
+    if (u.updating)
+    {// Integrate over every time step since the last update
+      u.system->SetUpdateTimeStep(u.elapsedSteps * dt_s);
+      u.elapsedSteps = 0;
+    }
+  }
+}
+
+void PulseController::ResetSystemUpdates()
+{
+  // Steps counted toward an update of the previous state do not carry over to this one
+  for (SystemUpdate& u : m_SystemUpdates)
+  {
+    u.elapsedSteps = 0;
+    u.updating = true;
+  }
+}
+
+void PulseController::CheckSystemUpdateIntervals()
+{
+  for (auto itr : m_Config->GetSystemUpdateIntervals())
+  {
+    bool found = false;
+    for (const SystemUpdate& u : m_SystemUpdates)
+      found |= u.name == itr.first;
+    if (!found)
+      Warning("System " + itr.first + " is updated every time step, ignoring its configured update interval");
+  }
+}
+
 void PulseController::PreProcess()
 {
-  m_Environment->PreProcess();
-  m_CardiovascularSystem->PreProcess();
-  m_Inhaler->PreProcess();
-  m_RespiratorySystem->PreProcess();
-  m_AnesthesiaMachine->PreProcess();
-  m_GastrointestinalSystem->PreProcess();
-  m_HepaticSystem->PreProcess();
-  m_RenalSystem->PreProcess();
-  m_NervousSystem->PreProcess();
-  m_EnergySystem->PreProcess();
-  m_EndocrineSystem->PreProcess();
-  m_DrugSystem->PreProcess();
-  m_TissueSystem->PreProcess();
-  m_BloodChemistrySystem->PreProcess();
-  m_ECG->PreProcess();
+  ScheduleSystemUpdates();
+  m_Scheduler->Run(SystemScheduler::Phase::PreProcess);
 }
 void PulseController::Process()
 {
-  m_Environment->Process();
-  m_CardiovascularSystem->Process();
-  m_Inhaler->Process();
-  m_RespiratorySystem->Process();
-  m_AnesthesiaMachine->Process();
-  m_GastrointestinalSystem->Process();
-  m_HepaticSystem->Process();
-  m_RenalSystem->Process();
-  m_NervousSystem->Process();
-  m_EnergySystem->Process();
-  m_EndocrineSystem->Process();
-  m_DrugSystem->Process();
-  m_TissueSystem->Process();
-  m_BloodChemistrySystem->Process();
-  m_ECG->Process();
+  m_Scheduler->Run(SystemScheduler::Phase::Process);
 }
 void PulseController::PostProcess()
 {
-  m_Environment->PostProcess();
-  m_CardiovascularSystem->PostProcess();
-  m_Inhaler->PostProcess();
-  m_RespiratorySystem->PostProcess();
-  m_AnesthesiaMachine->PostProcess();
-  m_GastrointestinalSystem->PostProcess();
-  m_HepaticSystem->PostProcess();
-  m_RenalSystem->PostProcess();
-  m_NervousSystem->PostProcess();
-  m_EnergySystem->PostProcess();
-  m_EndocrineSystem->PostProcess();
-  m_DrugSystem->PostProcess();
-  m_TissueSystem->PostProcess();
-  m_BloodChemistrySystem->PostProcess();
-  m_ECG->PostProcess();
+  m_Scheduler->Run(SystemScheduler::Phase::PostProcess);
 }
 
 bool PulseController::GetPatientAssessment(SEPatientAssessment& assessment)
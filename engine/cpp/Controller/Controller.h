@@ -6,6 +6,7 @@
 #include "Controller/Circuits.h"
 #include "Controller/Compartments.h"
 #include "Controller/Substances.h"
+#include "Controller/SystemScheduler.h"
 
 // CDM 
 #include "scenario/SEActionManager.h"
@@ -14,6 +15,7 @@
 
 #include "utils/DataTrack.h"
 #include "engine/SEEngineTracker.h"
+#include "engine/SEEngineProfiler.h"
 
 // Pulse
 #include "Systems/BloodChemistry.h"
@@ -106,6 +108,11 @@ public:
   cdm::eSwitch                            GetIntubation() { return m_Intubation; }
   void                                    SetIntubation(cdm::eSwitch s);
 
+  // Set the worker count to run independent system work of a time step on multiple threads
+  SystemScheduler&                        GetScheduler() { return *m_Scheduler; }
+  // Wall time of each part of a time step, recorded when enabled
+  SEEngineProfiler&                       GetProfiler() { return *m_Profiler; }
+
   bool CreateCircuitsAndCompartments();
 protected:
   void SetupCardiovascular();
@@ -127,6 +134,14 @@ protected:
   void PreProcess();
   void Process();
   void PostProcess();
+  // Declares what each system reads and writes in each phase
+  void SetupScheduler();
+  // Decides which slow systems are updated in this time step, and the time their update covers
+  void ScheduleSystemUpdates();
+  // Starts every slow system on a new update interval, for a new or newly loaded state
+  void ResetSystemUpdates();
+  // Warns about configured update intervals of systems that are always updated every time step
+  void CheckSystemUpdateIntervals();
 
   void ForwardFatal(const std::string&  msg, const std::string&  origin);
 
@@ -169,6 +184,22 @@ protected:
 
   std::unique_ptr<SEPatient>                                    m_Patient;
 
+  std::unique_ptr<SEEngineProfiler>                             m_Profiler;
+  size_t                                                        m_TimeStepProfileSlot;
+
+  // Systems that can be updated less often than every time step, see PulseConfiguration::GetSystemUpdateInterval
+  struct SystemUpdate
+  {
+    std::string  name;
+    PulseSystem* system;
+    unsigned int elapsedSteps;// Time steps since the last update
+    bool         updating;// Updated in the current time step
+  };
+  std::vector<SystemUpdate>                                     m_SystemUpdates;
+
+  // Last, so its threads are stopped before any system is destroyed
+  std::unique_ptr<SystemScheduler>                              m_Scheduler;
+
   // Flag to destroy the logger or not                          
   bool                                                          myLogger;
 };
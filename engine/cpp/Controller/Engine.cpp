@@ -5,6 +5,7 @@ PROTO_PUSH
 #include "bind/engine/EngineState.pb.h"
 PROTO_POP
 #include "Controller/Engine.h"
+#include "Controller/StabilizationCache.h"
 #include "patient/SEPatient.h"
 #include "circuit/SECircuit.h"
 #include "compartment/SECompartmentManager.h"
@@ -13,6 +14,7 @@ PROTO_POP
 #include "scenario/SECondition.h"
 
 #include "utils/FileUtils.h"
+#include "utils/ProtobufFile.h"
 
 #include "scenario/SESerializeState.h"
 #include "patient/actions/SEPatientAssessmentRequest.h"
@@ -65,6 +67,11 @@ SEEngineTracker* PulseEngine::GetEngineTracker()
   return &m_EngineTrack;
 }
 
+SEEngineProfiler* PulseEngine::GetProfiler()
+{
+  return m_Profiler.get();
+}
+
 
 void MyLogHandler(google::protobuf::LogLevel level, const char* filename, int line, const std::string& message)
 {
@@ -74,17 +81,12 @@ void MyLogHandler(google::protobuf::LogLevel level, const char* filename, int li
 bool PulseEngine::LoadStateFile(const std::string& filename, const SEScalarTime* simTime, const SEEngineConfiguration* config)
 {
   pulse::StateData src;
-  std::ifstream file_stream(filename, std::ios::in);
-  std::string fmsg((std::istreambuf_iterator<char>(file_stream)), std::istreambuf_iterator<char>());
   google::protobuf::SetLogHandler(MyLogHandler);
-  if (fmsg.empty() || !google::protobuf::TextFormat::ParseFromString(fmsg, &src))
+  // Binary or ASCII, based on the file header
+  if (!LoadProtobufFile(filename, src, GetLogger()))
     return false;
   LoadState(src, simTime);
   return true;
-
-  // If its a binary string in the file...
-  //std::ifstream binary_istream(patientFile, std::ios::in | std::ios::binary);
-  //src.ParseFromIstream(&binary_istream);
 }
 
 bool PulseEngine::LoadState(const google::protobuf::Message& state, const SEScalarTime* simTime, const SEEngineConfiguration* config)
@@ -195,6 +197,8 @@ bool PulseEngine::LoadState(const google::protobuf::Message& state, const SEScal
     m_ss << "PulseState must have a compartment manager" << std::endl;
   else
     SECompartmentManager::Load(peState->compartmentmanager(), *m_Compartments, m_Circuits.get());
+  // Compartments were recreated, and any solutions cached for them do not apply to this state
+  m_SaturationCalculator->ClearCompartmentCache();
   // Configuration //
   if (!peState->has_configuration())
     m_ss << "PulseState must have a configuration" << std::endl;
@@ -210,6 +214,9 @@ bool PulseEngine::LoadState(const google::protobuf::Message& state, const SEScal
     }
     m_Config->Merge(*peConfig);
   }
+  CheckSystemUpdateIntervals();
+  ResetSystemUpdates();
+  m_Actions->RecordProcessedActions(m_Config->IsRecordingProcessedActions());
 
   /////////////
   // Systems //
@@ -339,18 +346,121 @@ std::unique_ptr<google::protobuf::Message> PulseEngine::SaveState(const std::str
   if (!filename.empty())
   {
     CreateFilePath(filename);
-    std::string content;
-    google::protobuf::TextFormat::PrintToString(*state, &content);
-    std::ofstream ascii_ostream(filename, std::ios::out | std::ios::trunc);
-    ascii_ostream << content;
-    ascii_ostream.flush();
-    ascii_ostream.close();
+    if (!SaveProtobufFile(*state, filename, GetSerializationFormat(filename), GetLogger()))
+    {
+      Error("Unable to save state to " + filename);
+      delete state;
+      return nullptr;
+    }
   }
 
   std::unique_ptr<google::protobuf::Message> msg(state);
   return msg;
 }
 
+bool PulseEngine::ForkInto(PhysiologyEngine& engine)
+{
+  PulseEngine* dst = dynamic_cast<PulseEngine*>(&engine);
+  if (dst == nullptr)
+  {
+    Error("Can only fork into another Pulse engine");
+    return false;
+  }
+  if (dst == this)
+    return true;
+  if (!IsReady())
+    return false;
+  if (dst->m_State != EngineState::NotReady && CopyState(*dst))
+    return true;
+
+  // Different circuits, compartments or substances, build the engine from a full state instead
+  std::unique_ptr<google::protobuf::Message> state = SaveState();
+  static_cast<pulse::StateData*>(state.get())->clear_datarequestmanager();
+  return dst->LoadState(*state);
+}
+
+bool PulseEngine::CopyState(PulseEngine& dst)
+{
+  // Objects are matched by index, so the substances must line up before anything is touched
+  const std::vector<SESubstance*>& srcSubs = m_Substances->GetActiveSubstances();
+  const std::vector<SESubstance*>& dstSubs = dst.m_Substances->GetActiveSubstances();
+  if (srcSubs.size() != dstSubs.size())
+    return false;
+  for (size_t i = 0; i < srcSubs.size(); i++)
+  {
+    if (srcSubs[i]->GetName() != dstSubs[i]->GetName())
+      return false;
+  }
+  for (SESubstanceCompound* c : m_Substances->GetActiveCompounds())
+  {
+    if (dst.m_Substances->GetCompound(c->GetName()) == nullptr)
+      return false;
+  }
+  // Circuits are checked and copied first, if the compartments then differ
+  // the caller loads a full state over everything we have copied
+  if (!SECircuitManager::CopyState(*m_Circuits, *dst.m_Circuits) ||
+      !SECompartmentManager::CopyState(*m_Compartments, *dst.m_Compartments))
+    return false;
+
+  dst.m_State = EngineState::NotReady;
+  // Systems and actions depend on the configuration, so it goes first
+  PulseConfiguration::Copy(*m_Config, *dst.m_Config);
+  dst.CheckSystemUpdateIntervals();
+  dst.ResetSystemUpdates();
+  dst.m_Actions->RecordProcessedActions(dst.m_Config->IsRecordingProcessedActions());
+
+  // Reset keeps the substance objects our compartments point to
+  dst.m_Substances->Reset();
+  for (size_t i = 0; i < srcSubs.size(); i++)
+  {
+    SESubstance::Copy(*srcSubs[i], *dstSubs[i]);
+    dst.m_Substances->AddActiveSubstance(*dstSubs[i]);
+  }
+  for (SESubstanceCompound* c : m_Substances->GetActiveCompounds())
+  {
+    SESubstanceCompound* cmpd = dst.m_Substances->GetCompound(c->GetName());
+    SESubstanceCompound::Copy(*c, *cmpd, *dst.m_Substances);
+    dst.m_Substances->AddActiveCompound(*cmpd);
+  }
+  // Warm started blood gas solves continue from our last solutions
+  SaturationCalculator::Copy(*m_SaturationCalculator, *dst.m_SaturationCalculator);
+
+  dst.m_CurrentTime->Set(*m_SimulationTime);
+  dst.m_SimulationTime->Set(*m_SimulationTime);
+  dst.m_AirwayMode = m_AirwayMode;
+  dst.m_Intubation = m_Intubation;
+
+  SEPatient::Copy(*m_Patient, *dst.m_Patient);
+  // The managers bind the copied conditions and actions to the destination substances
+  SEConditionManager::Copy(*m_Conditions, *dst.m_Conditions);
+  SEActionManager::Copy(*m_Actions, *dst.m_Actions);
+
+  // Systems set themselves up against the copied compartments
+  BloodChemistry::Copy(*m_BloodChemistrySystem, *dst.m_BloodChemistrySystem);
+  Cardiovascular::Copy(*m_CardiovascularSystem, *dst.m_CardiovascularSystem);
+  Drugs::Copy(*m_DrugSystem, *dst.m_DrugSystem);
+  Endocrine::Copy(*m_EndocrineSystem, *dst.m_EndocrineSystem);
+  Energy::Copy(*m_EnergySystem, *dst.m_EnergySystem);
+  Gastrointestinal::Copy(*m_GastrointestinalSystem, *dst.m_GastrointestinalSystem);
+  Hepatic::Copy(*m_HepaticSystem, *dst.m_HepaticSystem);
+  Nervous::Copy(*m_NervousSystem, *dst.m_NervousSystem);
+  Renal::Copy(*m_RenalSystem, *dst.m_RenalSystem);
+  Respiratory::Copy(*m_RespiratorySystem, *dst.m_RespiratorySystem);
+  Tissue::Copy(*m_TissueSystem, *dst.m_TissueSystem);
+  Environment::Copy(*m_Environment, *dst.m_Environment);
+  AnesthesiaMachine::Copy(*m_AnesthesiaMachine, *dst.m_AnesthesiaMachine);
+  ECG::Copy(*m_ECG, *dst.m_ECG);
+  Inhaler::Copy(*m_Inhaler, *dst.m_Inhaler);
+
+  // Make sure links are correct with our modes
+  dst.m_Compartments->UpdateAirwayGraph();
+  dst.m_Compartments->GetActiveRespiratoryGraph();
+  dst.m_Compartments->GetActiveAerosolGraph();
+
+  dst.m_State = EngineState::Active;
+  return true;
+}
+
 bool PulseEngine::InitializeEngine(const std::string& patientFile, const std::vector<const SECondition*>* conditions, const SEEngineConfiguration* config)
 {
   std::string pFile = patientFile;
@@ -402,6 +512,36 @@ bool PulseEngine::InitializeEngine(const std::vector<const SECondition*>* condit
     return false;
   }
 
+  // Reuse a state stabilized from the same patient, conditions, configuration and substances
+  std::string cacheKey;
+  if (PulseStabilizationCache::IsEnabled() && !m_Config->GetStabilization()->IsTrackingStabilization())
+  {
+    cacheKey = PulseStabilizationCache::ComputeKey(*m_Patient, conditions, *m_Config, *m_Substances);
+    std::string stateFile = PulseStabilizationCache::GetStateFile(cacheKey);
+    if (std::ifstream(stateFile).good())
+    {
+      pulse::StateData state;
+      if (LoadProtobufFile(stateFile, state, GetLogger()) && LoadState(state))
+      {
+        Info("Stabilization cache hit, loaded " + stateFile);
+        m_EngineTrack.ForceConnection();
+        m_Patient->ForwardEvents(m_EventHandler);
+        m_AnesthesiaMachine->ForwardEvents(m_EventHandler);
+        m_Circuits->SetReadOnly(true);
+        return true;
+      }
+      Warning("Unable to load cached state " + stateFile + ", removing it from the cache");
+      PulseStabilizationCache::Invalidate(cacheKey);
+      // Start over, the failed load left the engine in a cleared state
+      m_State = EngineState::Initialization;
+      if (!PulseController::Initialize(pConfig))
+        return false;
+      m_Patient->ForwardEvents(nullptr);
+      m_AnesthesiaMachine->ForwardEvents(nullptr);
+    }
+    Info("Stabilization cache miss, the stabilized state will be saved to " + stateFile);
+  }
+
   m_State = EngineState::InitialStabilization;
   if (!m_Config->GetStabilization()->StabilizeRestingState(*this))
     return false;  
@@ -452,6 +592,15 @@ bool PulseEngine::InitializeEngine(const std::vector<const SECondition*>* condit
   // Use Quantity/Potential/Flux Sources
   m_Circuits->SetReadOnly(true);
 
+  if (!cacheKey.empty())
+  {
+    std::unique_ptr<google::protobuf::Message> state = SaveState();
+    // Data requests belong to whoever initializes the engine, not to the stabilized state
+    static_cast<pulse::StateData*>(state.get())->clear_datarequestmanager();
+    if (!PulseStabilizationCache::SaveState(*state, cacheKey, GetLogger()))
+      Warning("Unable to save the stabilized state to the cache");
+  }
+
   return true;
 }
 
@@ -472,6 +621,7 @@ void PulseEngine::AdvanceModelTime()
   if(m_Patient->IsEventActive(cdm::PatientData_eEvent_IrreversibleState))
     return;  
 
+  SEEngineProfiler::ScopedTimer timer(m_Profiler.get(), m_TimeStepProfileSlot);
   PreProcess();
   Process();
   PostProcess();
@@ -503,7 +653,8 @@ bool PulseEngine::ProcessAction(const SEAction& action)
     {
       if (serialize->HasFilename())
       {
-        SaveState(serialize->GetFilename());
+        if (SaveState(serialize->GetFilename()) == nullptr)
+          return false;
       }
       else
       {
@@ -511,7 +662,8 @@ bool PulseEngine::ProcessAction(const SEAction& action)
         MKDIR("./states");
         ss << "./states/" << m_Patient->GetName() << "@" << GetSimulationTime(TimeUnit::s) << "s.pba";
         Info("Saving " + ss.str());
-        SaveState(ss.str());
+        if (SaveState(ss.str()) == nullptr)
+          return false;
         // Debug code to make sure things are consistent
         //LoadStateFile(ss.str());
         //SaveState("./states/AfterSave.pba");
@@ -539,6 +691,7 @@ bool PulseEngine::ProcessAction(const SEAction& action)
         m_ss << "PFT@" << GetSimulationTime(TimeUnit::s) << "s";
         pftFile = Replace(pftFile, "Results", m_ss.str());
         pftFile = Replace(pftFile, ".txt", ".pba");
+        pftFile = Replace(pftFile, BinaryResultsWriter::Extension, ".pba");
         m_ss << "PulmonaryFunctionTest@" << GetSimulationTime(TimeUnit::s) << "s.pba";
         pft.SaveFile(pftFile);
         break;
@@ -554,6 +707,7 @@ bool PulseEngine::ProcessAction(const SEAction& action)
         m_ss << "Urinalysis@" << GetSimulationTime(TimeUnit::s) << "s";
         upanFile = Replace(upanFile, "Results", m_ss.str());
         upanFile = Replace(upanFile, ".txt", ".pba");
+        upanFile = Replace(upanFile, BinaryResultsWriter::Extension, ".pba");
         m_ss << "Urinalysis@" << GetSimulationTime(TimeUnit::s) << "s.pba";
         upan.SaveFile(upanFile);
         break;
@@ -569,6 +723,7 @@ bool PulseEngine::ProcessAction(const SEAction& action)
         m_ss << "CBC@" << GetSimulationTime(TimeUnit::s) << "s";
         cbcFile = Replace(cbcFile, "Results", m_ss.str());
         cbcFile = Replace(cbcFile, ".txt", ".pba");
+        cbcFile = Replace(cbcFile, BinaryResultsWriter::Extension, ".pba");
         m_ss << "CompleteBloodCount@" << GetSimulationTime(TimeUnit::s) << "s.pba";
         cbc.SaveFile(cbcFile);
         break;
@@ -584,6 +739,7 @@ bool PulseEngine::ProcessAction(const SEAction& action)
         m_ss << "CMP@" << GetSimulationTime(TimeUnit::s) << "s";
         mpFile = Replace(mpFile, "Results", m_ss.str());
         mpFile = Replace(mpFile, ".txt", ".pba");
+        mpFile = Replace(mpFile, BinaryResultsWriter::Extension, ".pba");
         m_ss << "ComprehensiveMetabolicPanel@" << GetSimulationTime(TimeUnit::s) << "s.pba";
         mp.SaveFile(mpFile);
         break;
@@ -34,9 +34,11 @@ public:
   virtual bool LoadStateFile(const std::string& file, const SEScalarTime* simTime = nullptr, const SEEngineConfiguration* config = nullptr);
   virtual bool LoadState(const google::protobuf::Message& state, const SEScalarTime* simTime = nullptr, const SEEngineConfiguration* config = nullptr);
   virtual std::unique_ptr<google::protobuf::Message> SaveState(const std::string& file = "");
+  virtual bool ForkInto(PhysiologyEngine& engine);
 
   virtual Logger* GetLogger();
   virtual SEEngineTracker* GetEngineTracker();
+  virtual SEEngineProfiler* GetProfiler();
 
   virtual bool InitializeEngine(const std::string& patientFile, const std::vector<const SECondition*>* conditions = nullptr, const SEEngineConfiguration* config = nullptr);
   virtual bool InitializeEngine(const SEPatient& patient, const std::vector<const SECondition*>* conditions = nullptr, const SEEngineConfiguration* config = nullptr);
@@ -77,6 +79,7 @@ protected:
 
   virtual bool IsReady();
   virtual bool InitializeEngine(const std::vector<const SECondition*>* conditions = nullptr, const SEEngineConfiguration* config = nullptr);
+  virtual bool CopyState(PulseEngine& dst);
 
   SEEventHandler*                                 m_EventHandler;
   SEEngineTracker                                 m_EngineTrack;
@@ -0,0 +1,118 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "Controller/StabilizationCache.h"
+#include "PulseConfiguration.h"
+#include "patient/SEPatient.h"
+#include "scenario/SECondition.h"
+#include "substance/SESubstanceManager.h"
+#include "utils/ContentHash.h"
+#include "utils/FileUtils.h"
+#include "utils/ProtobufFile.h"
+PROTO_PUSH
+#include "bind/cdm/Scenario.pb.h"
+PROTO_POP
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+  std::mutex            g_CacheMutex;
+  std::string           g_CacheDirectory;
+  std::atomic<uint64_t> g_TempFileCount(0);
+}
+
+void PulseStabilizationCache::SetDirectory(const std::string& directory)
+{
+  std::lock_guard<std::mutex> lock(g_CacheMutex);
+  g_CacheDirectory = directory;
+}
+
+std::string PulseStabilizationCache::GetDirectory()
+{
+  std::lock_guard<std::mutex> lock(g_CacheMutex);
+  return g_CacheDirectory;
+}
+
+bool PulseStabilizationCache::IsEnabled()
+{
+  return !GetDirectory().empty();
+}
+
+void PulseStabilizationCache::Invalidate()
+{
+  std::string directory = GetDirectory();
+  if (directory.empty())
+    return;
+  std::vector<std::string> files;
+  ListFiles(directory, files, BINARY_PROTOBUF_EXTENSION);
+  // Only remove what we named, in case the directory is shared with other states
+  const size_t cachedNameSize = directory.size() + 1 + 16 + strlen(BINARY_PROTOBUF_EXTENSION);
+  for (const std::string& file : files)
+  {
+    if (file.size() == cachedNameSize && file.compare(0, directory.size() + 1, directory + "/") == 0)
+      std::remove(file.c_str());
+  }
+}
+
+void PulseStabilizationCache::Invalidate(const std::string& key)
+{
+  if (IsEnabled())
+    std::remove(GetStateFile(key).c_str());
+}
+
+std::string PulseStabilizationCache::ComputeKey(const SEPatient& patient, const std::vector<const SECondition*>* conditions,
+                                                const PulseConfiguration& config, const SESubstanceManager& subMgr)
+{
+  ContentHash hash;
+  hash.Add(std::string(pulse::Version));
+
+  cdm::PatientData* patientData = SEPatient::Unload(patient);
+  hash.Add(*patientData);
+  delete patientData;
+
+  if (conditions != nullptr)
+  {
+    for (const SECondition* c : *conditions)
+    {
+      cdm::AnyConditionData* conditionData = SECondition::Unload(*c);
+      hash.Add(*conditionData);
+      delete conditionData;
+    }
+  }
+
+  pulse::ConfigurationData* configData = PulseConfiguration::Unload(config);
+  hash.Add(*configData);
+  delete configData;
+
+  const SESubstanceLibrary* library = subMgr.GetSubstanceLibrary();
+  hash.Add(library == nullptr ? std::string() : library->GetContentHash());
+  return hash.ToString();
+}
+
+std::string PulseStabilizationCache::GetStateFile(const std::string& key)
+{
+  return GetDirectory() + "/" + key + BINARY_PROTOBUF_EXTENSION;
+}
+
+bool PulseStabilizationCache::SaveState(const google::protobuf::Message& state, const std::string& key, Logger* logger)
+{
+  std::string filename = GetStateFile(key);
+  std::string tmpFilename = filename + "." + std::to_string(g_TempFileCount++) + ".tmp";
+  CreateFilePath(filename);
+  if (!SaveProtobufFile(state, tmpFilename, SerializationFormat::BINARY, logger))
+  {
+    std::remove(tmpFilename.c_str());
+    return false;
+  }
+  std::remove(filename.c_str());// Windows will not rename over an existing file
+  if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)
+  {
+    std::remove(tmpFilename.c_str());
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,37 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+class SEPatient;
+class SECondition;
+class SESubstanceManager;
+class PulseConfiguration;
+
+/**
+ * @brief On disk cache of the engine states InitializeEngine stabilizes to.
+ * @details
+ * States are keyed by a content hash of the patient, conditions, configuration and substance
+ * definitions they were stabilized from, so a change to any of them is a miss, not a stale hit.
+ * The cache is off until a directory is set, and is shared by all engines in the process.
+ * Cached states are not tied to a build of the engine other than through its version,
+ * so invalidate the cache after changing any physiology model.
+ */
+class PULSE_DECL PulseStabilizationCache
+{
+public:
+  // An empty directory turns the cache off
+  static void SetDirectory(const std::string& directory);
+  static std::string GetDirectory();
+  static bool IsEnabled();
+
+  // Removes every state in the cache directory
+  static void Invalidate();
+  // Removes the state cached under the key
+  static void Invalidate(const std::string& key);
+
+  static std::string ComputeKey(const SEPatient& patient, const std::vector<const SECondition*>* conditions,
+                                const PulseConfiguration& config, const SESubstanceManager& subMgr);
+  static std::string GetStateFile(const std::string& key);
+  // Writes through a temporary file, so engines on other threads never load a partial state
+  static bool SaveState(const google::protobuf::Message& state, const std::string& key, Logger* logger = nullptr);
+};
@@ -704,9 +704,9 @@ void PulseSubstances::InitializeLiquidCompartmentNonGases()
   SetSubstanceMolarity(*m_urea, tissue, molarity1);
 }
 
-bool PulseSubstances::LoadSubstanceDirectory()
+bool PulseSubstances::LoadSubstanceLibrary(std::shared_ptr<const SESubstanceLibrary> library)
 {
-  if (!SESubstanceManager::LoadSubstanceDirectory())
+  if (!SESubstanceManager::LoadSubstanceLibrary(library))
     return false;
 
   m_O2 = GetSubstance("Oxygen");
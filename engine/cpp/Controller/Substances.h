@@ -37,7 +37,7 @@ public:
 
   virtual void Clear();
 
-  virtual bool LoadSubstanceDirectory();
+  virtual bool LoadSubstanceLibrary(std::shared_ptr<const SESubstanceLibrary> library);
   virtual void InitializeSubstances();
 
   virtual void AddActiveSubstance(SESubstance& substance);
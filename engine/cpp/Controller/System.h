@@ -26,6 +26,10 @@ public:
   virtual void PreProcess() = 0;
   virtual void Process() = 0;
   virtual void PostProcess() = 0;
+  /**
+  * @brief - Time covered by the next update, for systems the engine can update less often than every time step
+  */
+  virtual void SetUpdateTimeStep(double /*dt_s*/) {}
 
 protected:
   virtual void SetUp() = 0;
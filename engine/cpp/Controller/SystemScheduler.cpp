@@ -0,0 +1,226 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "stdafx.h"
+#include "Controller/SystemScheduler.h"
+#include "engine/SEEngineProfiler.h"
+#include <algorithm>
+
+namespace
+{
+  bool Overlaps(const std::vector<std::string>& a, const std::vector<std::string>& b)
+  {
+    for (const std::string& r : a)
+    {
+      if (std::find(b.begin(), b.end(), r) != b.end())
+        return true;
+    }
+    return false;
+  }
+}
+
+SystemScheduler::SystemScheduler(Logger* logger) : Loggable(logger)
+{
+  m_Profiler = nullptr;
+  m_Running = nullptr;
+  m_NumCompleted = 0;
+  m_NumInFlight = 0;
+  m_Stop = false;
+}
+
+SystemScheduler::~SystemScheduler()
+{
+  StopWorkers();
+}
+
+void SystemScheduler::Clear()
+{
+  for (std::vector<Task>& tasks : m_Tasks)
+    tasks.clear();
+}
+
+std::string SystemScheduler::PhaseName(Phase phase)
+{
+  switch (phase)
+  {
+  case Phase::PreProcess: return "PreProcess";
+  case Phase::Process: return "Process";
+  default: return "PostProcess";
+  }
+}
+
+bool SystemScheduler::Conflicts(const Task& earlier, const Task& later)
+{
+  return Overlaps(earlier.writes, later.reads) || Overlaps(earlier.writes, later.writes) || Overlaps(earlier.reads, later.writes);
+}
+
+void SystemScheduler::AddTask(Phase phase, const std::string& name, std::function<void()> task,
+                              const std::vector<std::string>& reads, const std::vector<std::string>& writes)
+{
+  std::vector<Task>& tasks = m_Tasks[(int)phase];
+  Task t;
+  t.name = name;
+  t.run = task;
+  t.reads = reads;
+  t.writes = writes;
+  const std::string engine = Engine;
+  t.onCaller = std::find(reads.begin(), reads.end(), engine) != reads.end() ||
+               std::find(writes.begin(), writes.end(), engine) != writes.end();
+  t.profileSlot = m_Profiler == nullptr ? 0 : m_Profiler->RegisterSlot(PhaseName(phase), name);
+  for (size_t i = 0; i < tasks.size(); i++)
+  {
+    if (Conflicts(tasks[i], t))
+    {
+      t.dependencies.push_back(i);
+      tasks[i].dependents.push_back(tasks.size());
+    }
+  }
+  tasks.push_back(t);
+}
+
+void SystemScheduler::SetWorkerCount(size_t count)
+{
+  StopWorkers();
+  for (size_t i = 0; i < count; i++)
+    m_Workers.push_back(std::thread(&SystemScheduler::WorkerLoop, this));
+}
+
+void SystemScheduler::StopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stop = true;
+  }
+  m_WorkAvailable.notify_all();
+  for (std::thread& worker : m_Workers)
+    worker.join();
+  m_Workers.clear();
+  m_Stop = false;
+}
+
+void SystemScheduler::WorkerLoop()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while (true)
+  {
+    m_WorkAvailable.wait(lock, [this]() { return m_Stop || !m_Ready.empty(); });
+    if (m_Stop)
+      return;
+    size_t task = m_Ready.back();
+    m_Ready.pop_back();
+    RunTask(task, lock);
+  }
+}
+
+void SystemScheduler::RunTask(size_t task, std::unique_lock<std::mutex>& lock)
+{
+  std::vector<Task>& tasks = *m_Running;
+  m_NumInFlight++;
+  lock.unlock();
+  std::exception_ptr error;
+  try
+  {
+    SEEngineProfiler::ScopedTimer timer(m_Profiler, tasks[task].profileSlot);
+    tasks[task].run();
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  lock.lock();
+  m_NumInFlight--;
+  if (error != nullptr)
+  {// Nothing else gets started, the caller rethrows once the tasks in flight are done
+    if (m_Error == nullptr)
+      m_Error = error;
+    m_Ready.clear();
+  }
+  else
+  {
+    m_NumCompleted++;
+    for (size_t dependent : tasks[task].dependents)
+    {
+      if (--m_Waiting[dependent] == 0 && !tasks[dependent].onCaller)
+      {
+        m_Ready.push_back(dependent);
+        m_WorkAvailable.notify_one();
+      }
+    }
+  }
+  m_TaskCompleted.notify_all();
+}
+
+void SystemScheduler::Run(Phase phase)
+{
+  std::vector<Task>& tasks = m_Tasks[(int)phase];
+  if (m_Workers.empty())
+  {
+    for (Task& task : tasks)
+    {
+      SEEngineProfiler::ScopedTimer timer(m_Profiler, task.profileSlot);
+      task.run();
+    }
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_Running = &tasks;
+  m_Waiting.resize(tasks.size());
+  m_Ready.clear();
+  m_NumCompleted = 0;
+  m_Error = nullptr;
+  for (size_t i = 0; i < tasks.size(); i++)
+  {
+    m_Waiting[i] = tasks[i].dependencies.size();
+    if (m_Waiting[i] == 0 && !tasks[i].onCaller)
+      m_Ready.push_back(i);
+  }
+  m_WorkAvailable.notify_all();
+
+  // Run our tasks in order, helping with the others while we wait on them
+  auto waitFor = [&](std::function<bool()> done)
+  {
+    while (m_Error == nullptr && !done())
+    {
+      if (!m_Ready.empty())
+      {
+        size_t task = m_Ready.back();
+        m_Ready.pop_back();
+        RunTask(task, lock);
+      }
+      else
+        m_TaskCompleted.wait(lock);
+    }
+  };
+  for (size_t i = 0; i < tasks.size() && m_Error == nullptr; i++)
+  {
+    if (!tasks[i].onCaller)
+      continue;
+    waitFor([&]() { return m_Waiting[i] == 0; });
+    if (m_Error == nullptr)
+      RunTask(i, lock);
+  }
+  waitFor([&]() { return m_NumCompleted == tasks.size(); });
+  m_TaskCompleted.wait(lock, [this]() { return m_NumInFlight == 0; });
+  m_Running = nullptr;
+  if (m_Error != nullptr)
+  {
+    std::exception_ptr error = m_Error;
+    m_Error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+std::string SystemScheduler::DescribeDependencies(Phase phase) const
+{
+  const std::vector<Task>& tasks = m_Tasks[(int)phase];
+  std::stringstream ss;
+  for (const Task& task : tasks)
+  {
+    ss << task.name << (task.onCaller ? "" : " (any thread)");
+    for (size_t i = 0; i < task.dependencies.size(); i++)
+      ss << (i == 0 ? " waits on " : ", ") << tasks[task.dependencies[i]].name;
+    ss << std::endl;
+  }
+  return ss.str();
+}
@@ -0,0 +1,84 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+class SEEngineProfiler;
+
+/**
+ * @brief Runs the work of each engine phase (PreProcess, Process, PostProcess) as a dependency graph.
+ * @details
+ * Tasks are added in the order the engine has always called them in, with the data each one reads and writes.
+ * A task waits on every earlier task of its phase that writes what it reads or writes, or reads what it writes,
+ * so any two tasks that could see each other's changes still run in their original order and results
+ * are identical to running every task in sequence.
+ * Tasks using the Engine resource, i.e. anything not declared more precisely, always run on the calling thread,
+ * the remaining tasks are also picked up by worker threads as soon as the tasks they wait on are done.
+ * Without worker threads, every task is run in order on the calling thread.
+ * With a profiler, each task gets a slot named after it, in the category of its phase.
+ */
+class PULSE_DECL SystemScheduler : public Loggable
+{
+public:
+  enum class Phase { PreProcess = 0, Process, PostProcess };
+  DEFINE_STATIC_STRING(Engine);
+
+  SystemScheduler(Logger* logger);
+  virtual ~SystemScheduler();
+
+  void Clear();
+  // Set before adding tasks, tasks are timed whenever the profiler is enabled
+  void SetProfiler(SEEngineProfiler* profiler) { m_Profiler = profiler; }
+  void AddTask(Phase phase, const std::string& name, std::function<void()> task,
+               const std::vector<std::string>& reads, const std::vector<std::string>& writes);
+
+  // Threads in addition to the calling thread, 0 runs every task in order on the calling thread
+  void SetWorkerCount(size_t count);
+  size_t GetWorkerCount() const { return m_Workers.size(); }
+
+  void Run(Phase phase);
+
+  // Lists each task of the phase with the tasks it waits on
+  std::string DescribeDependencies(Phase phase) const;
+
+protected:
+  struct Task
+  {
+    std::string              name;
+    std::function<void()>    run;
+    std::vector<std::string> reads;
+    std::vector<std::string> writes;
+    bool                     onCaller;
+    size_t                   profileSlot;
+    std::vector<size_t>      dependencies;
+    std::vector<size_t>      dependents;
+  };
+  static bool Conflicts(const Task& earlier, const Task& later);
+  static std::string PhaseName(Phase phase);
+
+  void StopWorkers();
+  void WorkerLoop();
+  // Called with the lock held, it is released while the task runs
+  void RunTask(size_t task, std::unique_lock<std::mutex>& lock);
+
+  std::vector<Task>        m_Tasks[3];
+  SEEngineProfiler*        m_Profiler;
+
+  // Execution state of the phase being run, guarded by m_Mutex
+  std::mutex               m_Mutex;
+  std::condition_variable  m_WorkAvailable;
+  std::condition_variable  m_TaskCompleted;
+  std::vector<Task>*       m_Running;
+  std::vector<size_t>      m_Waiting;// Number of dependencies each task is still waiting on
+  std::vector<size_t>      m_Ready;// Tasks any thread may run
+  size_t                   m_NumCompleted;
+  size_t                   m_NumInFlight;
+  std::exception_ptr       m_Error;
+  bool                     m_Stop;
+
+  std::vector<std::thread> m_Workers;
+};
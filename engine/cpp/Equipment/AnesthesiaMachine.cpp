@@ -104,6 +104,17 @@ void AnesthesiaMachine::Serialize(const pulse::AnesthesiaMachineData& src, Anest
   dst.m_totalBreathingCycleTime.SetValue(src.totalbreathingcycletime_s(), TimeUnit::s);
 }
 
+void AnesthesiaMachine::Copy(const AnesthesiaMachine& src, AnesthesiaMachine& dst)
+{
+  SEAnesthesiaMachine::Copy(src, dst);
+  dst.m_inhaling = src.m_inhaling;
+  dst.m_currentbreathingCycleTime.Set(src.m_currentbreathingCycleTime);
+  dst.m_inspirationTime.Set(src.m_inspirationTime);
+  dst.m_O2InletVolumeFraction.Set(src.m_O2InletVolumeFraction);
+  dst.m_totalBreathingCycleTime.Set(src.m_totalBreathingCycleTime);
+  dst.SetUp();
+}
+
 pulse::AnesthesiaMachineData* AnesthesiaMachine::Unload(const AnesthesiaMachine& src)
 {
   pulse::AnesthesiaMachineData* dst = new pulse::AnesthesiaMachineData();
@@ -31,6 +31,7 @@ public:
 
   static void Load(const pulse::AnesthesiaMachineData& src, AnesthesiaMachine& dst);
   static pulse::AnesthesiaMachineData* Unload(const AnesthesiaMachine& src);
+  static void Copy(const AnesthesiaMachine& src, AnesthesiaMachine& dst);
 protected:
   static void Serialize(const pulse::AnesthesiaMachineData& src, AnesthesiaMachine& dst);
   static void Serialize(const AnesthesiaMachine& src, pulse::AnesthesiaMachineData& dst);
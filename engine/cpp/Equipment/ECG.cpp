@@ -88,6 +88,16 @@ void ECG::Serialize(const pulse::ElectroCardioGramData& src, ECG& dst)
   dst.m_interpolator.SetLeadElectricPotential(cdm::ElectroCardioGramWaveformData_eLead_Lead3, dst.GetLead3ElectricPotential());
 }
 
+void ECG::Copy(const ECG& src, ECG& dst)
+{
+  SEElectroCardioGram::Copy(src, dst);
+  dst.m_heartRhythmTime.Set(src.m_heartRhythmTime);
+  dst.m_heartRhythmPeriod.Set(src.m_heartRhythmPeriod);
+  SEElectroCardioGramWaveformInterpolator::Copy(src.m_interpolator, dst.m_interpolator);
+  dst.m_interpolator.SetLeadElectricPotential(cdm::ElectroCardioGramWaveformData_eLead_Lead3, dst.GetLead3ElectricPotential());
+  dst.SetUp();
+}
+
 pulse::ElectroCardioGramData* ECG::Unload(const ECG& src)
 {
   pulse::ElectroCardioGramData* dst = new pulse::ElectroCardioGramData();
@@ -105,6 +115,41 @@ void ECG::Serialize(const ECG& src, pulse::ElectroCardioGramData& dst)
 void ECG::SetUp()
 {
   m_dt_s = m_data.GetTimeStep().GetValue(TimeUnit::s);
+  // Sample tables are built from the configuration waveforms, which are at their original resolution
+  // Our own waveforms are interpolated to the time step, so they are too coarse to sample from
+  const PulseConfiguration& config = m_data.GetConfiguration();
+  if (!config.HasECGSampleRate())
+  {
+    m_interpolator.InvalidateSampleRate();
+    return;
+  }
+  SEScalarFrequency rate;
+  rate.SetValue(config.GetECGSampleRate(FrequencyUnit::Per_s), FrequencyUnit::Per_s);
+  if (config.HasECGInterpolator())
+  {
+    m_interpolator.SetSampleRate(rate, *config.GetECGInterpolator());
+    return;
+  }
+  // The configuration waveforms are not part of a state, so a loaded engine samples the standard waveforms
+  SEElectroCardioGramWaveformInterpolator source(GetLogger());
+  if (!source.LoadFile("./ecg/StandardECG.pba"))
+  {
+    Error("Unable to load ./ecg/StandardECG.pba, ECG samples will not be synthesized");
+    m_interpolator.InvalidateSampleRate();
+    return;
+  }
+  m_interpolator.SetSampleRate(rate, source);
+}
+
+bool ECG::SetLeadSampleBuffer(cdm::ElectroCardioGramWaveformData_eLead lead, SEElectroCardioGramSampleBuffer* buffer)
+{
+  if (buffer != nullptr && !m_interpolator.HasSampleRate())
+  {
+    Error("An ECG sample rate must be configured to synthesize ECG samples");
+    return false;
+  }
+  m_interpolator.SetLeadSampleBuffer(lead, buffer);
+  return true;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -132,7 +177,8 @@ void ECG::PreProcess()
 /// data at a specific time point on the interpolated waveform data. Process increments the time point
 /// and sums up the value of any active iterators. The iterators continue being incremented until they
 /// reach the end of the interpolated waveform data. If there are no active iterators, the output
-/// defaults to 0 mV.
+/// defaults to 0 mV. When an ECG sample rate is configured, the samples of this time step are also
+/// synthesized into any lead sample buffers.
 //--------------------------------------------------------------------------------------------------
 void ECG::Process()
 {
@@ -152,6 +198,7 @@ void ECG::Process()
     }
   }
   m_interpolator.CalculateWaveformsElectricPotential();
+  m_interpolator.SynthesizeSamples(m_dt_s);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -9,6 +9,7 @@ PROTO_PUSH
 PROTO_POP
 #include "system/equipment/electrocardiogram/SEElectroCardioGram.h"
 #include "system/equipment/electrocardiogram/SEElectroCardioGramWaveformInterpolator.h"
+#include "system/equipment/electrocardiogram/SEElectroCardioGramSampleBuffer.h"
 
 /**
 * @brief 
@@ -32,6 +33,7 @@ public:
 
   static void Load(const pulse::ElectroCardioGramData& src, ECG& dst);
   static pulse::ElectroCardioGramData* Unload(const ECG& src);
+  static void Copy(const ECG& src, ECG& dst);
 protected:
   static void Serialize(const pulse::ElectroCardioGramData& src, ECG& dst);
   static void Serialize(const ECG& src, pulse::ElectroCardioGramData& dst);
@@ -46,6 +48,10 @@ public:
   void Process();
   void PostProcess();
 
+  // High rate output, each time step writes the lead samples at the configured ECG sample rate into the provided buffer
+  // Pass nullptr to stop writing samples for the lead
+  bool SetLeadSampleBuffer(cdm::ElectroCardioGramWaveformData_eLead lead, SEElectroCardioGramSampleBuffer* buffer);
+
 protected:
   // Serializable member variables (Set in Initialize and in schema)
   SEScalarTime m_heartRhythmTime;
@@ -60,6 +60,12 @@ void Inhaler::Serialize(const pulse::InhalerData& src, Inhaler& dst)
   SEInhaler::Serialize(src.common(), dst);
 }
 
+void Inhaler::Copy(const Inhaler& src, Inhaler& dst)
+{
+  SEInhaler::Copy(src, dst);
+  dst.SetUp();
+}
+
 pulse::InhalerData* Inhaler::Unload(const Inhaler& src)
 {
   pulse::InhalerData* dst = new pulse::InhalerData();
@@ -190,6 +196,7 @@ void Inhaler::Administer()
   // Initialize pressure in the inhaler node to ambient  
   double dAmbientPressure = m_AmbientEnv->GetPressure(PressureUnit::cmH2O);
   m_Mouthpiece->GetPressure().SetValue(dAmbientPressure, PressureUnit::cmH2O);
+  m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
 
   // Copy the environment substance data to the mouth piece
   m_Mouthpiece->ZeroSubstanceQuantities();
@@ -211,6 +218,7 @@ void Inhaler::Administer()
     double dSpacerVolume_L = m_SpacerVolume->GetValue(VolumeUnit::L);
     dVolume_L += dSpacerVolume_L;
     m_Mouthpiece->GetVolume().SetValue(dVolume_L, VolumeUnit::L);
+    m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
   }
 
   // Get dose properties we need
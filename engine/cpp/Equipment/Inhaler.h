@@ -31,6 +31,7 @@ public:
 
   static void Load(const pulse::InhalerData& src, Inhaler& dst);
   static pulse::InhalerData* Unload(const Inhaler& src);
+  static void Copy(const Inhaler& src, Inhaler& dst);
 protected:
   static void Serialize(const pulse::InhalerData& src, Inhaler& dst);
   static void Serialize(const Inhaler& src, pulse::InhalerData& dst);
@@ -29,6 +29,7 @@
 #include "properties/SEScalarVolumePerTime.h"
 #include "properties/SEScalarInverseVolume.h"
 #include "properties/SEScalarPowerPerAreaTemperatureToTheFourth.h"
+#include "properties/SEScalarFrequency.h"
 #include "patient/SENutrition.h"
 #include "engine/SEDynamicStabilization.h"
 #include "engine/SETimedStabilization.h"
@@ -45,6 +46,7 @@ PulseConfiguration::PulseConfiguration(SESubstanceManager& substances) : SEEngin
   m_DynamicStabilization = nullptr;
   m_AutoSerialization = nullptr;
   m_WritePatientBaselineFile = cdm::eSwitch::Off;
+  m_RecordProcessedActions = cdm::eSwitch::NullSwitch;
 
   // Barorecptors
   m_ResponseSlope = nullptr;
@@ -67,6 +69,7 @@ PulseConfiguration::PulseConfiguration(SESubstanceManager& substances) : SEEngin
   m_MeanCorpuscularVolume = nullptr;
   m_StandardDiffusionDistance = nullptr;
   m_StandardOxygenDiffusionCoefficient = nullptr;
+  m_WarmStartBloodGasSolver = cdm::eSwitch::Off;
 
   // Cardiovascular
   m_LeftHeartElastanceMaximum = nullptr;
@@ -96,9 +99,11 @@ PulseConfiguration::PulseConfiguration(SESubstanceManager& substances) : SEEngin
 
   // Drugs 
   m_PDEnabled = cdm::eSwitch::On;
+  m_PartitionCoefficientTolerance = nullptr;
 
   // ECG
   m_ECGInterpolator = nullptr;
+  m_ECGSampleRate = nullptr;
 
   // Energy
   m_BodySpecificHeat = nullptr;
@@ -176,6 +181,8 @@ void PulseConfiguration::Clear()
   RemoveStabilization();
   SAFE_DELETE(m_AutoSerialization);
   m_WritePatientBaselineFile = cdm::eSwitch::Off;
+  m_SystemUpdateIntervals.clear();
+  m_RecordProcessedActions = cdm::eSwitch::NullSwitch;
 
   // Barorecptors
   SAFE_DELETE(m_ResponseSlope);
@@ -198,6 +205,7 @@ void PulseConfiguration::Clear()
   SAFE_DELETE(m_MeanCorpuscularVolume);
   SAFE_DELETE(m_StandardDiffusionDistance);
   SAFE_DELETE(m_StandardOxygenDiffusionCoefficient);
+  m_WarmStartBloodGasSolver = cdm::eSwitch::Off;
 
   // Cardiovascular
   SAFE_DELETE(m_LeftHeartElastanceMaximum);
@@ -227,9 +235,11 @@ void PulseConfiguration::Clear()
 
   // Drugs
   m_PDEnabled = cdm::eSwitch::On;
+  SAFE_DELETE(m_PartitionCoefficientTolerance);
 
   //  ECG
   SAFE_DELETE(m_ECGInterpolator);
+  SAFE_DELETE(m_ECGSampleRate);
 
   // Energy
   SAFE_DELETE(m_BodySpecificHeat);
@@ -300,10 +310,12 @@ void PulseConfiguration::Initialize()
 {
   Clear();
   m_WritePatientBaselineFile = cdm::eSwitch::Off;
+  m_RecordProcessedActions = cdm::eSwitch::On;
 
   // Reset to default values
   GetTimeStep().SetValue(1.0 / 50.0, TimeUnit::s);
-  GetECGInterpolator().LoadFile("./ecg/StandardECG.pba",&GetTimeStep());
+  // The ECG interpolates its own copy to the time step, keep the original resolution for high rate sampling
+  GetECGInterpolator().LoadFile("./ecg/StandardECG.pba");
   GetDynamicStabilization().LoadFile("./config/DynamicStabilization.pba");
   //GetTimedStabilization().LoadFile("./config/TimedStabilization.pba");
   //GetDynamicStabilization().TrackStabilization(cdm::eSwitch::On);// Hard coded override for debugging
@@ -329,6 +341,7 @@ void PulseConfiguration::Initialize()
   GetMeanCorpuscularHemoglobin().SetValue(29, MassPerAmountUnit::pg_Per_ct);
   GetStandardDiffusionDistance().SetValue(0.0006, LengthUnit::mm);
   GetStandardOxygenDiffusionCoefficient().SetValue(0.00000000246, AreaPerTimePressureUnit::cm2_Per_min_mmHg);
+  m_WarmStartBloodGasSolver = cdm::eSwitch::Off;
 
   // Cardiovascular
   GetLeftHeartElastanceMaximum().SetValue(2.49, FlowElastanceUnit::mmHg_Per_mL);
@@ -358,6 +371,10 @@ void PulseConfiguration::Initialize()
 
   // Drugs 
   m_PDEnabled = cdm::eSwitch::On;
+  // Recalculate on any change, so results match the verification data
+  // Scenarios can opt in to a tolerance, ex. a relative change of 1e-4 (~0.0007 pH) changes
+  // the ionized fractions by less than 0.2%, while skipping most time steps once the blood pH is stable
+  GetPartitionCoefficientTolerance().SetValue(0);
 
   // Energy
   GetBodySpecificHeat().SetValue(0.83, HeatCapacitancePerMassUnit::kcal_Per_K_kg);
@@ -477,6 +494,10 @@ void PulseConfiguration::Serialize(const pulse::ConfigurationData& src, PulseCon
     SEAutoSerialization::Load(src.autoserialization(), dst.GetAutoSerialization());
   if (src.writepatientbaselinefile() != cdm::eSwitch::NullSwitch)
     dst.EnableWritePatientBaselineFile(src.writepatientbaselinefile());
+  for (auto itr : src.systemupdateinterval())
+    dst.SetSystemUpdateInterval(itr.first, itr.second);
+  if (src.recordprocessedactions() != cdm::eSwitch::NullSwitch)
+    dst.EnableRecordProcessedActions(src.recordprocessedactions());
 
   //Barorecptors
   if (src.has_baroreceptorconfiguration())
@@ -524,6 +545,8 @@ void PulseConfiguration::Serialize(const pulse::ConfigurationData& src, PulseCon
       SEScalarLength::Load(config.standarddiffusiondistance(),dst.GetStandardDiffusionDistance());
     if (config.has_standardoxygendiffusioncoefficient())
       SEScalarAreaPerTimePressure::Load(config.standardoxygendiffusioncoefficient(),dst.GetStandardOxygenDiffusionCoefficient());
+    if (config.warmstartbloodgassolver() != cdm::eSwitch::NullSwitch)
+      dst.UseWarmStartBloodGasSolver(config.warmstartbloodgassolver());
   }
 
   // Cardiovascular
@@ -590,6 +613,16 @@ void PulseConfiguration::Serialize(const pulse::ConfigurationData& src, PulseCon
     const pulse::ConfigurationData_DrugsConfigurationData& config = src.drugsconfiguration();
     if(config.pdmodel()!=cdm::eSwitch::NullSwitch)
       dst.UsePDModel(config.pdmodel());
+    if (config.has_partitioncoefficienttolerance())
+      SEScalar0To1::Load(config.partitioncoefficienttolerance(), dst.GetPartitionCoefficientTolerance());
+  }
+
+  // ECG
+  if (src.has_ecgconfiguration())
+  {
+    const pulse::ConfigurationData_ECGConfigurationData& config = src.ecgconfiguration();
+    if (config.has_samplerate())
+      SEScalarFrequency::Load(config.samplerate(), dst.GetECGSampleRate());
   }
   
   // Energy
@@ -764,6 +797,121 @@ void PulseConfiguration::Serialize(const pulse::ConfigurationData& src, PulseCon
   }
 }
 
+void PulseConfiguration::Copy(const PulseConfiguration& src, PulseConfiguration& dst)
+{
+  // Stabilization only drives engine initialization, the destination keeps its own
+  if (src.m_AutoSerialization != nullptr)
+    SEAutoSerialization::Copy(*src.m_AutoSerialization, dst.GetAutoSerialization());
+  else
+    SAFE_DELETE(dst.m_AutoSerialization);
+  dst.m_WritePatientBaselineFile = src.m_WritePatientBaselineFile;
+  dst.m_SystemUpdateIntervals = src.m_SystemUpdateIntervals;
+  dst.m_RecordProcessedActions = src.m_RecordProcessedActions;
+  dst.m_PDEnabled = src.m_PDEnabled;
+  dst.m_WarmStartBloodGasSolver = src.m_WarmStartBloodGasSolver;
+  dst.m_RenalEnabled = src.m_RenalEnabled;
+  dst.m_TissueEnabled = src.m_TissueEnabled;
+  CopyScalar(src.m_TimeStep, dst.m_TimeStep);
+  CopyScalar(src.m_ResponseSlope, dst.m_ResponseSlope);
+  CopyScalar(src.m_HeartRateDistributedTimeDelay, dst.m_HeartRateDistributedTimeDelay);
+  CopyScalar(src.m_HeartElastanceDistributedTimeDelay, dst.m_HeartElastanceDistributedTimeDelay);
+  CopyScalar(src.m_SystemicResistanceDistributedTimeDelay, dst.m_SystemicResistanceDistributedTimeDelay);
+  CopyScalar(src.m_VenousComplianceDistributedTimeDelay, dst.m_VenousComplianceDistributedTimeDelay);
+  CopyScalar(src.m_NormalizedHeartRateIntercept, dst.m_NormalizedHeartRateIntercept);
+  CopyScalar(src.m_NormalizedHeartRateSympatheticSlope, dst.m_NormalizedHeartRateSympatheticSlope);
+  CopyScalar(src.m_NormalizedHeartRateParasympatheticSlope, dst.m_NormalizedHeartRateParasympatheticSlope);
+  CopyScalar(src.m_NormalizedHeartElastanceIntercept, dst.m_NormalizedHeartElastanceIntercept);
+  CopyScalar(src.m_NormalizedHeartElastanceSympatheticSlope, dst.m_NormalizedHeartElastanceSympatheticSlope);
+  CopyScalar(src.m_NormalizedResistanceIntercept, dst.m_NormalizedResistanceIntercept);
+  CopyScalar(src.m_NormalizedResistanceSympatheticSlope, dst.m_NormalizedResistanceSympatheticSlope);
+  CopyScalar(src.m_NormalizedComplianceIntercept, dst.m_NormalizedComplianceIntercept);
+  CopyScalar(src.m_NormalizedComplianceParasympatheticSlope, dst.m_NormalizedComplianceParasympatheticSlope);
+  CopyScalar(src.m_MeanCorpuscularVolume, dst.m_MeanCorpuscularVolume);
+  CopyScalar(src.m_MeanCorpuscularHemoglobin, dst.m_MeanCorpuscularHemoglobin);
+  CopyScalar(src.m_StandardDiffusionDistance, dst.m_StandardDiffusionDistance);
+  CopyScalar(src.m_StandardOxygenDiffusionCoefficient, dst.m_StandardOxygenDiffusionCoefficient);
+  CopyScalar(src.m_LeftHeartElastanceMaximum, dst.m_LeftHeartElastanceMaximum);
+  CopyScalar(src.m_LeftHeartElastanceMinimum, dst.m_LeftHeartElastanceMinimum);
+  CopyScalar(src.m_MinimumBloodVolumeFraction, dst.m_MinimumBloodVolumeFraction);
+  CopyScalar(src.m_RightHeartElastanceMaximum, dst.m_RightHeartElastanceMaximum);
+  CopyScalar(src.m_RightHeartElastanceMinimum, dst.m_RightHeartElastanceMinimum);
+  CopyScalar(src.m_StandardPulmonaryCapillaryCoverage, dst.m_StandardPulmonaryCapillaryCoverage);
+  CopyScalar(src.m_CardiovascularOpenResistance, dst.m_CardiovascularOpenResistance);
+  CopyScalar(src.m_DefaultOpenElectricResistance, dst.m_DefaultOpenElectricResistance);
+  CopyScalar(src.m_DefaultOpenFlowResistance, dst.m_DefaultOpenFlowResistance);
+  CopyScalar(src.m_DefaultOpenHeatResistance, dst.m_DefaultOpenHeatResistance);
+  CopyScalar(src.m_DefaultClosedElectricResistance, dst.m_DefaultClosedElectricResistance);
+  CopyScalar(src.m_DefaultClosedFlowResistance, dst.m_DefaultClosedFlowResistance);
+  CopyScalar(src.m_DefaultClosedHeatResistance, dst.m_DefaultClosedHeatResistance);
+  CopyScalar(src.m_MachineClosedResistance, dst.m_MachineClosedResistance);
+  CopyScalar(src.m_MachineOpenResistance, dst.m_MachineOpenResistance);
+  CopyScalar(src.m_RespiratoryClosedResistance, dst.m_RespiratoryClosedResistance);
+  CopyScalar(src.m_RespiratoryOpenResistance, dst.m_RespiratoryOpenResistance);
+  CopyScalar(src.m_OxygenMetabolicConstant, dst.m_OxygenMetabolicConstant);
+  CopyScalar(src.m_StefanBoltzmann, dst.m_StefanBoltzmann);
+  CopyScalar(src.m_UniversalGasConstant, dst.m_UniversalGasConstant);
+  CopyScalar(src.m_PartitionCoefficientTolerance, dst.m_PartitionCoefficientTolerance);
+  CopyScalar(src.m_ECGSampleRate, dst.m_ECGSampleRate);
+  // The waveforms are not serialized, but a fork can keep building its sample tables from them
+  if (src.m_ECGInterpolator != nullptr)
+    SEElectroCardioGramWaveformInterpolator::Copy(*src.m_ECGInterpolator, dst.GetECGInterpolator());
+  else
+    SAFE_DELETE(dst.m_ECGInterpolator);
+  CopyScalar(src.m_BodySpecificHeat, dst.m_BodySpecificHeat);
+  CopyScalar(src.m_CarbonDioxideProductionFromOxygenConsumptionConstant, dst.m_CarbonDioxideProductionFromOxygenConsumptionConstant);
+  CopyScalar(src.m_CoreTemperatureLow, dst.m_CoreTemperatureLow);
+  CopyScalar(src.m_CoreTemperatureHigh, dst.m_CoreTemperatureHigh);
+  CopyScalar(src.m_DeltaCoreTemperatureLow, dst.m_DeltaCoreTemperatureLow);
+  CopyScalar(src.m_EnergyPerATP, dst.m_EnergyPerATP);
+  CopyScalar(src.m_SweatHeatTransfer, dst.m_SweatHeatTransfer);
+  CopyScalar(src.m_VaporizationEnergy, dst.m_VaporizationEnergy);
+  CopyScalar(src.m_VaporSpecificHeat, dst.m_VaporSpecificHeat);
+  CopyScalar(src.m_AirDensity, dst.m_AirDensity);
+  CopyScalar(src.m_AirSpecificHeat, dst.m_AirSpecificHeat);
+  CopyScalar(src.m_MolarMassOfDryAir, dst.m_MolarMassOfDryAir);
+  CopyScalar(src.m_MolarMassOfWaterVapor, dst.m_MolarMassOfWaterVapor);
+  CopyScalar(src.m_WaterDensity, dst.m_WaterDensity);
+  CopyScalar(src.m_CalciumAbsorptionFraction, dst.m_CalciumAbsorptionFraction);
+  CopyScalar(src.m_CalciumDigestionRate, dst.m_CalciumDigestionRate);
+  CopyScalar(src.m_CarbohydrateAbsorptionFraction, dst.m_CarbohydrateAbsorptionFraction);
+  CopyScalar(src.m_DefaultCarbohydrateDigestionRate, dst.m_DefaultCarbohydrateDigestionRate);
+  CopyScalar(src.m_DefaultFatDigestionRate, dst.m_DefaultFatDigestionRate);
+  CopyScalar(src.m_DefaultProteinDigestionRate, dst.m_DefaultProteinDigestionRate);
+  CopyScalar(src.m_FatAbsorptionFraction, dst.m_FatAbsorptionFraction);
+  CopyScalar(src.m_ProteinToUreaFraction, dst.m_ProteinToUreaFraction);
+  CopyScalar(src.m_WaterDigestionRate, dst.m_WaterDigestionRate);
+  CopyScalar(src.m_PupilDiameterBaseline, dst.m_PupilDiameterBaseline);
+  CopyScalar(src.m_PlasmaSodiumConcentrationSetPoint, dst.m_PlasmaSodiumConcentrationSetPoint);
+  CopyScalar(src.m_LeftGlomerularFluidPermeabilityBaseline, dst.m_LeftGlomerularFluidPermeabilityBaseline);
+  CopyScalar(src.m_LeftGlomerularFilteringSurfaceAreaBaseline, dst.m_LeftGlomerularFilteringSurfaceAreaBaseline);
+  CopyScalar(src.m_LeftTubularReabsorptionFluidPermeabilityBaseline, dst.m_LeftTubularReabsorptionFluidPermeabilityBaseline);
+  CopyScalar(src.m_LeftTubularReabsorptionFilteringSurfaceAreaBaseline, dst.m_LeftTubularReabsorptionFilteringSurfaceAreaBaseline);
+  CopyScalar(src.m_MaximumAfferentResistance, dst.m_MaximumAfferentResistance);
+  CopyScalar(src.m_MinimumAfferentResistance, dst.m_MinimumAfferentResistance);
+  CopyScalar(src.m_RightGlomerularFluidPermeabilityBaseline, dst.m_RightGlomerularFluidPermeabilityBaseline);
+  CopyScalar(src.m_RightGlomerularFilteringSurfaceAreaBaseline, dst.m_RightGlomerularFilteringSurfaceAreaBaseline);
+  CopyScalar(src.m_RightTubularReabsorptionFluidPermeabilityBaseline, dst.m_RightTubularReabsorptionFluidPermeabilityBaseline);
+  CopyScalar(src.m_RightTubularReabsorptionFilteringSurfaceAreaBaseline, dst.m_RightTubularReabsorptionFilteringSurfaceAreaBaseline);
+  CopyScalar(src.m_TargetSodiumDelivery, dst.m_TargetSodiumDelivery);
+  CopyScalar(src.m_PeritubularPotassiumConcentrationSetPoint, dst.m_PeritubularPotassiumConcentrationSetPoint);
+  CopyScalar(src.m_CentralControllerCO2PressureSetPoint, dst.m_CentralControllerCO2PressureSetPoint);
+  CopyScalar(src.m_CentralVentilatoryControllerGain, dst.m_CentralVentilatoryControllerGain);
+  CopyScalar(src.m_PeripheralControllerCO2PressureSetPoint, dst.m_PeripheralControllerCO2PressureSetPoint);
+  CopyScalar(src.m_PeripheralVentilatoryControllerGain, dst.m_PeripheralVentilatoryControllerGain);
+  CopyScalar(src.m_PleuralComplianceSensitivity, dst.m_PleuralComplianceSensitivity);
+  CopyScalar(src.m_PulmonaryVentilationRateMaximum, dst.m_PulmonaryVentilationRateMaximum);
+  CopyScalar(src.m_VentilationTidalVolumeIntercept, dst.m_VentilationTidalVolumeIntercept);
+  CopyScalar(src.m_VentilatoryOcclusionPressure, dst.m_VentilatoryOcclusionPressure);
+  if (src.m_InitialEnvironmentalConditions != nullptr)
+    SEEnvironmentalConditions::Copy(*src.m_InitialEnvironmentalConditions, dst.GetInitialEnvironmentalConditions());
+  else
+    SAFE_DELETE(dst.m_InitialEnvironmentalConditions);
+  if (src.m_DefaultStomachContents != nullptr)
+    SENutrition::Copy(*src.m_DefaultStomachContents, dst.GetDefaultStomachContents());
+  else
+    SAFE_DELETE(dst.m_DefaultStomachContents);
+}
+
 pulse::ConfigurationData* PulseConfiguration::Unload(const PulseConfiguration& src)
 {
   pulse::ConfigurationData* dst = new pulse::ConfigurationData();
@@ -781,6 +929,9 @@ void PulseConfiguration::Serialize(const PulseConfiguration& src, pulse::Configu
   if (src.HasAutoSerialization())
     dst.set_allocated_autoserialization(SEAutoSerialization::Unload(*src.m_AutoSerialization));
   dst.set_writepatientbaselinefile(src.m_WritePatientBaselineFile);
+  for (auto itr : src.m_SystemUpdateIntervals)
+    (*dst.mutable_systemupdateinterval())[itr.first] = itr.second;
+  dst.set_recordprocessedactions(src.m_RecordProcessedActions);
 
   // Barorecptor
   pulse::ConfigurationData_BaroreceptorConfigurationData* baro = dst.mutable_baroreceptorconfiguration();
@@ -823,6 +974,7 @@ void PulseConfiguration::Serialize(const PulseConfiguration& src, pulse::Configu
     bc->set_allocated_standarddiffusiondistance(SEScalarLength::Unload(*src.m_StandardDiffusionDistance));
   if (src.HasStandardOxygenDiffusionCoefficient())
     bc->set_allocated_standardoxygendiffusioncoefficient(SEScalarAreaPerTimePressure::Unload(*src.m_StandardOxygenDiffusionCoefficient));
+  bc->set_warmstartbloodgassolver(src.m_WarmStartBloodGasSolver);
 
   // Cardiovascular
   pulse::ConfigurationData_CardiovascularConfigurationData* cv = dst.mutable_cardiovascularconfiguration();
@@ -876,6 +1028,12 @@ void PulseConfiguration::Serialize(const PulseConfiguration& src, pulse::Configu
   // Drugs
   pulse::ConfigurationData_DrugsConfigurationData* drugs = dst.mutable_drugsconfiguration();
   drugs->set_pdmodel(src.m_PDEnabled);
+  if (src.HasPartitionCoefficientTolerance())
+    drugs->set_allocated_partitioncoefficienttolerance(SEScalar0To1::Unload(*src.m_PartitionCoefficientTolerance));
+
+  // ECG
+  if (src.HasECGSampleRate())
+    dst.mutable_ecgconfiguration()->set_allocated_samplerate(SEScalarFrequency::Unload(*src.m_ECGSampleRate));
 
   // Energy
   pulse::ConfigurationData_EnergyConfigurationData* energy = dst.mutable_energyconfiguration();
@@ -1087,6 +1245,19 @@ void PulseConfiguration::RemoveAutoSerialization()
   SAFE_DELETE(m_AutoSerialization);
 }
 
+unsigned int PulseConfiguration::GetSystemUpdateInterval(const std::string& system) const
+{
+  auto itr = m_SystemUpdateIntervals.find(system);
+  return itr == m_SystemUpdateIntervals.end() ? 1 : itr->second;
+}
+void PulseConfiguration::SetSystemUpdateInterval(const std::string& system, unsigned int steps)
+{
+  if (steps <= 1)
+    m_SystemUpdateIntervals.erase(system);
+  else
+    m_SystemUpdateIntervals[system] = steps;
+}
+
 ////////////////////
 /** Baroreceptors */
 ////////////////////
@@ -1751,6 +1922,26 @@ double PulseConfiguration::GetUniversalGasConstant(const HeatCapacitancePerAmoun
   return m_UniversalGasConstant->GetValue(unit);
 }
 
+///////////
+// Drugs //
+///////////
+bool PulseConfiguration::HasPartitionCoefficientTolerance() const
+{
+  return m_PartitionCoefficientTolerance == nullptr ? false : m_PartitionCoefficientTolerance->IsValid();
+}
+SEScalar0To1& PulseConfiguration::GetPartitionCoefficientTolerance()
+{
+  if (m_PartitionCoefficientTolerance == nullptr)
+    m_PartitionCoefficientTolerance = new SEScalar0To1();
+  return *m_PartitionCoefficientTolerance;
+}
+double PulseConfiguration::GetPartitionCoefficientTolerance() const
+{
+  if (m_PartitionCoefficientTolerance == nullptr)
+    return SEScalar::dNaN();
+  return m_PartitionCoefficientTolerance->GetValue();
+}
+
 /////////
 // ECG //
 /////////
@@ -1773,6 +1964,23 @@ void PulseConfiguration::RemoveECGInterpolator()
   SAFE_DELETE(m_ECGInterpolator);
 }
 
+bool PulseConfiguration::HasECGSampleRate() const
+{
+  return m_ECGSampleRate == nullptr ? false : m_ECGSampleRate->IsValid();
+}
+SEScalarFrequency& PulseConfiguration::GetECGSampleRate()
+{
+  if (m_ECGSampleRate == nullptr)
+    m_ECGSampleRate = new SEScalarFrequency();
+  return *m_ECGSampleRate;
+}
+double PulseConfiguration::GetECGSampleRate(const FrequencyUnit& unit) const
+{
+  if (m_ECGSampleRate == nullptr)
+    return SEScalar::dNaN();
+  return m_ECGSampleRate->GetValue(unit);
+}
+
 /////////////
 /** Energy */
 /////////////
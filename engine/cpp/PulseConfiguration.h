@@ -35,6 +35,7 @@ public:
 
   static void Load(const pulse::ConfigurationData& src, PulseConfiguration& dst);
   static pulse::ConfigurationData* Unload(const PulseConfiguration& src);
+  static void Copy(const PulseConfiguration& src, PulseConfiguration& dst);
 protected:
   static void Serialize(const pulse::ConfigurationData& src, PulseConfiguration& dst);
   static void Serialize(const PulseConfiguration& src, pulse::ConfigurationData& dst);
@@ -69,6 +70,18 @@ public:
   virtual const SEAutoSerialization* GetAutoSerialization() const;
   virtual void RemoveAutoSerialization();
 
+  // Once the engine is active, these systems can be updated every N time steps instead of every time step,
+  // each update covers all the time since the last one: Endocrine, Energy, Gastrointestinal, Hepatic and Renal (Process only)
+  // Gastric secretion, chyme absorption and sweat are still moved every time step, at the rates of the last update
+  virtual unsigned int GetSystemUpdateInterval(const std::string& system) const;
+  virtual void SetSystemUpdateInterval(const std::string& system, unsigned int steps);
+  virtual const std::map<std::string, unsigned int>& GetSystemUpdateIntervals() const { return m_SystemUpdateIntervals; }
+  virtual void RemoveSystemUpdateIntervals() { m_SystemUpdateIntervals.clear(); }
+
+  // Keep every processed action in the engine action list (the default), or only the latest state of each active action
+  virtual bool IsRecordingProcessedActions() const { return m_RecordProcessedActions != cdm::eSwitch::Off; }
+  virtual void EnableRecordProcessedActions(cdm::eSwitch s) { m_RecordProcessedActions = s; }
+
 protected:
 
   bool                       m_Merge;
@@ -77,6 +90,8 @@ protected:
   SEDynamicStabilization*    m_DynamicStabilization;
   SEAutoSerialization*       m_AutoSerialization;
   cdm::eSwitch               m_WritePatientBaselineFile;
+  std::map<std::string, unsigned int> m_SystemUpdateIntervals;
+  cdm::eSwitch               m_RecordProcessedActions;
 
   ////////////////////
   /** Baroreceptors */
@@ -173,11 +188,16 @@ public:
   virtual bool HasStandardOxygenDiffusionCoefficient() const;
   virtual SEScalarAreaPerTimePressure& GetStandardOxygenDiffusionCoefficient();
   virtual double GetStandardOxygenDiffusionCoefficient(const AreaPerTimePressureUnit& unit) const;
+
+  // Blood gas distributions are solved from each compartment's last solution, instead of its current values
+  virtual bool IsWarmStartBloodGasSolverEnabled() const { return m_WarmStartBloodGasSolver == cdm::eSwitch::On; }
+  virtual void UseWarmStartBloodGasSolver(cdm::eSwitch s) { m_WarmStartBloodGasSolver = (s == cdm::eSwitch::NullSwitch) ? cdm::eSwitch::Off : s; }
 protected:
   SEScalarMassPerAmount*           m_MeanCorpuscularHemoglobin;
   SEScalarVolume*                  m_MeanCorpuscularVolume;
   SEScalarLength*                  m_StandardDiffusionDistance;
   SEScalarAreaPerTimePressure*     m_StandardOxygenDiffusionCoefficient;
+  cdm::eSwitch                     m_WarmStartBloodGasSolver;
 
   /////////////////////
   /** Cardiovascular */
@@ -302,8 +322,15 @@ protected:
 public:
   virtual bool IsPDEnabled() const { return m_PDEnabled==cdm::eSwitch::On; }
   virtual void UsePDModel(cdm::eSwitch s) { m_PDEnabled = (s == cdm::eSwitch::NullSwitch) ? cdm::eSwitch::On : s; }
+
+  // Partition coefficients are only recalculated when the pH or plasma lipid fractions change by more than this fraction
+  // The default of 0 recalculates them every time step
+  virtual bool HasPartitionCoefficientTolerance() const;
+  virtual SEScalar0To1& GetPartitionCoefficientTolerance();
+  virtual double GetPartitionCoefficientTolerance() const;
 protected:
   cdm::eSwitch m_PDEnabled;
+  SEScalar0To1* m_PartitionCoefficientTolerance;
 
   ///////////
   /** ECG */
@@ -313,8 +340,14 @@ public:
   virtual SEElectroCardioGramWaveformInterpolator& GetECGInterpolator();
   virtual const SEElectroCardioGramWaveformInterpolator* GetECGInterpolator() const;
   virtual void RemoveECGInterpolator();
+
+  // High rate ECG output is synthesized at this rate, when set
+  virtual bool HasECGSampleRate() const;
+  virtual SEScalarFrequency& GetECGSampleRate();
+  virtual double GetECGSampleRate(const FrequencyUnit& unit) const;
 //protected:
   SEElectroCardioGramWaveformInterpolator*         m_ECGInterpolator;
+  SEScalarFrequency*                               m_ECGSampleRate;
 
   /////////////
   /** Energy */
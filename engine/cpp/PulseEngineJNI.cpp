@@ -165,6 +165,8 @@ JNIEXPORT jstring JNICALL Java_mil_tatrc_physiology_pulse_engine_PulseEngine_nat
   const char* pStateFilename = env->GetStringUTFChars(stateFilename, JNI_FALSE);
   std::unique_ptr<google::protobuf::Message> data = engineJNI->eng->SaveState(pStateFilename);
   env->ReleaseStringUTFChars(stateFilename, pStateFilename);
+  if (data == nullptr)
+    return nullptr;// The engine logged why the state could not be saved
 
   std::string content;
   google::protobuf::TextFormat::PrintToString(*data, &content);
@@ -332,32 +334,116 @@ JNIEXPORT bool JNICALL Java_mil_tatrc_physiology_pulse_engine_PulseEngine_native
   }
   env->ReleaseStringUTFChars(actions, aStr);
 
+  return engineJNI->ProcessActions(aList);
+}
+
+extern "C"
+JNIEXPORT bool JNICALL Java_mil_tatrc_physiology_pulse_engine_PulseEngine_nativeProcessActionsBuffer(JNIEnv *env, jobject obj, jlong ptr, jobject actions, jint length)
+{
+  if (actions == nullptr || length <= 0)
+    return true;
+  PulseEngineJNI *engineJNI = reinterpret_cast<PulseEngineJNI*>(ptr);
+  engineJNI->jniEnv = env;
+  engineJNI->jniObj = obj;
+  // The buffer holds a binary serialized action list, parse it in place
+  void* aBytes = env->GetDirectBufferAddress(actions);
+  if (aBytes == nullptr || length > env->GetDirectBufferCapacity(actions))
+  {
+    engineJNI->GetLogger()->Error("Actions must be provided in a direct buffer");
+    return false;
+  }
+
+  cdm::ActionListData aList;
+  if (!aList.ParseFromArray(aBytes, length))
+  {
+    engineJNI->GetLogger()->Error("Unable to parse the action buffer");
+    return false;
+  }
+  return engineJNI->ProcessActions(aList);
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL Java_mil_tatrc_physiology_pulse_engine_PulseEngine_nativeSetDataBuffer(JNIEnv *env, jobject obj, jlong ptr, jobject buffer)
+{
+  PulseEngineJNI *engineJNI = reinterpret_cast<PulseEngineJNI*>(ptr);
+  engineJNI->jniEnv = env;
+  engineJNI->jniObj = obj;
+  engineJNI->dataBuffer = nullptr;
+  engineJNI->dataBufferSize = 0;
+  engineJNI->dataBufferColumns = 0;
+  if (buffer == nullptr)
+    return true;// Go back to pushing data through updateCDM
+  jdouble* data = static_cast<jdouble*>(env->GetDirectBufferAddress(buffer));
+  if (data == nullptr)
+  {
+    engineJNI->GetLogger()->Error("The data buffer must be a direct buffer");
+    return false;
+  }
+  // The capacity of a DoubleBuffer is in doubles
+  engineJNI->dataBuffer = data;
+  engineJNI->dataBufferSize = (size_t)env->GetDirectBufferCapacity(buffer);
+  // Java sized its rows with nativeGetDataColumns, rows are written with the same stride
+  engineJNI->dataBufferColumns = engineJNI->GetDataColumns();
+  return true;
+}
+
+extern "C"
+JNIEXPORT jint JNICALL Java_mil_tatrc_physiology_pulse_engine_PulseEngine_nativeGetDataColumns(JNIEnv *env, jobject obj, jlong ptr)
+{
+  PulseEngineJNI *engineJNI = reinterpret_cast<PulseEngineJNI*>(ptr);
+  engineJNI->jniEnv = env;
+  engineJNI->jniObj = obj;
+  return (jint)engineJNI->GetDataColumns();
+}
+
+extern "C"
+JNIEXPORT jint JNICALL Java_mil_tatrc_physiology_pulse_engine_PulseEngine_nativeAdvanceTimeAndCollect(JNIEnv *env, jobject obj, jlong ptr, jint steps)
+{
+  PulseEngineJNI *engineJNI = reinterpret_cast<PulseEngineJNI*>(ptr);
+  engineJNI->jniEnv = env;
+  engineJNI->jniObj = obj;
+  if (engineJNI->dataBuffer == nullptr || steps <= 0)
+  {
+    engineJNI->GetLogger()->Error("A data buffer must be registered to collect data");
+    return 0;
+  }
+  if ((size_t)steps * engineJNI->dataBufferColumns > engineJNI->dataBufferSize)
+  {
+    engineJNI->GetLogger()->Error("The data buffer is too small for the requested number of steps");
+    return 0;
+  }
+
+  // Each completed step is written to its own row of the buffer,
+  // we return how many rows were written
+  jint row = 0;
   try
   {
-    for (int i = 0; i < aList.anyaction_size(); i++)
+    for (; row < steps; row++)
     {
-      SEAction* a = SEAction::Load(aList.anyaction()[i], engineJNI->eng->GetSubstanceManager());
-      if (!engineJNI->eng->ProcessAction(*a))
-        success = false;
-      SAFE_DELETE(a);
+      engineJNI->eng->AdvanceModelTime();
+      double currentTime_s = engineJNI->eng->GetSimulationTime(TimeUnit::s);
+      engineJNI->eng->GetEngineTracker()->TrackData(currentTime_s);
+      if (row == 0)
+        engineJNI->PushHeadings();
+      if (!engineJNI->CollectData(currentTime_s, row))
+      {
+        engineJNI->GetLogger()->Error("Unable to write the tracked data into the data buffer");
+        break;
+      }
     }
   }
   catch (CommonDataModelException& ex)
   {
-    success = false;
     engineJNI->GetLogger()->Error(ex.what());
   }
   catch (std::exception& ex)
   {
-    success = false;
     engineJNI->GetLogger()->Error(ex.what());
   }
   catch (...)
   {
-    success = false;
   }
-
-  return success;
+  return row;
 }
 
 extern "C"
@@ -435,6 +521,9 @@ void PulseEngineJNI::Reset()
   jniFatalMethodID=nullptr;
   update_cnt = 0;
   updateFrequency_cnt = 45;// About every half second
+  dataBuffer = nullptr;
+  dataBufferSize = 0;
+  dataBufferColumns = 0;
 }
 
 void PulseEngineJNI::CustomExec(double time_s, PhysiologyEngine* engine)
@@ -445,43 +534,101 @@ void PulseEngineJNI::CustomExec(double time_s, PhysiologyEngine* engine)
     update_cnt = 0;
   }
 }
+void PulseEngineJNI::PushHeadings()
+{
+  if (firstUpdate && jniEnv != nullptr && jniObj != nullptr)
+  {
+    firstUpdate = false;
+    std::vector<std::string>& headings = trk->GetHeadings();
+    jobjectArray sary = jniEnv->NewObjectArray(headings.size(), jniEnv->FindClass("java/lang/String"), jniEnv->NewStringUTF(""));
+    for (unsigned int i = 0; i < headings.size(); i++)
+      jniEnv->SetObjectArrayElement(sary, i, jniEnv->NewStringUTF(headings[i].c_str()));
+    jmethodID m = jniEnv->GetMethodID(jniEnv->GetObjectClass(jniObj), "setCDMHeadings", "([Ljava/lang/String;)V");
+    if (m == nullptr)
+      std::cerr << "Can't find setCDMHeadings method in Java" << std::endl;
+    jniEnv->CallVoidMethod(jniObj, m, sary);
+  }
+}
 void PulseEngineJNI::PushData(double time_s)
 {
   if (jniEnv != nullptr && jniObj != nullptr)
   {
-    jmethodID m;
-    std::vector<std::string>& headings = trk->GetHeadings();
+    PushHeadings();
 
-    if (firstUpdate)
+    // With a registered buffer, Java reads the values once the call returns
+    if (dataBuffer != nullptr)
     {
-      firstUpdate = false;
-      jobjectArray sary = jniEnv->NewObjectArray(headings.size(), jniEnv->FindClass("java/lang/String"), jniEnv->NewStringUTF(""));
-      for (unsigned int i = 0; i < headings.size(); i++)
-        jniEnv->SetObjectArrayElement(sary, i, jniEnv->NewStringUTF(headings[i].c_str()));
-      m = jniEnv->GetMethodID(jniEnv->GetObjectClass(jniObj), "setCDMHeadings", "([Ljava/lang/String;)V");
-      if (m == nullptr)
-        std::cerr << "Can't find setCDMHeadings method in Java" << std::endl;
-      jniEnv->CallVoidMethod(jniObj, m, sary);
+      CollectData(time_s, 0);
+      return;
     }
 
     // Gather up the requested data into an array and pass it over to java
     // The order is set in the header order
-    jdoubleArray ary = jniEnv->NewDoubleArray(trk->GetProbes()->size());
+    std::vector<double>& probes = trk->GetProbes();
+    jdoubleArray ary = jniEnv->NewDoubleArray(probes.size());
+    jniEnv->SetDoubleArrayRegion(ary, 0, probes.size(), probes.data());
 
-    jboolean isCopy = JNI_FALSE;
-    jdouble* reqData = jniEnv->GetDoubleArrayElements(ary, &isCopy);
-    for (unsigned int i = 0; i < headings.size(); i++)
-      reqData[i] = trk->GetProbe(headings[i]);
-    if (isCopy == JNI_TRUE)
-      jniEnv->ReleaseDoubleArrayElements(ary, reqData, JNI_COMMIT);
-
-    m = jniEnv->GetMethodID(jniEnv->GetObjectClass(jniObj), "updateCDM", "(D[D)V");
+    jmethodID m = jniEnv->GetMethodID(jniEnv->GetObjectClass(jniObj), "updateCDM", "(D[D)V");
     if (m == nullptr)
       std::cerr << "Can't find updateCDM method in Java" << std::endl;
     jniEnv->CallVoidMethod(jniObj, m, time_s, ary);
   }
 }
 
+size_t PulseEngineJNI::GetDataColumns()
+{
+  // The tracker only makes its columns on its first TrackData, so hook up the requests now,
+  // this fixes the columns of the results file too, so the file and the buffer rows match
+  if (eng->GetEngineTracker()->GetDataRequestManager().HasDataRequests())
+    eng->GetEngineTracker()->SetupRequests();
+  return trk->GetProbes().size() + 1;
+}
+
+bool PulseEngineJNI::CollectData(double time_s, size_t row)
+{
+  std::vector<double>& probes = trk->GetProbes();
+  if (dataBuffer == nullptr || (row + 1) * dataBufferColumns > dataBufferSize)
+    return false;
+  if (probes.size() + 1 != dataBufferColumns)
+  {
+    GetLogger()->Error("The tracker columns changed since the data buffer was registered");
+    return false;
+  }
+  jdouble* r = dataBuffer + row * dataBufferColumns;
+  r[0] = time_s;
+  std::copy(probes.begin(), probes.end(), r + 1);
+  return true;
+}
+bool PulseEngineJNI::ProcessActions(const cdm::ActionListData& aList)
+{
+  bool success = true;
+  try
+  {
+    for (int i = 0; i < aList.anyaction_size(); i++)
+    {
+      SEAction* a = SEAction::Load(aList.anyaction()[i], eng->GetSubstanceManager());
+      if (!eng->ProcessAction(*a))
+        success = false;
+      SAFE_DELETE(a);
+    }
+  }
+  catch (CommonDataModelException& ex)
+  {
+    success = false;
+    GetLogger()->Error(ex.what());
+  }
+  catch (std::exception& ex)
+  {
+    success = false;
+    GetLogger()->Error(ex.what());
+  }
+  catch (...)
+  {
+    success = false;
+  }
+  return success;
+}
+
 void PulseEngineJNI::ForwardDebug(const std::string&  msg, const std::string&  origin)
 {
   if(jniEnv!=nullptr&&jniObj!=nullptr)
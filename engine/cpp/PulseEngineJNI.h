@@ -24,7 +24,13 @@ public:
   void ForwardError(const std::string&  msg, const std::string&  origin);
   void ForwardFatal(const std::string&  msg, const std::string&  origin);
   void CustomExec(double time_s, PhysiologyEngine* engine);
+  void PushHeadings();
   void PushData(double time_s);
+  // Number of values in a row of the data buffer, the time and every column of the tracker
+  size_t GetDataColumns();
+  // Writes the time and the tracked values, in column order, into a row of the registered data buffer
+  bool CollectData(double time_s, size_t row);
+  bool ProcessActions(const cdm::ActionListData& aList);
 
   void HandlePatientEvent(cdm::PatientData_eEvent type, bool active, const SEScalarTime* time = nullptr);
   void HandleAnesthesiaMachineEvent(cdm::AnesthesiaMachineData_eEvent type, bool active, const SEScalarTime* time = nullptr);
@@ -37,6 +43,11 @@ public:
   int        update_cnt;
   int        updateFrequency_cnt;
   std::unique_ptr<PulseEngine> eng;
+
+  // Direct buffer registered from Java, each row is the time followed by each tracked column
+  jdouble*   dataBuffer;
+  size_t     dataBufferSize;
+  size_t     dataBufferColumns;// Stride of a row, set when the buffer is registered
   
   jmethodID jniDebugMethodID;
   jmethodID jniInfoMethodID;
@@ -5,7 +5,14 @@
 #include "PulsePhysiologyEngine.h"
 #include "Controller/Controller.h"
 #include "Controller/ScenarioExec.h"
+#include "Controller/StabilizationCache.h"
+#include "PulseScenario.h"
 #include "utils/FileUtils.h"
+#include "utils/ResultsWriter.h"
+#include "utils/ProtobufFile.h"
+PROTO_PUSH
+#include "bind/engine/EngineState.pb.h"
+PROTO_POP
 
 bool PulseScenarioDriver::Configure(int argc, char* argv[])
 {
@@ -29,6 +36,53 @@ bool PulseScenarioDriver::Configure(int argc, char* argv[])
 
 void PulseScenarioDriver::Run()
 {
+  const std::string& binExt = BinaryResultsWriter::Extension;
+  if (m_file.size() > binExt.size() && m_file.compare(m_file.size() - binExt.size(), binExt.size(), binExt) == 0)
+  {// Convert a binary results file to the text layout
+    std::string csvFile = Replace(m_file, binExt, ".txt");
+    BinaryResultsReader reader;
+    if (!reader.Open(m_file) || !reader.WriteCSV(csvFile))
+      std::cerr << "Unable to convert " << m_file << std::endl;
+    return;
+  }
+  if (HasArgument("convert_state"))
+  {// Convert a state file, or every state file in a directory, to the other serialization format
+    std::vector<std::string> files;
+    ListFiles(m_file, files, ".pb");
+    if (files.empty())
+      files.push_back(m_file);
+    for (const std::string& file : files)
+    {
+      std::string converted;
+      if (GetSerializationFormat(file) == SerializationFormat::BINARY)
+        converted = Replace(file, BINARY_PROTOBUF_EXTENSION, ".pba");
+      else if (file.find(".pba") != std::string::npos)
+        converted = Replace(file, ".pba", BINARY_PROTOBUF_EXTENSION);
+      else
+        continue;
+      pulse::StateData state;
+      if (!LoadProtobufFile(file, state))
+      {
+        std::cerr << "Skipping " << file << ", it is not a state file" << std::endl;
+        continue;
+      }
+      if (!SaveProtobufFile(state, converted, GetSerializationFormat(converted)))
+        std::cerr << "Unable to convert " << file << std::endl;
+    }
+    return;
+  }
+
+  if (HasArgument("multirate_drift"))
+  {
+    std::string baseName = m_file;
+    baseName = Replace(baseName, "verification", "");
+    baseName = Replace(baseName, ".pba", "");
+    if (HasArgument("stabilization_cache"))
+      PulseStabilizationCache::SetDirectory("./stabilization_cache");
+    ReportMultiRateDrift(baseName);
+    return;
+  }
+
   // Set up the log file
   std::string logFile = m_file;
   logFile = Replace(logFile, "verification", "");
@@ -36,9 +90,12 @@ void PulseScenarioDriver::Run()
   // Set up the verification output file  
   std::string dataFile = m_file;
   dataFile = Replace(dataFile, "verification", "");
-  dataFile = Replace(dataFile, ".pba", "Results.txt");
+  dataFile = Replace(dataFile, ".pba", HasArgument("binary") ? "Results" + binExt : "Results.txt");
   // Delete any results file that may be there
   remove(dataFile.c_str());
+  // Scenarios that initialize the same patient and conditions can share their stabilized states
+  if (HasArgument("stabilization_cache"))
+    PulseStabilizationCache::SetDirectory("./stabilization_cache");
   std::unique_ptr<PhysiologyEngine> Pulse = CreatePulseEngine(logFile.c_str());
   if (!Pulse)
   {
@@ -69,6 +126,105 @@ bool PulseScenarioDriver::HasArgument(const std::string& argument)
     return m_arguments.find(argument) != end(m_arguments);
 }
 
+bool PulseScenarioDriver::RunScenario(const std::string& logFile, const std::string& dataFile, bool multiRate, double& wallTime_s)
+{
+  remove(dataFile.c_str());
+  std::unique_ptr<PhysiologyEngine> Pulse = CreatePulseEngine(logFile.c_str());
+  if (!Pulse)
+  {
+    std::cerr << "Unable to create PulseEngine" << std::endl;
+    return false;
+  }
+  try
+  {
+    PulseScenario scenario(Pulse->GetSubstanceManager());
+    if (!scenario.LoadFile(m_file))
+    {
+      std::cerr << "Unable to load scenario file : " << m_file << std::endl;
+      return false;
+    }
+    PulseConfiguration& config = scenario.GetConfiguration();
+    if (!multiRate)
+      config.RemoveSystemUpdateIntervals();
+    else if (config.GetSystemUpdateIntervals().empty())
+    {// Default to updating every slow system 5 times a second
+      for (const std::string& system : { "Endocrine", "Energy", "Gastrointestinal", "Hepatic", "Renal" })
+        config.SetSystemUpdateInterval(system, 10);
+    }
+    auto start = std::chrono::steady_clock::now();
+    PulseScenarioExec exec(*((PulseEngine*)Pulse.get()));
+    bool success = exec.Execute(scenario, dataFile, nullptr);
+    wallTime_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return success;
+  }
+  catch (std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+  }
+  catch (...)
+  {
+    std::cerr << "Unable to run scenario " << m_file << std::endl;
+  }
+  return false;
+}
+
+void PulseScenarioDriver::ReportMultiRateDrift(const std::string& baseName)
+{
+  const std::string& binExt = BinaryResultsWriter::Extension;
+  std::string singleFile = baseName + "SingleRateResults" + binExt;
+  std::string multiFile = baseName + "MultiRateResults" + binExt;
+  double singleTime_s = 0;
+  double multiTime_s = 0;
+  if (!RunScenario(baseName + "SingleRate.log", singleFile, false, singleTime_s) ||
+      !RunScenario(baseName + "MultiRate.log", multiFile, true, multiTime_s))
+  {
+    std::cerr << "Unable to run " << m_file << " at both rates" << std::endl;
+    return;
+  }
+
+  BinaryResultsReader single;
+  BinaryResultsReader multi;
+  if (!single.Open(singleFile) || !multi.Open(multiFile) || single.GetHeadings() != multi.GetHeadings())
+  {
+    std::cerr << "Unable to compare the results of " << m_file << std::endl;
+    return;
+  }
+  // Drift of each column is reported as the largest difference between the runs,
+  // and relative to the largest magnitude the column reached in the single rate run
+  std::string reportFile = baseName + "MultiRateDrift.csv";
+  std::ofstream report(reportFile);
+  report << "Heading,MaxAbsoluteDrift,MaxRelativeDrift(%),FinalRelativeDrift(%)" << std::endl;
+  size_t numRows = std::min(single.GetNumberOfRows(), multi.GetNumberOfRows());
+  double worst = 0;
+  std::string worstHeading;
+  for (size_t c = 0; c < single.GetHeadings().size(); c++)
+  {
+    double maxDrift = 0;
+    double maxMagnitude = 0;
+    double finalDrift = 0;
+    for (size_t r = 0; r < numRows; r++)
+    {
+      double a = single.GetRow(r)[c + 1];
+      double b = multi.GetRow(r)[c + 1];
+      if (std::isnan(a) || std::isnan(b))
+        continue;
+      maxDrift = std::max(maxDrift, std::abs(a - b));
+      maxMagnitude = std::max(maxMagnitude, std::abs(a));
+      finalDrift = std::abs(a - b);
+    }
+    double relative = maxMagnitude == 0 ? 0 : 100 * maxDrift / maxMagnitude;
+    double finalRelative = maxMagnitude == 0 ? 0 : 100 * finalDrift / maxMagnitude;
+    report << single.GetHeadings()[c] << "," << maxDrift << "," << relative << "," << finalRelative << std::endl;
+    if (relative >= worst)
+    {
+      worst = relative;
+      worstHeading = single.GetHeadings()[c];
+    }
+  }
+  std::cout << m_file << " : single rate " << singleTime_s << "s, multi-rate " << multiTime_s << "s, largest drift "
+            << worst << "% in " << worstHeading << ", see " << reportFile << std::endl;
+}
+
 int main(int argc, char* argv[])
 {
   try
@@ -16,6 +16,10 @@ public:
 
 private:
     bool HasArgument(const std::string& argument);
+    // Runs the scenario with slow systems updated every time step, and at their multi-rate intervals,
+    // then writes how far each result drifted between the two runs
+    void ReportMultiRateDrift(const std::string& baseName);
+    bool RunScenario(const std::string& logFile, const std::string& dataFile, bool multiRate, double& wallTime_s);
     std::string m_file;
     std::set<std::string> m_arguments;
 };
\ No newline at end of file
@@ -108,6 +108,14 @@ void BloodChemistry::Serialize(const pulse::BloodChemistrySystemData& src, Blood
   RunningAverage::Load(src.arterialcarbondioxideaverage_mmhg(), dst.m_ArterialCarbonDioxide_mmHg);
 }
 
+void BloodChemistry::Copy(const BloodChemistry& src, BloodChemistry& dst)
+{
+  SEBloodChemistrySystem::Copy(src, dst);
+  dst.m_ArterialOxygen_mmHg = src.m_ArterialOxygen_mmHg;
+  dst.m_ArterialCarbonDioxide_mmHg = src.m_ArterialCarbonDioxide_mmHg;
+  dst.SetUp();
+}
+
 pulse::BloodChemistrySystemData* BloodChemistry::Unload(const BloodChemistry& src)
 {
   pulse::BloodChemistrySystemData* dst = new pulse::BloodChemistrySystemData();
@@ -133,6 +141,8 @@ void BloodChemistry::SetUp()
   const PulseConfiguration& ConfigData = m_data.GetConfiguration();
   m_redBloodCellVolume_mL = ConfigData.GetMeanCorpuscularVolume(VolumeUnit::mL);
   m_HbPerRedBloodCell_ug_Per_ct = ConfigData.GetMeanCorpuscularHemoglobin(MassPerAmountUnit::ug_Per_ct);
+  m_data.GetSaturationCalculator().SetSolverMode(ConfigData.IsWarmStartBloodGasSolverEnabled() ?
+    SaturationCalculator::SolverMode::WarmStartAnalyticJacobian : SaturationCalculator::SolverMode::NumericalJacobian);
 
   //Substance
   SESubstance* acetoacetate = &m_data.GetSubstances().GetAcetoacetate();
@@ -34,6 +34,7 @@ public:
 
   static void Load(const pulse::BloodChemistrySystemData& src, BloodChemistry& dst);
   static pulse::BloodChemistrySystemData* Unload(const BloodChemistry& src);
+  static void Copy(const BloodChemistry& src, BloodChemistry& dst);
 protected:
   static void Serialize(const pulse::BloodChemistrySystemData& src, BloodChemistry& dst);
   static void Serialize(const BloodChemistry& src, pulse::BloodChemistrySystemData& dst);
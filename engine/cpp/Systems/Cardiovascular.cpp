@@ -250,6 +250,46 @@ void Cardiovascular::Serialize(const pulse::CardiovascularSystemData& src, Cardi
   RunningAverage::Load(src.cardiaccycleskinflow_ml_per_s(), dst.m_CardiacCycleSkinFlow_mL_Per_s);
 }
 
+void Cardiovascular::Copy(const Cardiovascular& src, Cardiovascular& dst)
+{
+  SECardiovascularSystem::Copy(src, dst);
+  dst.m_StartSystole = src.m_StartSystole;
+  dst.m_HeartFlowDetected = src.m_HeartFlowDetected;
+  dst.m_EnterCardiacArrest = src.m_EnterCardiacArrest;
+  dst.m_CardiacCyclePeriod_s = src.m_CardiacCyclePeriod_s;
+  dst.m_CurrentCardiacCycleDuration_s = src.m_CurrentCardiacCycleDuration_s;
+  dst.m_LeftHeartElastanceModifier = src.m_LeftHeartElastanceModifier;
+  dst.m_LeftHeartElastance_mmHg_Per_mL = src.m_LeftHeartElastance_mmHg_Per_mL;
+  dst.m_LeftHeartElastanceMax_mmHg_Per_mL = src.m_LeftHeartElastanceMax_mmHg_Per_mL;
+  dst.m_LeftHeartElastanceMin_mmHg_Per_mL = src.m_LeftHeartElastanceMin_mmHg_Per_mL;
+  dst.m_RightHeartElastance_mmHg_Per_mL = src.m_RightHeartElastance_mmHg_Per_mL;
+  dst.m_RightHeartElastanceMax_mmHg_Per_mL = src.m_RightHeartElastanceMax_mmHg_Per_mL;
+  dst.m_RightHeartElastanceMin_mmHg_Per_mL = src.m_RightHeartElastanceMin_mmHg_Per_mL;
+
+  dst.m_CompressionTime_s = src.m_CompressionTime_s;
+  dst.m_CompressionRatio = src.m_CompressionRatio;
+  dst.m_CompressionPeriod_s = src.m_CompressionPeriod_s;
+
+  dst.m_CurrentCardiacCycleTime_s = src.m_CurrentCardiacCycleTime_s;
+  dst.m_CardiacCycleDiastolicVolume_mL = src.m_CardiacCycleDiastolicVolume_mL;
+  dst.m_CardiacCycleAortaPressureLow_mmHg = src.m_CardiacCycleAortaPressureLow_mmHg;
+  dst.m_CardiacCycleAortaPressureHigh_mmHg = src.m_CardiacCycleAortaPressureHigh_mmHg;
+  dst.m_CardiacCyclePulmonaryArteryPressureLow_mmHg = src.m_CardiacCyclePulmonaryArteryPressureLow_mmHg;
+  dst.m_CardiacCyclePulmonaryArteryPressureHigh_mmHg = src.m_CardiacCyclePulmonaryArteryPressureHigh_mmHg;
+  dst.m_LastCardiacCycleMeanArterialCO2PartialPressure_mmHg = src.m_LastCardiacCycleMeanArterialCO2PartialPressure_mmHg;
+  dst.m_CardiacCycleStrokeVolume_mL = src.m_CardiacCycleStrokeVolume_mL;
+
+  dst.m_CardiacCycleArterialPressure_mmHg = src.m_CardiacCycleArterialPressure_mmHg;
+  dst.m_CardiacCycleArterialCO2PartialPressure_mmHg = src.m_CardiacCycleArterialCO2PartialPressure_mmHg;
+  dst.m_CardiacCyclePulmonaryCapillariesWedgePressure_mmHg = src.m_CardiacCyclePulmonaryCapillariesWedgePressure_mmHg;
+  dst.m_CardiacCyclePulmonaryCapillariesFlow_mL_Per_s = src.m_CardiacCyclePulmonaryCapillariesFlow_mL_Per_s;
+  dst.m_CardiacCyclePulmonaryShuntFlow_mL_Per_s = src.m_CardiacCyclePulmonaryShuntFlow_mL_Per_s;
+  dst.m_CardiacCyclePulmonaryArteryPressure_mmHg = src.m_CardiacCyclePulmonaryArteryPressure_mmHg;
+  dst.m_CardiacCycleCentralVenousPressure_mmHg = src.m_CardiacCycleCentralVenousPressure_mmHg;
+  dst.m_CardiacCycleSkinFlow_mL_Per_s = src.m_CardiacCycleSkinFlow_mL_Per_s;
+  dst.SetUp();
+}
+
 pulse::CardiovascularSystemData* Cardiovascular::Unload(const Cardiovascular& src)
 {
   pulse::CardiovascularSystemData* dst = new pulse::CardiovascularSystemData();
@@ -307,6 +347,8 @@ void Cardiovascular::SetUp()
   m_dT_s = m_data.GetTimeStep().GetValue(TimeUnit::s);
   m_patient = &m_data.GetPatient();
   m_minIndividialSystemicResistance__mmHg_s_Per_mL = 0.1;
+  m_CircuitProfileSlot = m_data.GetProfiler().RegisterSlot("Circuit", "Cardiovascular");
+  m_TransportProfileSlot = m_data.GetProfiler().RegisterSlot("Transport", "Cardiovascular");
 
   //Circuits
   m_CirculatoryCircuit = &m_data.GetCircuits().GetActiveCardiovascularCircuit();
@@ -651,8 +693,15 @@ void Cardiovascular::PreProcess()
 //--------------------------------------------------------------------------------------------------
 void Cardiovascular::Process()
 {
-  m_circuitCalculator.Process(*m_CirculatoryCircuit, m_dT_s);
-  m_transporter.Transport(*m_CirculatoryGraph, m_dT_s);
+  {
+    SEEngineProfiler::ScopedTimer timer(&m_data.GetProfiler(), m_CircuitProfileSlot);
+    m_circuitCalculator.Process(*m_CirculatoryCircuit, m_dT_s);
+    timer.SetIterations(m_circuitCalculator.GetNumberOfValveIterations());
+  }
+  {
+    SEEngineProfiler::ScopedTimer timer(&m_data.GetProfiler(), m_TransportProfileSlot);
+    m_transporter.Transport(*m_CirculatoryGraph, m_dT_s);
+  }
   CalculateVitalSigns();
 }
 
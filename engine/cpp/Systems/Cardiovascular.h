@@ -39,6 +39,7 @@ public:
 
   static void Load(const pulse::CardiovascularSystemData& src, Cardiovascular& dst);
   static pulse::CardiovascularSystemData* Unload(const Cardiovascular& src);
+  static void Copy(const Cardiovascular& src, Cardiovascular& dst);
 protected:
   static void Serialize(const pulse::CardiovascularSystemData& src, Cardiovascular& dst);
   static void Serialize(const Cardiovascular& src, pulse::CardiovascularSystemData& dst);
@@ -130,6 +131,8 @@ private:
   
   SEFluidCircuitCalculator         m_circuitCalculator;
   SELiquidTransporter              m_transporter;
+  size_t                           m_CircuitProfileSlot;
+  size_t                           m_TransportProfileSlot;
 
   SEPatient*                       m_patient;
 
@@ -54,6 +54,7 @@ void Drugs::Clear()
   m_liverVascular    = nullptr;
   m_liverTissue      = nullptr;
   m_IVToVenaCava     = nullptr;
+  m_PartitionCoefficientInputs.clear();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -75,6 +76,8 @@ void Drugs::Initialize()
   GetSedationLevel().SetValue(0.0);
   GetTidalVolumeChange().SetValue(0.0, VolumeUnit::mL);
   GetTubularPermeabilityChange().SetValue(0);
+
+  m_PartitionCoefficientInputs.clear();
 }
 
 void Drugs::Load(const pulse::DrugSystemData& src, Drugs& dst)
@@ -85,6 +88,41 @@ void Drugs::Load(const pulse::DrugSystemData& src, Drugs& dst)
 void Drugs::Serialize(const pulse::DrugSystemData& src, Drugs& dst)
 {
   SEDrugSystem::Serialize(src.common(), dst);
+
+  dst.m_PartitionCoefficientInputs.clear();
+  for (int i = 0; i < src.partitioncoefficientinputs_size(); i++)
+  {
+    const pulse::DrugSystemData_PartitionCoefficientInputsData& inputsData = src.partitioncoefficientinputs(i);
+    SESubstance* sub = dst.m_data.GetSubstances().GetSubstance(inputsData.substance());
+    if (sub == nullptr)
+    {
+      dst.Error("Unable to find substance " + inputsData.substance() + " for partition coefficient inputs");
+      continue;
+    }
+    PartitionCoefficientInputs& inputs = dst.m_PartitionCoefficientInputs[sub];
+    inputs.PlasmaPH = inputsData.plasmaph();
+    inputs.IntracellularPH = inputsData.intracellularph();
+    inputs.NeutralLipidInPlasmaVolumeFraction = inputsData.neutrallipidinplasmavolumefraction();
+    inputs.NeutralPhospholipidInPlasmaVolumeFraction = inputsData.neutralphospholipidinplasmavolumefraction();
+  }
+}
+
+void Drugs::Copy(const Drugs& src, Drugs& dst)
+{
+  SEDrugSystem::Copy(src, dst);
+
+  dst.m_PartitionCoefficientInputs.clear();
+  for (auto& itr : src.m_PartitionCoefficientInputs)
+  {
+    SESubstance* sub = dst.m_data.GetSubstances().GetSubstance(itr.first->GetName());
+    if (sub == nullptr)
+    {
+      dst.Error("Unable to find substance " + itr.first->GetName() + " for partition coefficient inputs");
+      continue;
+    }
+    dst.m_PartitionCoefficientInputs[sub] = itr.second;
+  }
+  dst.SetUp();
 }
 
 pulse::DrugSystemData* Drugs::Unload(const Drugs& src)
@@ -96,6 +134,20 @@ pulse::DrugSystemData* Drugs::Unload(const Drugs& src)
 void Drugs::Serialize(const Drugs& src, pulse::DrugSystemData& dst)
 {
   SEDrugSystem::Serialize(src, *dst.mutable_common());
+
+  // Written in substance order, so the same inputs always serialize the same
+  for (const SESubstance* sub : src.m_data.GetSubstances().GetSubstances())
+  {
+    auto itr = src.m_PartitionCoefficientInputs.find(sub);
+    if (itr == src.m_PartitionCoefficientInputs.end())
+      continue;
+    pulse::DrugSystemData_PartitionCoefficientInputsData* inputsData = dst.add_partitioncoefficientinputs();
+    inputsData->set_substance(sub->GetName());
+    inputsData->set_plasmaph(itr->second.PlasmaPH);
+    inputsData->set_intracellularph(itr->second.IntracellularPH);
+    inputsData->set_neutrallipidinplasmavolumefraction(itr->second.NeutralLipidInPlasmaVolumeFraction);
+    inputsData->set_neutralphospholipidinplasmavolumefraction(itr->second.NeutralPhospholipidInPlasmaVolumeFraction);
+  }
 }
 
 
@@ -370,6 +422,9 @@ void Drugs::AdministerSubstanceCompoundInfusion()
 /// To ensure the diffusion is modeled with PK for the substance, a check is performed for Ionic State. If 
 /// the property is present the coefficients are calculated. They are calculated for all tissue compartments.
 /// coefficients are set on the substance compartment effects for use during the diffusion calculation.
+/// The coefficients only depend on the plasma and intracellular pH and the plasma lipid fractions, so a substance's
+/// coefficients are only recalculated when it becomes active or when one of these values has changed by more than
+/// the configured partition coefficient tolerance since they were last calculated.
 //--------------------------------------------------------------------------------------------------
 void Drugs::CalculatePartitionCoefficients()
 {
@@ -388,6 +443,44 @@ void Drugs::CalculatePartitionCoefficients()
   double PartitionCoefficient = 0;
   double TissueToPlasmaProteinRatio = 0;
 
+  double tolerance = m_data.GetConfiguration().HasPartitionCoefficientTolerance() ? m_data.GetConfiguration().GetPartitionCoefficientTolerance() : 0;
+  auto changed = [tolerance](double now, double then) { return !(std::abs(now - then) <= tolerance * std::abs(then)); };
+
+  //Find the substances whose coefficients need to be recalculated
+  const std::vector<SESubstance*>& activeSubstances = m_data.GetCompartments().GetLiquidCompartmentSubstances();
+  std::vector<SESubstance*>& substances = m_PartitionCoefficientSubstances;
+  substances.clear();
+  for (SESubstance* sub : activeSubstances)
+  {
+    auto itr = m_PartitionCoefficientInputs.find(sub);
+    if (itr != m_PartitionCoefficientInputs.end() &&
+        !changed(PlasmaPH, itr->second.PlasmaPH) &&
+        !changed(IntracellularPH, itr->second.IntracellularPH) &&
+        !changed(NeutralLipidInPlasmaVolumeFraction, itr->second.NeutralLipidInPlasmaVolumeFraction) &&
+        !changed(NeutralPhosphoLipidInPlasmaVolumeFraction, itr->second.NeutralPhospholipidInPlasmaVolumeFraction))
+      continue;
+    PartitionCoefficientInputs& inputs = m_PartitionCoefficientInputs[sub];
+    inputs.PlasmaPH = PlasmaPH;
+    inputs.IntracellularPH = IntracellularPH;
+    inputs.NeutralLipidInPlasmaVolumeFraction = NeutralLipidInPlasmaVolumeFraction;
+    inputs.NeutralPhospholipidInPlasmaVolumeFraction = NeutralPhosphoLipidInPlasmaVolumeFraction;
+    substances.push_back(sub);
+  }
+  //Every active substance has inputs now, so any extra inputs belong to substances that are no longer active
+  //They are dropped, so they are recalculated if they become active again
+  if (m_PartitionCoefficientInputs.size() > activeSubstances.size())
+  {
+    for (auto itr = m_PartitionCoefficientInputs.begin(); itr != m_PartitionCoefficientInputs.end();)
+    {
+      if (std::find(activeSubstances.begin(), activeSubstances.end(), itr->first) == activeSubstances.end())
+        itr = m_PartitionCoefficientInputs.erase(itr);
+      else
+        ++itr;
+    }
+  }
+  if (substances.empty())
+    return;
+
   //Loop over tissue nodes
   for (SETissueCompartment* tissue : m_data.GetCompartments().GetTissueLeafCompartments())
   {
@@ -399,7 +492,7 @@ void Drugs::CalculatePartitionCoefficients()
     SELiquidCompartment& IntracellularFluid = m_data.GetCompartments().GetIntracellularFluid(*tissue);
 
     //Loop over substances
-    for (SESubstance* sub : m_data.GetCompartments().GetLiquidCompartmentSubstances())
+    for (SESubstance* sub : substances)
     {
       if (!sub->HasPK())
         continue;        
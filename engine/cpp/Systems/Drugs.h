@@ -30,6 +30,7 @@ public:
 
   static void Load(const pulse::DrugSystemData& src, Drugs& dst);
   static pulse::DrugSystemData* Unload(const Drugs& src);
+  static void Copy(const Drugs& src, Drugs& dst);
 protected:
   static void Serialize(const pulse::DrugSystemData& src, Drugs& dst);
   static void Serialize(const Drugs& src, pulse::DrugSystemData& dst);
@@ -54,6 +55,19 @@ protected:
   void CalculatePlasmaSubstanceConcentration();
   void CalculateDrugEffects();
 
+  // Inputs the partition coefficients of a substance were last calculated with
+  struct PartitionCoefficientInputs
+  {
+    double PlasmaPH;
+    double IntracellularPH;
+    double NeutralLipidInPlasmaVolumeFraction;
+    double NeutralPhospholipidInPlasmaVolumeFraction;
+  };
+  // Serializable member variables (Set in Initialize and in schema)
+  std::map<const SESubstance*, PartitionCoefficientInputs> m_PartitionCoefficientInputs;
+  // Substances whose partition coefficients are recalculated this time step, kept to reuse its memory
+  std::vector<SESubstance*> m_PartitionCoefficientSubstances;
+
   // Stateless member variable (Set in SetUp())
   double m_dt_s;
   SELiquidCompartment*  m_aortaVascular;
@@ -59,6 +59,12 @@ void Endocrine::Serialize(const pulse::EndocrineSystemData& src, Endocrine& dst)
   SEEndocrineSystem::Serialize(src.common(), dst);
 }
 
+void Endocrine::Copy(const Endocrine& src, Endocrine& dst)
+{
+  SEEndocrineSystem::Copy(src, dst);
+  dst.SetUp();
+}
+
 pulse::EndocrineSystemData* Endocrine::Unload(const Endocrine& src)
 {
 
@@ -31,6 +31,7 @@ public:
 
   static void Load(const pulse::EndocrineSystemData& src, Endocrine& dst);
   static pulse::EndocrineSystemData* Unload(const Endocrine& src);
+  static void Copy(const Endocrine& src, Endocrine& dst);
 protected:
   static void Serialize(const pulse::EndocrineSystemData& src, Endocrine& dst);
   static void Serialize(const Endocrine& src, pulse::EndocrineSystemData& dst);
@@ -43,6 +44,7 @@ public:
   void PreProcess(){}
   void Process();
   void PostProcess(){}
+  void SetUpdateTimeStep(double dt_s) { m_dt_s = dt_s; }
 
 private:
   void SynthesizeInsulin();
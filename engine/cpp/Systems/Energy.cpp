@@ -121,6 +121,19 @@ void Energy::Serialize(const pulse::EnergySystemData& src, Energy& dst)
   RunningAverage::Load(src.bicarbonatemolarity_mmol_per_l(), dst.m_BicarbonateMolarity_mmol_Per_L);
 }
 
+void Energy::Copy(const Energy& src, Energy& dst)
+{
+  SEEnergySystem::Copy(src, dst);
+  dst.m_UsableEnergyStore_J = src.m_UsableEnergyStore_J;
+  dst.m_PeakPowerEnergyStore_J = src.m_PeakPowerEnergyStore_J;
+  dst.m_MediumPowerEnergyStore_J = src.m_MediumPowerEnergyStore_J;
+  dst.m_EnduranceEnergyStore_J = src.m_EnduranceEnergyStore_J;
+
+  dst.m_BloodpH = src.m_BloodpH;
+  dst.m_BicarbonateMolarity_mmol_Per_L = src.m_BicarbonateMolarity_mmol_Per_L;
+  dst.SetUp();
+}
+
 pulse::EnergySystemData* Energy::Unload(const Energy& src)
 {
   pulse::EnergySystemData* dst = new pulse::EnergySystemData();
@@ -154,6 +167,7 @@ void Energy::SetUp()
   m_dT_s = m_data.GetTimeStep().GetValue(TimeUnit::s);
   m_PatientActions = &m_data.GetActions().GetPatientActions();
   m_Patient = &m_data.GetPatient();
+  m_CircuitProfileSlot = m_data.GetProfiler().RegisterSlot("Circuit", "Temperature");
 
   m_AortaHCO3 = m_data.GetCompartments().GetLiquidCompartment(pulse::VascularCompartment::Aorta)->GetSubstanceQuantity(m_data.GetSubstances().GetHCO3());
 
@@ -485,10 +499,24 @@ void Energy::Exercise()
 //--------------------------------------------------------------------------------------------------
 void Energy::Process()
 {
-  m_circuitCalculator.Process(*m_TemperatureCircuit, m_dT_s);
+  SolveTemperatureCircuit();
   CalculateVitalSigns();
 }
 
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Solves the temperature circuit
+///
+/// \details
+/// Only the temperature circuit is modified, so the solve can run alongside the processing of other systems.
+//--------------------------------------------------------------------------------------------------
+void Energy::SolveTemperatureCircuit()
+{
+  SEEngineProfiler::ScopedTimer timer(&m_data.GetProfiler(), m_CircuitProfileSlot);
+  m_circuitCalculator.Process(*m_TemperatureCircuit, m_dT_s);
+  timer.SetIterations(m_circuitCalculator.GetNumberOfValveIterations());
+}
+
 //--------------------------------------------------------------------------------------------------
 /// \brief
 /// Updates the parameters for the temperature circuit
@@ -662,8 +690,7 @@ void Energy::CalculateMetabolicHeatGeneration()
 /// Calculates the sweat rate if the core temperature is too high
 ///
 /// \details
-/// The sweat rate is calculated from a core temperature control function. The mass lost due to sweating is accounted for
-/// and a flow source from the skin extravascular to ground path is updated to ensure fluid loss
+/// The sweat rate is calculated from a core temperature control function. The fluid is removed by Sweat
 //--------------------------------------------------------------------------------------------------
 void Energy::CalculateSweatRate()
 {
@@ -679,14 +706,29 @@ void Energy::CalculateSweatRate()
   double sweatRate_kg_Per_s = (0.25*sweatHeatTranferCoefficient_W_Per_K / vaporizationEnergy_J_Per_kg)*(coreTemperature_degC - coreTemperatureHigh_degC);
   sweatRate_kg_Per_s = MAX(sweatRate_kg_Per_s, 0.0);
 
+  GetSweatRate().SetValue(sweatRate_kg_Per_s, MassPerTimeUnit::kg_Per_s);
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Removes the fluid lost to sweating
+///
+/// \details
+/// The mass lost due to sweating is accounted for and a flow source from the skin extravascular
+/// to ground path is updated to ensure fluid loss. The flow source is only applied for a single time step,
+/// so this is called every time step, even when the system is updated less often.
+//--------------------------------------------------------------------------------------------------
+void Energy::Sweat()
+{
+  if (!HasSweatRate())
+    return;
+  double sweatRate_kg_Per_s = GetSweatRate(MassPerTimeUnit::kg_Per_s);
 
   //Account for mass lost by substracting from the current patient mass
-  double massLost_kg = sweatRate_kg_Per_s*m_dT_s;
+  double massLost_kg = sweatRate_kg_Per_s*m_data.GetTimeStep().GetValue(TimeUnit::s);
   m_Patient->GetWeight().IncrementValue(-massLost_kg, MassUnit::kg);
 
-  GetSweatRate().SetValue(sweatRate_kg_Per_s, MassPerTimeUnit::kg_Per_s);
-
-  double sweatDensity_kg_Per_m3 = config.GetWaterDensity(MassPerVolumeUnit::kg_Per_m3); /// \todo Convert to sweat density once specific gravity calculation is in
+  double sweatDensity_kg_Per_m3 = m_data.GetConfiguration().GetWaterDensity(MassPerVolumeUnit::kg_Per_m3); /// \todo Convert to sweat density once specific gravity calculation is in
 
   //Set the flow source on the extravascular circuit to begin removing the fluid that is excreted
   double sweatRate_mL_Per_s = sweatRate_kg_Per_s / sweatDensity_kg_Per_m3 * 1.e6;
@@ -29,6 +29,7 @@ public:
 
   static void Load(const pulse::EnergySystemData& src, Energy& dst);
   static pulse::EnergySystemData* Unload(const Energy& src);
+  static void Copy(const Energy& src, Energy& dst);
 protected:
   static void Serialize(const pulse::EnergySystemData& src, Energy& dst);
   static void Serialize(const Energy& src, pulse::EnergySystemData& dst);
@@ -41,12 +42,15 @@ public:
   void PreProcess();
   void Process();
   void PostProcess();
+  void SetUpdateTimeStep(double dt_s) { m_dT_s = dt_s; }
 
 private:
 
   // Preprocess Methods
   void CalculateMetabolicHeatGeneration();
   void CalculateSweatRate();
+  // Called by the engine every time step, including the ones the system is not updated in
+  void Sweat();
   void UpdateHeatResistance();
   // Actions/Conditions
   void Exercise();
@@ -57,6 +61,7 @@ private:
   void CalculateBasalMetabolicRate();
 
   // Process Methods
+  void SolveTemperatureCircuit();
   void CalculateVitalSigns();
 
   // Serializable member variables (Set in Initialize and in schema)
@@ -84,5 +89,6 @@ private:
   SEThermalCircuit*           m_InternalTemperatureCircuit;
   SEThermalCircuit*           m_TemperatureCircuit;
   SEThermalCircuitCalculator  m_circuitCalculator;
+  size_t                      m_CircuitProfileSlot;
 };
 
@@ -106,6 +106,13 @@ void Environment::Serialize(const pulse::EnvironmentData& src, Environment& dst)
   dst.m_PatientEquivalentDiameter_m = src.patientequivalentdiameter_m();
 }
 
+void Environment::Copy(const Environment& src, Environment& dst)
+{
+  SEEnvironment::Copy(src, dst);
+  dst.m_PatientEquivalentDiameter_m = src.m_PatientEquivalentDiameter_m;
+  dst.SetUp();
+}
+
 pulse::EnvironmentData* Environment::Unload(const Environment& src)
 {
   pulse::EnvironmentData* dst = new pulse::EnvironmentData();
@@ -191,6 +198,7 @@ void Environment::StateChange()
       subQ->GetVolume().SetValue(std::numeric_limits<double>::infinity(), VolumeUnit::L);
     }
     m_AmbientGases->GetPressure().Set(GetConditions().GetAtmosphericPressure());
+    m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
     m_AmbientGases->Balance(BalanceGasBy::VolumeFraction);
   }
   // Add aerosols to the environment compartment
@@ -29,6 +29,7 @@ public:
 
   static void Load(const pulse::EnvironmentData& src, Environment& dst);
   static pulse::EnvironmentData* Unload(const Environment& src);
+  static void Copy(const Environment& src, Environment& dst);
 protected:
   static void Serialize(const pulse::EnvironmentData& src, Environment& dst);
   static void Serialize(const Environment& src, pulse::EnvironmentData& dst);
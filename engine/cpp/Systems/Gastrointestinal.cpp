@@ -106,6 +106,14 @@ void Gastrointestinal::Serialize(const pulse::GastrointestinalSystemData& src, G
   SEGastrointestinalSystem::Serialize(src.common(), dst);
 }
 
+void Gastrointestinal::Copy(const Gastrointestinal& src, Gastrointestinal& dst)
+{
+  SEGastrointestinalSystem::Copy(src, dst);
+  dst.SetUp();
+  // We assume state is from after all stabilization
+  dst.m_DecrementNutrients = true;
+}
+
 pulse::GastrointestinalSystemData* Gastrointestinal::Unload(const Gastrointestinal& src)
 {
   pulse::GastrointestinalSystemData* dst = new pulse::GastrointestinalSystemData();
@@ -174,6 +182,7 @@ void Gastrointestinal::AtSteadyState()
       m_data.GetPatient().GetWeight().IncrementValue(m_StomachContents->GetWeight(MassUnit::g), MassUnit::g);
       // Empty out the gut
       m_SmallIntestineChyme->GetVolume().SetValue(0, VolumeUnit::mL);
+      m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
       m_SmallIntestineChymeGlucose->GetMass().SetValue(0,MassUnit::ug);
       m_SmallIntestineChymeGlucose->Balance(BalanceLiquidBy::Mass);
       m_SmallIntestineChymeTristearin->GetMass().SetValue(0, MassUnit::ug);
@@ -281,7 +290,6 @@ void Gastrointestinal::PreProcess()
       m_data.GetPatient().GetWeight().IncrementValue(c->GetNutrition().GetWeight(MassUnit::kg), MassUnit::kg);
       m_data.GetActions().GetPatientActions().RemoveConsumeNutrients();
     }
-    GastricSecretion(m_dT_s); // Move some water from the Gut EV fluids to the Stomach
     DigestStomachNutrients(m_dT_s);
   }
   else
@@ -301,15 +309,19 @@ void Gastrointestinal::PreProcess()
 /// Absorb fluids from the tissues back into the stomach so it always has fluid in it
 ///
 /// \details
-/// Fluid absorption is based on time step at a constant rate
+/// Fluid absorption is based on time step at a constant rate.
+/// This is called every time step, even when the system is updated less often,
+/// as the circuit only applies the flow source for the time step it is set in.
 //--------------------------------------------------------------------------------------------------
-void Gastrointestinal::GastricSecretion(double duration_s)
+void Gastrointestinal::GastricSecretion()
 {
+  if (m_data.GetState() != EngineState::Active)
+    return;
   // Increase the water in the stomach by the flow rate
   // Take it out of the tissue at the same rate it's being added to the stomach
   //There is a compliance, so the volume will be modified accordingly
   m_GutT1ToGroundPath->GetNextFlowSource().SetValue(m_secretionRate_mL_Per_s, VolumePerTimeUnit::mL_Per_s);
-  m_StomachContents->GetWater().IncrementValue(m_secretionRate_mL_Per_s * duration_s, VolumeUnit::mL);
+  m_StomachContents->GetWater().IncrementValue(m_secretionRate_mL_Per_s * m_data.GetTimeStep().GetValue(TimeUnit::s), VolumeUnit::mL);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -366,6 +378,7 @@ void Gastrointestinal::DigestStomachNutrients(double duration_s)
     Info(m_ss);
 #endif
     m_SmallIntestineChyme->GetVolume().IncrementValue(digestedAmount, VolumeUnit::mL);
+    m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
   }
   // Balance Sodium, now that we have proper volume on the gut
   m_SmallIntestineChymeSodium->Balance(BalanceLiquidBy::Mass);
@@ -515,11 +528,29 @@ void Gastrointestinal::AbsorbNutrients(double duration_s)
     }
   }
  
+  // Moved into the vasculature every time step until the next update, see ChymeAbsorption
   GetChymeAbsorptionRate().SetValue(absorptionRate_mL_Per_min, VolumePerTimeUnit::mL_Per_min);
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Move the absorbed chyme into the vascular system
+///
+/// \details
+/// The chyme absorption rate is applied to the circuit for a single time step.
+/// This is called every time step, even when the system is updated less often,
+/// so the volume removed from the chyme is the volume the circuit moves.
+//--------------------------------------------------------------------------------------------------
+void Gastrointestinal::ChymeAbsorption()
+{
+  if (!HasChymeAbsorptionRate())
+    return;
+  double absorptionRate_mL_Per_min = GetChymeAbsorptionRate(VolumePerTimeUnit::mL_Per_min);
   //This will move substances
   m_GItoCVPath->GetNextFlowSource().SetValue(absorptionRate_mL_Per_min, VolumePerTimeUnit::mL_Per_min);
   //Need to manually remove volume, since there isn't a compliance
-  m_GItoCVPath->GetSourceNode().GetNextVolume().IncrementValue(-absorptionRate_mL_Per_min / 60.0 * m_dT_s, VolumeUnit::mL);
+  m_GItoCVPath->GetSourceNode().GetNextVolume().IncrementValue(-absorptionRate_mL_Per_min / 60.0 * m_data.GetTimeStep().GetValue(TimeUnit::s), VolumeUnit::mL);
+  m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -558,6 +589,7 @@ void Gastrointestinal::AbsorbMeal(double duration_min)
   Info(m_ss);
 #endif
   m_SmallIntestineChyme->GetVolume().IncrementValue(-absorbedVolume_mL, VolumeUnit::mL);
+  m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
 
   SEScalarVolume absorbedVolume;
   absorbedVolume.SetValue(absorbedVolume_mL, VolumeUnit::mL);
@@ -28,6 +28,7 @@ public:
 
   static void Load(const pulse::GastrointestinalSystemData& src, Gastrointestinal& dst);
   static pulse::GastrointestinalSystemData* Unload(const Gastrointestinal& src);
+  static void Copy(const Gastrointestinal& src, Gastrointestinal& dst);
 protected:
   static void Serialize(const pulse::GastrointestinalSystemData& src, Gastrointestinal& dst);
   static void Serialize(const Gastrointestinal& src, pulse::GastrointestinalSystemData& dst);
@@ -40,10 +41,13 @@ public:
   void PreProcess();
   void Process();
   void PostProcess();
+  void SetUpdateTimeStep(double dt_s) { m_dT_s = dt_s; }
 
 protected:
 
-  void   GastricSecretion(double duration_s);
+  // Called by the engine every time step, including the ones the system is not updated in
+  void   GastricSecretion();
+  void   ChymeAbsorption();
   void   DefaultNutritionRates(SENutrition& n);
   void   DigestStomachNutrients(double duration_s);
   double DigestNutrient(SEUnitScalar& totalAmt, SEUnitScalar& rate, bool mass, double duration_s);
@@ -39,6 +39,12 @@ void Hepatic::Serialize(const pulse::HepaticSystemData& src, Hepatic& dst)
   SEHepaticSystem::Serialize(src.common(), dst);
 }
 
+void Hepatic::Copy(const Hepatic& src, Hepatic& dst)
+{
+  SEHepaticSystem::Copy(src, dst);
+  dst.SetUp();
+}
+
 pulse::HepaticSystemData* Hepatic::Unload(const Hepatic& src)
 {
   pulse::HepaticSystemData* dst = new pulse::HepaticSystemData();
@@ -26,6 +26,7 @@ public:
 
   static void Load(const pulse::HepaticSystemData& src, Hepatic& dst);
   static pulse::HepaticSystemData* Unload(const Hepatic& src);
+  static void Copy(const Hepatic& src, Hepatic& dst);
 protected:
   static void Serialize(const pulse::HepaticSystemData& src, Hepatic& dst);
   static void Serialize(const Hepatic& src, pulse::HepaticSystemData& dst);
@@ -77,6 +77,16 @@ void Nervous::Serialize(const pulse::NervousSystemData& src, Nervous& dst)
   dst.m_ArterialCarbonDioxideSetPoint_mmHg = src.arterialcarbondioxidesetpoint_mmhg();
 }
 
+void Nervous::Copy(const Nervous& src, Nervous& dst)
+{
+  SENervousSystem::Copy(src, dst);
+  // We assume state have to be after all stabilization
+  dst.m_FeedbackActive = true;
+  dst.m_ArterialOxygenSetPoint_mmHg = src.m_ArterialOxygenSetPoint_mmHg;
+  dst.m_ArterialCarbonDioxideSetPoint_mmHg = src.m_ArterialCarbonDioxideSetPoint_mmHg;
+  dst.SetUp();
+}
+
 pulse::NervousSystemData* Nervous::Unload(const Nervous& src)
 {
   pulse::NervousSystemData* dst = new pulse::NervousSystemData();
@@ -27,6 +27,7 @@ public:
 
   static void Load(const pulse::NervousSystemData& src, Nervous& dst);
   static pulse::NervousSystemData* Unload(const Nervous& src);
+  static void Copy(const Nervous& src, Nervous& dst);
 protected:
   static void Serialize(const pulse::NervousSystemData& src, Nervous& dst);
   static void Serialize(const Nervous& src, pulse::NervousSystemData& dst);
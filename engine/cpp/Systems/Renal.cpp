@@ -274,6 +274,26 @@ void Renal::Serialize(const pulse::RenalSystemData& src, Renal& dst)
   RunningAverage::Load(src.rightrenalarterialpressure_mmhg(),dst.m_rightRenalArterialPressure_mmHg_runningAvg);
 }
 
+void Renal::Copy(const Renal& src, Renal& dst)
+{
+  SERenalSystem::Copy(src, dst);
+  dst.m_Urinating = src.m_Urinating;
+  dst.m_leftAfferentResistance_mmHg_s_Per_mL = src.m_leftAfferentResistance_mmHg_s_Per_mL;
+  dst.m_rightAfferentResistance_mmHg_s_Per_mL = src.m_rightAfferentResistance_mmHg_s_Per_mL;
+  dst.m_leftSodiumFlowSetPoint_mg_Per_s = src.m_leftSodiumFlowSetPoint_mg_Per_s;
+  dst.m_rightSodiumFlowSetPoint_mg_Per_s = src.m_rightSodiumFlowSetPoint_mg_Per_s;
+
+  dst.m_urineProductionRate_mL_Per_min_runningAvg = src.m_urineProductionRate_mL_Per_min_runningAvg;
+  dst.m_urineOsmolarity_mOsm_Per_L_runningAvg = src.m_urineOsmolarity_mOsm_Per_L_runningAvg;
+  dst.m_sodiumConcentration_mg_Per_mL_runningAvg = src.m_sodiumConcentration_mg_Per_mL_runningAvg;
+  dst.m_sodiumExcretionRate_mg_Per_min_runningAvg = src.m_sodiumExcretionRate_mg_Per_min_runningAvg;
+  dst.m_leftSodiumFlow_mg_Per_s_runningAvg = src.m_leftSodiumFlow_mg_Per_s_runningAvg;
+  dst.m_rightSodiumFlow_mg_Per_s_runningAvg = src.m_rightSodiumFlow_mg_Per_s_runningAvg;
+  dst.m_leftRenalArterialPressure_mmHg_runningAvg = src.m_leftRenalArterialPressure_mmHg_runningAvg;
+  dst.m_rightRenalArterialPressure_mmHg_runningAvg = src.m_rightRenalArterialPressure_mmHg_runningAvg;
+  dst.SetUp();
+}
+
 pulse::RenalSystemData* Renal::Unload(const Renal& src)
 {
   pulse::RenalSystemData* dst = new pulse::RenalSystemData();
@@ -302,6 +322,7 @@ void Renal::Serialize(const Renal& src, pulse::RenalSystemData& dst)
 void Renal::SetUp()
 {  
   m_dt = m_data.GetTimeStep().GetValue(TimeUnit::s);  
+  m_processDt = m_dt;
   m_patient = &m_data.GetPatient();
 
   //Substances
@@ -692,7 +713,7 @@ void Renal::CalculateGluconeogenesis()
       lactateExcreted_mg = m_SubstanceTransport.rightLactateExcretedMass_mg;
     }
 
-    double reabsorptionRate_mg_Per_s = (lactateExcreted_mg + glucoseReabsorptionMass_mg) / m_dt;
+    double reabsorptionRate_mg_Per_s = (lactateExcreted_mg + glucoseReabsorptionMass_mg) / m_processDt;
     
     //Convert 1-to-1 Lactate to Glucose and put in PeritubularCapillaries
     //If Converted Glucose + Reabsorbed Glucose > TM, the difference is excreted as Lactate
@@ -702,7 +723,7 @@ void Renal::CalculateGluconeogenesis()
       reabsorptionRate_mg_Per_s = MIN(reabsorptionRate_mg_Per_s, transportMaximum_mg_Per_s);
     }
 
-    double massToMove_mg = reabsorptionRate_mg_Per_s * m_dt;
+    double massToMove_mg = reabsorptionRate_mg_Per_s * m_processDt;
     massToMove_mg = MAX(massToMove_mg, 0.0);
     double lactateConverted_mg = massToMove_mg - glucoseReabsorptionMass_mg;
     lactateExcreted_mg = massToMove_mg - (lactateExcreted_mg + glucoseReabsorptionMass_mg);
@@ -724,7 +745,7 @@ void Renal::CalculateGluconeogenesis()
 
     //Set the substance output values
     totalReabsorptionRate_mg_Per_s += reabsorptionRate_mg_Per_s;
-    totalLactateExcretionRate_mg_Per_s += lactateExcreted_mg / m_dt;
+    totalLactateExcretionRate_mg_Per_s += lactateExcreted_mg / m_processDt;
   }
 
   //Set the substance output values
@@ -734,7 +755,7 @@ void Renal::CalculateGluconeogenesis()
   double patientWeight_kg = m_patient->GetWeight(MassUnit::kg);
   m_lactate->GetClearance().GetRenalClearance().SetValue(totalLactateExcretionRate_mg_Per_s / plasmaConcentration_mg_Per_mL / patientWeight_kg, VolumePerTimeMassUnit::mL_Per_s_kg);
 
-  double singleExcreted_mg = totalLactateExcretionRate_mg_Per_s * m_dt * 0.5;// We are assuming the kindney's are doing the same amount of work
+  double singleExcreted_mg = totalLactateExcretionRate_mg_Per_s * m_processDt * 0.5;// We are assuming the kindney's are doing the same amount of work
   m_leftKidneyIntracellularLactate->GetMassExcreted().IncrementValue(singleExcreted_mg, MassUnit::mg);
   m_leftKidneyIntracellularLactate->GetMassCleared().IncrementValue(singleExcreted_mg, MassUnit::mg);
   m_rightKidneyIntracellularLactate->GetMassExcreted().IncrementValue(singleExcreted_mg, MassUnit::mg);
@@ -862,7 +883,7 @@ void Renal::CalculateGlomerularTransport(SESubstance& sub)
     //Determine how much is unbound - i.e. available to move
     double fractionUnbound = sub.GetClearance().GetFractionUnboundInPlasma().GetValue();
 
-    double massToMove_mg = concentration_mg_Per_mL * flow_mL_Per_s * m_dt * filterability * fractionUnbound;
+    double massToMove_mg = concentration_mg_Per_mL * flow_mL_Per_s * m_processDt * filterability * fractionUnbound;
     
     //Make sure we don't try to move too much
     massToMove_mg = MIN(massToMove_mg, glomerularSubQ->GetMass().GetValue(MassUnit::mg));
@@ -883,7 +904,7 @@ void Renal::CalculateGlomerularTransport(SESubstance& sub)
     bowmansSubQ->Balance(BalanceLiquidBy::Mass);
     
     //Set the substance output values
-    filtrationRate_mg_Per_s += massToMove_mg / m_dt;
+    filtrationRate_mg_Per_s += massToMove_mg / m_processDt;
   }
 
   //Set the substance output values
@@ -1083,13 +1104,13 @@ void Renal::CalculateReabsorptionTransport(SESubstance& sub)
       double massModification = 1.0 / permeabilityModificationFactor;
       //limit the ratio to 1 to allow for concentrated urine
       massModification = MIN(massModification, 1.0);
-      massToMove_mg = concentration_mg_Per_mL * flow_mL_Per_s * m_dt * reabsorptionRatio * massModification;
+      massToMove_mg = concentration_mg_Per_mL * flow_mL_Per_s * m_processDt * reabsorptionRatio * massModification;
     }        
 
     //Make sure we don't try to move too much
     massToMove_mg = MIN(massToMove_mg, tubulesSubQ->GetMass().GetValue(MassUnit::mg));
 
-    double reabsorptionRate_mg_Per_s = massToMove_mg / m_dt;
+    double reabsorptionRate_mg_Per_s = massToMove_mg / m_processDt;
     //Stay below the maximum allowable transport
     if (!sub.GetClearance().GetRenalTransportMaximum().IsInfinity())
     {
@@ -1097,7 +1118,7 @@ void Renal::CalculateReabsorptionTransport(SESubstance& sub)
       reabsorptionRate_mg_Per_s = MIN(reabsorptionRate_mg_Per_s, transportMaximum_mg_Per_s);
     }  
     
-    massToMove_mg = reabsorptionRate_mg_Per_s * m_dt;
+    massToMove_mg = reabsorptionRate_mg_Per_s * m_processDt;
 
     //Store information about glucose to be used later in Gluconeogenesis
     if (&sub == m_glucose)
@@ -1181,12 +1202,12 @@ void Renal::CalculateExcretion(SESubstance& sub)
       if (kidney == 0)
       {
         //Left
-        m_SubstanceTransport.leftLactateExcretedMass_mg = excretionRate_mg_Per_s * m_dt;
+        m_SubstanceTransport.leftLactateExcretedMass_mg = excretionRate_mg_Per_s * m_processDt;
       }
       else
       {
         //Right
-        m_SubstanceTransport.rightLactateExcretedMass_mg = excretionRate_mg_Per_s * m_dt;
+        m_SubstanceTransport.rightLactateExcretedMass_mg = excretionRate_mg_Per_s * m_processDt;
       }
     }
   }
@@ -1210,7 +1231,7 @@ void Renal::CalculateExcretion(SESubstance& sub)
     SELiquidSubstanceQuantity* leftKidneySubQ = m_data.GetCompartments().GetIntracellularFluid(*m_leftKidneyTissue).GetSubstanceQuantity(sub);
     SELiquidSubstanceQuantity* rightKidneySubQ = m_data.GetCompartments().GetIntracellularFluid(*m_rightKidneyTissue).GetSubstanceQuantity(sub);
 
-    double singleExcreted_mg = totalExcretionRate_mg_Per_s * m_dt * 0.5;// We are assuming the kindneys are doing the same amount of work
+    double singleExcreted_mg = totalExcretionRate_mg_Per_s * m_processDt * 0.5;// We are assuming the kindneys are doing the same amount of work
     leftKidneySubQ->GetMassExcreted().IncrementValue(singleExcreted_mg, MassUnit::mg);
     leftKidneySubQ->GetMassCleared().IncrementValue(singleExcreted_mg, MassUnit::mg);
     rightKidneySubQ->GetMassExcreted().IncrementValue(singleExcreted_mg, MassUnit::mg);
@@ -1241,7 +1262,7 @@ void Renal::CalculateAutomaticClearance(SESubstance& sub)
     return;//nothing to do
 
   //Renal Volume Cleared - Clearance happens through the renal system
-  renalVolumeCleared_mL = (clearance.GetRenalClearance().GetValue(VolumePerTimeMassUnit::mL_Per_s_kg) * patientWeight_kg * m_dt) / 2;
+  renalVolumeCleared_mL = (clearance.GetRenalClearance().GetValue(VolumePerTimeMassUnit::mL_Per_s_kg) * patientWeight_kg * m_processDt) / 2;
 
   double massCleared_ug = 0.0;
 
@@ -1635,6 +1656,7 @@ void Renal::UpdateBladderVolume()
   //The urination action will catch it next time around, so this shouldn't be hit more than once (and likely never)
   bladderVolume_mL = MAX(bladderVolume_mL, 0.0);
   m_bladderNode->GetNextVolume().SetValue(bladderVolume_mL, VolumeUnit::mL);  
+  m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
 }
 
 //--------------------------------------------------------------------------------------------------
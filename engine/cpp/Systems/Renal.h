@@ -23,6 +23,7 @@ protected:
   PulseController& m_data;
 
   double m_dt;
+  double m_processDt;// Time covered by Process, more than m_dt when Process is updated less often than every time step
   
 public:
   virtual ~Renal();
@@ -34,6 +35,7 @@ public:
 
   static void Load(const pulse::RenalSystemData& src, Renal& dst);
   static pulse::RenalSystemData* Unload(const Renal& src);
+  static void Copy(const Renal& src, Renal& dst);
 protected:
   static void Serialize(const pulse::RenalSystemData& src, Renal& dst);
   static void Serialize(const Renal& src, pulse::RenalSystemData& dst);
@@ -46,6 +48,8 @@ public:
   void PreProcess();  
   void Process();  
   void PostProcess();
+  // Only Process can be updated less often, the rest of Renal adjusts the circulatory circuit every time step
+  void SetUpdateTimeStep(double dt_s) { m_processDt = dt_s; }
 
   // Assessments
   bool CalculateUrinalysis(SEUrinalysis& u);
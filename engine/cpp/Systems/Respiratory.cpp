@@ -253,6 +253,52 @@ void Respiratory::Serialize(const pulse::RespiratorySystemData& src, Respiratory
   dst.m_ConsciousEndPressure_cmH2O = src.consciousendpressure_cmh2o();
 }
 
+void Respiratory::Copy(const Respiratory& src, Respiratory& dst)
+{
+  SERespiratorySystem::Copy(src, dst);
+  dst.m_InitialExpiratoryReserveVolume_L = src.m_InitialExpiratoryReserveVolume_L;
+  dst.m_InitialFunctionalResidualCapacity_L = src.m_InitialFunctionalResidualCapacity_L;
+  dst.m_InitialInspiratoryCapacity_L = src.m_InitialInspiratoryCapacity_L;
+  dst.m_InitialResidualVolume_L = src.m_InitialResidualVolume_L;
+
+  dst.m_bNotBreathing = src.m_bNotBreathing;
+  dst.m_TopBreathTotalVolume_L = src.m_TopBreathTotalVolume_L;
+  dst.m_TopBreathAlveoliVolume_L = src.m_TopBreathAlveoliVolume_L;
+  dst.m_TopBreathDeadSpaceVolume_L = src.m_TopBreathDeadSpaceVolume_L;
+  dst.m_TopBreathPleuralPressure_cmH2O = src.m_TopBreathPleuralPressure_cmH2O;
+  dst.m_LastCardiacCycleBloodPH = src.m_LastCardiacCycleBloodPH;
+  dst.m_PreviousTotalLungVolume_L = src.m_PreviousTotalLungVolume_L;
+  dst.m_BloodPHRunningAverage = src.m_BloodPHRunningAverage;
+
+  dst.m_BreathingCycle = src.m_BreathingCycle;
+  dst.m_ArterialO2PartialPressure_mmHg = src.m_ArterialO2PartialPressure_mmHg;
+  dst.m_ArterialCO2PartialPressure_mmHg = src.m_ArterialCO2PartialPressure_mmHg;
+  dst.m_BreathingCycleTime_s = src.m_BreathingCycleTime_s;
+  dst.m_BreathTimeExhale_min = src.m_BreathTimeExhale_min;
+  dst.m_DefaultDrivePressure_cmH2O = src.m_DefaultDrivePressure_cmH2O;
+  dst.m_DriverPressure_cmH2O = src.m_DriverPressure_cmH2O;
+  dst.m_DriverPressureMin_cmH2O = src.m_DriverPressureMin_cmH2O;
+  dst.m_ElapsedBreathingCycleTime_min = src.m_ElapsedBreathingCycleTime_min;
+  dst.m_IEscaleFactor = src.m_IEscaleFactor;
+  dst.m_InstantaneousFunctionalResidualCapacity_L = src.m_InstantaneousFunctionalResidualCapacity_L;
+  dst.m_MaxDriverPressure_cmH2O = src.m_MaxDriverPressure_cmH2O;
+  dst.m_PeakRespiratoryDrivePressure_cmH2O = src.m_PeakRespiratoryDrivePressure_cmH2O;
+  dst.m_PreviousTargetAlveolarVentilation_L_Per_min = src.m_PreviousTargetAlveolarVentilation_L_Per_min;
+  dst.m_VentilationFrequency_Per_min = src.m_VentilationFrequency_Per_min;
+  dst.m_VentilationToTidalVolumeSlope = src.m_VentilationToTidalVolumeSlope;
+  dst.m_ArterialO2RunningAverage_mmHg = src.m_ArterialO2RunningAverage_mmHg;
+  dst.m_ArterialCO2RunningAverage_mmHg = src.m_ArterialCO2RunningAverage_mmHg;
+
+  dst.m_ConsciousBreathing = src.m_ConsciousBreathing;
+  dst.m_ConsciousRespirationPeriod_s = src.m_ConsciousRespirationPeriod_s;
+  dst.m_ConsciousRespirationRemainingPeriod_s = src.m_ConsciousRespirationRemainingPeriod_s;
+  dst.m_ExpiratoryReserveVolumeFraction = src.m_ExpiratoryReserveVolumeFraction;
+  dst.m_InspiratoryCapacityFraction = src.m_InspiratoryCapacityFraction;
+  dst.m_ConsciousStartPressure_cmH2O = src.m_ConsciousStartPressure_cmH2O;
+  dst.m_ConsciousEndPressure_cmH2O = src.m_ConsciousEndPressure_cmH2O;
+  dst.SetUp();
+}
+
 pulse::RespiratorySystemData* Respiratory::Unload(const Respiratory& src)
 {
   pulse::RespiratorySystemData* dst = new pulse::RespiratorySystemData();
@@ -319,6 +365,10 @@ void Respiratory::SetUp()
   //Patient
   m_Patient = &m_data.GetPatient();
   m_PatientActions = &m_data.GetActions().GetPatientActions();
+  //Profiling
+  m_CircuitProfileSlot = m_data.GetProfiler().RegisterSlot("Circuit", "Respiratory");
+  m_GasTransportProfileSlot = m_data.GetProfiler().RegisterSlot("Transport", "RespiratoryGas");
+  m_AerosolTransportProfileSlot = m_data.GetProfiler().RegisterSlot("Transport", "RespiratoryAerosol");
   //Configuration parameters
   m_dDefaultOpenResistance_cmH2O_s_Per_L = m_data.GetConfiguration().GetDefaultOpenFlowResistance(FlowResistanceUnit::cmH2O_s_Per_L);
   m_dDefaultClosedResistance_cmH2O_s_Per_L = m_data.GetConfiguration().GetDefaultClosedFlowResistance(FlowResistanceUnit::cmH2O_s_Per_L);
@@ -502,14 +552,24 @@ void Respiratory::Process()
   // When dynamic intercircuit connections work, we can stash off the respiration circuit in a member variable
   SEFluidCircuit& RespirationCircuit = m_data.GetCircuits().GetActiveRespiratoryCircuit();
   // Calc the circuits
-  m_Calculator.Process(RespirationCircuit, m_dt_s);
+  {
+    SEEngineProfiler::ScopedTimer timer(&m_data.GetProfiler(), m_CircuitProfileSlot);
+    m_Calculator.Process(RespirationCircuit, m_dt_s);
+    timer.SetIterations(m_Calculator.GetNumberOfValveIterations());
+  }
   //ModifyPleuralVolume();
   SEGasCompartmentGraph& RespirationGraph = m_data.GetCompartments().GetActiveRespiratoryGraph();
   SELiquidCompartmentGraph& AerosolGraph = m_data.GetCompartments().GetActiveAerosolGraph();
   // Transport substances
-  m_GasTransporter.Transport(RespirationGraph, m_dt_s);
-  if(m_AerosolMouth->HasSubstanceQuantities())
+  {
+    SEEngineProfiler::ScopedTimer timer(&m_data.GetProfiler(), m_GasTransportProfileSlot);
+    m_GasTransporter.Transport(RespirationGraph, m_dt_s);
+  }
+  if (m_AerosolMouth->HasSubstanceQuantities())
+  {
+    SEEngineProfiler::ScopedTimer timer(&m_data.GetProfiler(), m_AerosolTransportProfileSlot);
     m_AerosolTransporter.Transport(AerosolGraph, m_dt_s);
+  }
   //Update system data
   CalculateVitalSigns();
 }
@@ -1209,6 +1269,7 @@ void Respiratory::Intubation()
     //Keep volume the same by changing the pressure equally on both sides
     double pressureChange_cmH2O = m_Ambient->GetNextPressure(PressureUnit::cmH2O) - m_Ambient->GetPressure(PressureUnit::cmH2O);
     m_Stomach->GetNextPressure().IncrementValue(pressureChange_cmH2O, PressureUnit::cmH2O);
+    m_data.GetCircuits().GetCircuitEpoch().Increment();// Node value modified outside of the calculator
   }
 
   if (m_PatientActions->HasIntubation())
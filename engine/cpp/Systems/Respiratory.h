@@ -40,6 +40,7 @@ public:
 
   static void Load(const pulse::RespiratorySystemData& src, Respiratory& dst);
   static pulse::RespiratorySystemData* Unload(const Respiratory& src);
+  static void Copy(const Respiratory& src, Respiratory& dst);
 protected:
   static void Serialize(const pulse::RespiratorySystemData& src, Respiratory& dst);
   static void Serialize(const Respiratory& src, pulse::RespiratorySystemData& dst);
@@ -221,4 +222,7 @@ private:
   SEFluidCircuitCalculator   m_Calculator;
   SEGasTransporter           m_GasTransporter;
   SELiquidTransporter        m_AerosolTransporter;
+  size_t                     m_CircuitProfileSlot;
+  size_t                     m_GasTransportProfileSlot;
+  size_t                     m_AerosolTransportProfileSlot;
 };
@@ -12,6 +12,7 @@
 #include "properties/SEScalarInversePressure.h"
 
 #include "unsupported/Eigen/NonLinearOptimization"
+#include "unsupported/Eigen/AutoDiff"
 #include <cmath>
 
 //#define VERBOSE
@@ -38,15 +39,32 @@ struct Functor
   int values() const { return m_values; }
 };
 
+namespace
+{
+  // Scalar carrying its derivatives by pH, dissolved CO2 mM and dissolved O2 mM
+  typedef Eigen::AutoDiffScalar<Eigen::Vector3d> ADScalar;
+
+  // Math used by the hemoglobin saturation model, on doubles or on ADScalars
+  inline double Value(double x) { return x; }
+  inline double Value(const ADScalar& x) { return x.value(); }
+  inline double Log10(double x) { return std::log10(x); }
+  inline ADScalar Log10(const ADScalar& x) { return ADScalar(log(x) / std::log(10.0)); }
+  inline double Pow(double base, double exponent) { return std::pow(base, exponent); }
+  inline ADScalar Pow(const ADScalar& base, double exponent) { return ADScalar(pow(base, exponent)); }
+  inline ADScalar Pow(double base, const ADScalar& exponent) { return ADScalar(exp(exponent * std::log(base))); }
+  inline ADScalar Pow(const ADScalar& base, const ADScalar& exponent) { return ADScalar(exp(exponent * log(base))); }
+}
+
 struct error_functor : Functor<double>
 {
 protected:
   mutable SEScalarMassPerVolume concentration;
   mutable SEScalarPressure      partialPressure;
-  SaturationCalculator& m_SatCalc;
+  const SaturationCalculator& m_SatCalc;
+  SaturationCalculator::Workspace& m_Ws;
 
 public:
-  error_functor(SaturationCalculator& SatCalc) : Functor<double>(4, 4), m_SatCalc(SatCalc) {}
+  error_functor(const SaturationCalculator& SatCalc, SaturationCalculator::Workspace& ws) : Functor<double>(4, 4), m_SatCalc(SatCalc), m_Ws(ws) {}
   int operator()(const Eigen::VectorXd &x, Eigen::VectorXd &fvec) const
   {
     double pH = x(0);
@@ -75,17 +93,18 @@ public:
       if (CO2_scaling_factor > 1.0) CO2_scaling_factor = 1.0;
       else if (CO2_scaling_factor < 0.1) CO2_scaling_factor = 0.1;
 
-      m_SatCalc.CalculateHemoglobinSaturations(O2PartialPressureGuess_mmHg, CO2PartialPressureGuess_mmHg, pH, m_SatCalc.m_temperature_C, m_SatCalc.m_hematocrit, OxygenSaturation, CarbonDioxideSaturation, CO2_scaling_factor);
+      double CO_sat = m_Ws.bg->subCOQ == nullptr ? 0 : m_Ws.bg->subCOQ->GetSaturation().GetValue();
+      m_SatCalc.CalculateHemoglobinSaturations(O2PartialPressureGuess_mmHg, CO2PartialPressureGuess_mmHg, pH, m_SatCalc.m_temperature_C, m_SatCalc.m_hematocrit, CO_sat, OxygenSaturation, CarbonDioxideSaturation, CO2_scaling_factor);
       logTerm = log10(bicarb_mM / co2_mM);
     }
 
-    double CO2_mM = m_SatCalc.m_subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double O2_mM = m_SatCalc.m_subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double Hb_mM = m_SatCalc.m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double HbO2_mM = m_SatCalc.m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double HbCO2_mM = m_SatCalc.m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double HbO2CO2_mM = m_SatCalc.m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double HCO3_mM = m_SatCalc.m_subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double CO2_mM = m_Ws.bg->subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double O2_mM = m_Ws.bg->subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double Hb_mM = m_Ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HbO2_mM = m_Ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HbCO2_mM = m_Ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HbO2CO2_mM = m_Ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HCO3_mM = m_Ws.bg->subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
 
     double totalHemoglobin_mM = Hb_mM + HbO2_mM + HbCO2_mM + HbO2CO2_mM;
     double totalCO2_mM = CO2_mM + HCO3_mM + 4.0 * HbCO2_mM + 4.0 * HbO2CO2_mM;
@@ -106,14 +125,142 @@ public:
     fvec(2) = f2 - negativePenaltyO2*100.0;
     fvec(3) = f3;
 
-    m_SatCalc.m_subO2Q->GetSaturation().SetValue(OxygenSaturation);
-    m_SatCalc.m_subCO2Q->GetSaturation().SetValue(CarbonDioxideSaturation);
+    m_Ws.bg->subO2Q->GetSaturation().SetValue(OxygenSaturation);
+    m_Ws.bg->subCO2Q->GetSaturation().SetValue(CarbonDioxideSaturation);
+    return 0;
+  }
+};
+
+/**
+ * @brief The blood gas equations of error_functor, with a Jacobian computed from the equations themselves.
+ * @details
+ * The hemoglobin saturations are evaluated on automatic differentiation scalars to get their exact
+ * derivatives, the remaining equations are differentiated by hand.
+ * The hemoglobin and total gas amounts do not change during a solve, so they are only read once.
+ */
+struct analytic_error_functor : Functor<double>
+{
+protected:
+  const SaturationCalculator& m_SatCalc;
+  SaturationCalculator::Workspace& m_Ws;
+  double m_CO_sat;
+  double m_TotalHemoglobin_mM;
+  double m_TotalCO2_mM;
+  double m_TotalO2_mM;
+
+public:
+  analytic_error_functor(const SaturationCalculator& SatCalc, SaturationCalculator::Workspace& ws) : Functor<double>(4, 4), m_SatCalc(SatCalc), m_Ws(ws)
+  {
+    double CO2_mM = m_Ws.bg->subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double O2_mM = m_Ws.bg->subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double Hb_mM = m_Ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HbO2_mM = m_Ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HbCO2_mM = m_Ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HbO2CO2_mM = m_Ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double HCO3_mM = m_Ws.bg->subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+
+    m_CO_sat = m_Ws.bg->subCOQ == nullptr ? 0 : m_Ws.bg->subCOQ->GetSaturation().GetValue();
+    m_TotalHemoglobin_mM = Hb_mM + HbO2_mM + HbCO2_mM + HbO2CO2_mM;
+    m_TotalCO2_mM = CO2_mM + HCO3_mM + 4.0 * HbCO2_mM + 4.0 * HbO2CO2_mM;
+    m_TotalO2_mM = O2_mM + 4.0 * HbO2_mM + 4.0 * HbO2CO2_mM;
+  }
+
+  template<typename T>
+  void Saturations(const T& pH, const T& co2_mM, const T& o2_mM, T& OxygenSaturation, T& CarbonDioxideSaturation) const
+  {
+    T O2PartialPressure_mmHg = m_SatCalc.m_O2_mmHg_Per_mM * o2_mM;
+    T CO2PartialPressure_mmHg = m_SatCalc.m_CO2_mmHg_Per_mM * co2_mM;
+    //calculate a scaling factor for the CO2 saturation curve based on total CO2
+    //scaling factor is linear such that when CO2 mM is 27, factor is .4; when CO2 mM is 29, factor is 1
+    T CO2_scaling_factor = 0.4 * (co2_mM / .05) - 10.6;
+    if (Value(CO2_scaling_factor) > 1.0) CO2_scaling_factor = T(1.0);
+    else if (Value(CO2_scaling_factor) < 0.1) CO2_scaling_factor = T(0.1);
+    SaturationCalculator::CalculateHemoglobinSaturations(O2PartialPressure_mmHg, CO2PartialPressure_mmHg, pH, m_SatCalc.m_temperature_C, m_SatCalc.m_hematocrit, m_CO_sat, OxygenSaturation, CarbonDioxideSaturation, CO2_scaling_factor);
+  }
+
+  int operator()(const Eigen::VectorXd &x, Eigen::VectorXd &fvec) const
+  {
+    double pH = x(0);
+    double bicarb_mM = x(1);
+    double co2_mM = x(2);
+    double o2_mM = x(3);
+
+    double OxygenSaturation = 0.0;
+    double CarbonDioxideSaturation = 0.0;
+    double logTerm = 0.0;
+    if (co2_mM > 0.0 && o2_mM > 0.0 && bicarb_mM > 0.0)
+    {
+      Saturations(pH, co2_mM, o2_mM, OxygenSaturation, CarbonDioxideSaturation);
+      logTerm = log10(bicarb_mM / co2_mM);
+    }
+
+    fvec(0) = m_SatCalc.m_StrongIonDifference_mmol_Per_L - bicarb_mM - m_SatCalc.m_albumin_g_per_L*(0.123*pH - 0.631) - m_SatCalc.m_Phosphate_mmol_Per_L*(0.309*pH - 0.469);
+    fvec(1) = m_TotalCO2_mM - co2_mM - bicarb_mM - 4.0 * CarbonDioxideSaturation * m_TotalHemoglobin_mM - (MIN(0.0, bicarb_mM) + MIN(0.0, co2_mM))*100.0;
+    fvec(2) = m_TotalO2_mM - o2_mM - 4.0 * OxygenSaturation * m_TotalHemoglobin_mM - MIN(0.0, o2_mM)*100.0;
+    fvec(3) = pH - 6.1 - logTerm;
+    return 0;
+  }
+
+  int df(const Eigen::VectorXd &x, Eigen::MatrixXd &fjac) const
+  {
+    double bicarb_mM = x(1);
+    double co2_mM = x(2);
+    double o2_mM = x(3);
+
+    Eigen::Vector3d dOxygenSaturation = Eigen::Vector3d::Zero();
+    Eigen::Vector3d dCarbonDioxideSaturation = Eigen::Vector3d::Zero();
+    double dLogTerm_dBicarb = 0.0;
+    double dLogTerm_dCO2 = 0.0;
+    if (co2_mM > 0.0 && o2_mM > 0.0 && bicarb_mM > 0.0)
+    {
+      ADScalar OxygenSaturation;
+      ADScalar CarbonDioxideSaturation;
+      Saturations(ADScalar(x(0), 3, 0), ADScalar(co2_mM, 3, 1), ADScalar(o2_mM, 3, 2), OxygenSaturation, CarbonDioxideSaturation);
+      dOxygenSaturation = OxygenSaturation.derivatives();
+      dCarbonDioxideSaturation = CarbonDioxideSaturation.derivatives();
+      dLogTerm_dBicarb = 1.0 / (bicarb_mM * std::log(10.0));
+      dLogTerm_dCO2 = -1.0 / (co2_mM * std::log(10.0));
+    }
+    double boundHemoglobin_mM = 4.0 * m_TotalHemoglobin_mM;
+
+    fjac.setZero();
+    // Strong ion difference
+    fjac(0, 0) = -0.123*m_SatCalc.m_albumin_g_per_L - 0.309*m_SatCalc.m_Phosphate_mmol_Per_L;
+    fjac(0, 1) = -1.0;
+    // Total CO2
+    fjac(1, 0) = -boundHemoglobin_mM * dCarbonDioxideSaturation(0);
+    fjac(1, 1) = bicarb_mM < 0.0 ? -101.0 : -1.0;
+    fjac(1, 2) = (co2_mM < 0.0 ? -101.0 : -1.0) - boundHemoglobin_mM * dCarbonDioxideSaturation(1);
+    fjac(1, 3) = -boundHemoglobin_mM * dCarbonDioxideSaturation(2);
+    // Total O2
+    fjac(2, 0) = -boundHemoglobin_mM * dOxygenSaturation(0);
+    fjac(2, 2) = -boundHemoglobin_mM * dOxygenSaturation(1);
+    fjac(2, 3) = (o2_mM < 0.0 ? -101.0 : -1.0) - boundHemoglobin_mM * dOxygenSaturation(2);
+    // Henderson-Hasselbalch
+    fjac(3, 0) = 1.0;
+    fjac(3, 1) = -dLogTerm_dBicarb;
+    fjac(3, 2) = -dLogTerm_dCO2;
     return 0;
   }
+
+  // The solve never sets the saturations, set them for the solution
+  void SetSaturations(const Eigen::VectorXd &x) const
+  {
+    double OxygenSaturation = 0.0;
+    double CarbonDioxideSaturation = 0.0;
+    if (x(2) > 0.0 && x(3) > 0.0 && x(1) > 0.0)
+      Saturations(x(0), x(2), x(3), OxygenSaturation, CarbonDioxideSaturation);
+    m_Ws.bg->subO2Q->GetSaturation().SetValue(OxygenSaturation);
+    m_Ws.bg->subCO2Q->GetSaturation().SetValue(CarbonDioxideSaturation);
+  }
 };
 
 SaturationCalculator::SaturationCalculator(PulseController& data) : Loggable(data.GetLogger()), m_data(data)
 {
+  m_SolverMode = SolverMode::NumericalJacobian;
+  m_NextBatchCompartment = 0;
+  // Workspace 0 is used for single compartment calculations
+  m_Workspaces.push_back(std::unique_ptr<Workspace>(new Workspace()));
   Initialize(data.GetSubstances());
 }
 
@@ -156,6 +303,128 @@ void SaturationCalculator::Initialize(SESubstanceManager& substances)
   m_HbO2_g_Per_mol = m_HbO2->GetMolarMass(MassPerAmountUnit::g_Per_mol);
   m_HbCO2_g_Per_mol = m_HbCO2->GetMolarMass(MassPerAmountUnit::g_Per_mol);
   m_HbO2CO2_g_Per_mol = m_HbO2CO2->GetMolarMass(MassPerAmountUnit::g_Per_mol);
+
+  // Henry's law, see GeneralMath::CalculatePartialPressureInLiquid, 1 g/L = 1000 ug/mL
+  m_O2_mmHg_Per_mM = m_O2->GetMolarMass(MassPerAmountUnit::g_Per_mmol) * 1000.0 / m_O2->GetDensity(MassPerVolumeUnit::ug_Per_mL) / m_O2->GetSolubilityCoefficient(InversePressureUnit::Inverse_mmHg);
+  m_CO2_mmHg_Per_mM = m_CO2->GetMolarMass(MassPerAmountUnit::g_Per_mmol) * 1000.0 / m_CO2->GetDensity(MassPerVolumeUnit::ug_Per_mL) / m_CO2->GetSolubilityCoefficient(InversePressureUnit::Inverse_mmHg);
+
+  ClearCompartmentCache();
+}
+
+void SaturationCalculator::Copy(const SaturationCalculator& src, SaturationCalculator& dst)
+{
+  // Compartments are matched by name, the destination has its own compartment objects
+  dst.ClearCompartmentCache();
+  for (auto& itr : src.m_BloodGasCompartments)
+  {
+    if (!itr.second.hasSolution)
+      continue;
+    SELiquidCompartment* cmpt = dst.m_data.GetCompartments().GetLiquidCompartment(itr.first->GetName());
+    if (cmpt == nullptr)
+      continue;
+    BloodGasCompartment& bg = dst.GetBloodGasCompartment(*cmpt);
+    bg.hasSolution = true;
+    std::copy(itr.second.solution, itr.second.solution + 4, bg.solution);
+  }
+}
+
+void SaturationCalculator::SetSolverMode(SolverMode mode)
+{
+  m_SolverMode = mode;
+}
+
+void SaturationCalculator::ClearCompartmentCache()
+{
+  m_BloodGasCompartments.clear();
+  m_Batch.clear();
+  for (auto& ws : m_Workspaces)
+  {
+    ws->cmpt = nullptr;
+    ws->bg = nullptr;
+  }
+}
+
+SaturationCalculator::Workspace::Workspace()
+{
+  cmpt = nullptr;
+  bg = nullptr;
+  lastFunctionEvaluations = 0;
+  lastJacobianEvaluations = 0;
+  solveCount = 0;
+  totalFunctionEvaluations = 0;
+  totalJacobianEvaluations = 0;
+}
+
+size_t SaturationCalculator::GetSolveCount() const
+{
+  size_t count = 0;
+  for (auto& ws : m_Workspaces)
+    count += ws->solveCount;
+  return count;
+}
+size_t SaturationCalculator::GetTotalFunctionEvaluations() const
+{
+  size_t count = 0;
+  for (auto& ws : m_Workspaces)
+    count += ws->totalFunctionEvaluations;
+  return count;
+}
+size_t SaturationCalculator::GetTotalJacobianEvaluations() const
+{
+  size_t count = 0;
+  for (auto& ws : m_Workspaces)
+    count += ws->totalJacobianEvaluations;
+  return count;
+}
+
+void SaturationCalculator::ResetSolverStatistics()
+{
+  for (auto& ws : m_Workspaces)
+  {
+    ws->lastFunctionEvaluations = 0;
+    ws->lastJacobianEvaluations = 0;
+    ws->solveCount = 0;
+    ws->totalFunctionEvaluations = 0;
+    ws->totalJacobianEvaluations = 0;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Finds the blood gas species quantities of a compartment, scanning its substance quantities only
+/// the first time the compartment is seen or after substances are added to it
+//--------------------------------------------------------------------------------------------------
+SaturationCalculator::BloodGasCompartment& SaturationCalculator::GetBloodGasCompartment(SELiquidCompartment& cmpt)
+{
+  BloodGasCompartment& bg = m_BloodGasCompartments[&cmpt];
+  if (bg.subO2Q != nullptr && bg.numSubstanceQuantities == cmpt.GetSubstanceQuantities().size())
+    return bg;
+
+  bg = BloodGasCompartment();
+  bg.numSubstanceQuantities = cmpt.GetSubstanceQuantities().size();
+  for (SELiquidSubstanceQuantity* subQ : cmpt.GetSubstanceQuantities())
+  {
+    const SESubstance* sub = &subQ->GetSubstance();
+    if (sub == m_O2)
+      bg.subO2Q = subQ;
+    else if (sub == m_CO2)
+      bg.subCO2Q = subQ;
+    else if (sub == m_Hb)
+      bg.subHbQ = subQ;
+    else if (sub == m_HbO2)
+      bg.subHbO2Q = subQ;
+    else if (sub == m_HbCO2)
+      bg.subHbCO2Q = subQ;
+    else if (sub == m_HbO2CO2)
+      bg.subHbO2CO2Q = subQ;
+    else if (sub == m_HCO3)
+      bg.subHCO3Q = subQ;
+    else if (sub == m_CO)
+      bg.subCOQ = subQ;
+    else if (sub == m_HbCO)
+      bg.subHbCOQ = subQ;
+  }
+  return bg;
 }
 
 SaturationCalculator::~SaturationCalculator()
@@ -172,6 +441,49 @@ void SaturationCalculator::SetBodyState(const SEScalarMassPerVolume& AlbuminConc
     m_Phosphate_mmol_Per_L = Phosphate.GetValue(AmountPerVolumeUnit::mmol_Per_L);  
 }
 
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Sets up the compartments the following CalculateBloodGasDistributions calls are to balance
+///
+/// \param  cmpts       compartments to balance, after SetBodyState
+/// \param  numWorkers  number of threads that will call CalculateBloodGasDistributions
+///
+/// \details
+/// Each compartment's species are found here, on the calling thread, so the calculations themselves
+/// only change their own compartment and workspace.
+//--------------------------------------------------------------------------------------------------
+void SaturationCalculator::PrepareBloodGasDistributions(const std::vector<SELiquidCompartment*>& cmpts, size_t numWorkers)
+{
+  m_Batch.clear();
+  for (SELiquidCompartment* cmpt : cmpts)
+    m_Batch.push_back(std::make_pair(cmpt, &GetBloodGasCompartment(*cmpt)));
+  while (m_Workspaces.size() < std::max<size_t>(numWorkers, 1))
+    m_Workspaces.push_back(std::unique_ptr<Workspace>(new Workspace()));
+  m_NextBatchCompartment = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Balances compartments of the prepared batch until there are none left
+///
+/// \param  worker  index of the calling thread, from 0 to the number of workers it was prepared for
+///
+/// \details
+/// Threads calling this at the same time take compartments from the batch one at a time.
+/// Each compartment is balanced independently of the others, so it does not matter which thread
+/// balances it, or when, and one thread can balance the whole batch.
+//--------------------------------------------------------------------------------------------------
+void SaturationCalculator::CalculateBloodGasDistributions(size_t worker)
+{
+  Workspace& ws = *m_Workspaces[worker];
+  for (size_t i = m_NextBatchCompartment++; i < m_Batch.size(); i = m_NextBatchCompartment++)
+  {
+    ws.cmpt = m_Batch[i].first;
+    ws.bg = m_Batch[i].second;
+    CalculateBloodGasDistribution(ws);
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 /// \brief
 /// Determines the carbon monoxide (CO) species distribution in a compartment and sets the CO saturation.
@@ -189,20 +501,27 @@ void SaturationCalculator::SetBodyState(const SEScalarMassPerVolume& AlbuminConc
 /// @anchor CalculateCarbonMonoxideSpeciesDistribution
 //--------------------------------------------------------------------------------------------------
 void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCompartment& cmpt)
+{
+  Workspace& ws = *m_Workspaces[0];
+  ws.cmpt = &cmpt;
+  ws.bg = &GetBloodGasCompartment(cmpt);
+  CalculateCarbonMonoxideSpeciesDistribution(ws);
+}
+void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(Workspace& ws) const
 {
   const double MH = 218.0; // Haldane affinity ratio for hemoglobin (Hb) @cite bruce2003multicompartment
 
   // Mols present on the previous timestep (total Hb should be constant)
-  double HbUnbound_mM = m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  double HbO2_mM = m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  double HbCO2_mM = m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  double HbO2CO2_mM = m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  double HbCO_mM = m_subHbCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double HbUnbound_mM = ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double HbO2_mM = ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double HbCO2_mM = ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double HbO2CO2_mM = ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double HbCO_mM = ws.bg->subHbCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
   double totalHb_mM = HbUnbound_mM + HbO2_mM + HbCO2_mM + HbO2CO2_mM + HbCO_mM;
   double newTotalHb_mM = 0.0;
 
   // First we need to know the total amount of carbon monoxide (CO) in the compartment
-  double dissolvedCO_mM = m_subCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double dissolvedCO_mM = ws.bg->subCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
   
   // Recall that in %Pulse when a gas binds to hemoglobin it binds to all four sites, i.e. 4 moles CO per mole Hb.
   // Note that fractions of hemoglobin are possible in %Pulse, so in practice the actual number of sites bound is an abstraction.
@@ -210,8 +529,8 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
 
   // Now we need to know the distribution of oxygen species in order to compute the distribution 
   // of CO species using conservation of mass and the Haldane relationship @cite bruce2003multicompartment
-  double boundO2_mM = 4.0 * m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  double O2_pp_mmHg = m_subO2Q->GetPartialPressure(PressureUnit::mmHg);
+  double boundO2_mM = 4.0 * ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  double O2_pp_mmHg = ws.bg->subO2Q->GetPartialPressure(PressureUnit::mmHg);
 
   // Apply the equations
   double tempTerm = 0.0;
@@ -235,12 +554,12 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
   {
     HbUnbound_mM -= diffHbCO_mM; // Give it all to unbound. Minus negative = plus.
     diffHbCO_mM = 0.0;
-    m_subHbQ->GetMolarity().SetValue(HbUnbound_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbQ->GetMolarity().SetValue(HbUnbound_mM, AmountPerVolumeUnit::mmol_Per_L);
   }
   
   // Set new saturation value
   double CO_sat = targetBoundCO_mM / (totalHb_mM);
-  m_subCOQ->GetSaturation().SetValue(CO_sat);
+  ws.bg->subCOQ->GetSaturation().SetValue(CO_sat);
 
   // Now we need to take away the available Hb for oxygen
   // We assume CO binds first to any unbound Hb, then displaces HbO2, then HbO2CO2, then HbCO2
@@ -257,7 +576,7 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
     }
     else
       HbUnbound_mM = -remaining; //Otherwise, HbUnbound had more than enough
-    m_subHbQ->GetMolarity().SetValue(HbUnbound_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbQ->GetMolarity().SetValue(HbUnbound_mM, AmountPerVolumeUnit::mmol_Per_L);
   }
 
   if (HbO2_mM > 0 && remaining > 0) //Next take from HbO2 using the same logic; this will probably be as far as we go
@@ -271,7 +590,7 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
     }
     else
       HbO2_mM = -remaining;
-    m_subHbO2Q->GetMolarity().SetValue(HbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbO2Q->GetMolarity().SetValue(HbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
   }
 
   if (HbO2CO2_mM > 0 && remaining > 0)
@@ -285,7 +604,7 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
     }
     else
       HbO2CO2_mM = -remaining;
-    m_subHbO2CO2Q->GetMolarity().SetValue(HbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbO2CO2Q->GetMolarity().SetValue(HbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
   }
 
   if (HbCO2_mM > 0 && remaining > 0)
@@ -299,7 +618,7 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
     }
     else
       HbCO2_mM = -remaining;
-    m_subHbCO2Q->GetMolarity().SetValue(HbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbCO2Q->GetMolarity().SetValue(HbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
   }
   // After the cascade, if there is any remaining it gets distributed to dissolved CO.
   if (remaining > tolerance)
@@ -314,13 +633,13 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
     Warning("Hemoglobin not conserved during carbon monoxide species distribution calculation.");
 
   // We can now set and balance for CO.
-  m_subCOQ->GetPartialPressure().SetValue(CO_pp_mmHg, PressureUnit::mmHg);
-  m_subCOQ->Balance(BalanceLiquidBy::PartialPressure);
+  ws.bg->subCOQ->GetPartialPressure().SetValue(CO_pp_mmHg, PressureUnit::mmHg);
+  ws.bg->subCOQ->Balance(BalanceLiquidBy::PartialPressure);
 
-  m_subHbCOQ->GetMolarity().SetValue(targetBoundCO_mM, AmountPerVolumeUnit::mmol_Per_L);
-  double check1 = m_subHbCOQ->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbCOQ->Balance(BalanceLiquidBy::Molarity);
-  double check2 = m_subHbCOQ->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbCOQ->GetMolarity().SetValue(targetBoundCO_mM, AmountPerVolumeUnit::mmol_Per_L);
+  double check1 = ws.bg->subHbCOQ->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbCOQ->Balance(BalanceLiquidBy::Molarity);
+  double check2 = ws.bg->subHbCOQ->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
   // No need to balance everything. The sat method only uses moles, and it balances at the end. Just need to balance CO
 }
 
@@ -335,74 +654,29 @@ void SaturationCalculator::CalculateCarbonMonoxideSpeciesDistribution(SELiquidCo
 /// dioxide in the blood and also the fraction of total carbon dioxide that is in bicarbonate form.
 /// The method uses the Eigen HybridNonLinearSolver to solve the system of equations described
 /// in @ref bloodchemistry-approach.
+/// By default each solve starts from the compartment's current values and uses a finite difference
+/// Jacobian. SolverMode::WarmStartAnalyticJacobian starts from the compartment's last solution and
+/// uses the analytic Jacobian of analytic_error_functor, which takes fewer function evaluations.
 //--------------------------------------------------------------------------------------------------
 void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cmpt)
 {
-  m_cmpt = &cmpt;
-  m_subO2Q = nullptr;
-  m_subCO2Q = nullptr;
-  m_subHbQ = nullptr;
-  m_subHbO2Q = nullptr;
-  m_subHbCO2Q = nullptr;
-  m_subHbO2CO2Q = nullptr;
-  m_subHCO3Q = nullptr;
-  m_subCOQ = nullptr;
-  m_subHbCOQ = nullptr;
-  for (SELiquidSubstanceQuantity* subQ : cmpt.GetSubstanceQuantities())
-  {
-    if (&subQ->GetSubstance() == m_O2)
-    {
-      m_subO2Q = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_CO2)
-    {
-      m_subCO2Q = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_Hb)
-    {
-      m_subHbQ = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_HbO2)
-    {
-      m_subHbO2Q = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_HbCO2)
-    {
-      m_subHbCO2Q = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_HbO2CO2)
-    {
-      m_subHbO2CO2Q = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_HCO3)
-    {
-      m_subHCO3Q = subQ;
-      continue;
-    }
-    if (&subQ->GetSubstance() == m_CO)
-    {
-      m_subCOQ = subQ;
-      continue;
-    }if (&subQ->GetSubstance() == m_HbCO)
-    {
-      m_subHbCOQ = subQ;
-      continue;
-    }
-  }
-
-  double HbO2_mM = m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Hemoglobin with Oxygen bound to 4 sites
-  double HbCO2_mM = m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);    // Hemoglobin with Carbon Dioxide bound to 4 sites
-  double HbO2CO2_mM = m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);// Hemoglobin with Oxygen and Carbon Dioxide bound to 4 sites
-  double Hb_mM = m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Hemoglobin with nothing bound
-  double O2_mM = m_subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Dissolved Oxygen
-  double CO2_mM = m_subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);        // Dissolved Carbon Dioxide
-  double HCO3_mM = m_subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Bicarbonate
+  Workspace& ws = *m_Workspaces[0];
+  ws.cmpt = &cmpt;
+  ws.bg = &GetBloodGasCompartment(cmpt);
+  CalculateBloodGasDistribution(ws);
+}
+void SaturationCalculator::CalculateBloodGasDistribution(Workspace& ws) const
+{
+  ws.lastFunctionEvaluations = 0;
+  ws.lastJacobianEvaluations = 0;
+
+  double HbO2_mM = ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Hemoglobin with Oxygen bound to 4 sites
+  double HbCO2_mM = ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);    // Hemoglobin with Carbon Dioxide bound to 4 sites
+  double HbO2CO2_mM = ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);// Hemoglobin with Oxygen and Carbon Dioxide bound to 4 sites
+  double Hb_mM = ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Hemoglobin with nothing bound
+  double O2_mM = ws.bg->subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Dissolved Oxygen
+  double CO2_mM = ws.bg->subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);        // Dissolved Carbon Dioxide
+  double HCO3_mM = ws.bg->subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Bicarbonate
   // Current amounts
   double InputAmountTotalHb_mM = HbO2_mM + HbCO2_mM + HbO2CO2_mM + Hb_mM;
   double InputAmountTotalO2_mM = O2_mM + 4.0 * (HbO2_mM + HbO2CO2_mM);
@@ -411,18 +685,18 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
   double newHbCO_mM = 0.0;
   double oldTotalHb_mM = InputAmountTotalHb_mM;
 
-  if (m_subCOQ != nullptr && m_subHbCOQ != nullptr)
+  if (ws.bg->subCOQ != nullptr && ws.bg->subHbCOQ != nullptr)
   {
-    HbCO_mM = m_subHbCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    HbCO_mM = ws.bg->subHbCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
     oldTotalHb_mM += HbCO_mM;
-    CalculateCarbonMonoxideSpeciesDistribution(cmpt);
-    newHbCO_mM = m_subHbCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    CalculateCarbonMonoxideSpeciesDistribution(ws);
+    newHbCO_mM = ws.bg->subHbCOQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
 
     // Verify that hemoglobin was conserved after adjusting for carbon monoxide
-    double newHbO2_mM = m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double newHbCO2_mM = m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double newHbO2CO2_mM = m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-    double newHb_mM = m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double newHbO2_mM = ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double newHbCO2_mM = ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double newHbO2CO2_mM = ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+    double newHb_mM = ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
     double newTotalHb_mM = newHbO2_mM + newHbCO2_mM + newHbO2CO2_mM + newHb_mM + newHbCO_mM;
     double diffTotal = newTotalHb_mM - oldTotalHb_mM;
     if (abs(diffTotal) > 1.0e-8)
@@ -435,13 +709,13 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
     }
   }
 
-  HbO2_mM = m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Hemoglobin with Oxygen bound to 4 sites
-  HbCO2_mM = m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);    // Hemoglobin with Carbon Dioxide bound to 4 sites
-  HbO2CO2_mM = m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);// Hemoglobin with Oxygen and Carbon Dioxide bound to 4 sites
-  Hb_mM = m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Hemoglobin with nothing bound
-  O2_mM = m_subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Dissolved Oxygen
-  CO2_mM = m_subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);        // Dissolved Carbon Dioxide
-  HCO3_mM = m_subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Bicarbonate
+  HbO2_mM = ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Hemoglobin with Oxygen bound to 4 sites
+  HbCO2_mM = ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);    // Hemoglobin with Carbon Dioxide bound to 4 sites
+  HbO2CO2_mM = ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);// Hemoglobin with Oxygen and Carbon Dioxide bound to 4 sites
+  Hb_mM = ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Hemoglobin with nothing bound
+  O2_mM = ws.bg->subO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);          // Dissolved Oxygen
+  CO2_mM = ws.bg->subCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);        // Dissolved Carbon Dioxide
+  HCO3_mM = ws.bg->subHCO3Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);      // Bicarbonate
 
   // Current amounts
   InputAmountTotalHb_mM = HbO2_mM + HbCO2_mM + HbO2CO2_mM + Hb_mM;
@@ -482,29 +756,74 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
 
   Eigen::VectorXd x(4);
 
-  //// Initial Guess - just use the last values
-  x(0) = m_cmpt->GetPH().GetValue();
-  x(1) = m_subHCO3Q->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
-  x(2) = m_subCO2Q->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
-  x(3) = m_subO2Q->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
-
-  error_functor functor(*this);
-  Eigen::NumericalDiff<error_functor> numDiff(functor);
-  Eigen::HybridNonLinearSolver<Eigen::NumericalDiff<error_functor>, double> solver(numDiff);
-  solver.parameters.maxfev = 250;  // Maximum number of function evaluations - 250
-  solver.parameters.xtol = 1.0e-6; // Maximum 2-norm of the solution vector 1.0e-6
-  solver.parameters.factor = 0.015;// Damping factor
+  if (m_SolverMode == SolverMode::WarmStartAnalyticJacobian && ws.bg->hasSolution)
+  {
+    //// Initial Guess - the last solution for this compartment, what is in the compartment has since been moved by transport
+    for (int i = 0; i < 4; i++)
+      x(i) = ws.bg->solution[i];
+  }
+  else
+  {
+    //// Initial Guess - just use the last values
+    x(0) = ws.cmpt->GetPH().GetValue();
+    x(1) = ws.bg->subHCO3Q->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
+    x(2) = ws.bg->subCO2Q->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
+    x(3) = ws.bg->subO2Q->GetMolarity().GetValue(AmountPerVolumeUnit::mmol_Per_L);
+  }
 
   std::stringstream errMsg;
   std::stringstream check;   //check for specific error
   errMsg << "GeneralMath::CalculateBloodGasDistribution: ";
 
   // Solve the acid base equations
-  int ret = solver.solveNumericalDiffInit(x);
-  while (ret == Eigen::HybridNonLinearSolverSpace::Running)
+  int ret;
+  size_t nfev;
+  size_t njev;
+  double fnorm;
+  Eigen::VectorXd fvec;
+  if (m_SolverMode == SolverMode::WarmStartAnalyticJacobian)
   {
-    ret = solver.solveNumericalDiffOneStep(x);
+    analytic_error_functor functor(*this, ws);
+    Eigen::HybridNonLinearSolver<analytic_error_functor, double> solver(functor);
+    solver.parameters.maxfev = 250;  // Maximum number of function evaluations - 250
+    solver.parameters.xtol = 1.0e-6; // Maximum 2-norm of the solution vector 1.0e-6
+    solver.parameters.factor = 0.015;// Damping factor
+
+    ret = solver.solveInit(x);
+    while (ret == Eigen::HybridNonLinearSolverSpace::Running)
+    {
+      ret = solver.solveOneStep(x);
+    }
+    functor.SetSaturations(x);// Only the saturations, not counted as a function evaluation
+    nfev = solver.nfev;
+    njev = solver.njev;
+    fnorm = solver.fnorm;
+    fvec = solver.fvec;
   }
+  else
+  {
+    error_functor functor(*this, ws);
+    Eigen::NumericalDiff<error_functor> numDiff(functor);
+    Eigen::HybridNonLinearSolver<Eigen::NumericalDiff<error_functor>, double> solver(numDiff);
+    solver.parameters.maxfev = 250;  // Maximum number of function evaluations - 250
+    solver.parameters.xtol = 1.0e-6; // Maximum 2-norm of the solution vector 1.0e-6
+    solver.parameters.factor = 0.015;// Damping factor
+
+    ret = solver.solveNumericalDiffInit(x);
+    while (ret == Eigen::HybridNonLinearSolverSpace::Running)
+    {
+      ret = solver.solveNumericalDiffOneStep(x);
+    }
+    nfev = solver.nfev;// Includes the evaluations of the finite difference Jacobians
+    njev = solver.njev;
+    fnorm = solver.fnorm;
+    fvec = solver.fvec;
+  }
+  ws.lastFunctionEvaluations = nfev;
+  ws.lastJacobianEvaluations = njev;
+  ws.solveCount++;
+  ws.totalFunctionEvaluations += nfev;
+  ws.totalJacobianEvaluations += njev;
 
   switch (ret)
   {
@@ -525,12 +844,12 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
     break;
   default:
     errMsg << "SaturationCalculator::CalculateBloodGasDistribution: Unknown return from Eigen solver.";
-    errMsg << ". NumFuncEvals= = " << solver.nfev;
-    errMsg << ". f0 = " << solver.fvec(0);
-    errMsg << ". f1 = " << solver.fvec(1);
-    errMsg << ". f2 = " << solver.fvec(2);
-    errMsg << ". f3 = " << solver.fvec(3);
-    errMsg << ". compartment = " << m_cmpt->GetName();
+    errMsg << ". NumFuncEvals= = " << nfev;
+    errMsg << ". f0 = " << fvec(0);
+    errMsg << ". f1 = " << fvec(1);
+    errMsg << ". f2 = " << fvec(2);
+    errMsg << ". f3 = " << fvec(3);
+    errMsg << ". compartment = " << ws.cmpt->GetName();
     Fatal(errMsg);
     break;
   }
@@ -539,12 +858,12 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
   // a zero then we move to the brute-force distribution.
 
   //first check if solver stopped early, did it have an "ok" error output: 
-  if (!(solver.fnorm < fnormCheck))
+  if (!(fnorm < fnormCheck))
   {
 #ifdef VERBOSE
     errMsg << "SaturationCalculator::CalculateBloodGasDistribution: Eigen solution out of tolerance. Switch to secondary. ";
-    errMsg << "fnorm: " << solver.fnorm;
-    errMsg << ". compartment = " << m_cmpt->GetName();
+    errMsg << "fnorm: " << fnorm;
+    errMsg << ". compartment = " << ws.cmpt->GetName();
     Error(errMsg);
 #endif
     solverSolution = false;    
@@ -565,14 +884,17 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
   }
 
   // Check saturations. If there is O2 and CO2 and the saturations are zero then the solver got on a bad gradient
-  if(m_subO2Q->GetSaturation().GetValue() < approxZero && InputAmountTotalO2_mM > approxZero)
+  if(ws.bg->subO2Q->GetSaturation().GetValue() < approxZero && InputAmountTotalO2_mM > approxZero)
     solverSolution = false;
-  if (m_subCO2Q->GetSaturation().GetValue() < approxZero && InputAmountTotalCO2_mM > approxZero)
+  if (ws.bg->subCO2Q->GetSaturation().GetValue() < approxZero && InputAmountTotalCO2_mM > approxZero)
     solverSolution = false; 
 
+  ws.bg->hasSolution = solverSolution;
   if (solverSolution)
   {
-    m_cmpt->GetPH().SetValue(x(0));
+    for (int i = 0; i < 4; i++)
+      ws.bg->solution[i] = x(i);
+    ws.cmpt->GetPH().SetValue(x(0));
     resultantHCO3_mM = x(1);
     resultantDissolvedCO2_mM = x(2);
     resultantDissolvedO2_mM = x(3);
@@ -701,29 +1023,29 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
     if (resultantO2Sat > 1.0 || resultantO2Sat < 0.0 || resultantCO2Sat > 1.0 || resultantCO2Sat < 0.0)
       Fatal("SaturationCalculator::CalculateBloodGasDistribution: Resultant saturation out of range. High probability of cows raining from the sky.");
 
-    m_subO2Q->GetSaturation().SetValue(resultantO2Sat);
-    m_subCO2Q->GetSaturation().SetValue(resultantCO2Sat);
-
-    m_subHbQ->GetMolarity().SetValue(Hb_mM, AmountPerVolumeUnit::mmol_Per_L);
-    m_subHbQ->Balance(BalanceLiquidBy::Molarity);
-    m_subHbO2Q->GetMolarity().SetValue(HbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-    m_subHbO2Q->Balance(BalanceLiquidBy::Molarity);
-    m_subHbCO2Q->GetMolarity().SetValue(HbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-    m_subHbCO2Q->Balance(BalanceLiquidBy::Molarity);
-    m_subHbO2CO2Q->GetMolarity().SetValue(HbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-    m_subHbO2CO2Q->Balance(BalanceLiquidBy::Molarity);
+    ws.bg->subO2Q->GetSaturation().SetValue(resultantO2Sat);
+    ws.bg->subCO2Q->GetSaturation().SetValue(resultantCO2Sat);
+
+    ws.bg->subHbQ->GetMolarity().SetValue(Hb_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbQ->Balance(BalanceLiquidBy::Molarity);
+    ws.bg->subHbO2Q->GetMolarity().SetValue(HbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbO2Q->Balance(BalanceLiquidBy::Molarity);
+    ws.bg->subHbCO2Q->GetMolarity().SetValue(HbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbCO2Q->Balance(BalanceLiquidBy::Molarity);
+    ws.bg->subHbO2CO2Q->GetMolarity().SetValue(HbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+    ws.bg->subHbO2CO2Q->Balance(BalanceLiquidBy::Molarity);
   } // End alternate solution
 
-  if (!DistributeHemoglobinBySaturation())
+  if (!DistributeHemoglobinBySaturation(ws))
   {
     errMsg << " Failed to update hemoglobin saturation.";
     Fatal(errMsg);
   }
 
-  resultantHb_mM = m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  resultantHbO2_mM = m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  resultantHbCO2_mM = m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
-  resultantHbO2CO2_mM = m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  resultantHb_mM = ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  resultantHbO2_mM = ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  resultantHbCO2_mM = ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
+  resultantHbO2CO2_mM = ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);
   resultantTotalHgb_mM = resultantHb_mM + resultantHbO2_mM + resultantHbCO2_mM + resultantHbO2CO2_mM;
 
   // The acid-base equations use some approximation (see documentation) and the
@@ -847,54 +1169,54 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
   if (std::abs(totalCO2RelativeError) > tolerance && InputAmountTotalCO2_mM > approxZero)
   {
     resultantDissolvedCO2_mM += (InputAmountTotalCO2_mM - resultantTotalCO2_mM);    
-    errMsg << "Failure to conserve CO2 amount (GeneralMath:CalculateBloodGasDistribution);" << " node: " << m_cmpt->GetName() << "; error: " << totalCO2RelativeError;
+    errMsg << "Failure to conserve CO2 amount (GeneralMath:CalculateBloodGasDistribution);" << " node: " << ws.cmpt->GetName() << "; error: " << totalCO2RelativeError;
   errMsg << ". Rectifying it by incrementing that amount dissolved.";
     Error(errMsg);
   }
   if (std::abs(totalO2RelativeError) > tolerance && InputAmountTotalO2_mM > approxZero)
   {
     resultantDissolvedO2_mM += (InputAmountTotalO2_mM - resultantTotalO2_mM);
-    errMsg << "Failure to conserve O2 amount (GeneralMath:CalculateBloodGasDistribution);" << " node: " << m_cmpt->GetName() << "; error: " << totalO2RelativeError;
+    errMsg << "Failure to conserve O2 amount (GeneralMath:CalculateBloodGasDistribution);" << " node: " << ws.cmpt->GetName() << "; error: " << totalO2RelativeError;
   errMsg << ". Rectifying it by incrementing that amount dissolved.";
     Error(errMsg);
   }
   if (std::abs(totalHbRelativeError) > tolerance && InputAmountTotalHb_mM > approxZero)
   {
     resultantHb_mM += (InputAmountTotalHb_mM - resultantTotalHgb_mM);
-    errMsg << "Failure to conserve Hb amount (GeneralMath:CalculateBloodGasDistribution);" << " node: " << m_cmpt->GetName() << "; error: " << totalHbRelativeError;
+    errMsg << "Failure to conserve Hb amount (GeneralMath:CalculateBloodGasDistribution);" << " node: " << ws.cmpt->GetName() << "; error: " << totalHbRelativeError;
   errMsg << ". Rectifying it by incrementing that amount unbound.";
     Error(errMsg);
   }
 
   // Update concentrations
-  m_subHbO2Q->GetMolarity().SetValue(resultantHbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbCO2Q->GetMolarity().SetValue(resultantHbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbO2CO2Q->GetMolarity().SetValue(resultantHbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbQ->GetMolarity().SetValue(resultantHb_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subO2Q->GetMolarity().SetValue(resultantDissolvedO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subCO2Q->GetMolarity().SetValue(resultantDissolvedCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHCO3Q->GetMolarity().SetValue(resultantHCO3_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbO2Q->GetMolarity().SetValue(resultantHbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbCO2Q->GetMolarity().SetValue(resultantHbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbO2CO2Q->GetMolarity().SetValue(resultantHbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbQ->GetMolarity().SetValue(resultantHb_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subO2Q->GetMolarity().SetValue(resultantDissolvedO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subCO2Q->GetMolarity().SetValue(resultantDissolvedCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHCO3Q->GetMolarity().SetValue(resultantHCO3_mM, AmountPerVolumeUnit::mmol_Per_L);
 
   // Balance to calc the masses and partial pressures
-  m_subHbO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subHbCO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subHbO2CO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subHbQ->Balance(BalanceLiquidBy::Molarity);
-  m_subO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subCO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subHCO3Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbCO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbO2CO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbQ->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subCO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHCO3Q->Balance(BalanceLiquidBy::Molarity);
 
   // Now set the final saturations
   double totalHb_mM = resultantHb_mM + resultantHbO2CO2_mM + resultantHbO2_mM + resultantHbCO2_mM;
 
-  if (m_subCOQ != nullptr)
+  if (ws.bg->subCOQ != nullptr)
   {
     totalHb_mM += newHbCO_mM;
-    m_subCOQ->GetSaturation().SetValue(HbCO_mM / totalHb_mM);
+    ws.bg->subCOQ->GetSaturation().SetValue(HbCO_mM / totalHb_mM);
   }
 
-  m_subO2Q->GetSaturation().SetValue((resultantHbO2_mM + resultantHbO2CO2_mM) / (totalHb_mM));
-  m_subCO2Q->GetSaturation().SetValue((resultantHbCO2_mM + resultantHbO2CO2_mM) / (totalHb_mM));
+  ws.bg->subO2Q->GetSaturation().SetValue((resultantHbO2_mM + resultantHbO2CO2_mM) / (totalHb_mM));
+  ws.bg->subCO2Q->GetSaturation().SetValue((resultantHbCO2_mM + resultantHbO2CO2_mM) / (totalHb_mM));
 
   return;
 }
@@ -907,13 +1229,9 @@ void SaturationCalculator::CalculateBloodGasDistribution(SELiquidCompartment& cm
 /// \details
 /// This code is adapted directly from the model described in @cite dash2010erratum.
 //--------------------------------------------------------------------------------------------------
-void SaturationCalculator::CalculateHemoglobinSaturations(double O2PartialPressureGuess_mmHg, double CO2PartialPressureGuess_mmHg, double pH, double temperature_C, double  hematocrit, double& OxygenSaturation, double& CarbonDioxideSaturation, double CO2_scaling_factor)
+template<typename T>
+void SaturationCalculator::CalculateHemoglobinSaturations(const T& O2PartialPressureGuess_mmHg, const T& CO2PartialPressureGuess_mmHg, const T& pH, double temperature_C, double hematocrit, double CO_sat, T& OxygenSaturation, T& CarbonDioxideSaturation, const T& CO2_scaling_factor)
 {
-  double CO_sat = 0;
-
-  if (m_subCOQ != nullptr)
-    CO_sat = m_subCOQ->GetSaturation().GetValue();
-
   //check temperature and override if below 5 degrees C (solved for negative value in the function that uses temp diff: p504): 
   if (temperature_C < 4.6)
     temperature_C += 4.6;
@@ -923,9 +1241,7 @@ void SaturationCalculator::CalculateHemoglobinSaturations(double O2PartialPressu
 
                                           // Fixed parameters
   double Wpl = 0.94;                      // fractional water space in plasma; unitless
-  double Wrbc = 0.65;                     // fractional water space in RBCs; unitless
   double Rrbc = 0.69;                     // Gibbs - Donnan ratio across RBC membrane; unitless
-  double Hbrbc = 5.18e-3;                 // hemoglobin concentration in RBCs; M
   double K2 = 2.95e-5;                    // CO2 + HbNH2 equilibrium constant; unitless
   double K2dp = 1.0e-6;                   // HbNHCOOH dissociation constant; M
   double K2p = K2 / K2dp;                 // kf2p / kb2p; 1 / M
@@ -948,67 +1264,60 @@ void SaturationCalculator::CalculateHemoglobinSaturations(double O2PartialPressu
   double O20 = alphaO20*pO20;              // standard O2 concentration in RBCs; M
   double CO20 = alphaCO20*pCO20;          // standard CO2 concentration in RBCs; M
   double Hp0 = pow(10, (-pH0));           // standard H + concentration in RBCs; M
-  double pHpl0 = pH0 - log10(Rrbc);        // standard pH in plasma; unitless
   double P500 = 26.8 - 20*CO_sat;         // standard pO2 at 50% SHbO2; mmHg
   double C500 = alphaO20*P500;            // standard O2 concentration at 50 % SHbO2; M
 
-  double Wbl = (1 - hematocrit)*Wpl + hematocrit*Wrbc;
-  double pHpl = pH - log10(Rrbc);
-  double pHpldiff = pHpl - pHpl0;
-  double pHdiff = pH - pH0;
-  double pCO2diff = CO2PartialPressureGuess_mmHg - pCO20;
+  T pHdiff = pH - pH0;
+  T pCO2diff = CO2PartialPressureGuess_mmHg - pCO20;
   double DPGdiff = DPG - DPG0;
   double Tempdiff = temperature_C - Temp0;
   double alphaO2 = fact*(1.37 - 0.0137*Tempdiff + 0.00058*Tempdiff*Tempdiff);
   double alphaCO2 = fact*(30.7 - 0.57*Tempdiff + 0.02*Tempdiff*Tempdiff);
-  double pK1 = 6.091 - 0.0434*pHpldiff + 0.0014*Tempdiff*pHpldiff;
-  double K1 = pow(10, -pK1);
-  double O2 = alphaO2*O2PartialPressureGuess_mmHg;
-  double CO2 = alphaCO2*CO2PartialPressureGuess_mmHg;
-  double Hp = pow(10, -pH);
-  double Hppl = pow(10, -pHpl);
-
-  double Term1 = K2p*(1 + K2dp / Hp);
-  double Term2 = K3p*(1 + K3dp / Hp);
-  double Term3 = (1 + Hp / K5dp);
-  double Term4 = (1 + Hp / K6dp);
+  T O2 = alphaO2*O2PartialPressureGuess_mmHg;
+  T CO2 = alphaCO2*CO2PartialPressureGuess_mmHg;
+  T Hp = Pow(10.0, T(-pH));
+
+  T Term1 = K2p*(1.0 + K2dp / Hp);
+  T Term2 = K3p*(1.0 + K3dp / Hp);
+  T Term3 = (1.0 + Hp / K5dp);
+  T Term4 = (1.0 + Hp / K6dp);
   double Term10 = K2p*(1 + K2dp / Hp0);
   double Term20 = K3p*(1 + K3dp / Hp0);
   double Term30 = (1 + Hp0 / K5dp);
   double Term40 = (1 + Hp0 / K6dp);
   double Kratio10 = (Term10*CO20 + Term30) / (Term20*CO20 + Term40);
-  double Kratio11 = (Term1*CO20 + Term3) / (Term2*CO20 + Term4);
-  double Kratio12 = (Term10*alphaCO20*CO2PartialPressureGuess_mmHg + Term30) / (Term20*alphaCO20*CO2PartialPressureGuess_mmHg + Term40);
+  T Kratio11 = (Term1*CO20 + Term3) / (Term2*CO20 + Term4);
+  T Kratio12 = (Term10*alphaCO20*CO2PartialPressureGuess_mmHg + Term30) / (Term20*alphaCO20*CO2PartialPressureGuess_mmHg + Term40);
   double K4dp = Kratio10*pow(O20, n0) / pow(C500, nhill);
   double K4tp = K4dp / pow(O20, n0);
   double Kratio20 = Kratio10 / K4tp; // = C500^nhill
-  double Kratio21 = Kratio11 / K4tp;
-  double Kratio22 = Kratio12 / K4tp;
+  T Kratio21 = Kratio11 / K4tp;
+  T Kratio22 = Kratio12 / K4tp;
 
-  double P501 = 26.765 - 21.279*pHdiff + 8.872*pHdiff*pHdiff;
-  double P502 = 26.80 + 0.0428*pCO2diff + 3.64e-5*pCO2diff*pCO2diff;
+  T P501 = 26.765 - 21.279*pHdiff + 8.872*pHdiff*pHdiff;
+  T P502 = 26.80 + 0.0428*pCO2diff + 3.64e-5*pCO2diff*pCO2diff;
   double P503 = 26.78 + 795.633533*DPGdiff - 19660.8947*DPGdiff*DPGdiff;
   double P504 = 26.75 + 1.4945*Tempdiff + 0.04335*Tempdiff*Tempdiff + 0.0007*Tempdiff*Tempdiff*Tempdiff;
-  double C501 = alphaO20*P501;
-  double C502 = alphaO20*P502;
+  T C501 = alphaO20*P501;
+  T C502 = alphaO20*P502;
   double C503 = alphaO20*P503;
   double C504 = alphaO2*P504;
 
-  double n1 = 1.0;
-  double n2 = 1.0;
+  T n1 = T(1.0);
+  T n2 = T(1.0);
   double n3 = 1.0;
   double n4 = 1.0; // Can be any arbitrary value
 
 
 
-  if (std::abs(pH - pH0) > 1.0e-6)
+  if (std::abs(Value(pH) - pH0) > 1.0e-6)
   {
-    n1 = (log10(Kratio21) - nhill*log10(C501)) / (pH - pH0);
+    n1 = (Log10(Kratio21) - nhill*Log10(C501)) / (pH - pH0);
   }
 
-  if (std::abs(CO2PartialPressureGuess_mmHg - pCO20) > 1.0e-6)
+  if (std::abs(Value(CO2PartialPressureGuess_mmHg) - pCO20) > 1.0e-6)
   {
-    n2 = (log10(Kratio22) - nhill*log10(C502)) / (log10(CO20) - log10(CO2));
+    n2 = (Log10(Kratio22) - nhill*Log10(C502)) / (log10(CO20) - Log10(CO2));
   }
 
   if (std::abs(DPG - DPG0) > 1.0e-6)
@@ -1021,15 +1330,15 @@ void SaturationCalculator::CalculateHemoglobinSaturations(double O2PartialPressu
     n4 = (log10(Kratio20) - nhill*log10(C504)) / (log10(Temp0) - log10(temperature_C));
   }
 
-  double Term5 = pow((Hp0 / Hp), n1)*pow((CO20 / CO2), n2)*pow((DPG0 / DPG), n3)*pow((Temp0 / temperature_C), n4);
+  T Term5 = Pow(T(Hp0 / Hp), n1)*Pow(T(CO20 / CO2), n2)*pow((DPG0 / DPG), n3)*pow((Temp0 / temperature_C), n4);
 
-  double K4p = K4dp*pow((O2 / O20), n0)*Term5;
-  double KHbO2 = K4p*(Term2*CO2 + Term4) / (Term1*CO2 + Term3);
-  double KHbCO2 = (Term1 + Term2*K4p*O2) / (Term3 + Term4*K4p*O2);
+  T K4p = K4dp*Pow(T(O2 / O20), n0)*Term5;
+  T KHbO2 = K4p*(Term2*CO2 + Term4) / (Term1*CO2 + Term3);
+  T KHbCO2 = (Term1 + Term2*K4p*O2) / (Term3 + Term4*K4p*O2);
 
   // Now set the saturations
-  OxygenSaturation = KHbO2*O2 / (1 + KHbO2*O2);
-  CarbonDioxideSaturation = KHbCO2*CO2*CO2_scaling_factor / (1 + KHbCO2*CO2*CO2_scaling_factor);
+  OxygenSaturation = KHbO2*O2 / (1.0 + KHbO2*O2);
+  CarbonDioxideSaturation = KHbCO2*CO2*CO2_scaling_factor / (1.0 + KHbCO2*CO2*CO2_scaling_factor);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1043,10 +1352,10 @@ void SaturationCalculator::CalculateHemoglobinSaturations(double O2PartialPressu
 /// The method first attempts an assumed solution. If the assumed solution requires more hemoglobin 
 /// than is available, the method steps towards a solution that minimizes total hemoglobin use.
 //--------------------------------------------------------------------------------------------------
-bool SaturationCalculator::DistributeHemoglobinBySaturation()
+bool SaturationCalculator::DistributeHemoglobinBySaturation(Workspace& ws) const
 {
-  double O2_sat = m_subO2Q->GetSaturation().GetValue();
-  double CO2_sat = m_subCO2Q->GetSaturation().GetValue();
+  double O2_sat = ws.bg->subO2Q->GetSaturation().GetValue();
+  double CO2_sat = ws.bg->subCO2Q->GetSaturation().GetValue();
 
   if (O2_sat > 1.0)
   {
@@ -1070,10 +1379,10 @@ bool SaturationCalculator::DistributeHemoglobinBySaturation()
   }
 
   //Grab the current values of Hb substances to get total Hb
-  double Hb_mM = m_subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);           // Hemoglobin with nothing bound
-  double HbO2_mM = m_subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);       // Hemoglobin with Oxygen bound to 4 sites
-  double HbCO2_mM = m_subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);     // Hemoglobin with Carbon Dioxide bound to 4 sites
-  double HbO2CO2_mM = m_subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L); // Hemoglobin with Oxygen and Carbon Dioxide bound to 4 sites
+  double Hb_mM = ws.bg->subHbQ->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);           // Hemoglobin with nothing bound
+  double HbO2_mM = ws.bg->subHbO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);       // Hemoglobin with Oxygen bound to 4 sites
+  double HbCO2_mM = ws.bg->subHbCO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L);     // Hemoglobin with Carbon Dioxide bound to 4 sites
+  double HbO2CO2_mM = ws.bg->subHbO2CO2Q->GetMolarity(AmountPerVolumeUnit::mmol_Per_L); // Hemoglobin with Oxygen and Carbon Dioxide bound to 4 sites
   double Hb_total_mM = HbO2_mM + HbCO2_mM + HbO2CO2_mM + Hb_mM;
 
   double HbReq4CO2_mM = CO2_sat * Hb_total_mM;
@@ -1118,14 +1427,14 @@ bool SaturationCalculator::DistributeHemoglobinBySaturation()
     return false;
   }
 
-  m_subHbQ->GetMolarity().SetValue(Hb_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbQ->Balance(BalanceLiquidBy::Molarity);
-  m_subHbO2Q->GetMolarity().SetValue(HbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subHbCO2Q->GetMolarity().SetValue(HbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbCO2Q->Balance(BalanceLiquidBy::Molarity);
-  m_subHbO2CO2Q->GetMolarity().SetValue(HbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
-  m_subHbO2CO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbQ->GetMolarity().SetValue(Hb_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbQ->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbO2Q->GetMolarity().SetValue(HbO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbCO2Q->GetMolarity().SetValue(HbCO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbCO2Q->Balance(BalanceLiquidBy::Molarity);
+  ws.bg->subHbO2CO2Q->GetMolarity().SetValue(HbO2CO2_mM, AmountPerVolumeUnit::mmol_Per_L);
+  ws.bg->subHbO2CO2Q->Balance(BalanceLiquidBy::Molarity);
 
   return true;
 }
@@ -3,16 +3,22 @@
 
 #pragma once
 #include "system/physiology/SETissueSystem.h"
+#include <atomic>
 struct error_functor;
+struct analytic_error_functor;
 
 /**
 * @brief
 * The %SaturationCalculator class holds the blood gas distribution model.
+* @details
+* The model itself only reads the body state and coefficients held here, what a calculation changes
+* is kept in a workspace, so several compartments can be balanced at once, each on its own workspace.
 */
 class PULSE_DECL SaturationCalculator : public Loggable
 {
 protected:
   friend error_functor;
+  friend analytic_error_functor;
   friend PulseController;
   friend class PulseEngineTest;
 
@@ -21,15 +27,91 @@ protected:
 public:
   virtual ~SaturationCalculator();
 
+  /** How the blood gas distribution equations are solved */
+  enum class SolverMode
+  {
+    NumericalJacobian = 0,    ///< Starts from the compartment's current values, finite difference Jacobian
+    WarmStartAnalyticJacobian ///< Starts from the compartment's last solution, analytic Jacobian
+  };
+
   void Initialize(SESubstanceManager& substances);
+  // Copies the last solution of each compartment, so a forked engine warm starts where its source would
+  static void Copy(const SaturationCalculator& src, SaturationCalculator& dst);
+
+  SolverMode GetSolverMode() const { return m_SolverMode; }
+  void SetSolverMode(SolverMode mode);
+  // Forgets the species and solutions cached for each compartment, needed whenever compartments are recreated
+  void ClearCompartmentCache();
+
+  // Solver effort of the last single compartment CalculateBloodGasDistribution call
+  size_t GetLastFunctionEvaluations() const { return m_Workspaces[0]->lastFunctionEvaluations; }
+  size_t GetLastJacobianEvaluations() const { return m_Workspaces[0]->lastJacobianEvaluations; }
+  // Solver effort summed over all calls, on all threads, since the last reset
+  size_t GetSolveCount() const;
+  size_t GetTotalFunctionEvaluations() const;
+  size_t GetTotalJacobianEvaluations() const;
+  void ResetSolverStatistics();
 
   void SetBodyState(const SEScalarMassPerVolume& AlbuminConcentration, const SEScalar0To1& Hematocrit, const SEScalarTemperature& Temperature, const SEScalarAmountPerVolume& StrongIonDifference, const SEScalarAmountPerVolume& Phosphate);
   void CalculateBloodGasDistribution(SELiquidCompartment& cmpt);
   void CalculateCarbonMonoxideSpeciesDistribution(SELiquidCompartment& cmpt);
 
+  // Balancing many compartments on several threads: prepare them on one thread,
+  // then call CalculateBloodGasDistributions on up to numWorkers threads, each with its own worker index
+  void PrepareBloodGasDistributions(const std::vector<SELiquidCompartment*>& cmpts, size_t numWorkers);
+  void CalculateBloodGasDistributions(size_t worker);
+
 protected:// Stewart Model + Dash-Bassingthwaighte Model + Henderson-Hasselbach Model
-  void CalculateHemoglobinSaturations(double O2PartialPressureGuess_mmHg, double CO2PartialPressureGuess_mmHg, double pH, double temperature_C, double  hematocrit, double& OxygenSaturation, double& CarbonDioxideSaturation, double CO2_scaling_factor);
-  bool DistributeHemoglobinBySaturation();
+  // Templated so it can also be evaluated on automatic differentiation scalars for the analytic Jacobian
+  template<typename T>
+  static void CalculateHemoglobinSaturations(const T& O2PartialPressureGuess_mmHg, const T& CO2PartialPressureGuess_mmHg, const T& pH, double temperature_C, double hematocrit, double CO_sat, T& OxygenSaturation, T& CarbonDioxideSaturation, const T& CO2_scaling_factor);
+
+  // The species quantities of a compartment, and its last solution
+  // The solution is not part of the engine state, it is forgotten when a state is loaded,
+  // so the next warm started solve of a loaded engine starts from the compartment's current values
+  // A forked engine copies the solutions, so it solves exactly as its source does
+  struct BloodGasCompartment
+  {
+    size_t                     numSubstanceQuantities;
+    SELiquidSubstanceQuantity* subO2Q;
+    SELiquidSubstanceQuantity* subCO2Q;
+    SELiquidSubstanceQuantity* subCOQ;
+    SELiquidSubstanceQuantity* subHbCOQ;
+    SELiquidSubstanceQuantity* subHCO3Q;
+    SELiquidSubstanceQuantity* subHbQ;
+    SELiquidSubstanceQuantity* subHbO2Q;
+    SELiquidSubstanceQuantity* subHbCO2Q;
+    SELiquidSubstanceQuantity* subHbO2CO2Q;
+    bool                       hasSolution;
+    double                     solution[4];// pH, HCO3 mM, dissolved CO2 mM, dissolved O2 mM
+  };
+  BloodGasCompartment& GetBloodGasCompartment(SELiquidCompartment& cmpt);
+
+  // Everything a calculation changes, other than its compartment
+  struct Workspace
+  {
+    Workspace();
+    // This is the current compartment and the quantities we are balancing
+    SELiquidCompartment*       cmpt;
+    BloodGasCompartment*       bg;
+    // Solver effort
+    size_t                     lastFunctionEvaluations;
+    size_t                     lastJacobianEvaluations;
+    size_t                     solveCount;
+    size_t                     totalFunctionEvaluations;
+    size_t                     totalJacobianEvaluations;
+  };
+  void CalculateBloodGasDistribution(Workspace& ws) const;
+  void CalculateCarbonMonoxideSpeciesDistribution(Workspace& ws) const;
+  bool DistributeHemoglobinBySaturation(Workspace& ws) const;
+
+  SolverMode m_SolverMode;
+  // Map nodes do not move, so compartments of a batch can be balanced while others are looked up
+  std::unordered_map<const SELiquidCompartment*, BloodGasCompartment> m_BloodGasCompartments;
+  // Workspace 0 is also used by the single compartment calculations
+  std::vector<std::unique_ptr<Workspace>> m_Workspaces;
+  std::vector<std::pair<SELiquidCompartment*, BloodGasCompartment*>> m_Batch;
+  std::atomic<size_t> m_NextBatchCompartment;
 
   // All properties are stateless and are set by either the Initialize method or SetBodyState method
   SESubstance* m_O2;
@@ -49,17 +131,9 @@ protected:// Stewart Model + Dash-Bassingthwaighte Model + Henderson-Hasselbach
   double m_HbO2_g_Per_mol;
   double m_HbCO2_g_Per_mol;
   double m_HbO2CO2_g_Per_mol;
-  // This is the current compartment and the quantities we are balancing
-  SELiquidCompartment*       m_cmpt;
-  SELiquidSubstanceQuantity* m_subO2Q;
-  SELiquidSubstanceQuantity* m_subCO2Q;
-  SELiquidSubstanceQuantity* m_subCOQ;
-  SELiquidSubstanceQuantity* m_subHbCOQ;
-  SELiquidSubstanceQuantity* m_subHCO3Q;
-  SELiquidSubstanceQuantity* m_subHbQ;
-  SELiquidSubstanceQuantity* m_subHbO2Q;
-  SELiquidSubstanceQuantity* m_subHbCO2Q;
-  SELiquidSubstanceQuantity* m_subHbO2CO2Q;
+  // Partial pressure of a dissolved gas per mmol/L
+  double m_O2_mmHg_Per_mM;
+  double m_CO2_mmHg_Per_mM;
   // The current state of the body to balance to
   double m_albumin_g_per_L;
   double m_hematocrit;
@@ -94,6 +94,8 @@ void Tissue::Clear()
   m_RightPulmonaryCapillaries = nullptr;
   
   m_PatientActions = nullptr;
+
+  m_DiffusionPlan.Clear();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -150,6 +152,18 @@ void Tissue::Serialize(const pulse::TissueSystemData& src, Tissue& dst)
   dst.m_RestingFluidMass_kg = src.restingfluidmass_kg();
 }
 
+void Tissue::Copy(const Tissue& src, Tissue& dst)
+{
+  SETissueSystem::Copy(src, dst);
+  dst.m_RestingTissueGlucose_g = src.m_RestingTissueGlucose_g;
+  dst.m_RestingBloodGlucose_g_Per_L = src.m_RestingBloodGlucose_g_Per_L;
+  dst.m_RestingBloodLipid_g_Per_L = src.m_RestingBloodLipid_g_Per_L;
+  dst.m_RestingBloodInsulin_g_Per_L = src.m_RestingBloodInsulin_g_Per_L;
+  dst.m_RestingPatientMass_kg = src.m_RestingPatientMass_kg;
+  dst.m_RestingFluidMass_kg = src.m_RestingFluidMass_kg;
+  dst.SetUp();
+}
+
 pulse::TissueSystemData* Tissue::Unload(const Tissue& src)
 {
   pulse::TissueSystemData* dst = new pulse::TissueSystemData();
@@ -265,6 +279,8 @@ void Tissue::SetUp()
         Warning("Tissue found a tissue compartment that it is not using in Consumption/Prodution : " + tissue->GetName());
     }
   }
+
+  BuildDiffusionPlan();
 }
 
 //#define logMeal
@@ -329,6 +345,21 @@ void Tissue::PreProcess()
 /// throughout the cardiovascular system and calculating diffusion and alveoli transfer of substances.
 //--------------------------------------------------------------------------------------------------
 void Tissue::Process()
+{
+  ProcessSubstanceTransport(1);
+  ProcessBloodGases(0);
+  ProcessVitals();
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// First part of Process, transports substances and prepares the blood gas distribution
+///
+/// \details
+/// The blood gases of each vascular compartment are distributed independently of the others,
+/// by ProcessBloodGases, on as many threads as are available.
+//--------------------------------------------------------------------------------------------------
+void Tissue::ProcessSubstanceTransport(size_t numBloodGasWorkers)
 {
   CalculateMetabolicConsumptionAndProduction(m_Dt_s);
   CalculatePulmonaryCapillarySubstanceTransfer();
@@ -342,13 +373,33 @@ void Tissue::Process()
                                                 m_data.GetEnergy().GetCoreTemperature(),
                                                 m_data.GetBloodChemistry().GetStrongIonDifference(),
                                                 m_data.GetBloodChemistry().GetPhosphate());
+  m_BloodGasCompartments.clear();
   for (SELiquidCompartment* cmpt : m_data.GetCompartments().GetVascularLeafCompartments())
   {
     if (cmpt->HasVolume())
-    {
-      m_data.GetSaturationCalculator().CalculateBloodGasDistribution(*cmpt);
-    }
+      m_BloodGasCompartments.push_back(cmpt);
   }
+  m_data.GetSaturationCalculator().PrepareBloodGasDistributions(m_BloodGasCompartments, numBloodGasWorkers);
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Distributes blood gases in the vascular compartments prepared by ProcessSubstanceTransport,
+/// until none are left
+///
+/// \param  worker  index of the calling thread, below the number of workers it was prepared for
+//--------------------------------------------------------------------------------------------------
+void Tissue::ProcessBloodGases(size_t worker)
+{
+  m_data.GetSaturationCalculator().CalculateBloodGasDistributions(worker);
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Last part of Process, once blood gases are distributed in every compartment
+//--------------------------------------------------------------------------------------------------
+void Tissue::ProcessVitals()
+{
   CalculateVitals();
 }
 
@@ -364,48 +415,57 @@ void Tissue::PostProcess()
 
 }
 
+void Tissue::DiffusionPlan::Clear()
+{
+  numSubstances = 0;
+  kind.clear();
+  tissue.clear();
+  substance.clear();
+  vascular.clear();
+  extracellular.clear();
+  intracellular.clear();
+  vascularSubQ.clear();
+  extracellularSubQ.clear();
+  intracellularSubQ.clear();
+  tissueKinetics.clear();
+  permeabilityCoefficient_mL_Per_s.clear();
+  facilitatedCoefficient_g_Per_s.clear();
+}
+
 //--------------------------------------------------------------------------------------------------
 /// \brief
-/// Determines the correct type of diffusion for a substance and executes the diffusion.
-///
+/// Determines the correct type of diffusion for each tissue and substance pair.
 ///
 /// \details
-/// Determines the type of diffusion for each substance and calls the function for that type of diffusion. 
-/// This is executed for all compartments in the tissue system. Options include, perfusion limited diffusion, 
-/// permeability limited diffusion (untested), pressure gradient diffusion, and flat rate diffusion. The appropriate
-/// diffusion methodology is chosen based on the substance parameters.
+/// The substance quantities and coefficients each pair needs are looked up here, once, rather than every
+/// time step. The plan is built on SetUp and rebuilt by CalculateDiffusion whenever substances become active.
 //--------------------------------------------------------------------------------------------------
-void Tissue::CalculateDiffusion()
+void Tissue::BuildDiffusionPlan()
 {
-  SETissueCompartment* tissue;
-  SELiquidCompartment* vascular;
-  const SESubstanceTissuePharmacokinetics* tissueKinetics;
-
-#ifdef PROBE_BLOOD_GASES
-  double totalO2movedVtoE_ug = 0;
-  double totalO2movedEtoI_ug = 0;
-  double totalCO2movedVtoE_ug = 0;
-  double totalCO2movedEtoI_ug = 0;
-#endif
+  DiffusionPlan& plan = m_DiffusionPlan;
+  plan.Clear();
+  const std::vector<SESubstance*>& substances = m_data.GetCompartments().GetLiquidCompartmentSubstances();
+  plan.numSubstances = substances.size();
 
   for (auto tissueVascular : m_TissueToVascular)
   {
-    tissue = tissueVascular.first;
-    vascular = tissueVascular.second;
+    SETissueCompartment* tissue = tissueVascular.first;
+    SELiquidCompartment* vascular = tissueVascular.second;
     SELiquidCompartment& extracellular = m_data.GetCompartments().GetExtracellularFluid(*tissue);
     SELiquidCompartment& intracellular = m_data.GetCompartments().GetIntracellularFluid(*tissue);
-    for (const SESubstance* sub : m_data.GetCompartments().GetLiquidCompartmentSubstances())
+    for (const SESubstance* sub : substances)
     {
-      tissueKinetics = nullptr;
-      if(sub->HasPK())
+      const SESubstanceTissuePharmacokinetics* tissueKinetics = nullptr;
+      if (sub->HasPK())
         tissueKinetics = sub->GetPK()->GetTissueKinetics(tissue->GetName());
+      DiffusionKind kind;
+      double permeabilityCoefficient_mL_Per_s = 0;
+      double facilitatedCoefficient_g_Per_s = 0;
       //Check to see if substance is a drug with the appropriate parameters to calculate PK diffusion
       // If the substance is a PBPK drug, then diffusion is computed by perfusion limited diffusion, as described in \cite huisinga2012modeling
       if (tissueKinetics != nullptr)
       {
-        if (!tissueKinetics->HasPartitionCoefficient())
-          continue;// wtf...? why would it not have it?
-        PerfusionLimitedDiffusion(*tissue, *vascular, *sub, tissueKinetics->GetPartitionCoefficient(), m_Dt_s); //Balance happens in the method      
+        kind = DiffusionKind::PerfusionLimited;
       }
       // Otherwise, the diffusion is computed by either:
       // Instantaneous diffusion (gases and very small molecules), Simple diffusion (all substances), Facilitated diffusion (glucose), or Active diffusion (pumps)
@@ -422,96 +482,178 @@ void Tissue::CalculateDiffusion()
         {
           // Sodium is special. We need to diffuse for renal function.
           // We will not treat sodium any differently once diffusion functionality is fully implemented.
-          if (sub == m_Sodium)
-            double moved_ug = MoveMassByInstantDiffusion(*vascular, extracellular, *sub, m_Dt_s);
-
-          continue;
+          if (sub != m_Sodium)
+            continue;
+          kind = DiffusionKind::Instant;
         }
-
-        double moved_ug;
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /////////////////// Vascular to Extravascular-Extracellular /////////////////////////////////////////////
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        // --- First, instant diffusion ---
-        moved_ug = MoveMassByInstantDiffusion(*vascular, extracellular, *sub, m_Dt_s);
-
-        // --- Second, simple diffusion ---
+        else
+        {
+          kind = DiffusionKind::Gas;
           // Compute the vascular to extracellular permeability coefficient
           // This is the coefficient per gram of tissue independent of the tissue type.
           // This uses the Renkin and Curry data for capillary exchange as reported in \cite fournier2011basic
           // Divide by 100 is because the Renkin-Curry equations are in per hectogram units, and 100 g/hg
-          /// \todo I believe we can optimize with a cache of these values. Also, we can cache permeabilityCoefficient_mL_Per_s_g which is not a function of the tissue properties
-        double molarMass_g_Per_mol = sub->GetMolarMass(MassPerAmountUnit::g_Per_mol);
-        double molecularRadius_nm = 0.0348*pow(molarMass_g_Per_mol, 0.4175);
-        double vToECpermeabilityCoefficient_mL_Per_s_g = 0.0287*pow(molecularRadius_nm, -2.920) / 100.0; // This is only valid if the molecular radius is > 1.0 nm.
-        if (molecularRadius_nm < 1.0)
-          vToECpermeabilityCoefficient_mL_Per_s_g = 0.0184*pow(molecularRadius_nm, -1.223) / 100.0;
-
+          double molarMass_g_Per_mol = sub->GetMolarMass(MassPerAmountUnit::g_Per_mol);
+          double molecularRadius_nm = 0.0348*pow(molarMass_g_Per_mol, 0.4175);
+          double vToECpermeabilityCoefficient_mL_Per_s_g = 0.0287*pow(molecularRadius_nm, -2.920) / 100.0; // This is only valid if the molecular radius is > 1.0 nm.
+          if (molecularRadius_nm < 1.0)
+            vToECpermeabilityCoefficient_mL_Per_s_g = 0.0184*pow(molecularRadius_nm, -1.223) / 100.0;
           // Multiply by tissue mass to get the tissue-dependent coefficient. 
-        double vToECpermeabilityCoefficient_mL_Per_s = vToECpermeabilityCoefficient_mL_Per_s_g * tissue->GetTotalMass(MassUnit::g);
-          // A tuning factor helps tune the dynamics - note that concentrations will ALWAYS equilibrate in steady state given enough time regardless of the permeability
-        double vToECPermeabilityTuningFactor = 1.0; 
-        moved_ug = MoveMassBySimpleDiffusion(*vascular, extracellular, *sub, vToECPermeabilityTuningFactor*vToECpermeabilityCoefficient_mL_Per_s, m_Dt_s);
+          permeabilityCoefficient_mL_Per_s = vToECpermeabilityCoefficient_mL_Per_s_g * tissue->GetTotalMass(MassUnit::g);
 
-        // --- Third facilitated diffusion ---
-        if (sub->HasMaximumDiffusionFlux())
-        {
-          double massToAreaCoefficient_cm2_Per_g = 1.0; /// \todo Define relationship between tissue mass and membrane area.
-          double capCoverage_cm2 = massToAreaCoefficient_cm2_Per_g * tissue->GetTotalMass(MassUnit::g);
-          double maximumMassFlux = sub->GetMaximumDiffusionFlux(MassPerAreaTimeUnit::g_Per_cm2_s);
-          double combinedCoefficient_g_Per_s = maximumMassFlux*capCoverage_cm2;
-          moved_ug = MoveMassByFacilitatedDiffusion(*vascular, extracellular, *sub, combinedCoefficient_g_Per_s, m_Dt_s);
+          if (sub->HasMaximumDiffusionFlux())
+          {
+            double massToAreaCoefficient_cm2_Per_g = 1.0; /// \todo Define relationship between tissue mass and membrane area.
+            double capCoverage_cm2 = massToAreaCoefficient_cm2_Per_g * tissue->GetTotalMass(MassUnit::g);
+            double maximumMassFlux = sub->GetMaximumDiffusionFlux(MassPerAreaTimeUnit::g_Per_cm2_s);
+            facilitatedCoefficient_g_Per_s = maximumMassFlux*capCoverage_cm2;
+          }
         }
+      }
+
+      SELiquidSubstanceQuantity* vascularSubQ = vascular->GetSubstanceQuantity(*sub);
+      SELiquidSubstanceQuantity* extracellularSubQ = extracellular.GetSubstanceQuantity(*sub);
+      SELiquidSubstanceQuantity* intracellularSubQ = intracellular.GetSubstanceQuantity(*sub);
+      if (vascularSubQ == nullptr)
+        throw CommonDataModelException("No Vascular Substance Quantity found for substance " + sub->GetName());
+      if (intracellularSubQ == nullptr)
+        throw CommonDataModelException("No Tissue-Intracellular Substance Quantity found for substance " + sub->GetName());
+      if (extracellularSubQ == nullptr)
+        throw CommonDataModelException("No Tissue-Extracellular Substance Quantity found for substance " + sub->GetName());
+
+      plan.kind.push_back(kind);
+      plan.tissue.push_back(tissue);
+      plan.substance.push_back(sub);
+      plan.vascular.push_back(vascular);
+      plan.extracellular.push_back(&extracellular);
+      plan.intracellular.push_back(&intracellular);
+      plan.vascularSubQ.push_back(vascularSubQ);
+      plan.extracellularSubQ.push_back(extracellularSubQ);
+      plan.intracellularSubQ.push_back(intracellularSubQ);
+      plan.tissueKinetics.push_back(tissueKinetics);
+      plan.permeabilityCoefficient_mL_Per_s.push_back(permeabilityCoefficient_mL_Per_s);
+      plan.facilitatedCoefficient_g_Per_s.push_back(facilitatedCoefficient_g_Per_s);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+/// \brief
+/// Executes the diffusion of every tissue and substance pair of the diffusion plan.
+///
+///
+/// \details
+/// The type of diffusion for each substance and compartment is determined by BuildDiffusionPlan.
+/// Options include, perfusion limited diffusion, permeability limited diffusion (untested),
+/// pressure gradient diffusion, and flat rate diffusion. The appropriate
+/// diffusion methodology is chosen based on the substance parameters.
+//--------------------------------------------------------------------------------------------------
+void Tissue::CalculateDiffusion()
+{
+  if (m_DiffusionPlan.numSubstances != m_data.GetCompartments().GetLiquidCompartmentSubstances().size())
+    BuildDiffusionPlan();
+  const DiffusionPlan& plan = m_DiffusionPlan;
 
-        // --- Fourth, and final vascular to EV-EC, Active diffusion ---
-        double pumpRate_g_Per_s = 0.0;
-        /// \todo Compute the pump rate from an empirically-determined baseline pump rate.
-        moved_ug = MoveMassByActiveTransport(*vascular, extracellular, *sub, pumpRate_g_Per_s, m_Dt_s);
-        
 #ifdef PROBE_BLOOD_GASES
-        if (sub == &m_data.GetSubstances().GetO2() || sub == &m_data.GetSubstances().GetCO2())
-          m_data.GetDataTrack().Probe(tissue->GetName() + "_" + sub->GetName() + "_VascularToExtracelluar_ug", moved_ug);
-        if (sub == &m_data.GetSubstances().GetO2())
-          totalO2movedVtoE_ug += moved_ug;
-        if (sub == &m_data.GetSubstances().GetCO2())
-          totalCO2movedVtoE_ug += moved_ug;
+  double totalO2movedVtoE_ug = 0;
+  double totalO2movedEtoI_ug = 0;
+  double totalCO2movedVtoE_ug = 0;
+  double totalCO2movedEtoI_ug = 0;
 #endif
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /////////////////// Extravascular-Extracellular to Extravascular-Intracellular //////////////////////////
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////
+  for (size_t i = 0; i < plan.kind.size(); i++)
+  {
+    SELiquidCompartment& vascular = *plan.vascular[i];
+    SELiquidCompartment& extracellular = *plan.extracellular[i];
+    SELiquidCompartment& intracellular = *plan.intracellular[i];
+    SELiquidSubstanceQuantity& vascularSubQ = *plan.vascularSubQ[i];
+    SELiquidSubstanceQuantity& extracellularSubQ = *plan.extracellularSubQ[i];
+    SELiquidSubstanceQuantity& intracellularSubQ = *plan.intracellularSubQ[i];
+
+    switch (plan.kind[i])
+    {
+    case DiffusionKind::PerfusionLimited:
+    {
+      const SESubstanceTissuePharmacokinetics* tissueKinetics = plan.tissueKinetics[i];
+      if (!tissueKinetics->HasPartitionCoefficient())
+        continue;// wtf...? why would it not have it?
+      PerfusionLimitedDiffusion(*plan.tissue[i], vascular, vascularSubQ, intracellular, intracellularSubQ, tissueKinetics->GetPartitionCoefficient(), m_Dt_s); //Balance happens in the method
+      break;
+    }
+    case DiffusionKind::Instant:
+    {
+      MoveMassByInstantDiffusion(vascular, vascularSubQ, extracellular, extracellularSubQ, m_Dt_s);
+      break;
+    }
+    case DiffusionKind::Gas:
+    {
+      double moved_ug;
+      /////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /////////////////// Vascular to Extravascular-Extracellular /////////////////////////////////////////////
+      /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // --- First, instant diffusion ---
-        moved_ug = MoveMassByInstantDiffusion(extracellular, intracellular, *sub, m_Dt_s);
+      // --- First, instant diffusion ---
+      moved_ug = MoveMassByInstantDiffusion(vascular, vascularSubQ, extracellular, extracellularSubQ, m_Dt_s);
 
-        // --- Second, simple diffusion ---
-          // Assuming that the capillary permeability coefficient is proportional to the cellular membrane permeability coefficient for a given tissue and substance
-        double ECtoICPermeabilityFactor = 1.0; // This is the permeability constant
-        moved_ug = MoveMassBySimpleDiffusion(extracellular, intracellular, *sub, ECtoICPermeabilityFactor*vToECpermeabilityCoefficient_mL_Per_s, m_Dt_s);
+      // --- Second, simple diffusion ---
+        // A tuning factor helps tune the dynamics - note that concentrations will ALWAYS equilibrate in steady state given enough time regardless of the permeability
+      double vToECPermeabilityTuningFactor = 1.0; 
+      moved_ug = MoveMassBySimpleDiffusion(vascular, vascularSubQ, extracellular, extracellularSubQ, vToECPermeabilityTuningFactor*plan.permeabilityCoefficient_mL_Per_s[i], m_Dt_s);
 
-        // --- Third facilitated diffusion ---
-          // In Pulse, only glucose moves by facilitated diffusion, and it is assumed that all glucose that gets to the 
-          // intracellular space is used for energy or converted to glycogen for storage. So no facilitated diffusion between EC and IC.
-          /// \todo Decrement glucose from EC for energy and decrement/increment from EC for conversions (glycogen, gluconeogenesis, etc).
+      // --- Third facilitated diffusion ---
+      if (plan.substance[i]->HasMaximumDiffusionFlux())
+        moved_ug = MoveMassByFacilitatedDiffusion(vascular, vascularSubQ, extracellular, extracellularSubQ, plan.facilitatedCoefficient_g_Per_s[i], m_Dt_s);
 
-        // --- Fourth, and final vascular to EV-EC, Active diffusion ---
-        pumpRate_g_Per_s = 0.0;
-        /// \todo Compute the pump rate from an empirically-determined baseline pump rate.
-        moved_ug = MoveMassByActiveTransport(extracellular, intracellular, *sub, pumpRate_g_Per_s, m_Dt_s);        
+      // --- Fourth, and final vascular to EV-EC, Active diffusion ---
+      double pumpRate_g_Per_s = 0.0;
+      /// \todo Compute the pump rate from an empirically-determined baseline pump rate.
+      moved_ug = MoveMassByActiveTransport(vascular, vascularSubQ, extracellular, extracellularSubQ, pumpRate_g_Per_s, m_Dt_s);
 
 #ifdef PROBE_BLOOD_GASES
-        if (sub == &m_data.GetSubstances().GetO2() || sub == &m_data.GetSubstances().GetCO2())
-          m_data.GetDataTrack().Probe(tissue->GetName() + "_" + sub->GetName() + "_ExtracelluarToIntracelluar_ug", moved_ug);
-        if (sub == &m_data.GetSubstances().GetO2())
-          totalO2movedEtoI_ug += moved_ug;
-        if (sub == &m_data.GetSubstances().GetCO2())
-          totalCO2movedEtoI_ug += moved_ug;
+      const SESubstance* sub = plan.substance[i];
+      if (sub == &m_data.GetSubstances().GetO2() || sub == &m_data.GetSubstances().GetCO2())
+        m_data.GetDataTrack().Probe(plan.tissue[i]->GetName() + "_" + sub->GetName() + "_VascularToExtracelluar_ug", moved_ug);
+      if (sub == &m_data.GetSubstances().GetO2())
+        totalO2movedVtoE_ug += moved_ug;
+      if (sub == &m_data.GetSubstances().GetCO2())
+        totalCO2movedVtoE_ug += moved_ug;
 #endif
-        vascular->GetSubstanceQuantity(*sub)->Balance(BalanceLiquidBy::Mass);
-        extracellular.GetSubstanceQuantity(*sub)->Balance(BalanceLiquidBy::Mass);
-        intracellular.GetSubstanceQuantity(*sub)->Balance(BalanceLiquidBy::Mass);
-      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /////////////////// Extravascular-Extracellular to Extravascular-Intracellular //////////////////////////
+      /////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+      // --- First, instant diffusion ---
+      moved_ug = MoveMassByInstantDiffusion(extracellular, extracellularSubQ, intracellular, intracellularSubQ, m_Dt_s);
+
+      // --- Second, simple diffusion ---
+        // Assuming that the capillary permeability coefficient is proportional to the cellular membrane permeability coefficient for a given tissue and substance
+      double ECtoICPermeabilityFactor = 1.0; // This is the permeability constant
+      moved_ug = MoveMassBySimpleDiffusion(extracellular, extracellularSubQ, intracellular, intracellularSubQ, ECtoICPermeabilityFactor*plan.permeabilityCoefficient_mL_Per_s[i], m_Dt_s);
+
+      // --- Third facilitated diffusion ---
+        // In Pulse, only glucose moves by facilitated diffusion, and it is assumed that all glucose that gets to the 
+        // intracellular space is used for energy or converted to glycogen for storage. So no facilitated diffusion between EC and IC.
+        /// \todo Decrement glucose from EC for energy and decrement/increment from EC for conversions (glycogen, gluconeogenesis, etc).
+
+      // --- Fourth, and final vascular to EV-EC, Active diffusion ---
+      pumpRate_g_Per_s = 0.0;
+      /// \todo Compute the pump rate from an empirically-determined baseline pump rate.
+      moved_ug = MoveMassByActiveTransport(extracellular, extracellularSubQ, intracellular, intracellularSubQ, pumpRate_g_Per_s, m_Dt_s);
+
+#ifdef PROBE_BLOOD_GASES
+      if (sub == &m_data.GetSubstances().GetO2() || sub == &m_data.GetSubstances().GetCO2())
+        m_data.GetDataTrack().Probe(plan.tissue[i]->GetName() + "_" + sub->GetName() + "_ExtracelluarToIntracelluar_ug", moved_ug);
+      if (sub == &m_data.GetSubstances().GetO2())
+        totalO2movedEtoI_ug += moved_ug;
+      if (sub == &m_data.GetSubstances().GetCO2())
+        totalCO2movedEtoI_ug += moved_ug;
+#endif
+      vascularSubQ.Balance(BalanceLiquidBy::Mass);
+      extracellularSubQ.Balance(BalanceLiquidBy::Mass);
+      intracellularSubQ.Balance(BalanceLiquidBy::Mass);
+      break;
+    }
     }
   }
 #ifdef PROBE_BLOOD_GASES
@@ -1156,7 +1298,11 @@ void Tissue::CalculateVitals()
 //--------------------------------------------------------------------------------------------------
 void Tissue::DistributeMassbyVolumeWeighted(SELiquidCompartment& cmpt, const SESubstance& sub, double mass, const MassUnit& unit)
 {
-  SELiquidSubstanceQuantity* subQ = cmpt.GetSubstanceQuantity(sub);
+  DistributeMassbyVolumeWeighted(cmpt, *cmpt.GetSubstanceQuantity(sub), mass, unit);
+}
+void Tissue::DistributeMassbyVolumeWeighted(SELiquidCompartment& cmpt, SELiquidSubstanceQuantity& cmptSubQ, double mass, const MassUnit& unit)
+{
+  SELiquidSubstanceQuantity* subQ = &cmptSubQ;
   if (mass < 0.0)
   {
     if (-mass > subQ->GetMass(unit))
@@ -1180,7 +1326,7 @@ void Tissue::DistributeMassbyVolumeWeighted(SELiquidCompartment& cmpt, const SES
     for (SELiquidCompartment* leaf : cmpt.GetLeaves())
     {
       double leafMass = mass * (leaf->GetVolume(VolumeUnit::mL) / volume_mL);
-      SELiquidSubstanceQuantity* subQ = leaf->GetSubstanceQuantity(sub);
+      SELiquidSubstanceQuantity* subQ = leaf->GetSubstanceQuantity(cmptSubQ.GetSubstance());
       subQ->GetMass().IncrementValue(leafMass, unit);
       if (std::abs(subQ->GetMass(MassUnit::ug)) < ZERO_APPROX)
       {
@@ -1206,7 +1352,11 @@ void Tissue::DistributeMassbyVolumeWeighted(SELiquidCompartment& cmpt, const SES
 //--------------------------------------------------------------------------------------------------
 void Tissue::DistributeMassbyMassWeighted(SELiquidCompartment& cmpt, const SESubstance& sub, double mass, const MassUnit& unit)
 {
-  SELiquidSubstanceQuantity* subQ = cmpt.GetSubstanceQuantity(sub);
+  DistributeMassbyMassWeighted(cmpt, *cmpt.GetSubstanceQuantity(sub), mass, unit);
+}
+void Tissue::DistributeMassbyMassWeighted(SELiquidCompartment& cmpt, SELiquidSubstanceQuantity& cmptSubQ, double mass, const MassUnit& unit)
+{
+  SELiquidSubstanceQuantity* subQ = &cmptSubQ;
   if (mass < 0.0)
   {
     mass = -mass > subQ->GetMass(unit) ? -subQ->GetMass(unit) : mass;
@@ -1225,7 +1375,7 @@ void Tissue::DistributeMassbyMassWeighted(SELiquidCompartment& cmpt, const SESub
     double mass_ug = subQ->GetMass(MassUnit::ug);
     for (SELiquidCompartment* leaf : cmpt.GetLeaves())
     {
-      SELiquidSubstanceQuantity* subQ = leaf->GetSubstanceQuantity(sub);
+      SELiquidSubstanceQuantity* subQ = leaf->GetSubstanceQuantity(cmptSubQ.GetSubstance());
     double leafMass = 0.0;
     if (mass_ug != 0.0)
     {
@@ -1266,12 +1416,18 @@ double Tissue::PerfusionLimitedDiffusion(SETissueCompartment& tissue, SELiquidCo
   SELiquidSubstanceQuantity* vSubQ = vascular.GetSubstanceQuantity(sub);
   if (vSubQ == nullptr)
     throw CommonDataModelException("No Vascular Substance Quantity found for substance " + sub.GetName());
-  double VascularFlow_m_LPer_s = vascular.GetInFlow(VolumePerTimeUnit::mL_Per_s);
-  double VascularConcentration_ug_Per_mL = vSubQ->GetConcentration(MassPerVolumeUnit::ug_Per_mL);
-
   SELiquidSubstanceQuantity* tSubQ = intracellular.GetSubstanceQuantity(sub);
   if (tSubQ == nullptr)
     throw CommonDataModelException("No Tissue-Intracellular Substance Quantity found for substance " + sub.GetName());
+  return PerfusionLimitedDiffusion(tissue, vascular, *vSubQ, intracellular, *tSubQ, partitionCoeff, timestep_s);
+}
+double Tissue::PerfusionLimitedDiffusion(SETissueCompartment& tissue, SELiquidCompartment& vascular, SELiquidSubstanceQuantity& vascularSubQ, SELiquidCompartment& intracellular, SELiquidSubstanceQuantity& intracellularSubQ, double partitionCoeff, double timestep_s)
+{
+  SELiquidSubstanceQuantity* vSubQ = &vascularSubQ;
+  SELiquidSubstanceQuantity* tSubQ = &intracellularSubQ;
+  double VascularFlow_m_LPer_s = vascular.GetInFlow(VolumePerTimeUnit::mL_Per_s);
+  double VascularConcentration_ug_Per_mL = vSubQ->GetConcentration(MassPerVolumeUnit::ug_Per_mL);
+
   SEScalarMassPerVolume tissueConcentration;
   GeneralMath::CalculateConcentration(tSubQ->GetMass(), tissue.GetMatrixVolume(), tissueConcentration, m_Logger);
   double TissueConcentration_ug_Per_mL = tissueConcentration.GetValue(MassPerVolumeUnit::ug_Per_mL);
@@ -1295,15 +1451,15 @@ double Tissue::PerfusionLimitedDiffusion(SETissueCompartment& tissue, SELiquidCo
     {
       if (MassIncrement_ug > vSubQ->GetMass(MassUnit::ug))
         MassIncrement_ug = vSubQ->GetMass(MassUnit::ug);
-      DistributeMassbyMassWeighted(vascular, sub, -MassIncrement_ug, MassUnit::ug);
-      DistributeMassbyVolumeWeighted(intracellular, sub, MassIncrement_ug, MassUnit::ug);
+      DistributeMassbyMassWeighted(vascular, *vSubQ, -MassIncrement_ug, MassUnit::ug);
+      DistributeMassbyVolumeWeighted(intracellular, *tSubQ, MassIncrement_ug, MassUnit::ug);
     }
     else
     {
       if (-MassIncrement_ug > tSubQ->GetMass(MassUnit::ug))
         MassIncrement_ug = -tSubQ->GetMass(MassUnit::ug);
-      DistributeMassbyVolumeWeighted(vascular, sub, -MassIncrement_ug, MassUnit::ug);
-      DistributeMassbyMassWeighted(intracellular, sub, MassIncrement_ug, MassUnit::ug);
+      DistributeMassbyVolumeWeighted(vascular, *vSubQ, -MassIncrement_ug, MassUnit::ug);
+      DistributeMassbyMassWeighted(intracellular, *tSubQ, MassIncrement_ug, MassUnit::ug);
     }    
 
     vSubQ->Balance(BalanceLiquidBy::Mass);
@@ -1410,8 +1566,12 @@ void Tissue::AlveolarPartialPressureGradientDiffusion(SEGasCompartment& pulmonar
 //--------------------------------------------------------------------------------------------------
 double Tissue::MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double permeabilityCofficient_mL_Per_s, double timestep_s)
 {
-  const SELiquidSubstanceQuantity* srcQ = source.GetSubstanceQuantity(sub);
-  const SELiquidSubstanceQuantity* tgtQ = target.GetSubstanceQuantity(sub);
+  return MoveMassBySimpleDiffusion(source, *source.GetSubstanceQuantity(sub), target, *target.GetSubstanceQuantity(sub), permeabilityCofficient_mL_Per_s, timestep_s);
+}
+double Tissue::MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcSubQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtSubQ, double permeabilityCofficient_mL_Per_s, double timestep_s)
+{
+  SELiquidSubstanceQuantity* srcQ = &srcSubQ;
+  SELiquidSubstanceQuantity* tgtQ = &tgtSubQ;
 
   double amountIncrement_ug = permeabilityCofficient_mL_Per_s * (srcQ->GetConcentration(MassPerVolumeUnit::ug_Per_mL) - tgtQ->GetConcentration(MassPerVolumeUnit::ug_Per_mL)) * timestep_s;
   // Need to limit the increment to what is available... just in case
@@ -1421,8 +1581,8 @@ double Tissue::MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidCo
     {
       amountIncrement_ug = srcQ->GetMass(MassUnit::ug);
     }
-    DistributeMassbyMassWeighted(source, sub, -amountIncrement_ug, MassUnit::ug);
-    DistributeMassbyVolumeWeighted(target, sub, amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyMassWeighted(source, *srcQ, -amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyVolumeWeighted(target, *tgtQ, amountIncrement_ug, MassUnit::ug);
   }
   else // negative increment means it is coming from the target and going to the source
   {
@@ -1430,8 +1590,8 @@ double Tissue::MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidCo
     {
       amountIncrement_ug = -tgtQ->GetMass(MassUnit::ug);
     }
-    DistributeMassbyVolumeWeighted(source, sub, -amountIncrement_ug, MassUnit::ug);
-    DistributeMassbyMassWeighted(target, sub, amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyVolumeWeighted(source, *srcQ, -amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyMassWeighted(target, *tgtQ, amountIncrement_ug, MassUnit::ug);
   }
 
   // Note we are only changing mass and NOT balancing on purpose
@@ -1455,8 +1615,12 @@ double Tissue::MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidCo
   //--------------------------------------------------------------------------------------------------
 double Tissue::MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double timestep_s)
 {
-  const SELiquidSubstanceQuantity* srcQ = source.GetSubstanceQuantity(sub);
-  const SELiquidSubstanceQuantity* tgtQ = target.GetSubstanceQuantity(sub);
+  return MoveMassByInstantDiffusion(source, *source.GetSubstanceQuantity(sub), target, *target.GetSubstanceQuantity(sub), timestep_s);
+}
+double Tissue::MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcSubQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtSubQ, double timestep_s)
+{
+  SELiquidSubstanceQuantity* srcQ = &srcSubQ;
+  SELiquidSubstanceQuantity* tgtQ = &tgtSubQ;
 
   double sConc_ug = srcQ->GetMass(MassUnit::ug);
   double tConc_ug = tgtQ->GetMass(MassUnit::ug);
@@ -1473,8 +1637,8 @@ double Tissue::MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidC
     {
       amountIncrement_ug = srcQ->GetMass(MassUnit::ug);
     }
-    DistributeMassbyMassWeighted(source, sub, -amountIncrement_ug, MassUnit::ug);
-    DistributeMassbyVolumeWeighted(target, sub, amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyMassWeighted(source, *srcQ, -amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyVolumeWeighted(target, *tgtQ, amountIncrement_ug, MassUnit::ug);
   }
   else // negative increment means it is coming from the target and going to the source
   {
@@ -1482,8 +1646,8 @@ double Tissue::MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidC
     {
       amountIncrement_ug = -tgtQ->GetMass(MassUnit::ug);
     }
-    DistributeMassbyVolumeWeighted(source, sub, -amountIncrement_ug, MassUnit::ug);
-    DistributeMassbyMassWeighted(target, sub, amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyVolumeWeighted(source, *srcQ, -amountIncrement_ug, MassUnit::ug);
+    DistributeMassbyMassWeighted(target, *tgtQ, amountIncrement_ug, MassUnit::ug);
   }
 
   // Note we are only changing mass and NOT balancing on purpose
@@ -1514,8 +1678,13 @@ double Tissue::MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidC
 //--------------------------------------------------------------------------------------------------
 double Tissue::MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double combinedCoefficient_g_Per_s, double timestep_s)
 {
-  const SELiquidSubstanceQuantity* sSubQ = source.GetSubstanceQuantity(sub);
-  const SELiquidSubstanceQuantity* tSubQ = target.GetSubstanceQuantity(sub);
+  return MoveMassByFacilitatedDiffusion(source, *source.GetSubstanceQuantity(sub), target, *target.GetSubstanceQuantity(sub), combinedCoefficient_g_Per_s, timestep_s);
+}
+double Tissue::MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcSubQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtSubQ, double combinedCoefficient_g_Per_s, double timestep_s)
+{
+  SELiquidSubstanceQuantity* sSubQ = &srcSubQ;
+  SELiquidSubstanceQuantity* tSubQ = &tgtSubQ;
+  const SESubstance& sub = srcSubQ.GetSubstance();
 
   double amountIncrement_g = combinedCoefficient_g_Per_s * (sSubQ->GetConcentration(MassPerVolumeUnit::g_Per_mL) - tSubQ->GetConcentration(MassPerVolumeUnit::g_Per_mL))
     / (sub.GetMichaelisCoefficient() + (sSubQ->GetConcentration(MassPerVolumeUnit::g_Per_mL) - tSubQ->GetConcentration(MassPerVolumeUnit::g_Per_mL))) *timestep_s;
@@ -1526,8 +1695,8 @@ double Tissue::MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiq
     {
       amountIncrement_g = sSubQ->GetMass(MassUnit::g);
     }
-    DistributeMassbyMassWeighted(source, sub, -amountIncrement_g, MassUnit::g);
-    DistributeMassbyVolumeWeighted(target, sub, amountIncrement_g, MassUnit::g);
+    DistributeMassbyMassWeighted(source, *sSubQ, -amountIncrement_g, MassUnit::g);
+    DistributeMassbyVolumeWeighted(target, *tSubQ, amountIncrement_g, MassUnit::g);
   }
   else // negative increment means it is coming from the target and going to the source
   {
@@ -1535,8 +1704,8 @@ double Tissue::MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiq
     {
       amountIncrement_g = -tSubQ->GetMass(MassUnit::g);
     }
-    DistributeMassbyVolumeWeighted(source, sub, -amountIncrement_g, MassUnit::g);
-    DistributeMassbyMassWeighted(target, sub, amountIncrement_g, MassUnit::g);
+    DistributeMassbyVolumeWeighted(source, *sSubQ, -amountIncrement_g, MassUnit::g);
+    DistributeMassbyMassWeighted(target, *tSubQ, amountIncrement_g, MassUnit::g);
   }
   // Note we are only changing mass and NOT balancing on purpose
   // We don't want the concentrations changing until we have completed our 
@@ -1566,8 +1735,12 @@ double Tissue::MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiq
 //--------------------------------------------------------------------------------------------------
 double Tissue::MoveMassByActiveTransport(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double pumpRate_g_Per_s, double timestep_s)
 {
-  const SELiquidSubstanceQuantity* srcQ = source.GetSubstanceQuantity(sub);
-  const SELiquidSubstanceQuantity* tgtQ = target.GetSubstanceQuantity(sub);
+  return MoveMassByActiveTransport(source, *source.GetSubstanceQuantity(sub), target, *target.GetSubstanceQuantity(sub), pumpRate_g_Per_s, timestep_s);
+}
+double Tissue::MoveMassByActiveTransport(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcSubQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtSubQ, double pumpRate_g_Per_s, double timestep_s)
+{
+  SELiquidSubstanceQuantity* srcQ = &srcSubQ;
+  SELiquidSubstanceQuantity* tgtQ = &tgtSubQ;
 
   double amountIncrement_g = pumpRate_g_Per_s * timestep_s;
 
@@ -1577,8 +1750,8 @@ double Tissue::MoveMassByActiveTransport(SELiquidCompartment& source, SELiquidCo
     {
       amountIncrement_g = srcQ->GetMass(MassUnit::g);
     }
-    DistributeMassbyMassWeighted(source, sub, -amountIncrement_g, MassUnit::g);
-    DistributeMassbyVolumeWeighted(target, sub, amountIncrement_g, MassUnit::g);
+    DistributeMassbyMassWeighted(source, *srcQ, -amountIncrement_g, MassUnit::g);
+    DistributeMassbyVolumeWeighted(target, *tgtQ, amountIncrement_g, MassUnit::g);
   }
   else // negative increment means it is coming from the target and going to the source
   {
@@ -1586,8 +1759,8 @@ double Tissue::MoveMassByActiveTransport(SELiquidCompartment& source, SELiquidCo
     {
       amountIncrement_g = -tgtQ->GetMass(MassUnit::g);
     }
-    DistributeMassbyVolumeWeighted(source, sub, -amountIncrement_g, MassUnit::g);
-    DistributeMassbyMassWeighted(target, sub, amountIncrement_g, MassUnit::g);
+    DistributeMassbyVolumeWeighted(source, *srcQ, -amountIncrement_g, MassUnit::g);
+    DistributeMassbyMassWeighted(target, *tgtQ, amountIncrement_g, MassUnit::g);
   }
 
   // Note we are only changing mass and NOT balancing on purpose
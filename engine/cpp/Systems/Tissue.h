@@ -4,6 +4,7 @@
 #pragma once
 #include "Controller/System.h"
 #include "system/physiology/SETissueSystem.h"
+class SESubstanceTissuePharmacokinetics;
 
 /**
  * @brief This class encapsulates logic necessary to connect independent systems together.
@@ -30,6 +31,7 @@ public:
 
   static void Load(const pulse::TissueSystemData& src, Tissue& dst);
   static pulse::TissueSystemData* Unload(const Tissue& src);
+  static void Copy(const Tissue& src, Tissue& dst);
 protected:
   static void Serialize(const pulse::TissueSystemData& src, Tissue& dst);
   static void Serialize(const Tissue& src, pulse::TissueSystemData& dst);
@@ -43,6 +45,12 @@ public:
   void Process();
   void PostProcess();
 
+  // Process in parts, so blood gases can be distributed on several threads,
+  // ProcessBloodGases can be called on up to numBloodGasWorkers threads at once
+  void ProcessSubstanceTransport(size_t numBloodGasWorkers);
+  void ProcessBloodGases(size_t worker);
+  void ProcessVitals();
+
 protected:
 
   // Preprocess Methods
@@ -53,6 +61,7 @@ protected:
   void GlucoseLipidControl(double time);
 
   /*Process Methods*/
+  void BuildDiffusionPlan();
   void CalculateDiffusion();
   void CalculatePulmonaryCapillarySubstanceTransfer();
   void CalculateVitals();
@@ -61,16 +70,56 @@ protected:
   /*Postprocess Methods*/  
 
   /*Diffusion Utilities*/
+  // Each utility looks up the substance quantities of its compartments,
+  // the overloads taking them are used by the diffusion plan, which looks them up once
   void DistributeMassbyVolumeWeighted(SELiquidCompartment& cmpt, const SESubstance& sub, double mass, const MassUnit& unit);
+  void DistributeMassbyVolumeWeighted(SELiquidCompartment& cmpt, SELiquidSubstanceQuantity& subQ, double mass, const MassUnit& unit);
   void DistributeMassbyMassWeighted(SELiquidCompartment& cmpt, const SESubstance& sub, double mass, const MassUnit& unit);
+  void DistributeMassbyMassWeighted(SELiquidCompartment& cmpt, SELiquidSubstanceQuantity& subQ, double mass, const MassUnit& unit);
 
   double PerfusionLimitedDiffusion(SETissueCompartment& tissue, SELiquidCompartment& vascular, const SESubstance& sub, double partitionCoeff, double timestep_s);
+  double PerfusionLimitedDiffusion(SETissueCompartment& tissue, SELiquidCompartment& vascular, SELiquidSubstanceQuantity& vSubQ, SELiquidCompartment& intracellular, SELiquidSubstanceQuantity& tSubQ, double partitionCoeff, double timestep_s);
   void AlveolarPartialPressureGradientDiffusion(SEGasCompartment& pulmonary, SELiquidCompartment& vascular, SESubstance& sub, double DiffusingCapacityO2_mL_Per_s_mmHg, double timestep_s);
 
   double MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double timestep_s);
+  double MoveMassByInstantDiffusion(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtQ, double timestep_s);
   double MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double permeabilityCofficient_mL_Per_s, double timestep_s);  
+  double MoveMassBySimpleDiffusion(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtQ, double permeabilityCofficient_mL_Per_s, double timestep_s);
   double MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double combinedCoefficient_g_Per_s, double timestep_s);
+  double MoveMassByFacilitatedDiffusion(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtQ, double combinedCoefficient_g_Per_s, double timestep_s);
   double MoveMassByActiveTransport(SELiquidCompartment& source, SELiquidCompartment& target, const SESubstance& sub, double DiffusingCapacityO2_mL_Per_s_mmHg, double timestep_s);
+  double MoveMassByActiveTransport(SELiquidCompartment& source, SELiquidSubstanceQuantity& srcQ, SELiquidCompartment& target, SELiquidSubstanceQuantity& tgtQ, double pumpRate_g_Per_s, double timestep_s);
+
+  // How each active substance diffuses in each tissue
+  enum class DiffusionKind
+  {
+    PerfusionLimited = 0, ///< PBPK drugs, between the vascular and intracellular fluids
+    Instant,              ///< Sodium, instantly between the vascular and extracellular fluids
+    Gas                   ///< Gases, from the vascular through the extracellular to the intracellular fluid
+  };
+  // Every tissue and substance pair that diffuses, with what it needs to diffuse looked up when the plan is built,
+  // one vector per field so each diffusion step only walks the pairs
+  struct DiffusionPlan
+  {
+    void Clear();
+    size_t                                                numSubstances;// Active liquid substances the plan was built for
+    std::vector<DiffusionKind>                            kind;
+    std::vector<SETissueCompartment*>                     tissue;
+    std::vector<const SESubstance*>                       substance;
+    std::vector<SELiquidCompartment*>                     vascular;
+    std::vector<SELiquidCompartment*>                     extracellular;
+    std::vector<SELiquidCompartment*>                     intracellular;
+    std::vector<SELiquidSubstanceQuantity*>               vascularSubQ;
+    std::vector<SELiquidSubstanceQuantity*>               extracellularSubQ;
+    std::vector<SELiquidSubstanceQuantity*>               intracellularSubQ;
+    std::vector<const SESubstanceTissuePharmacokinetics*> tissueKinetics;// PerfusionLimited, partition coefficients change every step
+    std::vector<double>                                   permeabilityCoefficient_mL_Per_s;// Gas
+    std::vector<double>                                   facilitatedCoefficient_g_Per_s;// Gas, if the substance has a maximum diffusion flux
+  };
+  DiffusionPlan m_DiffusionPlan;
+
+  // Vascular compartments to distribute blood gases in, reused every time step
+  std::vector<SELiquidCompartment*> m_BloodGasCompartments;
 
   // Serializable member variables (Set in Initialize and in schema
   double m_RestingTissueGlucose_g;
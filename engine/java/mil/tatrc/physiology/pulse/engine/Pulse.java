@@ -3,6 +3,7 @@
 package mil.tatrc.physiology.pulse.engine;
 
 import java.io.File;
+import java.nio.DoubleBuffer;
 import java.util.*;
 
 import com.kitware.physiology.cdm.Patient.PatientData;
@@ -219,6 +220,27 @@ public class Pulse
       cdmCallback.update(time_s);
   }
   
+  /**
+   * Same as updateCDM, but the values are read from
+   * a row of a buffer C++ has written into.
+   * Each row is the time followed by each requested value.
+   * @param data
+   * @param row
+   * @param columns - number of values in a row, as C++ writes them
+   */
+  protected void updateCDM(DoubleBuffer data, int row, int columns)
+  {
+    int i = row*columns;
+    double time_s = data.get(i++);
+    currentTime.setValue(time_s,TimeUnit.s);
+    for(Pair<SEDataRequest,SEScalar> e : dataRequests)
+    {
+      e.getR().setValue(data.get(i++),e.getL().getUnit());
+    }
+    if(this.cdmCallback!=null)
+      cdmCallback.update(time_s);
+  }
+  
   /**
    * You can provided a data request with out a unit
    * And the engine will update the request with what
@@ -2,9 +2,14 @@
    See accompanying NOTICE file for details.*/
 package mil.tatrc.physiology.pulse.engine;
 
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
 import java.util.ArrayList;
 import java.util.List;
 
+import com.google.protobuf.CodedOutputStream;
 import com.google.protobuf.TextFormat;
 import com.google.protobuf.TextFormat.ParseException;
 import com.kitware.physiology.cdm.PatientAssessments.CompleteBloodCountData;
@@ -33,6 +38,11 @@ import mil.tatrc.physiology.utilities.Log;
 public class PulseEngine extends Pulse
 {
   protected boolean deadEngine = false;
+  // Direct buffers shared with C++, so data does not need to be copied across JNI
+  protected ByteBuffer   actionBuffer;
+  protected DoubleBuffer dataBuffer;
+  protected int          dataBufferRows = 0;
+  protected int          dataBufferColumns = 0;// Time and every column C++ tracks
   
   public PulseEngine()
   {
@@ -45,6 +55,9 @@ public class PulseEngine extends Pulse
     if(this.nativeObj!=0)
       this.nativeReset(this.nativeObj);
     this.deadEngine = false;
+    this.dataBuffer = null;
+    this.dataBufferRows = 0;
+    this.dataBufferColumns = 0;
   }
   
   public synchronized boolean isDead()
@@ -75,12 +88,19 @@ public class PulseEngine extends Pulse
     }
     this.requestData(dataRequests);
     this.nativeObj = nativeAllocate(logFile);
-    return nativeLoadState(this.nativeObj, stateFile, simTime_s, dataRequestsStr);
+    if(!nativeLoadState(this.nativeObj, stateFile, simTime_s, dataRequestsStr))
+      return false;
+    return allocateDataBuffer(1);
   }
   
   public synchronized StateData saveState(String stateFile) throws ParseException
   {
     String str = nativeSaveState(this.nativeObj, stateFile);
+    if(str == null)
+    {
+      Log.error("Unable to save state to "+stateFile);
+      return null;
+    }
     StateData.Builder sd = StateData.newBuilder();
     TextFormat.getParser().merge(str, sd);
     return sd.build();
@@ -116,6 +136,8 @@ public class PulseEngine extends Pulse
     this.deadEngine = !nativeInitializeEngine(this.nativeObj, patientStr, conditionsStr, dataRequestsStr);
     if(this.deadEngine)
       Log.error("Unable to initialize engine");
+    else
+      allocateDataBuffer(1);
     return !this.deadEngine;
   }
   
@@ -149,6 +171,8 @@ public class PulseEngine extends Pulse
     this.deadEngine = !nativeInitializeEngine(this.nativeObj, patientStr, conditionsStr, dataRequestsStr);
     if(this.deadEngine)
       Log.error("Unable to initialize engine");
+    else
+      allocateDataBuffer(1);
     return !this.deadEngine;
   }
   
@@ -161,6 +185,8 @@ public class PulseEngine extends Pulse
     }
     if(!nativeAdvanceTimeStep(this.nativeObj))
       deadEngine=true;
+    else if(this.dataBuffer!=null)
+      updateCDM(this.dataBuffer, 0, this.dataBufferColumns);
     return !deadEngine;
   }
   
@@ -173,9 +199,74 @@ public class PulseEngine extends Pulse
     }
     if(!nativeAdvanceTime(this.nativeObj, time.getValue(TimeUnit.s)))
       deadEngine=true;
+    else if(this.dataBuffer!=null)
+      updateCDM(this.dataBuffer, 0, this.dataBufferColumns);
+    return !deadEngine;
+  }
+  
+  /**
+   * Advance the engine the provided number of time steps in a single call to C++.
+   * The data requested for every step is collected into the data buffer,
+   * and the CDM (and callback) is updated for each step once C++ returns.
+   * @param steps - number of time steps to advance
+   * @return - false if the engine did not complete every step
+   */
+  public synchronized boolean advanceTimeAndCollect(int steps)
+  {
+    if(this.deadEngine)
+    {
+      Log.error("Engine has died");
+      return false;
+    }
+    if(steps > this.dataBufferRows && !allocateDataBuffer(steps))
+    {
+      Log.error("Unable to allocate a data buffer for "+steps+" time steps");
+      return false;
+    }
+    int collected = nativeAdvanceTimeAndCollect(this.nativeObj, steps);
+    for(int row=0; row<collected; row++)
+      updateCDM(this.dataBuffer, row, this.dataBufferColumns);
+    if(collected < steps)
+      deadEngine=true;
     return !deadEngine;
   }
   
+  /**
+   * The buffer C++ writes requested data into.
+   * Each row is the time followed by each data request value, in request order,
+   * rows are getDataBufferColumns() values apart.
+   * After advanceTimeAndCollect(n), the first n rows hold each step.
+   */
+  public synchronized DoubleBuffer getDataBuffer()
+  {
+    return this.dataBuffer == null ? null : this.dataBuffer.asReadOnlyBuffer();
+  }
+  
+  /**
+   * @return - number of values in a row of the data buffer
+   */
+  public synchronized int getDataBufferColumns()
+  {
+    return this.dataBufferColumns;
+  }
+  
+  protected boolean allocateDataBuffer(int rows)
+  {
+    // Time is the first column, C++ may track more columns than we have data requests
+    int columns = nativeGetDataColumns(this.nativeObj);
+    this.dataBuffer = ByteBuffer.allocateDirect(rows*columns*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    this.dataBufferRows = rows;
+    this.dataBufferColumns = columns;
+    if(!nativeSetDataBuffer(this.nativeObj, this.dataBuffer))
+    {
+      this.dataBuffer = null;
+      this.dataBufferRows = 0;
+      this.dataBufferColumns = 0;
+      return false;
+    }
+    return true;
+  }
+  
   public synchronized boolean processAction(SEAction action)
   {
     List <SEAction> actions = new ArrayList<SEAction>(); 
@@ -195,8 +286,24 @@ public class PulseEngine extends Pulse
       ActionListData.Builder aData = ActionListData.newBuilder();
       for(SEAction a : actions)
       	aData.addAnyAction(SEAction.CDM2ANY(a));
-      String actionsStr = aData.toString();
-      if(!nativeProcessActions(this.nativeObj,actionsStr))
+      // Serialize the binary actions straight into a direct buffer C++ can parse in place
+      ActionListData aList = aData.build();
+      int size = aList.getSerializedSize();
+      if(this.actionBuffer==null || this.actionBuffer.capacity()<size)
+        this.actionBuffer = ByteBuffer.allocateDirect(2*size);
+      this.actionBuffer.clear();
+      try
+      {
+        CodedOutputStream out = CodedOutputStream.newInstance(this.actionBuffer);
+        aList.writeTo(out);
+        out.flush();
+      }
+      catch(IOException ex)
+      {
+        Log.error("Unable to serialize actions",ex);
+        return false;
+      }
+      if(!nativeProcessActionsBuffer(this.nativeObj,this.actionBuffer,size))
         deadEngine=true;
       return !deadEngine;
     }
@@ -261,5 +368,9 @@ public class PulseEngine extends Pulse
   protected native boolean nativeAdvanceTimeStep(long nativeObj);
   protected native boolean nativeAdvanceTime(long nativeObj, double time_s);
   protected native boolean nativeProcessActions(long nativeObj, String actions);
+  protected native boolean nativeProcessActionsBuffer(long nativeObj, ByteBuffer actions, int length);// binary serialized ActionListData in a direct buffer
+  protected native boolean nativeSetDataBuffer(long nativeObj, DoubleBuffer data);// direct buffer, pass null to go back to updateCDM(double,double[])
+  protected native int     nativeGetDataColumns(long nativeObj);// number of doubles in a row of the data buffer
+  protected native int     nativeAdvanceTimeAndCollect(long nativeObj, int steps);// returns the number of steps completed
   protected native String nativeGetAssessment(long nativeObj, int type);
 }
@@ -8,6 +8,7 @@
 #include "utils/taskrunner/TaskRunner.h"
 
 #include "scenario/SEScenarioExec.h"
+#include "substance/SESubstanceLibrary.h"
 
 //--------------------------------------------------------------------------------------------------
 /// \brief
@@ -53,7 +54,7 @@ void RunScenarioTask::Run()
 
   // Aquire the constrution mutex before we create the PulseEngine.  Due to some third-party library
   // initialization constructs not being thread safe, we must not construct PulseEngines simultaneously
-  // from multiple threads.
+  // from multiple threads. The shared substance library does not remove the need for this mutex.
   ms_constructionMutex.lock();
   std::unique_ptr<PhysiologyEngine> pe = CreatePulseEngine(logFile.c_str());
   ms_constructionMutex.unlock();
@@ -81,6 +82,12 @@ void HowToConcurrentEngines()
     // the thread count by specifying the desired number of threads in the constructor.
     TaskRunner runner;
 
+    // Substance definitions are parsed once and shared by every engine in the process.
+    // Each engine still builds its own substance objects from them.
+    // Loading them up front keeps the first engines from waiting on each other to parse them.
+    // A bundle written with SESubstanceLibrary::WriteBundle can be used here instead of the directory.
+    SESubstanceLibrary::SetDefault(SESubstanceLibrary::GetDirectory(GetCurrentWorkingDirectory() + "/substances"));
+
     // Create tasks to be run and give them to the task runner
     runner.AddTask(std::unique_ptr<RunScenarioTask>(new RunScenarioTask("verification/Scenarios/Patient/BasicStandard.pba")));
     runner.AddTask(std::unique_ptr<RunScenarioTask>(new RunScenarioTask("verification/Scenarios/Patient/BasicStandard.pba")));
@@ -0,0 +1,90 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "CommonDataModelTest.h"
+#include "scenario/SEActionManager.h"
+#include "scenario/SEAdvanceTime.h"
+#include "substance/SESubstanceManager.h"
+#include "system/equipment/anesthesiamachine/actions/SEMaskLeak.h"
+#include "properties/SEScalar0To1.h"
+#include "properties/SEScalarTime.h"
+#include "properties/SEScalarVolumePerTime.h"
+#include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
+#include "utils/TimingProfile.h"
+
+void CommonDataModelTest::ActionManagerTest(const std::string& rptDirectory)
+{
+  TimingProfile pTimer;
+  std::string testName = "ActionManagerTest";
+  m_Logger->ResetLogFile(rptDirectory + "/" + testName + ".log");
+
+  SETestReport testReport(m_Logger);
+  SETestSuite&  testSuite = testReport.CreateTestSuite();
+  testSuite.SetName(testName);
+
+  SESubstanceManager subMgr(m_Logger);
+  SEActionManager actions(subMgr);
+
+  pTimer.Start("Case");
+  SETestCase& dispatchCase = testSuite.CreateTestCase();
+  dispatchCase.SetName("Dispatch");
+  SEAcuteStress stress;
+  stress.GetSeverity().SetValue(0.3);
+  SEHemorrhage hemorrhage;
+  hemorrhage.SetCompartment("RightLeg");
+  hemorrhage.GetRate().SetValue(100, VolumePerTimeUnit::mL_Per_min);
+  SEMaskLeak leak;
+  leak.GetSeverity().SetValue(0.5);
+  SEAdvanceTime adv;
+  adv.GetTime().SetValue(1, TimeUnit::s);
+  if (stress.GetActionCategory() != eActionCategory::Patient || stress.GetActionType() != eActionType::AcuteStress)
+    dispatchCase.AddFailure("Acute stress has the wrong action tag");
+  if (!actions.ProcessAction(stress) || !actions.ProcessAction(hemorrhage) || !actions.ProcessAction(leak))
+    dispatchCase.AddFailure("Actions were not processed");
+  if (!actions.GetPatientActions().HasAcuteStress() || !actions.GetPatientActions().HasHemorrhage() || !actions.GetAnesthesiaMachineActions().HasMaskLeak())
+    dispatchCase.AddFailure("Actions were not dispatched to their collection");
+  if (actions.ProcessAction(adv))
+    dispatchCase.AddFailure("Scenario actions are not processed by the action manager");
+  dispatchCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& recordCase = testSuite.CreateTestCase();
+  recordCase.SetName("Record");
+  if (!actions.IsRecordingProcessedActions() || actions.GetActionList().anyaction_size() != 3)
+    recordCase.AddFailure("Every processed action should be recorded by default");
+  for (int i = 0; i < 10; i++)
+  {
+    stress.GetSeverity().SetValue(i / 10.0);
+    actions.ProcessAction(stress);
+  }
+  if (actions.GetActionList().anyaction_size() != 13)
+    recordCase.AddFailure("Every processed action should be recorded by default");
+  recordCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& latestCase = testSuite.CreateTestCase();
+  latestCase.SetName("Latest");
+  actions.RecordProcessedActions(false);
+  for (int i = 1; i < 10; i++)
+  {
+    stress.GetSeverity().SetValue(i / 10.0);
+    actions.ProcessAction(stress);
+    hemorrhage.GetRate().SetValue(10 * i, VolumePerTimeUnit::mL_Per_min);
+    actions.ProcessAction(hemorrhage);
+  }
+  if (actions.GetPatientActions().GetAcuteStress()->GetSeverity().GetValue() != 0.9 ||
+      actions.GetPatientActions().GetHemorrhages().at("RightLeg")->GetRate().GetValue(VolumePerTimeUnit::mL_Per_min) != 90)
+    latestCase.AddFailure("Actions should still be applied when not recording");
+  // Acute stress, hemorrhage and mask leak
+  if (actions.GetActionList().anyaction_size() != 3)
+    latestCase.AddFailure("Only the latest state of each active action should be kept");
+  leak.GetSeverity().SetValue(0);
+  actions.ProcessAction(leak);
+  if (actions.GetActionList().anyaction_size() != 2)
+    latestCase.AddFailure("Actions that are turned off should not be kept");
+  latestCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  testReport.WriteFile(rptDirectory + "/" + testName + "Report.pba");
+}
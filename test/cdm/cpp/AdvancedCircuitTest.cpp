@@ -25,6 +25,7 @@
 #include "properties/SEScalarVolume.h"
 #include "properties/SEScalarVolumePerTime.h"
 #include "utils/DataTrack.h"
+#include "utils/GeneralMath.h"
 
 //*********************************************************
 //Circuit Setup
@@ -1394,4 +1395,144 @@ void CommonDataModelTest::CircuitLockingTest(const std::string& sOutputDirectory
   std::string sOutputFile = sOutputDirectory + "/CircuitLockingTestReport.pba";
   testReport.WriteFile(sOutputFile);
   m_Circuits->Clear();
-}
\ No newline at end of file
+}
+
+void CommonDataModelTest::CompiledCircuitTest(const std::string& sOutputDirectory)
+{
+  SETestReport testReport(m_Logger);
+  SETestSuite& testSuite = testReport.CreateTestSuite();
+  testSuite.SetName("CompiledCircuit");
+
+  std::cout << "CompiledCircuitTest\n";
+  m_Logger->ResetLogFile(sOutputDirectory + "/CompiledCircuitTest.log");
+
+  // A pressure source driving two paths in series, the last one is a resistance or an open switch
+  auto createCircuit = [&](const std::string& name, bool openSwitch) -> SEFluidCircuit&
+  {
+    SEFluidCircuit& circuit = m_Circuits->CreateFluidCircuit(name);
+    SEFluidCircuitNode& Node1 = circuit.CreateNode(name + "Node1");
+    SEFluidCircuitNode& Node2 = circuit.CreateNode(name + "Node2");
+    SEFluidCircuitNode& Node3 = circuit.CreateNode(name + "Node3");
+    circuit.AddReferenceNode(Node3);
+    Node3.GetNextPressure().SetValue(0, PressureUnit::mmHg);
+    circuit.CreatePath(Node3, Node1, name + "Path1").GetNextPressureSource().SetValue(10, PressureUnit::mmHg);
+    circuit.CreatePath(Node1, Node2, name + "Path2").GetNextResistance().SetValue(2, FlowResistanceUnit::mmHg_s_Per_mL);
+    SEFluidCircuitPath& Path3 = circuit.CreatePath(Node2, Node3, name + "Path3");
+    if (openSwitch)
+      Path3.SetNextSwitch(cdm::eGate::Open);
+    else
+      Path3.GetNextResistance().SetValue(2, FlowResistanceUnit::mmHg_s_Per_mL);
+    circuit.StateChange();
+    return circuit;
+  };
+  SEFluidCircuitCalculator fluidCalculator(m_Logger);
+  SEFluidCircuit& changed = createCircuit("Changed", false);
+  SEFluidCircuit& cold = createCircuit("Cold", true);
+  fluidCalculator.Process(changed, 0.02);
+  fluidCalculator.PostProcess(changed);
+
+  // Replace the resistance with a switch without calling StateChange
+  SETestCase& elementCase = testSuite.CreateTestCase();
+  elementCase.SetName("ElementChange");
+  SEFluidCircuitPath& Path3 = *changed.GetPath("ChangedPath3");
+  Path3.GetNextResistance().Invalidate();
+  Path3.SetNextSwitch(cdm::eGate::Open);
+  if (changed.IsCompiledCircuitCurrent())
+    elementCase.AddFailure("Compiled circuit should be out of date once a path has a different element");
+  fluidCalculator.Process(changed, 0.02);
+  if (!changed.IsCompiledCircuitCurrent())
+    elementCase.AddFailure("Compiled circuit should be recompiled by the calculator");
+  if (changed.GetCompiledCircuit().PathElement[2] != SECompiledCircuit::Element::Switch)
+    elementCase.AddFailure("Path should be compiled as a switch");
+
+  // The changed circuit must solve the same as one that always had the switch
+  SETestCase& solveCase = testSuite.CreateTestCase();
+  solveCase.SetName("SameAsCold");
+  fluidCalculator.Process(cold, 0.02);
+  auto compare = [&](const std::string& name, double expected, double computed)
+  {
+    if (GeneralMath::PercentDifference(expected, computed) > 1e-6)
+      solveCase.AddFailure(name + " does not match the circuit that always had the switch");
+  };
+  compare("Node2 pressure", cold.GetNode("ColdNode2")->GetNextPressure(PressureUnit::mmHg), changed.GetNode("ChangedNode2")->GetNextPressure(PressureUnit::mmHg));
+  // An open switch stops the flow, so Node2 rises to the source pressure
+  if (GeneralMath::PercentDifference(10, changed.GetNode("ChangedNode2")->GetNextPressure(PressureUnit::mmHg)) > 1e-6)
+    solveCase.AddFailure("Node2 pressure should be the source pressure");
+  if (!SEScalar::IsZero(changed.GetPath("ChangedPath2")->GetNextFlow(VolumePerTimeUnit::mL_Per_s), 1e-10))
+    solveCase.AddFailure("Path2 flow should be stopped by the open switch");
+
+  std::string sOutputFile = sOutputDirectory + "/CompiledCircuitTestReport.pba";
+  testReport.WriteFile(sOutputFile);
+  m_Circuits->Clear();
+}
+
+void CommonDataModelTest::ValveCacheTest(const std::string& sOutputDirectory)
+{
+  SETestReport testReport(m_Logger);
+  SETestSuite& testSuite = testReport.CreateTestSuite();
+  testSuite.SetName("ValveCache");
+
+  std::cout << "ValveCacheTest\n";
+  m_Logger->ResetLogFile(sOutputDirectory + "/ValveCacheTest.log");
+
+  // An alternating pressure source across a resistance in parallel with a valve,
+  // the valve shorts the resistance on positive pressures and opens on negative ones
+  auto createCircuit = [&](const std::string& name) -> SEFluidCircuit&
+  {
+    SEFluidCircuit& circuit = m_Circuits->CreateFluidCircuit(name);
+    SEFluidCircuitNode& Node1 = circuit.CreateNode(name + "Node1");
+    SEFluidCircuitNode& Node2 = circuit.CreateNode(name + "Node2");
+    SEFluidCircuitNode& Node3 = circuit.CreateNode(name + "Node3");
+    circuit.AddReferenceNode(Node3);
+    Node3.GetNextPressure().SetValue(0, PressureUnit::mmHg);
+    circuit.CreatePath(Node3, Node1, name + "Source").GetNextPressureSource().SetValue(0, PressureUnit::mmHg);
+    circuit.CreatePath(Node1, Node2, name + "Path1").GetNextResistance().SetValue(1, FlowResistanceUnit::mmHg_s_Per_mL);
+    circuit.CreatePath(Node2, Node3, name + "Valve").SetNextValve(cdm::eGate::Closed);
+    circuit.CreatePath(Node2, Node3, name + "Path2").GetNextResistance().SetValue(2, FlowResistanceUnit::mmHg_s_Per_mL);
+    circuit.StateChange();
+    return circuit;
+  };
+  SEFluidCircuit& cached = createCircuit("Cached");
+  SEFluidCircuit& cold = createCircuit("Cold");
+  SEFluidCircuitCalculator cachedCalculator(m_Logger);
+  // Only keeping one configuration means every valve flip rebuilds the matrix structure and analysis
+  SEFluidCircuitCalculator coldCalculator(m_Logger);
+  coldCalculator.SetMaxCachedValveConfigurations(1);
+
+  SETestCase& solveCase = testSuite.CreateTestCase();
+  solveCase.SetName("SameAsColdSolve");
+  for (int i = 0; i < 10; i++)
+  {
+    double source_mmHg = (i % 2 == 0) ? 10 : -10;
+    cached.GetPath("CachedSource")->GetNextPressureSource().SetValue(source_mmHg, PressureUnit::mmHg);
+    cold.GetPath("ColdSource")->GetNextPressureSource().SetValue(source_mmHg, PressureUnit::mmHg);
+    cachedCalculator.Process(cached, 0.02);
+    coldCalculator.Process(cold, 0.02);
+    for (const std::string& node : { "Node1", "Node2" })
+    {
+      if (GeneralMath::PercentDifference(cold.GetNode("Cold" + node)->GetNextPressure(PressureUnit::mmHg),
+                                         cached.GetNode("Cached" + node)->GetNextPressure(PressureUnit::mmHg)) > 1e-8)
+        solveCase.AddFailure(node + " pressure does not match the cold solve at step " + std::to_string(i));
+    }
+    if (GeneralMath::PercentDifference(cold.GetPath("ColdPath1")->GetNextFlow(VolumePerTimeUnit::mL_Per_s),
+                                       cached.GetPath("CachedPath1")->GetNextFlow(VolumePerTimeUnit::mL_Per_s)) > 1e-8)
+      solveCase.AddFailure("Path1 flow does not match the cold solve at step " + std::to_string(i));
+    // Negative pressures open the valve, so the flow goes through Path2
+    if (source_mmHg < 0 && cached.GetPath("CachedValve")->GetNextValve() != cdm::eGate::Open)
+      solveCase.AddFailure("Valve should open on negative pressures at step " + std::to_string(i));
+    cachedCalculator.PostProcess(cached);
+    coldCalculator.PostProcess(cold);
+  }
+
+  // Both valve configurations stay cached, so every flip after the first two is a cache hit
+  SETestCase& cacheCase = testSuite.CreateTestCase();
+  cacheCase.SetName("CachedConfigurations");
+  if (cachedCalculator.GetNumberOfCachedValveConfigurations() != 2)
+    cacheCase.AddFailure("Both valve configurations should be cached");
+  if (coldCalculator.GetNumberOfCachedValveConfigurations() != 1)
+    cacheCase.AddFailure("Only the last valve configuration should be cached");
+
+  std::string sOutputFile = sOutputDirectory + "/ValveCacheTestReport.pba";
+  testReport.WriteFile(sOutputFile);
+  m_Circuits->Clear();
+}
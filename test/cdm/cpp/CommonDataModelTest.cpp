@@ -242,6 +242,8 @@ void CommonDataModelTest::FillFunctionMap()
   cdmMap.insert(std::make_pair("PreChargeComplianceNonZeroVolume", &CommonDataModelTest::PreChargeComplianceNonZeroVolume));
   cdmMap.insert(std::make_pair("CircuitErrorTest", &CommonDataModelTest::CircuitErrorTest));
   cdmMap.insert(std::make_pair("CircuitLockingTest", &CommonDataModelTest::CircuitLockingTest));
+  cdmMap.insert(std::make_pair("CompiledCircuitTest", &CommonDataModelTest::CompiledCircuitTest));
+  cdmMap.insert(std::make_pair("ValveCacheTest", &CommonDataModelTest::ValveCacheTest));
 
   cdmMap.insert(std::make_pair("GasCompartmentTest", &CommonDataModelTest::GasCompartmentTest));
   cdmMap.insert(std::make_pair("LiquidCompartmentTest", &CommonDataModelTest::LiquidCompartmentTest));
@@ -255,9 +257,14 @@ void CommonDataModelTest::FillFunctionMap()
   cdmMap.insert(std::make_pair("ReadPatientDirectory", &CommonDataModelTest::ReadPatientDirectory));
   cdmMap.insert(std::make_pair("ReadScenarios", &CommonDataModelTest::ReadScenarios));
   cdmMap.insert(std::make_pair("ReadSubstanceDirectory", &CommonDataModelTest::ReadSubstanceDirectory));
+  cdmMap.insert(std::make_pair("ResultsWriterTest", &CommonDataModelTest::ResultsWriterTest));
+  cdmMap.insert(std::make_pair("EngineProfilerTest", &CommonDataModelTest::EngineProfilerTest));
+  cdmMap.insert(std::make_pair("ActionManagerTest", &CommonDataModelTest::ActionManagerTest));
+  cdmMap.insert(std::make_pair("ElectroCardioGramTest", &CommonDataModelTest::ElectroCardioGramTest));
 
   cdmMap.insert(std::make_pair("ScalarTest", &CommonDataModelTest::ScalarTest));
   cdmMap.insert(std::make_pair("UnitsTest", &CommonDataModelTest::UnitsTest));
+  cdmMap.insert(std::make_pair("UnitConversionSpeedTest", &CommonDataModelTest::UnitConversionSpeedTest));
 
 }
 
@@ -230,6 +230,8 @@ public:
   void PreChargeComplianceZeroVolume(const std::string& sOutputDirectory);
   void PreChargeComplianceNonZeroVolume(const std::string& sOutputDirectory);
   void CircuitLockingTest(const std::string& sOutputDirectory);
+  void CompiledCircuitTest(const std::string& sOutputDirectory);
+  void ValveCacheTest(const std::string& sOutputDirectory);
 
 protected:
   //Used to generalize Basic Tests
@@ -390,6 +392,7 @@ protected:
   void CheckLiquidPressureAndVolume(SETestCase& testCase, SELiquidCompartment& cmpt);
   void TestLiquidSubstanceQuantity(SETestCase& testCase, SELiquidCompartment& cmpt, SELiquidSubstanceQuantity& subQ, double totalMass_mg, double totalVolume_mL);
   void TestUpdateLiquidLinks(SETestSuite& testSuite, SESubstanceManager& subMgr);
+  void TestLiquidHierarchyDirectWrite(SETestSuite& testSuite, SESubstanceManager& subMgr);
   //Thermal Compartments
   void TestThermalFlows(SETestSuite& testSuite, SESubstanceManager& subMgr);
   void TestThermalFlowHierarchy(SETestSuite& testSuite, SESubstanceManager& subMgr);
@@ -413,6 +416,10 @@ public:
   void ReadPatientDirectory(const std::string& sOutputDirectory);
   void ReadScenarios(const std::string& sOutputDirectory);
   void ReadSubstanceDirectory(const std::string& sOutputDirectory);
+  void ResultsWriterTest(const std::string& sOutputDirectory);
+  void EngineProfilerTest(const std::string& sOutputDirectory);
+  void ActionManagerTest(const std::string& sOutputDirectory);
+  void ElectroCardioGramTest(const std::string& sOutputDirectory);
 
   //////////////////////
   // Properties Tests //
@@ -420,6 +427,7 @@ public:
 public:
   void ScalarTest(const std::string& sOutputDirectory);
   void UnitsTest(const std::string& sOutputDirectory);
+  void UnitConversionSpeedTest(const std::string& sOutputDirectory);
 protected:
   void ConvertList(std::vector<std::string> stringList);
   // These property tests are not outputting any reports or anything, kind of just a sandbox at this point
@@ -0,0 +1,113 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "CommonDataModelTest.h"
+#include "system/equipment/electrocardiogram/SEElectroCardioGramWaveformInterpolator.h"
+#include "system/equipment/electrocardiogram/SEElectroCardioGramSampleBuffer.h"
+#include "properties/SEFunctionElectricPotentialVsTime.h"
+#include "properties/SEScalarElectricPotential.h"
+#include "properties/SEScalarFrequency.h"
+#include "properties/SEScalarTime.h"
+#include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
+#include "utils/TimingProfile.h"
+
+void CommonDataModelTest::ElectroCardioGramTest(const std::string& rptDirectory)
+{
+  TimingProfile pTimer;
+  std::string testName = "ElectroCardioGramTest";
+  m_Logger->ResetLogFile(rptDirectory + "/" + testName + ".log");
+
+  SETestReport testReport(m_Logger);
+  SETestSuite&  testSuite = testReport.CreateTestSuite();
+  testSuite.SetName(testName);
+
+  const cdm::ElectroCardioGramWaveformData_eLead lead = cdm::ElectroCardioGramWaveformData_eLead_Lead3;
+  const cdm::eHeartRhythm rhythm = cdm::eHeartRhythm::NormalSinus;
+  // A 0.4s triangle beat, rising at 10 mV/s, sampled every 0.1s
+  SEElectroCardioGramWaveformInterpolator source(m_Logger);
+  SEElectroCardioGramWaveform& waveform = source.GetWaveform(lead, rhythm);
+  waveform.SetLeadNumber(lead);
+  waveform.SetRhythm(rhythm);
+  waveform.GetData().GetTime() = { 0, 0.1, 0.2, 0.3, 0.4 };
+  waveform.GetData().SetTimeUnit(TimeUnit::s);
+  waveform.GetData().GetElectricPotential() = { 0, 1, 2, 1, 0 };
+  waveform.GetData().SetElectricPotentialUnit(ElectricPotentialUnit::mV);
+
+  double dt_s = 0.02;
+  SEScalarTime timeStep;
+  timeStep.SetValue(dt_s, TimeUnit::s);
+  SEScalarElectricPotential lead3;
+  SEElectroCardioGramWaveformInterpolator ecg(m_Logger);
+  auto* d = SEElectroCardioGramWaveformInterpolator::Unload(source);
+  SEElectroCardioGramWaveformInterpolator::Load(*d, ecg);
+  delete d;
+  ecg.Interpolate(timeStep);
+  ecg.SetLeadElectricPotential(lead, lead3);
+
+  pTimer.Start("Case");
+  SETestCase& stepCase = testSuite.CreateTestCase();
+  stepCase.SetName("TimeStep");
+  if (ecg.GetWaveform(lead, rhythm).GetData().Length() < 20)
+    stepCase.AddFailure("Waveform was not interpolated to the time step");
+  ecg.StartNewCycle(rhythm);
+  for (int i = 0; i < 6; i++)
+  {
+    ecg.CalculateWaveformsElectricPotential();
+    if (std::abs(lead3.GetValue(ElectricPotentialUnit::mV) - 0.2 * i) > 1e-9)
+      stepCase.AddFailure("Lead potential is wrong at step " + std::to_string(i));
+  }
+  stepCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& sampleCase = testSuite.CreateTestCase();
+  sampleCase.SetName("HighRate");
+  double samples_mV[64];
+  SEElectroCardioGramSampleBuffer buffer(samples_mV, 64);
+  SEScalarFrequency rate;
+  rate.SetValue(250, FrequencyUnit::Per_s);
+  if (!ecg.SetSampleRate(rate, source))
+    sampleCase.AddFailure("Unable to set the sample rate");
+  ecg.SetLeadSampleBuffer(lead, &buffer);
+  ecg.StartNewCycle(rhythm);
+  ecg.SynthesizeSamples(dt_s);
+  if (buffer.GetSampleCount() != 5)
+    sampleCase.AddFailure("Expected 5 samples per time step at 250Hz");
+  for (size_t i = 0; i < 5; i++)
+  {
+    if (std::abs(samples_mV[i] - 0.04 * i) > 1e-9)
+      sampleCase.AddFailure("Sample " + std::to_string(i) + " is wrong");
+  }
+  // The beat lasts 101 samples, after that the lead is flat until the next cycle
+  for (int i = 1; i < 30; i++)
+    ecg.SynthesizeSamples(dt_s);
+  if (buffer.GetSampleCount() != 150 || buffer.GetWriteIndex() != 150 % 64)
+    sampleCase.AddFailure("Samples did not wrap around the buffer");
+  if (samples_mV[(149 % 64)] != 0)
+    sampleCase.AddFailure("Lead should be flat after the beat");
+  // 3 samples per time step at 150 Hz, starting a new beat
+  rate.SetValue(150, FrequencyUnit::Per_s);
+  ecg.SetSampleRate(rate, source);
+  buffer.Clear();
+  ecg.StartNewCycle(rhythm);
+  for (int i = 0; i < 10; i++)
+    ecg.SynthesizeSamples(dt_s);
+  if (buffer.GetSampleCount() != 30 || std::abs(samples_mV[1] - 10.0 / 150) > 1e-9)
+    sampleCase.AddFailure("Samples are wrong at 150Hz");
+  // Rates that do not divide the time step carry the remaining time over
+  rate.SetValue(333, FrequencyUnit::Per_s);
+  ecg.SetSampleRate(rate, source);
+  buffer.Clear();
+  for (int i = 0; i < 100; i++)
+    ecg.SynthesizeSamples(dt_s);
+  if (buffer.GetSampleCount() != 666)
+    sampleCase.AddFailure("Expected 666 samples over 2s at 333Hz");
+  ecg.SetLeadSampleBuffer(lead, nullptr);
+  ecg.SynthesizeSamples(dt_s);
+  if (buffer.GetSampleCount() != 666)
+    sampleCase.AddFailure("Removed buffers should not be written to");
+  sampleCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  testReport.WriteFile(rptDirectory + "/" + testName + "Report.pba");
+}
@@ -0,0 +1,82 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "CommonDataModelTest.h"
+#include "engine/SEEngineProfiler.h"
+#include "properties/SEScalarTime.h"
+#include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
+#include "utils/TimingProfile.h"
+#include <thread>
+
+void CommonDataModelTest::EngineProfilerTest(const std::string& rptDirectory)
+{
+  TimingProfile pTimer;
+  std::string testName = "EngineProfilerTest";
+  m_Logger->ResetLogFile(rptDirectory + "/" + testName + ".log");
+
+  SETestReport testReport(m_Logger);
+  SETestSuite&  testSuite = testReport.CreateTestSuite();
+  testSuite.SetName(testName);
+
+  SEEngineProfiler profiler(m_Logger);
+  size_t solve = profiler.RegisterSlot("Circuit", "Cardiovascular");
+  size_t transport = profiler.RegisterSlot("Transport", "Cardiovascular");
+
+  pTimer.Start("Case");
+  SETestCase& slotCase = testSuite.CreateTestCase();
+  slotCase.SetName("Slots");
+  if (profiler.RegisterSlot("Circuit", "Cardiovascular") != solve || profiler.GetNumberOfSlots() != 2)
+    slotCase.AddFailure("Registering an existing slot should return that slot");
+  if (profiler.GetSlot("Transport", "Cardiovascular") != &profiler.GetSlot(transport) || profiler.GetSlot("Transport", "Respiratory") != nullptr)
+    slotCase.AddFailure("Slots are not found by category and name");
+  slotCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& recordCase = testSuite.CreateTestCase();
+  recordCase.SetName("Record");
+  {
+    SEEngineProfiler::ScopedTimer timer(&profiler, solve);
+  }
+  if (profiler.GetSlot(solve).count != 0)
+    recordCase.AddFailure("A disabled profiler should not record");
+  profiler.SetEnabled(true);
+  profiler.Record(solve, 0.5e-6, 2);  // Bin 0
+  profiler.Record(solve, 3e-6, 3);    // [2,4)us, bin 2
+  profiler.Record(solve, 10, 1);      // Beyond the last bound
+  {
+    SEEngineProfiler::ScopedTimer timer(&profiler, transport);
+    timer.SetIterations(4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  const SEEngineProfiler::Slot& s = profiler.GetSlot(solve);
+  if (s.count != 3 || s.iterations != 6)
+    recordCase.AddFailure("Slot count or iterations are wrong");
+  if (s.min_s != 0.5e-6 || s.max_s != 10 || std::abs(s.total_s - (10 + 3.5e-6)) > 1e-12)
+    recordCase.AddFailure("Slot times are wrong");
+  if (s.histogram[0] != 1 || s.histogram[2] != 1 || s.histogram[SEEngineProfiler::NumHistogramBins - 1] != 1)
+    recordCase.AddFailure("Slot histogram is wrong");
+  const SEEngineProfiler::Slot& t = profiler.GetSlot(transport);
+  if (t.count != 1 || t.iterations != 4 || t.total_s < 0.002)
+    recordCase.AddFailure("Scoped timer did not record the scope");
+  recordCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& outputCase = testSuite.CreateTestCase();
+  outputCase.SetName("Output");
+  std::string csv = profiler.ToCSV();
+  if (csv.find("Circuit,Cardiovascular,3,") == std::string::npos || std::count(csv.begin(), csv.end(), '\n') != 3)
+    outputCase.AddFailure("CSV does not have a row per slot");
+  std::string json = profiler.ToJSON();
+  if (json.find("\"Category\":\"Transport\",\"Name\":\"Cardiovascular\",\"Count\":1") == std::string::npos)
+    outputCase.AddFailure("JSON does not describe each slot");
+  if (!profiler.WriteCSV(rptDirectory + "/" + testName + "Profile.csv") || !profiler.WriteJSON(rptDirectory + "/" + testName + "Profile.json"))
+    outputCase.AddFailure("Unable to write the profile");
+  profiler.Reset();
+  if (profiler.GetSlot(solve).count != 0 || profiler.GetSlot(solve).histogram[0] != 0 || profiler.GetNumberOfSlots() != 2)
+    outputCase.AddFailure("Reset should zero the statistics and keep the slots");
+  outputCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  testReport.WriteFile(rptDirectory + "/" + testName + "Report.pba");
+}
@@ -1335,6 +1335,82 @@ void CommonDataModelTest::TestUpdateLiquidLinks(SETestSuite& testSuite, SESubsta
   testCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Test"), TimeUnit::s);
 }
 
+void CommonDataModelTest::TestLiquidHierarchyDirectWrite(SETestSuite& testSuite, SESubstanceManager& subMgr)
+{
+  SETestCase& testCase = testSuite.CreateTestCase();
+  testCase.SetName("HierarchyDirectWrite");
+
+  TimingProfile pTimer;
+  pTimer.Start("Test");
+
+  m_Circuits->Clear();
+  SEFluidCircuit& circuit = m_Circuits->CreateFluidCircuit("TestCircuit");
+  SEFluidCircuitNode& n1 = circuit.CreateNode("Node1");
+  n1.GetNextPressure().SetValue(10., PressureUnit::mmHg);
+  n1.GetVolumeBaseline().SetValue(10., VolumeUnit::mL);
+  SEFluidCircuitNode& n2 = circuit.CreateNode("Node2");
+  n2.GetNextPressure().SetValue(20., PressureUnit::mmHg);
+  n2.GetVolumeBaseline().SetValue(30., VolumeUnit::mL);
+  circuit.SetNextAndCurrentFromBaselines();
+  circuit.StateChange();
+
+  SECompartmentManager cmptMgr(subMgr);
+  cmptMgr.SetCircuitEpoch(&m_Circuits->GetCircuitEpoch());
+  // Leaves mapped to nodes, so the parent caches its aggregates
+  SELiquidCompartment& mapped1 = cmptMgr.CreateLiquidCompartment("Mapped1");
+  mapped1.MapNode(n1);
+  SELiquidCompartment& mapped2 = cmptMgr.CreateLiquidCompartment("Mapped2");
+  mapped2.MapNode(n2);
+  SELiquidCompartment& mapped = cmptMgr.CreateLiquidCompartment("Mapped");
+  mapped.AddChild(mapped1);
+  mapped.AddChild(mapped2);
+  // Leaves holding their own values, so the parent always recomputes
+  SELiquidCompartment& unmapped1 = cmptMgr.CreateLiquidCompartment("Unmapped1");
+  unmapped1.GetVolume().SetValue(10., VolumeUnit::mL);
+  unmapped1.GetPressure().SetValue(10., PressureUnit::mmHg);
+  SELiquidCompartment& unmapped2 = cmptMgr.CreateLiquidCompartment("Unmapped2");
+  unmapped2.GetVolume().SetValue(30., VolumeUnit::mL);
+  unmapped2.GetPressure().SetValue(20., PressureUnit::mmHg);
+  SELiquidCompartment& unmapped = cmptMgr.CreateLiquidCompartment("Unmapped");
+  unmapped.AddChild(unmapped1);
+  unmapped.AddChild(unmapped2);
+  cmptMgr.StateChange();
+
+  // Fill the caches
+  if (GeneralMath::PercentTolerance(mapped.GetVolume(VolumeUnit::mL), 40.) > m_PercentTolerance)
+    testCase.AddFailure("Mapped parent volume is not the sum of its children");
+  if (GeneralMath::PercentTolerance(mapped.GetPressure(PressureUnit::mmHg), 17.5) > m_PercentTolerance)
+    testCase.AddFailure("Mapped parent pressure is not the volume weighted average of its children");
+  if (GeneralMath::PercentTolerance(unmapped.GetVolume(VolumeUnit::mL), 40.) > m_PercentTolerance)
+    testCase.AddFailure("Unmapped parent volume is not the sum of its children");
+
+  // Write the leaf volumes directly, the way the systems do,
+  // node backed writes increment the epoch after writing the node value
+  mapped2.GetVolume().SetValue(10., VolumeUnit::mL);
+  m_Circuits->GetCircuitEpoch().Increment();
+  unmapped2.GetVolume().IncrementValue(-20., VolumeUnit::mL);
+
+  if (GeneralMath::PercentTolerance(mapped.GetVolume(VolumeUnit::mL), 20.) > m_PercentTolerance)
+    testCase.AddFailure("Mapped parent volume is stale after writing a child volume");
+  if (GeneralMath::PercentTolerance(mapped.GetVolume().GetValue(VolumeUnit::mL), 20.) > m_PercentTolerance)
+    testCase.AddFailure("Mapped parent volume scalar is stale after writing a child volume");
+  if (GeneralMath::PercentTolerance(mapped.GetPressure(PressureUnit::mmHg), 15.) > m_PercentTolerance)
+    testCase.AddFailure("Mapped parent pressure is stale after writing a child volume");
+  if (GeneralMath::PercentTolerance(unmapped.GetVolume(VolumeUnit::mL), 20.) > m_PercentTolerance)
+    testCase.AddFailure("Unmapped parent volume is stale after writing a child volume");
+  if (GeneralMath::PercentTolerance(unmapped.GetPressure(PressureUnit::mmHg), 15.) > m_PercentTolerance)
+    testCase.AddFailure("Unmapped parent pressure is stale after writing a child volume");
+
+  // Write a leaf pressure directly
+  mapped1.GetPressure().SetValue(30., PressureUnit::mmHg);
+  m_Circuits->GetCircuitEpoch().Increment();
+  if (GeneralMath::PercentTolerance(mapped.GetPressure(PressureUnit::mmHg), 25.) > m_PercentTolerance)
+    testCase.AddFailure("Mapped parent pressure is stale after writing a child pressure");
+
+  testCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Test"), TimeUnit::s);
+  m_Circuits->Clear();
+}
+
 void CommonDataModelTest::LiquidCompartmentTest(const std::string& rptDirectory)
 {
   m_PercentTolerance = 2.0;
@@ -1370,5 +1446,9 @@ void CommonDataModelTest::LiquidCompartmentTest(const std::string& rptDirectory)
   UpdateLiquidLinks.SetName("UpdateLiquidLinks");
   TestUpdateLiquidLinks(UpdateLiquidLinks, subMgr);
 
+  SETestSuite&  HierarchyDirectWrite = testReport.CreateTestSuite();
+  HierarchyDirectWrite.SetName("LiquidCompartmentHierarchyDirectWrite");
+  TestLiquidHierarchyDirectWrite(HierarchyDirectWrite, subMgr);
+
   testReport.WriteFile(rptDirectory + "/LiquidCompartmentTestReport.pba");
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "CommonDataModelTest.h"
 #include "substance/SESubstanceManager.h"
+#include "substance/SESubstanceLibrary.h"
 #include "utils/testing/SETestReport.h"
 #include "utils/testing/SETestCase.h"
 #include "utils/testing/SETestSuite.h"
@@ -32,5 +33,46 @@ void CommonDataModelTest::ReadSubstanceDirectory(const std::string& rptDirectory
   testCase.SetName(obj.GetName());
   // TODO would be nice to listen to errors on the logger and add them to the testCase failures...
 
+  // Other managers should share the definitions parsed by the first one
+  SETestCase& sharedCase = testSuite.CreateTestCase();
+  sharedCase.SetName("SharedSubstanceLibrary");
+  pTimer.Start("Case");
+  std::shared_ptr<const SESubstanceLibrary> library = SESubstanceLibrary::GetDirectory(dir, m_Logger);
+  if (library != SESubstanceLibrary::GetDirectory(dir, m_Logger))
+    sharedCase.AddFailure("Substance directory was parsed more than once");
+  SESubstanceManager sharedMgr(m_Logger);
+  if (!sharedMgr.LoadSubstanceLibrary(library))
+    sharedCase.AddFailure("Unable to load the shared substance library");
+  if (sharedMgr.GetSubstances().size() != subMgr.GetSubstances().size() ||
+      sharedMgr.GetCompounds().size() != subMgr.GetCompounds().size())
+    sharedCase.AddFailure("Shared substance library does not match the substance directory");
+  sharedCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  // A bundle should give us the same substances as the directory it was written from
+  SETestCase& bundleCase = testSuite.CreateTestCase();
+  bundleCase.SetName("SubstanceBundle");
+  pTimer.Start("Case");
+  std::string bundleFile = rptDirectory + "/" + testName + "Substances.bin";
+  if (!library->WriteBundle(bundleFile, m_Logger))
+    bundleCase.AddFailure("Unable to write substance bundle");
+  std::shared_ptr<const SESubstanceLibrary> bundle = SESubstanceLibrary::GetBundle(bundleFile, m_Logger);
+  SESubstanceManager bundleMgr(m_Logger);
+  if (bundle == nullptr || !bundleMgr.LoadSubstanceLibrary(bundle))
+    bundleCase.AddFailure("Unable to load substance bundle");
+  else
+  {
+    for (SESubstance* sub : subMgr.GetSubstances())
+    {
+      if (bundleMgr.GetSubstance(sub->GetName()) == nullptr)
+        bundleCase.AddFailure(sub->GetName() + " is not in the substance bundle");
+    }
+    for (SESubstanceCompound* compound : subMgr.GetCompounds())
+    {
+      if (bundleMgr.GetCompound(compound->GetName()) == nullptr)
+        bundleCase.AddFailure(compound->GetName() + " is not in the substance bundle");
+    }
+  }
+  bundleCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
   testReport.WriteFile(rptDirectory +"/"+testName+"Report.pba");
 }
@@ -0,0 +1,110 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "CommonDataModelTest.h"
+#include "properties/SEDecimalFormat.h"
+#include "properties/SEScalarTime.h"
+#include "utils/DataTrack.h"
+#include "utils/ResultsWriter.h"
+#include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
+#include "utils/TimingProfile.h"
+
+std::string ReadResultsFile(const std::string& filename)
+{
+  std::ifstream file(filename);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+void CommonDataModelTest::ResultsWriterTest(const std::string& rptDirectory)
+{
+  TimingProfile pTimer;
+  std::string testName = "ResultsWriterTest";
+  m_Logger->ResetLogFile(rptDirectory + "/" + testName + ".log");
+
+  SETestReport testReport(m_Logger);
+  SETestSuite&  testSuite = testReport.CreateTestSuite();
+  testSuite.SetName(testName);
+
+  SEDecimalFormat fixed;
+  fixed.SetNotation(cdm::DecimalFormatData_eType_FixedMantissa);
+  fixed.SetPrecision(8);
+  SEDecimalFormat sci;
+  sci.SetNotation(cdm::DecimalFormatData_eType_SignificantDigits);
+  sci.SetPrecision(4);
+
+  DataTrack track(m_Logger);
+  track.SetFormatting("Fixed(mL)", fixed);
+  track.SetFormatting("Scientific(mmHg)", sci);
+  track.SetFormatting("Unitless", fixed);
+
+  std::string textFile = rptDirectory + "/" + testName + "Results.txt";
+  std::string binaryFile = rptDirectory + "/" + testName + "Results" + BinaryResultsWriter::Extension;
+  std::string convertedFile = rptDirectory + "/" + testName + "ConvertedResults.txt";
+  std::string streamedFile = rptDirectory + "/" + testName + "StreamedResults.txt";
+
+  // Write the same rows with each writer and with the original per row stream
+  pTimer.Start("Case");
+  SETestCase& writeCase = testSuite.CreateTestCase();
+  writeCase.SetName("WriteResults");
+  const size_t numRows = 5000;
+  std::ofstream streamed;
+  CSVResultsWriter text(m_Logger);
+  BinaryResultsWriter binary(m_Logger);
+  track.CreateFile(streamedFile.c_str(), streamed);
+  if (!text.Open(textFile, track))
+    writeCase.AddFailure("Unable to open " + textFile);
+  if (!binary.Open(binaryFile, track))
+    writeCase.AddFailure("Unable to open " + binaryFile);
+  for (size_t i = 0; i < numRows; i++)
+  {
+    double time_s = i * 0.02;
+    track.Probe("Fixed(mL)", std::sqrt(i) + 100);
+    track.Probe("Scientific(mmHg)", i % 7 == 0 ? SEScalar::dNaN() : 1.0 / (i + 1));
+    track.Probe("Unitless", double(i % 3));
+    track.StreamProbesToFile(time_s, streamed);
+    text.Write(time_s, track);
+    binary.Write(time_s, track);
+  }
+  streamed.close();
+  text.Close();
+  binary.Close();
+  writeCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& textCase = testSuite.CreateTestCase();
+  textCase.SetName("BufferedText");
+  if (ReadResultsFile(textFile) != ReadResultsFile(streamedFile))
+    textCase.AddFailure(textFile + " does not match " + streamedFile);
+  textCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  pTimer.Start("Case");
+  SETestCase& binaryCase = testSuite.CreateTestCase();
+  binaryCase.SetName("BinaryRoundTrip");
+  BinaryResultsReader reader(m_Logger);
+  if (!reader.Open(binaryFile))
+    binaryCase.AddFailure("Unable to read " + binaryFile);
+  else
+  {
+    if (reader.GetHeadings() != track.GetHeadings())
+      binaryCase.AddFailure("Binary headings do not match the track headings");
+    if (reader.GetNumberOfRows() != numRows || reader.GetNumberOfColumns() != track.GetHeadings().size() + 1)
+      binaryCase.AddFailure("Binary file does not have the expected number of rows and columns");
+    else
+    {
+      const double* row = reader.GetRow(numRows - 1);
+      if (row[0] != (numRows - 1) * 0.02 || row[1] != std::sqrt(numRows - 1) + 100)
+        binaryCase.AddFailure("Binary values do not match the probed values");
+    }
+    if (!reader.WriteCSV(convertedFile))
+      binaryCase.AddFailure("Unable to convert " + binaryFile);
+    else if (ReadResultsFile(convertedFile) != ReadResultsFile(streamedFile))
+      binaryCase.AddFailure(convertedFile + " does not match " + streamedFile);
+  }
+  binaryCase.GetDuration().SetValue(pTimer.GetElapsedTime_s("Case"), TimeUnit::s);
+
+  testReport.WriteFile(rptDirectory + "/" + testName + "Report.pba");
+}
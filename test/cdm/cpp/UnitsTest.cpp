@@ -22,6 +22,10 @@
 #include "properties/SEScalarVolume.h"
 #include "properties/SEScalarVolumePerPressure.h"
 #include "properties/SEScalarVolumePerTime.h"
+#include "utils/TimingProfile.h"
+#include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
 #include <exception>
 
 void CommonDataModelTest::ConvertList(std::vector<std::string> stringList)
@@ -190,4 +194,55 @@ void CommonDataModelTest::UnitsTest(const std::string& sOutputDirectory)
   {
     std::cout << "caught exception: " << e.what() << std::endl;
   }
-}
\ No newline at end of file
+}
+
+void CommonDataModelTest::UnitConversionSpeedTest(const std::string& sOutputDirectory)
+{
+  // Compare converting through the cached conversion factors with going to the conversion engine every time
+  // using the conversions the engine uses the most
+  const size_t numConversions = 1000000;
+  const CCompoundUnit* from[] = { &VolumeUnit::mL, &VolumeUnit::L, &PressureUnit::mmHg, &PressureUnit::cmH2O, &VolumePerTimeUnit::mL_Per_s, &VolumePerTimeUnit::L_Per_min, &TemperatureUnit::C };
+  const CCompoundUnit* to[]   = { &VolumeUnit::L, &VolumeUnit::mL, &PressureUnit::cmH2O, &PressureUnit::mmHg, &VolumePerTimeUnit::L_Per_min, &VolumePerTimeUnit::mL_Per_s, &TemperatureUnit::K };
+  const size_t numPairs = sizeof(from) / sizeof(from[0]);
+  CUnitConversionEngine& uce = CUnitConversionEngine::GetEngine();
+
+  std::string testName = "UnitConversionSpeedTest";
+  m_Logger->ResetLogFile(sOutputDirectory + "/" + testName + ".log");
+  SETestReport testReport(m_Logger);
+  SETestSuite& testSuite = testReport.CreateTestSuite();
+  testSuite.SetName(testName);
+
+  TimingProfile timer;
+  double engineSum = 0;
+  timer.Start("Engine");
+  for (size_t i = 0; i < numConversions; i++)
+    engineSum += uce.QuickConvertValue(double(i), *from[i%numPairs], *to[i%numPairs]);
+  timer.Stop("Engine");
+
+  double cachedSum = 0;
+  timer.Start("Cached");
+  for (size_t i = 0; i < numConversions; i++)
+    cachedSum += Convert(double(i), *from[i%numPairs], *to[i%numPairs]);
+  timer.Stop("Cached");
+
+  double engine_s = timer.GetElapsedTime_s("Engine");
+  double cached_s = timer.GetElapsedTime_s("Cached");
+  SETestCase& engineCase = testSuite.CreateTestCase();
+  engineCase.SetName("Engine");
+  engineCase.GetDuration().SetValue(engine_s, TimeUnit::s);
+  SETestCase& cachedCase = testSuite.CreateTestCase();
+  cachedCase.SetName("Cached");
+  cachedCase.GetDuration().SetValue(cached_s, TimeUnit::s);
+  m_ss << numConversions << " conversions, engine : " << engine_s << "s, cached : " << cached_s << "s";
+  if (cached_s > 0)
+    m_ss << ", speedup : " << engine_s / cached_s << "x";
+  Info(m_ss);
+  // A cache hit does the same arithmetic in the same order as the engine, so the sums are identical
+  if (engineSum != cachedSum)
+  {
+    m_ss << "Cached conversions do not match the conversion engine : " << cachedSum << " vs. " << engineSum;
+    cachedCase.AddFailure(m_ss);
+  }
+
+  testReport.WriteFile(sOutputDirectory + "/" + testName + "Report.pba");
+}
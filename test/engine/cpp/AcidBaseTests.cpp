@@ -1,7 +1,11 @@
 /* Distributed under the Apache License, Version 2.0.
    See accompanying NOTICE file for details.*/
 #include "EngineTest.h"
+#include "EngineTestFixture.h"
 #include "Controller/Controller.h"
+#include "Controller/Engine.h"
+#include "PulseConfiguration.h"
+#include "Systems/Saturation.h"
 #include "substance/SESubstanceManager.h"
 #include "compartment/fluid/SELiquidCompartment.h"
 #include "compartment/SECompartmentManager.h"
@@ -19,6 +23,11 @@
 #include "compartment/fluid/SELiquidCompartmentGraph.h"
 #include "compartment/fluid/SELiquidCompartment.h"
 #include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
+#include "system/physiology/SEBloodChemistrySystem.h"
+#include "properties/SEScalarPressure.h"
+#include "properties/SEScalarTime.h"
 
 #define VERBOSE
 
@@ -1263,4 +1272,66 @@ void PulseEngineTest::AcidBaseBloodGasTests(const std::string& sOutputDirectory)
   pc.GetDataTrack().WriteTrackToFile(results.c_str());
 
   testReport.WriteFile(sOutputDirectory + "/AcidBaseBloodGasTestsReport.pba");
-}
\ No newline at end of file
+}
+
+void PulseEngineTest::BloodGasSolverTest(const std::string& sOutputDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sOutputDirectory, "BloodGasSolverTest");
+  std::unique_ptr<PhysiologyEngine> numerical = fixture.CreateEngine("Numerical");
+  std::unique_ptr<PhysiologyEngine> analytic = fixture.CreateEngine("Analytic");
+  PulseConfiguration config(analytic->GetSubstanceManager());
+  config.UseWarmStartBloodGasSolver(cdm::eSwitch::On);
+  if (!fixture.LoadStandardState(*numerical) || !fixture.LoadStandardState(*analytic, &config))
+  {
+    fixture.WriteReport();
+    return;
+  }
+  SaturationCalculator& numericalCalc = ((PulseEngine*)numerical.get())->GetSaturationCalculator();
+  SaturationCalculator& analyticCalc = ((PulseEngine*)analytic.get())->GetSaturationCalculator();
+
+  SETestCase& configCase = fixture.CreateTestCase("Configuration");
+  if (numericalCalc.GetSolverMode() != SaturationCalculator::SolverMode::NumericalJacobian ||
+      analyticCalc.GetSolverMode() != SaturationCalculator::SolverMode::WarmStartAnalyticJacobian)
+    configCase.AddFailure("Blood gas solver mode does not follow the engine configuration");
+
+  // Returns the average function evaluations per solve, or 0 if the engine never solved
+  auto runCase = [&](const std::string& name, PhysiologyEngine& engine, SaturationCalculator& calc) -> double
+  {
+    calc.ResetSolverStatistics();
+    SETestCase& testCase = fixture.TimeCase(name, [&]() { engine.AdvanceModelTime(60, TimeUnit::s); return true; });
+    if (calc.GetSolveCount() == 0)
+    {
+      testCase.AddFailure(name + " did not solve for any blood gases");
+      return 0;
+    }
+    double solves = (double)calc.GetSolveCount();
+    m_ss << name << " : " << calc.GetSolveCount() << " solves, "
+         << calc.GetTotalFunctionEvaluations() / solves << " function evaluations and "
+         << calc.GetTotalJacobianEvaluations() / solves << " Jacobian evaluations per solve";
+    Info(m_ss);
+    return calc.GetTotalFunctionEvaluations() / solves;
+  };
+  double numericalEvaluations = runCase("NumericalJacobian", *numerical, numericalCalc);
+  double analyticEvaluations = runCase("WarmStartAnalyticJacobian", *analytic, analyticCalc);
+
+  SETestCase& evaluationsCase = fixture.CreateTestCase("FewerFunctionEvaluations");
+  if (numericalEvaluations > 0 && analyticEvaluations >= numericalEvaluations)
+    evaluationsCase.AddFailure("Warm started analytic solves did not take fewer function evaluations");
+
+  // Both solve the same equations to the same tolerance
+  SETestCase& compareCase = fixture.CreateTestCase("SameSolution");
+  auto compare = [&](const std::string& name, double expected, double computed)
+  {
+    double diff = GeneralMath::PercentDifference(expected, computed);
+    if (diff > 0.5)
+      compareCase.AddFailure(name + " differs by " + std::to_string(diff) + "%");
+  };
+  const SEBloodChemistrySystem* n = numerical->GetBloodChemistrySystem();
+  const SEBloodChemistrySystem* a = analytic->GetBloodChemistrySystem();
+  compare("BloodPH", n->GetBloodPH(), a->GetBloodPH());
+  compare("OxygenSaturation", n->GetOxygenSaturation(), a->GetOxygenSaturation());
+  compare("ArterialOxygenPressure", n->GetArterialOxygenPressure(PressureUnit::mmHg), a->GetArterialOxygenPressure(PressureUnit::mmHg));
+  compare("ArterialCarbonDioxidePressure", n->GetArterialCarbonDioxidePressure(PressureUnit::mmHg), a->GetArterialCarbonDioxidePressure(PressureUnit::mmHg));
+
+  fixture.WriteReport();
+}
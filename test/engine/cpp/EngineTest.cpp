@@ -117,7 +117,15 @@ void PulseEngineTest::FillFunctionMap()
 
   bgeMap.insert(std::make_pair("ConditionCombinations", &PulseEngineTest::ConditionCombinations));
   bgeMap.insert(std::make_pair("MultiEngineTest", &PulseEngineTest::MultiEngineTest));
+  bgeMap.insert(std::make_pair("SystemSchedulerTest", &PulseEngineTest::SystemSchedulerTest));
+  bgeMap.insert(std::make_pair("SystemUpdateIntervalTest", &PulseEngineTest::SystemUpdateIntervalTest));
+  bgeMap.insert(std::make_pair("EnginePoolTest", &PulseEngineTest::EnginePoolTest));
   bgeMap.insert(std::make_pair("SerializationTest", &PulseEngineTest::SerializationTest));
+  bgeMap.insert(std::make_pair("StateSerializationSpeedTest", &PulseEngineTest::StateSerializationSpeedTest));
+  bgeMap.insert(std::make_pair("EngineForkTest", &PulseEngineTest::EngineForkTest));
+  bgeMap.insert(std::make_pair("ECGSampleStateTest", &PulseEngineTest::ECGSampleStateTest));
+  bgeMap.insert(std::make_pair("PartitionCoefficientTest", &PulseEngineTest::PartitionCoefficientTest));
+  bgeMap.insert(std::make_pair("StabilizationCacheTest", &PulseEngineTest::StabilizationCacheTest));
   bgeMap.insert(std::make_pair("SolverSpeedTest", &PulseEngineTest::SolverSpeedTest));
 
   bgeMap.insert(std::make_pair("AcidBaseMathTest", &PulseEngineTest::AcidBaseMathTest));
@@ -125,6 +133,7 @@ void PulseEngineTest::FillFunctionMap()
   bgeMap.insert(std::make_pair("AcidBaseLimitsTest", &PulseEngineTest::AcidBaseLimitsTest));
   bgeMap.insert(std::make_pair("AcidBaseExtremeTest", &PulseEngineTest::AcidBaseExtremeTest));
   bgeMap.insert(std::make_pair("AcidBaseBloodGasTests", &PulseEngineTest::AcidBaseBloodGasTests));
+  bgeMap.insert(std::make_pair("BloodGasSolverTest", &PulseEngineTest::BloodGasSolverTest));
 
   bgeMap.insert(std::make_pair("AerosolTest", &PulseEngineTest::AerosolTest));
 
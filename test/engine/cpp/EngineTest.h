@@ -177,6 +177,7 @@ public:
   void AcidBaseLimitsTest(const std::string& sOutputDirectory);
   void AcidBaseExtremeTest(const std::string & rptDirectory);
   void AcidBaseBloodGasTests(const std::string& sOutputDirectory);
+  void BloodGasSolverTest(const std::string& sOutputDirectory);
 protected:
   enum bloodType { ARTERIAL, VENOUS, CAPILLARY, RESPIRATORY_ACIDOSIS, METABOLIC_ALKALOSIS, METABOLIC_ACIDOSIS, RESPIRATORY_ALKALOSIS, CUSTOM };
   void AcidBaseBloodGasTest(PulseController& bg, bloodType compartment, SETestSuite& testSuite);
@@ -196,7 +197,15 @@ public:
   // General Engine Tests //
   void ConditionCombinations(const std::string& rptDirectory);
   void MultiEngineTest(const std::string& sTestDirectory);
+  void SystemSchedulerTest(const std::string& sTestDirectory);
+  void SystemUpdateIntervalTest(const std::string& sTestDirectory);
+  void EnginePoolTest(const std::string& sTestDirectory);
   void SerializationTest(const std::string& sTestDirectory);
+  void StateSerializationSpeedTest(const std::string& sTestDirectory);
+  void EngineForkTest(const std::string& sTestDirectory);
+  void ECGSampleStateTest(const std::string& sTestDirectory);
+  void PartitionCoefficientTest(const std::string& sTestDirectory);
+  void StabilizationCacheTest(const std::string& sTestDirectory);
   void SolverSpeedTest(const std::string& sTestDirectory);
 protected:
   void InhalerState(PhysiologyEngine* bg, HowToTracker& tracker);
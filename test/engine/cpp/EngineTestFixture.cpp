@@ -0,0 +1,64 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#include "EngineTest.h"
+#include "EngineTestFixture.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
+#include "properties/SEScalarTime.h"
+
+const std::string EngineTestFixture::StandardState = "./states/StandardMale@0s.pba";
+
+EngineTestFixture::EngineTestFixture(Logger* logger, const std::string& sTestDirectory, const std::string& testName) : Loggable(logger),
+  m_TestDirectory(sTestDirectory), m_TestName(testName), m_TestReport(logger)
+{
+  m_Logger->ResetLogFile(m_TestDirectory + "/" + m_TestName + ".log");
+  m_TestSuite = &m_TestReport.CreateTestSuite();
+  m_TestSuite->SetName(m_TestName);
+}
+
+SETestCase& EngineTestFixture::CreateTestCase(const std::string& name)
+{
+  SETestCase& testCase = m_TestSuite->CreateTestCase();
+  testCase.SetName(name);
+  return testCase;
+}
+
+std::unique_ptr<PhysiologyEngine> EngineTestFixture::CreateEngine(const std::string& suffix)
+{
+  return CreatePulseEngine(m_TestDirectory + "/" + m_TestName + suffix + ".log");
+}
+
+bool EngineTestFixture::LoadStandardState(PhysiologyEngine& engine, const SEEngineConfiguration* config)
+{
+  if (engine.LoadStateFile(StandardState, nullptr, config))
+    return true;
+  m_TestSuite->CreateTestCase().AddFailure("Unable to load " + StandardState);
+  return false;
+}
+
+SETestCase& EngineTestFixture::TimeCase(const std::string& name, std::function<bool()> fn, size_t iterations)
+{
+  SETestCase& testCase = CreateTestCase(name);
+  m_Timer.Start(name);
+  for (size_t i = 0; i < iterations; i++)
+  {
+    if (!fn())
+    {
+      testCase.AddFailure(name + " failed");
+      break;
+    }
+  }
+  double time_s = m_Timer.GetElapsedTime_s(name);
+  testCase.GetDuration().SetValue(time_s, TimeUnit::s);
+  m_ss << name << " took " << 1000 * time_s / iterations << "ms";
+  if (iterations > 1)
+    m_ss << " on average";
+  Info(m_ss);
+  return testCase;
+}
+
+void EngineTestFixture::WriteReport()
+{
+  m_TestReport.WriteFile(m_TestDirectory + "/" + m_TestName + "Report.pba");
+}
@@ -0,0 +1,45 @@
+/* Distributed under the Apache License, Version 2.0.
+   See accompanying NOTICE file for details.*/
+
+#pragma once
+#include "utils/TimingProfile.h"
+#include "utils/testing/SETestReport.h"
+class SEEngineConfiguration;
+class SETestCase;
+class SETestSuite;
+
+/**
+* @brief
+* Scaffolding shared by the engine tests that run engines from the standard state.
+* @details
+* The fixture logs to <directory>/<name>.log and reports to <directory>/<name>Report.pba,
+* with a single test suite named after the test. Engines it creates log to <directory>/<name><suffix>.log
+*/
+class EngineTestFixture : public Loggable
+{
+public:
+  EngineTestFixture(Logger* logger, const std::string& sTestDirectory, const std::string& testName);
+
+  static const std::string StandardState;
+
+  SETestSuite& GetTestSuite() { return *m_TestSuite; }
+  SETestCase& CreateTestCase(const std::string& name);
+
+  std::unique_ptr<PhysiologyEngine> CreateEngine(const std::string& suffix);
+  // Loads the standard state, a failure is added to the suite if it cannot be loaded
+  bool LoadStandardState(PhysiologyEngine& engine, const SEEngineConfiguration* config = nullptr);
+
+  // Runs fn the number of iterations in a new test case, stopping at the first iteration that fails
+  // The duration of the test case is the total time, the average time of an iteration is logged
+  SETestCase& TimeCase(const std::string& name, std::function<bool()> fn, size_t iterations = 1);
+
+  void WriteReport();
+
+protected:
+  std::string       m_TestDirectory;
+  std::string       m_TestName;
+  SETestReport      m_TestReport;
+  SETestSuite*      m_TestSuite;
+  TimingProfile     m_Timer;
+  std::stringstream m_ss;
+};
@@ -2,10 +2,31 @@
    See accompanying NOTICE file for details.*/
 
 #include "EngineTest.h"
+#include "EngineTestFixture.h"
 
 #include "Controller/Controller.h"
+#include "Controller/Engine.h"
+#include "PulseConfiguration.h"
+#include "circuit/fluid/SEFluidCircuit.h"
+#include "circuit/fluid/SEFluidCircuitNode.h"
+#include "patient/SENutrition.h"
+#include "system/physiology/SECardiovascularSystem.h"
+#include "system/physiology/SEEndocrineSystem.h"
+#include "system/physiology/SEEnergySystem.h"
+#include "system/physiology/SEGastrointestinalSystem.h"
+#include "system/physiology/SERenalSystem.h"
+#include "properties/SEScalarAmountPerTime.h"
+#include "properties/SEScalarMassPerTime.h"
+#include "properties/SEScalarMassPerVolume.h"
+#include "properties/SEScalarVolume.h"
+#include "utils/taskrunner/EnginePool.h"
 #include "utils/taskrunner/TaskRunner.h"
 #include "utils/FileUtils.h"
+#include "utils/GeneralMath.h"
+#include "utils/TimingProfile.h"
+#include "utils/testing/SETestReport.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
 
 #include "scenario/SEScenarioExec.h"
 
@@ -65,6 +86,7 @@ void RunScenarioTask::Run()
   // Delete any results file that may be there
   remove(dataFile.c_str());
 
+  // Some third-party library initialization is not thread safe, substances are not the reason for this lock
   ms_initializationMutex.lock();
   std::unique_ptr<PhysiologyEngine> Pulse = CreatePulseEngine(logFile.c_str());
   ms_initializationMutex.unlock();
@@ -157,4 +179,170 @@ void PulseEngineTest::MultiEngineTest(const std::string& sTestDirectory)
     "\n";
 
   std::cin.get();
-}
\ No newline at end of file
+}
+
+void PulseEngineTest::SystemSchedulerTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "SystemSchedulerTest");
+  std::unique_ptr<PhysiologyEngine> sequential = fixture.CreateEngine("Sequential");
+  std::unique_ptr<PhysiologyEngine> scheduled = fixture.CreateEngine("Scheduled");
+  if (!fixture.LoadStandardState(*sequential) || !fixture.LoadStandardState(*scheduled))
+  {
+    fixture.WriteReport();
+    return;
+  }
+  SystemScheduler& scheduler = ((PulseEngine*)scheduled.get())->GetScheduler();
+  scheduler.SetWorkerCount(2);
+  Info("Process phase dependencies :\n" + scheduler.DescribeDependencies(SystemScheduler::Phase::Process));
+  Info("PostProcess phase dependencies :\n" + scheduler.DescribeDependencies(SystemScheduler::Phase::PostProcess));
+
+  fixture.TimeCase("Sequential", [&]() { sequential->AdvanceModelTime(60, TimeUnit::s); return true; });
+  fixture.TimeCase("Scheduled", [&]() { scheduled->AdvanceModelTime(60, TimeUnit::s); return true; });
+
+  // Every task that could see another's changes still runs after it, so nothing may differ
+  SETestCase& compareCase = fixture.CreateTestCase("Deterministic");
+  if (sequential->SaveState()->SerializeAsString() != scheduled->SaveState()->SerializeAsString())
+    compareCase.AddFailure("Scheduled engine state does not match the sequential engine state");
+
+  fixture.WriteReport();
+}
+
+void PulseEngineTest::SystemUpdateIntervalTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "SystemUpdateIntervalTest");
+  std::unique_ptr<PhysiologyEngine> singleRate = fixture.CreateEngine("SingleRate");
+  std::unique_ptr<PhysiologyEngine> multiRate = fixture.CreateEngine("MultiRate");
+  PulseConfiguration config(multiRate->GetSubstanceManager());
+  for (const std::string& system : { "Endocrine", "Energy", "Gastrointestinal", "Hepatic", "Renal" })
+    config.SetSystemUpdateInterval(system, 10);
+  if (!fixture.LoadStandardState(*singleRate) || !fixture.LoadStandardState(*multiRate, &config))
+  {
+    fixture.WriteReport();
+    return;
+  }
+
+  fixture.TimeCase("SingleRate", [&]() { singleRate->AdvanceModelTime(5, TimeUnit::min); return true; });
+  fixture.TimeCase("MultiRate", [&]() { multiRate->AdvanceModelTime(5, TimeUnit::min); return true; });
+
+  // Each update integrates over the steps it skipped, so the slow systems may only drift a little
+  SETestCase& driftCase = fixture.CreateTestCase("Drift");
+  auto compare = [&](const std::string& name, double expected, double computed, double tolerance_percent)
+  {
+    double drift_percent = GeneralMath::PercentDifference(expected, computed);
+    m_ss << name << " drifted " << drift_percent << "%";
+    Info(m_ss);
+    if (drift_percent > tolerance_percent)
+      driftCase.AddFailure(name + " drifted " + std::to_string(drift_percent) + "%, more than " + std::to_string(tolerance_percent) + "%");
+  };
+  compare("CoreTemperature", singleRate->GetEnergySystem()->GetCoreTemperature(TemperatureUnit::C), multiRate->GetEnergySystem()->GetCoreTemperature(TemperatureUnit::C), 0.1);
+  compare("InsulinSynthesisRate", singleRate->GetEndocrineSystem()->GetInsulinSynthesisRate(AmountPerTimeUnit::pmol_Per_min), multiRate->GetEndocrineSystem()->GetInsulinSynthesisRate(AmountPerTimeUnit::pmol_Per_min), 2);
+  compare("UrineProductionRate", singleRate->GetRenalSystem()->GetUrineProductionRate(VolumePerTimeUnit::mL_Per_min), multiRate->GetRenalSystem()->GetUrineProductionRate(VolumePerTimeUnit::mL_Per_min), 2);
+  compare("MeanArterialPressure", singleRate->GetCardiovascularSystem()->GetMeanArterialPressure(PressureUnit::mmHg), multiRate->GetCardiovascularSystem()->GetMeanArterialPressure(PressureUnit::mmHg), 1);
+
+  // Slow systems move water with circuit sources that only last a time step,
+  // the water they account for has to be what the circuit moved at any update interval
+  SETestCase& waterCase = fixture.CreateTestCase("TotalBodyWater");
+  auto advanceWater = [&](PhysiologyEngine& engine, double duration_s)
+  {
+    PulseController& pc = (PulseEngine&)engine;
+    double dt_s = engine.GetTimeStep(TimeUnit::s);
+    double waterDensity_kg_Per_mL = pc.GetConfiguration().GetWaterDensity(MassPerVolumeUnit::kg_Per_m3) * 1.e-6;
+    // Water in the circuit (blood, tissues and chyme) and in the stomach, plus what was sweated out
+    auto bodyWater_mL = [&pc]()
+    {
+      double water_mL = pc.GetGastrointestinal().GetStomachContents().GetWater(VolumeUnit::mL);
+      for (SEFluidCircuitNode* node : pc.GetCircuits().GetActiveCardiovascularCircuit().GetNodes())
+      {
+        if (node->HasVolume() && !std::isinf(node->GetVolume(VolumeUnit::mL)))
+          water_mL += node->GetVolume(VolumeUnit::mL);
+      }
+      return water_mL;
+    };
+    double start_mL = bodyWater_mL();
+    double sweat_mL = 0;
+    int steps = static_cast<int>(duration_s / dt_s + 0.5);
+    for (int i = 0; i < steps; i++)
+    {
+      engine.AdvanceModelTime();
+      sweat_mL += pc.GetEnergy().GetSweatRate(MassPerTimeUnit::kg_Per_s) / waterDensity_kg_Per_mL * dt_s;
+    }
+    return bodyWater_mL() + sweat_mL - start_mL;
+  };
+  double singleRateWater_mL = advanceWater(*singleRate, 120);
+  double multiRateWater_mL = advanceWater(*multiRate, 120);
+  m_ss << "Total body water changed by " << singleRateWater_mL << "(mL) at single rate and " << multiRateWater_mL << "(mL) at multi rate";
+  Info(m_ss);
+  if (std::abs(multiRateWater_mL - singleRateWater_mL) > 1.0)
+    waterCase.AddFailure("Total body water is not conserved at multi rate, it changed by " + std::to_string(multiRateWater_mL) +
+                         "(mL), at single rate it changed by " + std::to_string(singleRateWater_mL) + "(mL)");
+
+  // Loading a state into an engine stopped part way into an update interval must start a new interval,
+  // so it updates on the same time steps as an engine that only ever held the loaded state
+  SETestCase& midIntervalCase = fixture.CreateTestCase("LoadMidInterval");
+  for (int i = 0; i < 3; i++)
+    multiRate->AdvanceModelTime();
+  std::unique_ptr<PhysiologyEngine> fresh = fixture.CreateEngine("Fresh");
+  if (fixture.LoadStandardState(*multiRate, &config) && fixture.LoadStandardState(*fresh, &config))
+  {
+    multiRate->AdvanceModelTime(10, TimeUnit::s);
+    fresh->AdvanceModelTime(10, TimeUnit::s);
+    if (multiRate->SaveState()->SerializeAsString() != fresh->SaveState()->SerializeAsString())
+      midIntervalCase.AddFailure("Engine loaded mid interval does not match an engine that only loaded the state");
+  }
+
+  fixture.WriteReport();
+}
+
+void PulseEngineTest::EnginePoolTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "EnginePoolTest");
+  const size_t numEngines = 4;
+  EnginePool pool(0, m_Logger);
+  std::unique_ptr<PhysiologyEngine> serial = fixture.CreateEngine("Serial");
+  if (!fixture.LoadStandardState(*serial))
+  {
+    fixture.WriteReport();
+    return;
+  }
+  for (size_t i = 0; i < numEngines; i++)
+  {
+    std::unique_ptr<PhysiologyEngine> engine = fixture.CreateEngine(std::to_string(i));
+    fixture.LoadStandardState(*engine);
+    pool.AddEngine(std::move(engine));
+  }
+
+  SETestCase& serialCase = fixture.TimeCase("Serial", [&]() { serial->AdvanceModelTime(30, TimeUnit::s); return true; });
+  double serial_s = serialCase.GetDuration().GetValue(TimeUnit::s);
+
+  bool asyncDone = false;
+  bool asyncSuccess = false;
+  SETestCase& pooledCase = fixture.TimeCase("Pooled", [&]()
+  {
+    for (size_t i = 0; i < 2; i++)
+    {
+      if (!pool.AdvanceAll(10, TimeUnit::s))
+        return false;
+    }
+    pool.AdvanceAllAsync(10, TimeUnit::s, [&](bool success) { asyncDone = true; asyncSuccess = success; });
+    pool.Wait();
+    return true;
+  });
+  if (!asyncDone || !asyncSuccess)
+    pooledCase.AddFailure("Asynchronous batch did not complete successfully");
+  m_ss << numEngines << " pooled engines on " << pool.GetThreadCount() << " threads ran at " << pool.GetThroughput()
+       << " simulated s per s, a single engine ran at " << 30 / serial_s;
+  Info(m_ss);
+
+  // Engines are advanced independently, so every pooled engine ends up where the serial one did
+  SETestCase& compareCase = fixture.CreateTestCase("Deterministic");
+  std::string expected = serial->SaveState()->SerializeAsString();
+  for (size_t i = 0; i < pool.GetEngineCount(); i++)
+  {
+    if (!pool.IsEngineActive(i))
+      compareCase.AddFailure("Engine " + std::to_string(i) + " is no longer active");
+    else if (pool.GetEngine(i).SaveState()->SerializeAsString() != expected)
+      compareCase.AddFailure("Engine " + std::to_string(i) + " state does not match the serial engine state");
+  }
+
+  fixture.WriteReport();
+}
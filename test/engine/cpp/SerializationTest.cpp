@@ -2,8 +2,15 @@
    See accompanying NOTICE file for details.*/
 
 #include "EngineTest.h"
+#include "EngineTestFixture.h"
 #include "Controller/Controller.h"
+#include "Controller/Engine.h"
+#include "Controller/StabilizationCache.h"
+#include "Equipment/ECG.h"
+#include "PulseConfiguration.h"
 #include "utils/FileUtils.h"
+#include "utils/testing/SETestCase.h"
+#include "utils/testing/SETestSuite.h"
 
 #include "engine/SETimedStabilization.h"
 #include "engine/SEEngineTracker.h"
@@ -11,6 +18,8 @@
 
 #include "substance/SESubstance.h"
 #include "substance/SESubstanceManager.h"
+#include "substance/SESubstancePharmacokinetics.h"
+#include "substance/SESubstanceTissuePharmacokinetics.h"
 
 #include "patient/actions/SEConsciousRespiration.h"
 #include "patient/actions/SEForcedExhale.h"
@@ -320,4 +329,246 @@ void PulseEngineTest::SerializationTest(const std::string& sTestDirectory)
     InjectSuccsState(pc.get(), tracker, *Succs);
   }
   pc->SaveState("./FinalEngineState.pba");
-}
\ No newline at end of file
+}
+
+void PulseEngineTest::StateSerializationSpeedTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "StateSerializationSpeedTest");
+  std::unique_ptr<PhysiologyEngine> pc = fixture.CreateEngine("Engine");
+  if (!fixture.LoadStandardState(*pc))
+  {
+    fixture.WriteReport();
+    return;
+  }
+  std::string asciiFile = sTestDirectory + "/StateSerializationSpeedTestState.pba";
+  std::string binaryFile = sTestDirectory + "/StateSerializationSpeedTestState.pbb";
+  std::string roundTripFile = sTestDirectory + "/StateSerializationSpeedTestRoundTripState.pba";
+
+  const size_t numIterations = 10;
+  fixture.TimeCase("SaveASCII", [&]() { return pc->SaveState(asciiFile) != nullptr; }, numIterations);
+  fixture.TimeCase("SaveBinary", [&]() { return pc->SaveState(binaryFile) != nullptr; }, numIterations);
+  fixture.TimeCase("LoadASCII", [&]() { return pc->LoadStateFile(asciiFile); }, numIterations);
+  fixture.TimeCase("LoadBinary", [&]() { return pc->LoadStateFile(binaryFile); }, numIterations);
+
+  // The binary state must hold exactly what the ASCII state holds
+  SETestCase& roundTrip = fixture.CreateTestCase("BinaryRoundTrip");
+  pc->SaveState(roundTripFile);
+  std::ifstream ascii(asciiFile);
+  std::ifstream converted(roundTripFile);
+  std::stringstream asciiContent, convertedContent;
+  asciiContent << ascii.rdbuf();
+  convertedContent << converted.rdbuf();
+  if (asciiContent.str() != convertedContent.str())
+    roundTrip.AddFailure(roundTripFile + " does not match " + asciiFile);
+
+  fixture.WriteReport();
+}
+
+void PulseEngineTest::EngineForkTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "EngineForkTest");
+  std::unique_ptr<PhysiologyEngine> src = fixture.CreateEngine("Source");
+  std::unique_ptr<PhysiologyEngine> fork = fixture.CreateEngine("Fork");
+  if (!fixture.LoadStandardState(*src) || !fixture.LoadStandardState(*fork))
+  {
+    fixture.WriteReport();
+    return;
+  }
+  src->AdvanceModelTime(30, TimeUnit::s);
+
+  // A fork must hold exactly what the source holds, and stay that way as both advance
+  auto compareStates = [&](SETestCase& testCase, const std::string& when)
+  {
+    if (src->SaveState()->SerializeAsString() != fork->SaveState()->SerializeAsString())
+      testCase.AddFailure("Forked state does not match the source state " + when);
+  };
+
+  SETestCase& loadCase = fixture.TimeCase("SaveAndLoadState", [&]() { return fork->LoadState(*src->SaveState()); });
+  compareStates(loadCase, "after loading");
+  fixture.LoadStandardState(*fork);
+  SETestCase& forkCase = fixture.TimeCase("ForkInto", [&]() { return src->ForkInto(*fork); });
+  compareStates(forkCase, "after forking");
+  // Forking copies objects in place, it should be well under a millisecond and never slower than a full load
+  double fork_ms = 1000 * forkCase.GetDuration().GetValue(TimeUnit::s);
+  if (fork_ms >= 1000 * loadCase.GetDuration().GetValue(TimeUnit::s))
+    forkCase.AddFailure("ForkInto is not faster than saving and loading a state");
+  if (fork_ms >= 1)
+  {
+    m_ss << "ForkInto took " << fork_ms << "ms, our target is under 1ms";
+    Warning(m_ss);
+  }
+
+  SETestCase& advanceCase = fixture.CreateTestCase("AdvanceFork");
+  src->AdvanceModelTime(10, TimeUnit::s);
+  fork->AdvanceModelTime(10, TimeUnit::s);
+  compareStates(advanceCase, "after advancing both");
+
+  // Warm started blood gas solves depend on the last solutions, which a fork carries over
+  SETestCase& warmStartCase = fixture.CreateTestCase("WarmStartFork");
+  std::unique_ptr<PhysiologyEngine> warm = fixture.CreateEngine("WarmStart");
+  PulseConfiguration config(warm->GetSubstanceManager());
+  config.UseWarmStartBloodGasSolver(cdm::eSwitch::On);
+  if (fixture.LoadStandardState(*warm, &config))
+  {
+    warm->AdvanceModelTime(10, TimeUnit::s);
+    if (!warm->ForkInto(*fork))
+      warmStartCase.AddFailure("Unable to fork the warm started engine");
+    warm->AdvanceModelTime(10, TimeUnit::s);
+    fork->AdvanceModelTime(10, TimeUnit::s);
+    if (warm->SaveState()->SerializeAsString() != fork->SaveState()->SerializeAsString())
+      warmStartCase.AddFailure("Forked state does not match the warm started source state after advancing both");
+  }
+
+  fixture.WriteReport();
+}
+
+void PulseEngineTest::ECGSampleStateTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "ECGSampleStateTest");
+  // The ECG sample tables are not part of a state, an engine must be able to sample however it got its state
+  std::unique_ptr<PhysiologyEngine> src = fixture.CreateEngine("Source");
+  std::unique_ptr<PhysiologyEngine> loaded = fixture.CreateEngine("Loaded");
+  std::unique_ptr<PhysiologyEngine> fork = fixture.CreateEngine("Fork");
+  PulseConfiguration config(src->GetSubstanceManager());
+  config.GetECGSampleRate().SetValue(500, FrequencyUnit::Per_s);
+  if (!fixture.LoadStandardState(*src, &config) || !fixture.LoadStandardState(*fork))
+  {
+    fixture.WriteReport();
+    return;
+  }
+
+  const size_t numSamples = 1000;// 2s at 500Hz
+  std::vector<double> srcSamples_mV(numSamples), loadedSamples_mV(numSamples), forkSamples_mV(numSamples);
+  SEElectroCardioGramSampleBuffer srcBuffer(srcSamples_mV.data(), numSamples);
+  SEElectroCardioGramSampleBuffer loadedBuffer(loadedSamples_mV.data(), numSamples);
+  SEElectroCardioGramSampleBuffer forkBuffer(forkSamples_mV.data(), numSamples);
+  auto sample = [&](SETestCase& testCase, PhysiologyEngine& engine, SEElectroCardioGramSampleBuffer& buffer)
+  {
+    if (!dynamic_cast<ECG&>(((PulseEngine&)engine).GetECG()).SetLeadSampleBuffer(cdm::ElectroCardioGramWaveformData_eLead_Lead3, &buffer))
+    {
+      testCase.AddFailure("Unable to sample the ECG of the " + testCase.GetName() + " engine");
+      return;
+    }
+    engine.AdvanceModelTime(2, TimeUnit::s);
+    if (buffer.GetSampleCount() != numSamples)
+      testCase.AddFailure("Expected " + std::to_string(numSamples) + " samples over 2s at 500Hz");
+  };
+
+  SETestCase& srcCase = fixture.CreateTestCase("LoadStateFile");
+  std::unique_ptr<google::protobuf::Message> state = src->SaveState();
+  if (!src->ForkInto(*fork))
+    srcCase.AddFailure("Unable to fork the source engine");
+  sample(srcCase, *src, srcBuffer);
+  bool beat = false;
+  for (double sample_mV : srcSamples_mV)
+    beat |= sample_mV != 0;
+  if (!beat)
+    srcCase.AddFailure("No heart beat was sampled");
+
+  SETestCase& loadCase = fixture.CreateTestCase("LoadState");
+  if (!loaded->LoadState(*state))
+    loadCase.AddFailure("Unable to load the source state");
+  sample(loadCase, *loaded, loadedBuffer);
+  if (loadedSamples_mV != srcSamples_mV)
+    loadCase.AddFailure("Loaded engine samples do not match the source engine samples");
+
+  SETestCase& forkCase = fixture.CreateTestCase("ForkInto");
+  sample(forkCase, *fork, forkBuffer);
+  if (forkSamples_mV != srcSamples_mV)
+    forkCase.AddFailure("Forked engine samples do not match the source engine samples");
+
+  fixture.WriteReport();
+}
+
+void PulseEngineTest::PartitionCoefficientTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "PartitionCoefficientTest");
+  std::unique_ptr<PhysiologyEngine> skip = fixture.CreateEngine("Skip");
+  std::unique_ptr<PhysiologyEngine> recalculate = fixture.CreateEngine("Recalculate");
+  std::unique_ptr<PhysiologyEngine> loaded = fixture.CreateEngine("Loaded");
+  PulseConfiguration skipConfig(skip->GetSubstanceManager());
+  skipConfig.GetPartitionCoefficientTolerance().SetValue(1);// The inputs never change that much
+  PulseConfiguration recalculateConfig(recalculate->GetSubstanceManager());
+  recalculateConfig.GetPartitionCoefficientTolerance().SetValue(0);// Any change
+  if (!fixture.LoadStandardState(*skip, &skipConfig) || !fixture.LoadStandardState(*recalculate, &recalculateConfig))
+  {
+    fixture.WriteReport();
+    return;
+  }
+
+  // Coefficients are calculated once the drug is active, then we overwrite one to see if it is ever recalculated
+  const double marker = 123;
+  auto coefficient = [&](PhysiologyEngine& engine) -> SEScalar&
+  {
+    SESubstance* succs = engine.GetSubstanceManager().GetSubstance("Succinylcholine");
+    return succs->GetPK().GetTissueKinetics(pulse::TissueCompartment::Muscle).GetPartitionCoefficient();
+  };
+  auto activate = [&](PhysiologyEngine& engine)
+  {
+    SESubstanceBolus injection(*engine.GetSubstanceManager().GetSubstance("Succinylcholine"));
+    injection.SetAdminRoute(cdm::SubstanceBolusData_eAdministrationRoute_Intravenous);
+    injection.GetConcentration().SetValue(4820, MassPerVolumeUnit::ug_Per_mL);
+    injection.GetDose().SetValue(30, VolumeUnit::mL);
+    engine.ProcessAction(injection);
+    engine.AdvanceModelTime(1, TimeUnit::s);
+    coefficient(engine).SetValue(marker);
+  };
+  activate(*skip);
+  activate(*recalculate);
+
+  SETestCase& skipCase = fixture.CreateTestCase("WithinTolerance");
+  skip->AdvanceModelTime(10, TimeUnit::s);
+  if (coefficient(*skip).GetValue() != marker)
+    skipCase.AddFailure("Partition coefficients were recalculated while their inputs were within tolerance");
+
+  SETestCase& recalculateCase = fixture.CreateTestCase("PastTolerance");
+  recalculate->AdvanceModelTime(10, TimeUnit::s);
+  if (coefficient(*recalculate).GetValue() == marker)
+    recalculateCase.AddFailure("Partition coefficients were not recalculated when their inputs changed");
+
+  // The inputs are part of the state, so the loaded engine keeps skipping
+  SETestCase& loadCase = fixture.CreateTestCase("SaveAndLoadState");
+  std::unique_ptr<google::protobuf::Message> state = skip->SaveState();
+  if (!loaded->LoadState(*state))
+    loadCase.AddFailure("Unable to load the state");
+  else
+  {
+    if (loaded->SaveState()->SerializeAsString() != state->SerializeAsString())
+      loadCase.AddFailure("Loaded state does not match the saved state");
+    loaded->AdvanceModelTime(10, TimeUnit::s);
+    if (coefficient(*loaded).GetValue() != marker)
+      loadCase.AddFailure("Partition coefficients were recalculated after loading a state");
+  }
+
+  fixture.WriteReport();
+}
+
+void PulseEngineTest::StabilizationCacheTest(const std::string& sTestDirectory)
+{
+  EngineTestFixture fixture(m_Logger, sTestDirectory, "StabilizationCacheTest");
+  std::string previousDirectory = PulseStabilizationCache::GetDirectory();
+  PulseStabilizationCache::SetDirectory(sTestDirectory + "/StabilizationCacheTest");
+  PulseStabilizationCache::Invalidate();
+
+  // The first engine stabilizes and fills the cache, the second loads what the first stabilized to
+  std::unique_ptr<PhysiologyEngine> missed = fixture.CreateEngine("Miss");
+  std::unique_ptr<PhysiologyEngine> hit = fixture.CreateEngine("Hit");
+  fixture.TimeCase("CacheMiss", [&]() { return missed->InitializeEngine("StandardMale.pba"); });
+  std::vector<std::string> cached;
+  ListFiles(PulseStabilizationCache::GetDirectory(), cached, ".pbb");
+  SETestCase& hitCase = fixture.TimeCase("CacheHit", [&]() { return hit->InitializeEngine("StandardMale.pba"); });
+  if (cached.size() != 1)
+    hitCase.AddFailure("Expected a single cached state");
+  if (missed->SaveState()->SerializeAsString() != hit->SaveState()->SerializeAsString())
+    hitCase.AddFailure("Cached state does not match the stabilized state");
+
+  SETestCase& invalidateCase = fixture.CreateTestCase("Invalidate");
+  PulseStabilizationCache::Invalidate();
+  cached.clear();
+  ListFiles(PulseStabilizationCache::GetDirectory(), cached, ".pbb");
+  if (!cached.empty())
+    invalidateCase.AddFailure("Invalidate left cached states behind");
+
+  PulseStabilizationCache::SetDirectory(previousDirectory);
+  fixture.WriteReport();
+}